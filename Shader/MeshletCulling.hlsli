@@ -0,0 +1,47 @@
+#ifndef __MESHLET_CULLING_HLSLI__
+#define __MESHLET_CULLING_HLSLI__
+
+// Resource/Meshlet.h의 Meshlet과 같은 레이아웃 (48 bytes)
+struct Meshlet
+{
+    float4 boundingSphere; // xyz = 중심, w = 반지름 (오브젝트 공간)
+    float4 cone;           // xyz = 법선 콘 축, w = cutoff. 1이면 뒷면 컬링을 하지 않는다.
+    uint vertexOffset;
+    uint triangleOffset;   // 바이트 단위, 4바이트 정렬
+    uint vertexCount;
+    uint triangleCount;
+};
+
+// MeshProxy::GetMeshletTriangleBuffer는 삼각형마다 8bit 로컬 인덱스 3개를 담는다.
+uint3 LoadMeshletTriangle(ByteAddressBuffer triangles, Meshlet meshlet, uint triangleIndex)
+{
+    uint byteOffset = meshlet.triangleOffset + triangleIndex * 3;
+    uint aligned    = byteOffset & ~3u;
+    uint shift      = (byteOffset & 3u) * 8;
+    uint2 packed    = triangles.Load2(aligned);
+    uint  bits      = shift == 0 ? packed.x : ((packed.x >> shift) | (packed.y << (32 - shift)));
+    return uint3(bits & 0xFF, (bits >> 8) & 0xFF, (bits >> 16) & 0xFF);
+}
+
+// cameraPositionOS는 오브젝트 공간 카메라 위치
+bool IsMeshletBackFacing(Meshlet meshlet, float3 cameraPositionOS)
+{
+    float3 toCenter = meshlet.boundingSphere.xyz - cameraPositionOS;
+    return dot(toCenter, meshlet.cone.xyz) >= meshlet.cone.w * length(toCenter) + meshlet.boundingSphere.w;
+}
+
+// 평면 법선은 안쪽을 향한다.
+bool IsMeshletOutsidePlanes(Meshlet meshlet, float4 planes[6])
+{
+    [unroll]
+    for (uint i = 0; i < 6; ++i)
+    {
+        if (dot(planes[i].xyz, meshlet.boundingSphere.xyz) + planes[i].w < -meshlet.boundingSphere.w)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef __VERTEX_DECODE_HLSLI__
+#define __VERTEX_DECODE_HLSLI__
+
+// MeshProxy가 기본으로 쓰는 압축 정점 형식(VertexCompressionInfo).
+// 정규화 정수와 half 형식은 입력 단계에서 float로 풀리므로 여기서는 나머지 디코드만 한다.
+// location은 C++의 EVertexAttributeLocation과 같다. 버퍼 안 순서(UV 세트와 색이 접선 앞)와 무관하게
+// 속성마다 고정이므로, 색이나 UV 세트가 더 있는 메시도 같은 입력으로 읽는다.
+// 위치, 법선, UV0, 접선이 모두 있는 메시용이다. 없는 속성은 파이프라인 입력에 빠지므로 이 구조체를 쓸 수 없다.
+struct VSCompressedInput
+{
+    [[vk::location(0)]] float4 positionQ : POSITION0;  // short4 norm, [-1, 1]
+    [[vk::location(1)]] float2 normalOct : NORMAL0;    // short2 norm, 팔면체 좌표
+    [[vk::location(2)]] float4 tangentOct : TANGENT0;  // short4 norm, xy = 팔면체 좌표, z = 종접선 부호
+    [[vk::location(5)]] float2 uv : TEXCOORD0;         // half2
+};
+
+// positionOS = positionQ * scale + offset. scale/offset은 MeshProxy::GetPositionScale/Offset이다.
+// 모델 행렬에 MeshProxy::GetPositionDecodeMatrix를 곱해 두었다면 이 함수는 건너뛴다.
+float3 DecodePosition(float4 positionQ, float3 scale, float3 offset)
+{
+    return positionQ.xyz * scale + offset;
+}
+
+float3 DecodeOctahedral(float2 oct)
+{
+    float3 n = float3(oct.x, oct.y, 1.0f - abs(oct.x) - abs(oct.y));
+    float t  = saturate(-n.z);
+    n.x += n.x >= 0.0f ? -t : t;
+    n.y += n.y >= 0.0f ? -t : t;
+    return normalize(n);
+}
+
+void DecodeTangentFrame(float2 normalOct, float4 tangentOct, out float3 normal, out float3 tangent, out float3 bitangent)
+{
+    normal    = DecodeOctahedral(normalOct);
+    tangent   = DecodeOctahedral(tangentOct.xy);
+    bitangent = cross(normal, tangent) * (tangentOct.z < 0.0f ? -1.0f : 1.0f);
+}
+
+#endif
@@ -17,6 +17,9 @@
 #include <execinfo.h> // For backtrace (optional)
 #include <unistd.h>
 
+#elif defined(__LINUX__)
+#include <unistd.h>
+
 #else
 
 #ifndef UNICODE
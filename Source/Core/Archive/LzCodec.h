@@ -0,0 +1,31 @@
+//
+//  LzCodec.h
+//  Core
+//
+//  Byte-oriented LZ77 block codec used by pack archives
+//
+#ifndef __HS_LZ_CODEC_H__
+#define __HS_LZ_CODEC_H__
+
+#include "Precompile.h"
+
+HS_NS_BEGIN
+
+// LZ4 블록과 같은 계열의 형식이다. 시퀀스마다 토큰(상위 4bit 리터럴 길이, 하위 4bit 매치 길이 - 4),
+// 리터럴, 2바이트 오프셋이 이어지고 15 이상인 길이는 255 단위 바이트로 이어 적는다.
+// 블록은 서로 독립적이어서 병렬로 풀 수 있다. 최대 블록 크기는 오프셋 범위(64KiB)와 무관하게 제한이 없다.
+class HS_API LzCodec
+{
+public:
+    static size_t GetCompressBound(size_t srcSize);
+
+    // 압축된 크기를 돌려준다. dstCapacity가 부족하면 0.
+    static size_t Compress(const uint8* src, size_t srcSize, uint8* dst, size_t dstCapacity);
+
+    // dstSize(원본 크기)만큼 정확히 풀리면 true. 손상된 입력에도 dst 밖을 쓰지 않는다.
+    static bool Decompress(const uint8* src, size_t srcSize, uint8* dst, size_t dstSize);
+};
+
+HS_NS_END
+
+#endif /* __HS_LZ_CODEC_H__ */
@@ -0,0 +1,142 @@
+//
+//  PackArchive.h
+//  Core
+//
+//  Indexed pack file with independently compressed blocks
+//
+#ifndef __HS_PACK_ARCHIVE_H__
+#define __HS_PACK_ARCHIVE_H__
+
+#include "Precompile.h"
+
+#include "Core/HAL/FileSystem.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+HS_NS_BEGIN
+
+// 파일 배치: [PackHeader][블록 데이터...][PackBlock 테이블][PackEntry 테이블][경로 문자열]
+// 모든 값은 little-endian이다.
+struct PackHeader
+{
+    static constexpr uint32 MAGIC   = 0x4B505348; // "HSPK"
+    static constexpr uint32 VERSION = 1;
+
+    uint32 magic;
+    uint32 version;
+    uint32 blockSize;
+    uint32 entryCount;
+    uint32 blockCount;
+    uint32 reserved;
+    uint64 blockTableOffset;
+    uint64 entryTableOffset;
+    uint64 stringTableOffset;
+    uint64 stringTableSize;
+};
+
+// 엔트리 테이블은 pathHash 오름차순으로 정렬되어 있다.
+struct PackEntry
+{
+    uint64 pathHash; // StringHash64(path)
+    uint32 pathOffset;
+    uint32 pathLength;
+    uint64 size;
+    uint32 firstBlock;
+    uint32 blockCount;
+};
+
+// compressedSize == uncompressedSize이면 압축하지 않고 저장한 블록이다.
+struct PackBlock
+{
+    uint64 offset;
+    uint32 compressedSize;
+    uint32 uncompressedSize;
+};
+
+static_assert(sizeof(PackHeader) == 56, "PackHeader layout");
+static_assert(sizeof(PackEntry) == 32, "PackEntry layout");
+static_assert(sizeof(PackBlock) == 16, "PackBlock layout");
+
+// 팩 파일을 매핑해 두고 엔트리를 해시로 찾는다. 블록은 서로 독립적이므로 여러 블록짜리 파일은 JobSystem으로 병렬로 푼다.
+// Open 이후에는 여러 스레드에서 동시에 Find/Read를 호출해도 된다.
+class HS_API PackArchive
+{
+public:
+    PackArchive() = default;
+    ~PackArchive();
+
+    PackArchive(const PackArchive&)            = delete;
+    PackArchive& operator=(const PackArchive&) = delete;
+
+    bool Open(const std::string& absolutePath);
+    void Close();
+
+    HS_FORCEINLINE bool IsOpen() const { return _mappedFile.IsValid(); }
+    HS_FORCEINLINE const std::string& GetPath() const { return _path; }
+    HS_FORCEINLINE uint32 GetEntryCount() const { return _header.entryCount; }
+
+    // path는 팩을 만들 때의 상대 경로 ('/' 구분)
+    const PackEntry* Find(const std::string& path) const;
+    std::string      GetEntryPath(const PackEntry& entry) const;
+    const PackEntry& GetEntry(uint32 index) const { return _entries[index]; }
+
+    // destination은 entry.size 바이트 이상이어야 한다.
+    bool Read(const PackEntry& entry, void* destination) const;
+    bool Read(const PackEntry& entry, std::vector<uint8>& outData) const;
+
+private:
+    bool readBlock(const PackBlock& block, uint8* destination) const;
+
+    std::string      _path;
+    MappedFile       _mappedFile;
+    PackHeader       _header{};
+    const PackEntry* _entries = nullptr;
+    const PackBlock* _blocks  = nullptr;
+    const char*      _strings = nullptr;
+};
+
+// 팩 파일을 만든다. AddFile마다 블록을 병렬로 압축해 바로 기록하고, Finish에서 테이블과 헤더를 쓴다.
+class HS_API PackWriter
+{
+public:
+    static constexpr uint32 DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    PackWriter() = default;
+    ~PackWriter();
+
+    PackWriter(const PackWriter&)            = delete;
+    PackWriter& operator=(const PackWriter&) = delete;
+
+    bool Begin(const std::string& absolutePath, uint32 blockSize = DEFAULT_BLOCK_SIZE);
+    // 같은 경로를 두 번 추가하면 실패한다.
+    bool AddFile(const std::string& path, const void* data, size_t size);
+    bool Finish();
+
+    HS_FORCEINLINE uint64 GetUncompressedSize() const { return _uncompressedSize; }
+    HS_FORCEINLINE uint64 GetCompressedSize() const { return _compressedSize; }
+
+private:
+    bool write(const void* data, size_t size);
+    void abort();
+
+    struct PendingEntry
+    {
+        PackEntry   entry;
+        std::string path;
+    };
+
+    std::ofstream             _file;
+    std::string               _filePath;
+    uint32                    _blockSize  = DEFAULT_BLOCK_SIZE;
+    uint64                    _offset     = 0;
+    std::vector<PendingEntry> _entries;
+    std::vector<PackBlock>    _blocks;
+    uint64                    _uncompressedSize = 0;
+    uint64                    _compressedSize   = 0;
+};
+
+HS_NS_END
+
+#endif /* __HS_PACK_ARCHIVE_H__ */
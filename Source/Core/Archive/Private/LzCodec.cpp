@@ -0,0 +1,249 @@
+//
+//  LzCodec.cpp
+//  Core
+//
+//  Byte-oriented LZ77 block codec used by pack archives
+//
+#include "Core/Archive/LzCodec.h"
+
+#include <cstring>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 s_minMatch     = 4;
+constexpr uint32 s_hashLog      = 14;
+constexpr uint32 s_maxOffset    = 0xFFFF;
+constexpr size_t s_lastLiterals = 5;  // 블록 끝의 몇 바이트는 항상 리터럴로 남긴다.
+constexpr size_t s_minBlockSize = 13; // 이보다 짧으면 매치를 찾지 않는다.
+
+HS_FORCEINLINE uint32 read32(const uint8* p)
+{
+    uint32 value;
+    ::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+HS_FORCEINLINE uint32 hash4(uint32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - s_hashLog);
+}
+
+HS_FORCEINLINE uint8* writeLength(uint8* op, size_t length)
+{
+    while (length >= 255)
+    {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<uint8>(length);
+    return op;
+}
+
+HS_FORCEINLINE size_t lengthBytes(size_t length)
+{
+    return (length >= 15) ? (length - 15) / 255 + 1 : 0;
+}
+} // namespace
+
+size_t LzCodec::GetCompressBound(size_t srcSize)
+{
+    return srcSize + srcSize / 255 + 16;
+}
+
+size_t LzCodec::Compress(const uint8* src, size_t srcSize, uint8* dst, size_t dstCapacity)
+{
+    const uint8* ip        = src;
+    const uint8* anchor    = src;
+    const uint8* const end = src + srcSize;
+    uint8*       op        = dst;
+    uint8* const opEnd     = dst + dstCapacity;
+
+    auto emitSequence = [&](const uint8* literalEnd, size_t matchLength, uint32 offset) -> bool
+    {
+        const size_t literalLength = static_cast<size_t>(literalEnd - anchor);
+        const size_t required      = 1 + lengthBytes(literalLength) + literalLength + (matchLength > 0 ? 2 + lengthBytes(matchLength - s_minMatch) : 0);
+        if (static_cast<size_t>(opEnd - op) < required)
+        {
+            return false;
+        }
+
+        uint8* token = op++;
+        *token       = static_cast<uint8>((literalLength >= 15 ? 15 : literalLength) << 4);
+        if (literalLength >= 15)
+        {
+            op = writeLength(op, literalLength - 15);
+        }
+        if (literalLength > 0)
+        {
+            ::memcpy(op, anchor, literalLength);
+            op += literalLength;
+        }
+
+        if (matchLength > 0)
+        {
+            *op++ = static_cast<uint8>(offset);
+            *op++ = static_cast<uint8>(offset >> 8);
+
+            const size_t code = matchLength - s_minMatch;
+            *token |= static_cast<uint8>(code >= 15 ? 15 : code);
+            if (code >= 15)
+            {
+                op = writeLength(op, code - 15);
+            }
+        }
+        return true;
+    };
+
+    if (srcSize >= s_minBlockSize)
+    {
+        uint32 table[1 << s_hashLog];
+        ::memset(table, 0xFF, sizeof(table));
+
+        const uint8* const matchLimit = end - s_lastLiterals;
+        const uint8* const searchEnd  = matchLimit - s_minMatch;
+
+        while (ip < searchEnd)
+        {
+            const uint32 sequence = read32(ip);
+            const uint32 h        = hash4(sequence);
+            const uint32 candidate = table[h];
+            table[h]               = static_cast<uint32>(ip - src);
+
+            if (candidate == 0xFFFFFFFF || static_cast<uint32>(ip - src) - candidate > s_maxOffset || read32(src + candidate) != sequence)
+            {
+                ip++;
+                continue;
+            }
+
+            const uint8* match = src + candidate;
+
+            // 뒤로 확장
+            while (ip > anchor && match > src && ip[-1] == match[-1])
+            {
+                ip--;
+                match--;
+            }
+
+            // 앞으로 확장
+            const uint8* matchEnd = ip + s_minMatch;
+            const uint8* ref      = match + s_minMatch;
+            while (matchEnd < matchLimit && *matchEnd == *ref)
+            {
+                matchEnd++;
+                ref++;
+            }
+
+            if (false == emitSequence(ip, static_cast<size_t>(matchEnd - ip), static_cast<uint32>(ip - match)))
+            {
+                return 0;
+            }
+
+            ip     = matchEnd;
+            anchor = ip;
+
+            if (ip < searchEnd)
+            {
+                table[hash4(read32(ip - 2))] = static_cast<uint32>(ip - 2 - src);
+            }
+        }
+    }
+
+    // 마지막 리터럴
+    if (false == emitSequence(end, 0, 0))
+    {
+        return 0;
+    }
+
+    return static_cast<size_t>(op - dst);
+}
+
+bool LzCodec::Decompress(const uint8* src, size_t srcSize, uint8* dst, size_t dstSize)
+{
+    const uint8*       ip     = src;
+    const uint8* const ipEnd  = src + srcSize;
+    uint8*             op     = dst;
+    uint8* const       opEnd  = dst + dstSize;
+
+    auto readLength = [&](size_t& length) -> bool
+    {
+        uint8 byte = 0;
+        do
+        {
+            if (ip >= ipEnd)
+            {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (ip < ipEnd)
+    {
+        const uint8 token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && false == readLength(literalLength))
+        {
+            return false;
+        }
+
+        if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op))
+        {
+            return false;
+        }
+        if (literalLength > 0)
+        {
+            ::memcpy(op, ip, literalLength);
+            ip += literalLength;
+            op += literalLength;
+        }
+
+        // 마지막 시퀀스는 리터럴만 있다.
+        if (ip == ipEnd)
+        {
+            break;
+        }
+
+        if (ipEnd - ip < 2)
+        {
+            return false;
+        }
+        const size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && false == readLength(matchLength))
+        {
+            return false;
+        }
+        matchLength += s_minMatch;
+
+        if (offset == 0 || offset > static_cast<size_t>(op - dst) || matchLength > static_cast<size_t>(opEnd - op))
+        {
+            return false;
+        }
+
+        const uint8* match = op - offset;
+        if (offset >= matchLength)
+        {
+            ::memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else
+        {
+            // 겹치는 매치는 반복 패턴이므로 한 바이트씩 복사한다.
+            for (size_t i = 0; i < matchLength; i++)
+            {
+                *op++ = *match++;
+            }
+        }
+    }
+
+    return op == opEnd;
+}
+
+HS_NS_END
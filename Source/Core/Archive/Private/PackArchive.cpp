@@ -0,0 +1,417 @@
+//
+//  PackArchive.cpp
+//  Core
+//
+//  Indexed pack file with independently compressed blocks
+//
+#include "Core/Archive/PackArchive.h"
+#include "Core/Archive/LzCodec.h"
+#include "Core/Hash.h"
+#include "Core/Job/JobSystem.h"
+#include "Core/Log.h"
+#include "Core/Profile/Profiler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+HS_NS_BEGIN
+
+namespace
+{
+bool is_range_valid(uint64 offset, uint64 size, uint64 fileSize)
+{
+    return offset <= fileSize && size <= fileSize - offset;
+}
+} // namespace
+
+PackArchive::~PackArchive()
+{
+    Close();
+}
+
+bool PackArchive::Open(const std::string& absolutePath)
+{
+    Close();
+
+    // 엔트리 조회와 블록 읽기 모두 띄엄띄엄 접근한다.
+    if (false == FileSystem::MapFile(absolutePath, EFileAccessPattern::RANDOM, _mappedFile) || false == _mappedFile.IsValid())
+    {
+        HS_LOG(error, "PackArchive: fail to map %s", absolutePath.c_str());
+        Close();
+        return false;
+    }
+
+    const uint64 fileSize = _mappedFile.size;
+    if (fileSize < sizeof(PackHeader))
+    {
+        HS_LOG(error, "PackArchive: %s is too small", absolutePath.c_str());
+        Close();
+        return false;
+    }
+
+    ::memcpy(&_header, _mappedFile.data, sizeof(PackHeader));
+    if (_header.magic != PackHeader::MAGIC || _header.version != PackHeader::VERSION || _header.blockSize == 0)
+    {
+        HS_LOG(error, "PackArchive: %s is not a valid pack (magic 0x%08X, version %u)", absolutePath.c_str(), _header.magic, _header.version);
+        Close();
+        return false;
+    }
+
+    if (false == is_range_valid(_header.blockTableOffset, static_cast<uint64>(_header.blockCount) * sizeof(PackBlock), fileSize) ||
+        false == is_range_valid(_header.entryTableOffset, static_cast<uint64>(_header.entryCount) * sizeof(PackEntry), fileSize) ||
+        false == is_range_valid(_header.stringTableOffset, _header.stringTableSize, fileSize) ||
+        (_header.blockTableOffset % alignof(PackBlock)) != 0 || (_header.entryTableOffset % alignof(PackEntry)) != 0)
+    {
+        HS_LOG(error, "PackArchive: %s has corrupted tables", absolutePath.c_str());
+        Close();
+        return false;
+    }
+
+    _entries = reinterpret_cast<const PackEntry*>(_mappedFile.data + _header.entryTableOffset);
+    _blocks  = reinterpret_cast<const PackBlock*>(_mappedFile.data + _header.blockTableOffset);
+    _strings = reinterpret_cast<const char*>(_mappedFile.data + _header.stringTableOffset);
+
+    // 여기서 한 번 검사해 두면 Read에서는 범위를 다시 확인하지 않아도 된다.
+    for (uint32 i = 0; i < _header.blockCount; i++)
+    {
+        const PackBlock& block = _blocks[i];
+        if (false == is_range_valid(block.offset, block.compressedSize, fileSize) || block.uncompressedSize > _header.blockSize || block.compressedSize > LzCodec::GetCompressBound(block.uncompressedSize))
+        {
+            HS_LOG(error, "PackArchive: %s has corrupted block %u", absolutePath.c_str(), i);
+            Close();
+            return false;
+        }
+    }
+
+    for (uint32 i = 0; i < _header.entryCount; i++)
+    {
+        const PackEntry& entry = _entries[i];
+
+        uint64 blockBytes       = 0;
+        bool   isBlockSizeValid = true;
+        const bool isBlockRangeValid = static_cast<uint64>(entry.firstBlock) + entry.blockCount <= _header.blockCount;
+        if (isBlockRangeValid)
+        {
+            for (uint32 b = 0; b < entry.blockCount; b++)
+            {
+                const uint32 uncompressedSize = _blocks[entry.firstBlock + b].uncompressedSize;
+                // 마지막 블록을 제외하면 모두 blockSize여야 출력 위치를 계산할 수 있다.
+                isBlockSizeValid &= (b + 1 == entry.blockCount) || (uncompressedSize == _header.blockSize);
+                blockBytes += uncompressedSize;
+            }
+        }
+
+        if (false == isBlockRangeValid || false == isBlockSizeValid || blockBytes != entry.size ||
+            false == is_range_valid(entry.pathOffset, entry.pathLength, _header.stringTableSize) ||
+            (i > 0 && _entries[i - 1].pathHash > entry.pathHash))
+        {
+            HS_LOG(error, "PackArchive: %s has corrupted entry %u", absolutePath.c_str(), i);
+            Close();
+            return false;
+        }
+    }
+
+    _path = absolutePath;
+
+    HS_LOG(info, "PackArchive: opened %s (%u files, %u blocks)", absolutePath.c_str(), _header.entryCount, _header.blockCount);
+    return true;
+}
+
+void PackArchive::Close()
+{
+    if (_mappedFile.IsValid())
+    {
+        FileSystem::UnmapFile(_mappedFile);
+    }
+
+    _mappedFile = MappedFile();
+    _header     = PackHeader{};
+    _entries    = nullptr;
+    _blocks     = nullptr;
+    _strings    = nullptr;
+    _path.clear();
+}
+
+const PackEntry* PackArchive::Find(const std::string& path) const
+{
+    if (false == IsOpen())
+    {
+        return nullptr;
+    }
+
+    const uint64 hash     = StringHash64(path);
+    const PackEntry* end  = _entries + _header.entryCount;
+    const PackEntry* iter = std::lower_bound(_entries, end, hash, [](const PackEntry& entry, uint64 value) { return entry.pathHash < value; });
+
+    // 해시 충돌에 대비해 경로까지 비교한다.
+    for (; iter != end && iter->pathHash == hash; ++iter)
+    {
+        if (iter->pathLength == path.size() && 0 == ::memcmp(_strings + iter->pathOffset, path.data(), path.size()))
+        {
+            return iter;
+        }
+    }
+
+    return nullptr;
+}
+
+std::string PackArchive::GetEntryPath(const PackEntry& entry) const
+{
+    return std::string(_strings + entry.pathOffset, entry.pathLength);
+}
+
+bool PackArchive::readBlock(const PackBlock& block, uint8* destination) const
+{
+    const uint8* source = _mappedFile.data + block.offset;
+    if (block.compressedSize == block.uncompressedSize)
+    {
+        ::memcpy(destination, source, block.uncompressedSize);
+        return true;
+    }
+
+    return LzCodec::Decompress(source, block.compressedSize, destination, block.uncompressedSize);
+}
+
+bool PackArchive::Read(const PackEntry& entry, void* destination) const
+{
+    HS_PROFILE_SCOPE("PackArchive::Read");
+
+    uint8* output = static_cast<uint8*>(destination);
+
+    // 블록 크기가 고정이므로 i번째 블록의 출력 위치는 i * blockSize이다. (마지막 블록만 짧다)
+    const uint64 blockSize = _header.blockSize;
+    const PackBlock* blocks = _blocks + entry.firstBlock;
+
+    if (entry.blockCount <= 1)
+    {
+        return entry.blockCount == 0 || readBlock(blocks[0], output);
+    }
+
+    std::atomic<bool> isFailed{false};
+    JobSystem::ParallelFor(entry.blockCount, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 i = begin; i < end; i++)
+        {
+            if (false == readBlock(blocks[i], output + i * blockSize))
+            {
+                isFailed.store(true, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    if (isFailed.load(std::memory_order_relaxed))
+    {
+        HS_LOG(error, "PackArchive: fail to decode %s in %s", GetEntryPath(entry).c_str(), _path.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool PackArchive::Read(const PackEntry& entry, std::vector<uint8>& outData) const
+{
+    outData.resize(static_cast<size_t>(entry.size));
+    if (false == Read(entry, outData.data()))
+    {
+        outData.clear();
+        return false;
+    }
+
+    return true;
+}
+
+PackWriter::~PackWriter()
+{
+    if (_file.is_open())
+    {
+        abort();
+    }
+}
+
+bool PackWriter::Begin(const std::string& absolutePath, uint32 blockSize)
+{
+    HS_ASSERT(false == _file.is_open(), "PackWriter is already writing");
+
+    _file.open(absolutePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (false == _file.is_open())
+    {
+        HS_LOG(error, "PackWriter: fail to open %s", absolutePath.c_str());
+        return false;
+    }
+
+    _filePath         = absolutePath;
+    _blockSize        = (blockSize == 0) ? DEFAULT_BLOCK_SIZE : blockSize;
+    _offset           = 0;
+    _uncompressedSize = 0;
+    _compressedSize   = 0;
+    _entries.clear();
+    _blocks.clear();
+
+    // 헤더 자리는 비워 두고 Finish에서 채운다.
+    const PackHeader placeholder{};
+    return write(&placeholder, sizeof(placeholder));
+}
+
+bool PackWriter::AddFile(const std::string& path, const void* data, size_t size)
+{
+    HS_PROFILE_SCOPE("PackWriter::AddFile");
+
+    if (false == _file.is_open())
+    {
+        return false;
+    }
+
+    const uint64 hash = StringHash64(path);
+    for (const PendingEntry& pending : _entries)
+    {
+        if (pending.entry.pathHash == hash && pending.path == path)
+        {
+            HS_LOG(error, "PackWriter: %s is added twice", path.c_str());
+            return false;
+        }
+    }
+
+    const uint8* source    = static_cast<const uint8*>(data);
+    const uint32 blockCount = static_cast<uint32>((size + _blockSize - 1) / _blockSize);
+
+    PendingEntry pending;
+    pending.path             = path;
+    pending.entry.pathHash   = hash;
+    pending.entry.size       = size;
+    pending.entry.firstBlock = static_cast<uint32>(_blocks.size());
+    pending.entry.blockCount = blockCount;
+
+    // 블록마다 독립적으로 압축하고, 기록은 순서대로 한다.
+    const size_t bound = LzCodec::GetCompressBound(_blockSize);
+    std::vector<uint8>  scratch(static_cast<size_t>(blockCount) * bound);
+    std::vector<uint32> compressedSizes(blockCount);
+
+    JobSystem::ParallelFor(blockCount, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 i = begin; i < end; i++)
+        {
+            const size_t blockOffset = static_cast<size_t>(i) * _blockSize;
+            const size_t blockBytes  = std::min<size_t>(_blockSize, size - blockOffset);
+            const size_t compressed  = LzCodec::Compress(source + blockOffset, blockBytes, scratch.data() + i * bound, bound);
+
+            // 줄어들지 않은 블록은 그대로 저장한다.
+            compressedSizes[i] = (compressed == 0 || compressed >= blockBytes) ? static_cast<uint32>(blockBytes) : static_cast<uint32>(compressed);
+        }
+    });
+
+    for (uint32 i = 0; i < blockCount; i++)
+    {
+        const size_t blockOffset = static_cast<size_t>(i) * _blockSize;
+        const uint32 blockBytes  = static_cast<uint32>(std::min<size_t>(_blockSize, size - blockOffset));
+        const bool   isStored    = compressedSizes[i] == blockBytes;
+
+        PackBlock block;
+        block.offset           = _offset;
+        block.compressedSize   = compressedSizes[i];
+        block.uncompressedSize = blockBytes;
+
+        if (false == write(isStored ? source + blockOffset : scratch.data() + i * bound, block.compressedSize))
+        {
+            return false;
+        }
+
+        _blocks.push_back(block);
+        _compressedSize += block.compressedSize;
+    }
+
+    _uncompressedSize += size;
+    _entries.push_back(std::move(pending));
+    return true;
+}
+
+bool PackWriter::Finish()
+{
+    if (false == _file.is_open())
+    {
+        return false;
+    }
+
+    std::sort(_entries.begin(), _entries.end(), [](const PendingEntry& lhs, const PendingEntry& rhs)
+    {
+        return (lhs.entry.pathHash != rhs.entry.pathHash) ? (lhs.entry.pathHash < rhs.entry.pathHash) : (lhs.path < rhs.path);
+    });
+
+    std::string strings;
+    std::vector<PackEntry> entries;
+    entries.reserve(_entries.size());
+    for (PendingEntry& pending : _entries)
+    {
+        pending.entry.pathOffset = static_cast<uint32>(strings.size());
+        pending.entry.pathLength = static_cast<uint32>(pending.path.size());
+        strings += pending.path;
+        entries.push_back(pending.entry);
+    }
+
+    // 테이블은 매핑한 뒤 그대로 참조하므로 8바이트 정렬을 맞춘다.
+    const uint64 padding = (8 - (_offset % 8)) % 8;
+    const uint8  zeros[8] = {};
+
+    PackHeader header{};
+    header.magic             = PackHeader::MAGIC;
+    header.version           = PackHeader::VERSION;
+    header.blockSize         = _blockSize;
+    header.entryCount        = static_cast<uint32>(entries.size());
+    header.blockCount        = static_cast<uint32>(_blocks.size());
+    header.blockTableOffset  = _offset + padding;
+    header.entryTableOffset  = header.blockTableOffset + _blocks.size() * sizeof(PackBlock);
+    header.stringTableOffset = header.entryTableOffset + entries.size() * sizeof(PackEntry);
+    header.stringTableSize   = strings.size();
+
+    bool result = write(zeros, static_cast<size_t>(padding)) &&
+                  write(_blocks.data(), _blocks.size() * sizeof(PackBlock)) &&
+                  write(entries.data(), entries.size() * sizeof(PackEntry)) &&
+                  write(strings.data(), strings.size());
+
+    if (result)
+    {
+        _file.seekp(0);
+        result = write(&header, sizeof(header));
+    }
+
+    if (false == result)
+    {
+        return false;
+    }
+
+    _file.close();
+    _entries.clear();
+    _blocks.clear();
+    return true;
+}
+
+bool PackWriter::write(const void* data, size_t size)
+{
+    if (size == 0)
+    {
+        return true;
+    }
+
+    _file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (false == _file.good())
+    {
+        HS_LOG(error, "PackWriter: fail to write %s", _filePath.c_str());
+        abort();
+        return false;
+    }
+
+    _offset += size;
+    return true;
+}
+
+void PackWriter::abort()
+{
+    // 반쯤 쓰인 팩이 남지 않도록 지운다.
+    _file.close();
+    std::remove(_filePath.c_str());
+    _entries.clear();
+    _blocks.clear();
+}
+
+HS_NS_END
@@ -0,0 +1,237 @@
+//
+//  VirtualFileSystem.cpp
+//  Core
+//
+//  Resolves asset reads against mounted packs before falling back to loose files
+//
+#include "Core/Archive/VirtualFileSystem.h"
+#include "Core/Archive/PackArchive.h"
+#include "Core/HAL/FileSystem.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+struct MountPoint
+{
+    Scoped<PackArchive> archive;
+    std::string         directory; // NormalizePath 결과, '/'로 끝난다.
+};
+
+struct VirtualFileSystemState
+{
+    std::shared_mutex       mutex;
+    std::vector<MountPoint> mounts; // 마지막이 가장 우선
+};
+
+VirtualFileSystemState& get_state()
+{
+    static VirtualFileSystemState s_state;
+    return s_state;
+}
+
+// 호출자가 state.mutex를 잡고 있어야 한다.
+bool find_entry(const VirtualFileSystemState& state, const std::string& absolutePath, const PackArchive*& outArchive, const PackEntry*& outEntry)
+{
+    if (state.mounts.empty())
+    {
+        return false;
+    }
+
+    const std::string path = VirtualFileSystem::NormalizePath(absolutePath);
+    for (auto it = state.mounts.rbegin(); it != state.mounts.rend(); ++it)
+    {
+        const std::string& directory = it->directory;
+        if (path.size() <= directory.size() || 0 != path.compare(0, directory.size(), directory))
+        {
+            continue;
+        }
+
+        const PackEntry* entry = it->archive->Find(path.substr(directory.size()));
+        if (nullptr != entry)
+        {
+            outArchive = it->archive.get();
+            outEntry   = entry;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool read_loose_file(const std::string& absolutePath, std::vector<uint8>& outData)
+{
+    FileHandle fileHandle = nullptr;
+    if (false == FileSystem::Open(absolutePath, EFileAccess::READ_ONLY, fileHandle))
+    {
+        return false;
+    }
+
+    const size_t size = FileSystem::GetSize(fileHandle);
+    outData.resize(size);
+
+    const bool result = (size == 0) || (FileSystem::Read(fileHandle, outData.data(), size) == size);
+    FileSystem::Close(fileHandle);
+
+    if (false == result)
+    {
+        outData.clear();
+    }
+    return result;
+}
+} // namespace
+
+bool VirtualFileSystem::Mount(const std::string& packPath, const std::string& mountDirectory)
+{
+    auto archive = MakeScoped<PackArchive>();
+    if (false == archive->Open(packPath))
+    {
+        return false;
+    }
+
+    std::string directory = NormalizePath(mountDirectory);
+    if (false == directory.empty() && directory.back() != '/')
+    {
+        directory.push_back('/');
+    }
+
+    VirtualFileSystemState& state = get_state();
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+    state.mounts.push_back(MountPoint{std::move(archive), std::move(directory)});
+
+    HS_LOG(info, "VirtualFileSystem: mounted %s at %s", packPath.c_str(), mountDirectory.c_str());
+    return true;
+}
+
+void VirtualFileSystem::Unmount(const std::string& packPath)
+{
+    VirtualFileSystemState& state = get_state();
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+
+    state.mounts.erase(std::remove_if(state.mounts.begin(), state.mounts.end(), [&packPath](const MountPoint& mount) { return mount.archive->GetPath() == packPath; }),
+                       state.mounts.end());
+}
+
+void VirtualFileSystem::UnmountAll()
+{
+    VirtualFileSystemState& state = get_state();
+    std::unique_lock<std::shared_mutex> lock(state.mutex);
+    state.mounts.clear();
+}
+
+bool VirtualFileSystem::IsPacked(const std::string& absolutePath)
+{
+    VirtualFileSystemState& state = get_state();
+    std::shared_lock<std::shared_mutex> lock(state.mutex);
+
+    const PackArchive* archive = nullptr;
+    const PackEntry*   entry   = nullptr;
+    return find_entry(state, absolutePath, archive, entry);
+}
+
+bool VirtualFileSystem::Exist(const std::string& absolutePath)
+{
+    return IsPacked(absolutePath) || FileSystem::Exist(absolutePath);
+}
+
+bool VirtualFileSystem::ReadFile(const std::string& absolutePath, std::vector<uint8>& outData)
+{
+    if (ReadPackedFile(absolutePath, outData))
+    {
+        return true;
+    }
+
+    return read_loose_file(absolutePath, outData);
+}
+
+bool VirtualFileSystem::ReadPackedFile(const std::string& absolutePath, std::vector<uint8>& outData)
+{
+    VirtualFileSystemState& state = get_state();
+    std::shared_lock<std::shared_mutex> lock(state.mutex);
+
+    const PackArchive* archive = nullptr;
+    const PackEntry*   entry   = nullptr;
+    if (false == find_entry(state, absolutePath, archive, entry))
+    {
+        return false;
+    }
+
+    return archive->Read(*entry, outData);
+}
+
+std::string VirtualFileSystem::NormalizePath(const std::string& path)
+{
+    std::string unified = path;
+    std::replace(unified.begin(), unified.end(), '\\', '/');
+
+    // 맨 앞의 "//"는 UNC 경로, "/"는 루트이므로 남긴다.
+    std::string result;
+    if (0 == unified.compare(0, 2, "//"))
+    {
+        result = "//";
+    }
+    else if (false == unified.empty() && unified[0] == '/')
+    {
+        result = "/";
+    }
+
+    const size_t             rootSize = result.size();
+    std::vector<std::string> segments;
+    size_t                   begin = 0;
+    while (begin <= unified.size())
+    {
+        size_t end = unified.find('/', begin);
+        if (end == std::string::npos)
+        {
+            end = unified.size();
+        }
+
+        std::string segment = unified.substr(begin, end - begin);
+        begin               = end + 1;
+
+        if (segment.empty() || segment == ".")
+        {
+            continue;
+        }
+        if (segment == "..")
+        {
+            // 드라이브("C:")나 루트 위로는 올라가지 않는다. 상대 경로 맨 앞의 ".."는 남긴다.
+            const bool isDrive = (segments.size() == 1 && rootSize == 0 && segments[0].size() == 2 && segments[0][1] == ':');
+            if (false == segments.empty() && segments.back() != ".." && false == isDrive)
+            {
+                segments.pop_back();
+                continue;
+            }
+            if (rootSize > 0 || isDrive)
+            {
+                continue;
+            }
+        }
+        segments.push_back(std::move(segment));
+    }
+
+    for (size_t i = 0; i < segments.size(); i++)
+    {
+        if (i > 0)
+        {
+            result.push_back('/');
+        }
+        result += segments[i];
+    }
+
+    // 디렉터리를 가리키던 구분자는 남긴다.
+    if (false == segments.empty() && unified.back() == '/')
+    {
+        result.push_back('/');
+    }
+
+    return result;
+}
+
+HS_NS_END
@@ -0,0 +1,41 @@
+//
+//  VirtualFileSystem.h
+//  Core
+//
+//  Resolves asset reads against mounted packs before falling back to loose files
+//
+#ifndef __HS_VIRTUAL_FILE_SYSTEM_H__
+#define __HS_VIRTUAL_FILE_SYSTEM_H__
+
+#include "Precompile.h"
+
+#include <string>
+#include <vector>
+
+HS_NS_BEGIN
+
+// 팩은 mountDirectory 아래의 파일을 대신한다. mountDirectory/Textures/a.png를 읽으면
+// 팩의 "Textures/a.png" 엔트리를 먼저 찾고, 없으면 디스크의 파일을 읽는다.
+// 나중에 마운트한 팩이 우선한다. Mount/Unmount는 읽기와 동시에 호출해도 된다.
+class HS_API VirtualFileSystem
+{
+public:
+    static bool Mount(const std::string& packPath, const std::string& mountDirectory);
+    static void Unmount(const std::string& packPath);
+    static void UnmountAll();
+
+    static bool IsPacked(const std::string& absolutePath);
+    static bool Exist(const std::string& absolutePath);
+
+    // 팩에 있으면 풀어서, 없으면 디스크에서 읽는다.
+    static bool ReadFile(const std::string& absolutePath, std::vector<uint8>& outData);
+    // 팩에 있을 때만 읽는다. 디스크 폴백은 호출자가 직접 처리하는 경우(비동기 배치 읽기 등)에 쓴다.
+    static bool ReadPackedFile(const std::string& absolutePath, std::vector<uint8>& outData);
+
+    // '\\'를 '/'로 바꾸고 중복된 구분자와 "."을 없애며 ".."은 앞 세그먼트와 상쇄한다. 팩 엔트리 경로는 이 형태로 저장된다.
+    static std::string NormalizePath(const std::string& path);
+};
+
+HS_NS_END
+
+#endif /* __HS_VIRTUAL_FILE_SYSTEM_H__ */
@@ -0,0 +1,562 @@
+//
+//  FlatHashMap.h
+//  Core
+//
+//  Open-addressing hash map with SwissTable-style control byte groups
+//
+#ifndef __HS_FLAT_HASH_MAP_H__
+#define __HS_FLAT_HASH_MAP_H__
+
+#include "Precompile.h"
+#include "Core/Hash.h"
+#include "Core/Log.h"
+
+#include <cstring>
+#include <functional>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define HS_FLAT_HASH_MAP_SSE2 1
+#else
+    #define HS_FLAT_HASH_MAP_SSE2 0
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+HS_NS_BEGIN
+
+// 정수/enum/포인터 키는 값을 그대로 넘기고(맵 내부에서 섞는다), 그 외 타입은 Hasher<T>를 사용한다.
+template <typename K>
+struct FlatHash
+{
+    HS_FORCEINLINE uint64 operator()(const K& key) const
+    {
+        if constexpr (std::is_integral<K>::value || std::is_enum<K>::value)
+        {
+            return static_cast<uint64>(key);
+        }
+        else if constexpr (std::is_pointer<K>::value)
+        {
+            return static_cast<uint64>(reinterpret_cast<uintptr_t>(key));
+        }
+        else
+        {
+            return static_cast<uint64>(Hasher<K>::Get(key));
+        }
+    }
+};
+
+namespace FlatHashMapDetail
+{
+using ControlByte = int8;
+
+constexpr ControlByte CTRL_EMPTY   = -128; // 0b10000000
+constexpr ControlByte CTRL_DELETED = -2;   // 0b11111110
+// 사용 중인 슬롯은 0..127 범위의 H2(해시 상위 7비트)를 가진다. 부호 비트만으로 빈/삭제 슬롯을 구분할 수 있다.
+
+HS_FORCEINLINE uint32 CountTrailingZeros(uint64 value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32>(index);
+#else
+    return static_cast<uint32>(__builtin_ctzll(value));
+#endif
+}
+
+// 그룹 내 매칭 결과. 비트를 하나씩 꺼내며 슬롯 오프셋을 돌려준다.
+struct BitMask
+{
+    uint64 mask;
+    uint32 shift; // SSE2: 1비트 = 1슬롯, SWAR: 8비트 = 1슬롯
+
+    HS_FORCEINLINE explicit operator bool() const { return mask != 0; }
+    HS_FORCEINLINE uint32   Lowest() const { return CountTrailingZeros(mask) >> shift; }
+    HS_FORCEINLINE void     ClearLowest() { mask &= (mask - 1); }
+};
+
+#if HS_FLAT_HASH_MAP_SSE2
+struct Group
+{
+    static constexpr size_t WIDTH = 16;
+
+    HS_FORCEINLINE explicit Group(const ControlByte* ctrl)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+    {
+    }
+
+    HS_FORCEINLINE BitMask Match(ControlByte h2) const
+    {
+        const __m128i pattern = _mm_set1_epi8(static_cast<char>(h2));
+        return BitMask{static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(pattern, ctrl)))), 0};
+    }
+
+    HS_FORCEINLINE BitMask MatchEmpty() const
+    {
+        return Match(CTRL_EMPTY);
+    }
+
+    HS_FORCEINLINE BitMask MatchEmptyOrDeleted() const
+    {
+        return BitMask{static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(ctrl))), 0};
+    }
+
+    __m128i ctrl;
+};
+#else
+// SIMD가 없는 환경(arm64 포함)에서는 8바이트 단위 SWAR로 비교한다.
+// Match는 드물게 거짓 양성을 낼 수 있으나 키 비교로 걸러진다.
+struct Group
+{
+    static constexpr size_t WIDTH = 8;
+
+    static constexpr uint64 LSBS = 0x0101010101010101ull;
+    static constexpr uint64 MSBS = 0x8080808080808080ull;
+
+    HS_FORCEINLINE explicit Group(const ControlByte* ctrl)
+    {
+        ::memcpy(&this->ctrl, ctrl, sizeof(uint64));
+    }
+
+    HS_FORCEINLINE BitMask Match(ControlByte h2) const
+    {
+        const uint64 x = ctrl ^ (LSBS * static_cast<uint8>(h2));
+        return BitMask{(x - LSBS) & ~x & MSBS, 3};
+    }
+
+    HS_FORCEINLINE BitMask MatchEmpty() const
+    {
+        // EMPTY(0x80)만 bit7=1, bit1=0 이다.
+        return BitMask{ctrl & ~(ctrl << 6) & MSBS, 3};
+    }
+
+    HS_FORCEINLINE BitMask MatchEmptyOrDeleted() const
+    {
+        return BitMask{ctrl & MSBS, 3};
+    }
+
+    uint64 ctrl;
+};
+#endif
+} // namespace FlatHashMapDetail
+
+// std::unordered_map의 자주 쓰는 부분집합과 같은 인터페이스를 제공한다.
+// - 원소는 연속 배열에 저장되며 삽입/재해시 시 반복자와 포인터가 무효화된다.
+// - 프로브는 그룹(16 또는 8 슬롯) 단위로 이뤄지고, 최대 부하율은 7/8이다.
+// - value_type은 std::pair<K, V>이며 반복자로 key를 수정해서는 안 된다.
+template <typename K, typename V, typename Hash = FlatHash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap
+{
+    using ControlByte = FlatHashMapDetail::ControlByte;
+    using Group       = FlatHashMapDetail::Group;
+
+public:
+    using key_type    = K;
+    using mapped_type = V;
+    using value_type  = std::pair<K, V>;
+
+    template <bool IsConst>
+    class IteratorBase
+    {
+        friend FlatHashMap;
+
+        using MapPtr = typename std::conditional<IsConst, const FlatHashMap*, FlatHashMap*>::type;
+
+    public:
+        using reference = typename std::conditional<IsConst, const value_type&, value_type&>::type;
+        using pointer   = typename std::conditional<IsConst, const value_type*, value_type*>::type;
+
+        IteratorBase() = default;
+        IteratorBase(const IteratorBase<false>& other)
+            : _map(other._map)
+            , _index(other._index)
+        {
+        }
+
+        HS_FORCEINLINE reference operator*() const { return _map->_slots[_index]; }
+        HS_FORCEINLINE pointer   operator->() const { return &_map->_slots[_index]; }
+
+        IteratorBase& operator++()
+        {
+            _index = _map->nextFull(_index + 1);
+            return *this;
+        }
+
+        HS_FORCEINLINE bool operator==(const IteratorBase& rhs) const { return _index == rhs._index; }
+        HS_FORCEINLINE bool operator!=(const IteratorBase& rhs) const { return _index != rhs._index; }
+
+    private:
+        IteratorBase(MapPtr map, size_t index)
+            : _map(map)
+            , _index(index)
+        {
+        }
+
+        MapPtr _map   = nullptr;
+        size_t _index = 0;
+
+        friend class IteratorBase<!IsConst>;
+    };
+
+    using iterator       = IteratorBase<false>;
+    using const_iterator = IteratorBase<true>;
+
+    FlatHashMap() = default;
+
+    explicit FlatHashMap(size_t expectedCount)
+    {
+        reserve(expectedCount);
+    }
+
+    FlatHashMap(const FlatHashMap& other)
+    {
+        reserve(other._size);
+        for (const auto& elem : other)
+        {
+            insertUnique(hashOf(elem.first), elem);
+        }
+    }
+
+    FlatHashMap(FlatHashMap&& other) noexcept
+    {
+        swap(other);
+    }
+
+    ~FlatHashMap()
+    {
+        destroyAll();
+        release();
+    }
+
+    FlatHashMap& operator=(const FlatHashMap& other)
+    {
+        if (this != &other)
+        {
+            FlatHashMap copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    FlatHashMap& operator=(FlatHashMap&& other) noexcept
+    {
+        if (this != &other)
+        {
+            FlatHashMap moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    void swap(FlatHashMap& other) noexcept
+    {
+        std::swap(_ctrl, other._ctrl);
+        std::swap(_slots, other._slots);
+        std::swap(_capacity, other._capacity);
+        std::swap(_size, other._size);
+        std::swap(_growthLeft, other._growthLeft);
+    }
+
+    iterator       begin() { return iterator(this, nextFull(0)); }
+    const_iterator begin() const { return const_iterator(this, nextFull(0)); }
+    iterator       end() { return iterator(this, _capacity); }
+    const_iterator end() const { return const_iterator(this, _capacity); }
+
+    HS_FORCEINLINE size_t size() const { return _size; }
+    HS_FORCEINLINE bool   empty() const { return _size == 0; }
+    HS_FORCEINLINE size_t capacity() const { return _capacity; }
+
+    iterator find(const K& key)
+    {
+        return iterator(this, findIndex(key, hashOf(key)));
+    }
+
+    const_iterator find(const K& key) const
+    {
+        return const_iterator(this, findIndex(key, hashOf(key)));
+    }
+
+    HS_FORCEINLINE size_t count(const K& key) const { return (findIndex(key, hashOf(key)) != _capacity) ? 1 : 0; }
+    HS_FORCEINLINE bool   contains(const K& key) const { return findIndex(key, hashOf(key)) != _capacity; }
+
+    V& at(const K& key)
+    {
+        const size_t index = findIndex(key, hashOf(key));
+        HS_ASSERT(index != _capacity, "FlatHashMap::at - key not found");
+        return _slots[index].second;
+    }
+
+    const V& at(const K& key) const
+    {
+        const size_t index = findIndex(key, hashOf(key));
+        HS_ASSERT(index != _capacity, "FlatHashMap::at - key not found");
+        return _slots[index].second;
+    }
+
+    V& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        const uint64 hash  = hashOf(key);
+        const size_t index = findIndex(key, hash);
+        if (index != _capacity)
+        {
+            return {iterator(this, index), false};
+        }
+
+        const size_t slot = insertUnique(hash, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator(this, slot), true};
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template <typename M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (false == result.second)
+        {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    size_t erase(const K& key)
+    {
+        const size_t index = findIndex(key, hashOf(key));
+        if (index == _capacity)
+        {
+            return 0;
+        }
+        eraseAt(index);
+        return 1;
+    }
+
+    iterator erase(iterator it)
+    {
+        eraseAt(it._index);
+        return iterator(this, nextFull(it._index + 1));
+    }
+
+    void clear()
+    {
+        destroyAll();
+        if (_capacity > 0)
+        {
+            ::memset(_ctrl, FlatHashMapDetail::CTRL_EMPTY, _capacity);
+        }
+        _size       = 0;
+        _growthLeft = maxLoadFor(_capacity);
+    }
+
+    void reserve(size_t count)
+    {
+        size_t required = Group::WIDTH;
+        while (maxLoadFor(required) < count)
+        {
+            required *= 2;
+        }
+        if (required > _capacity)
+        {
+            rehash(required);
+        }
+    }
+
+private:
+    static HS_FORCEINLINE size_t maxLoadFor(size_t capacity) { return capacity - capacity / 8; }
+
+    // 키 해시를 64비트 곱셈으로 섞어 상위 비트에서 H1(그룹 위치)과 H2(제어 바이트)를 뽑는다.
+    HS_FORCEINLINE uint64 hashOf(const K& key) const
+    {
+        return Hash{}(key) * 0x9E3779B97F4A7C15ull;
+    }
+    static HS_FORCEINLINE size_t      h1(uint64 hash) { return static_cast<size_t>(hash >> 32); }
+    static HS_FORCEINLINE ControlByte h2(uint64 hash) { return static_cast<ControlByte>((hash >> 25) & 0x7F); }
+
+    HS_FORCEINLINE size_t groupCount() const { return _capacity / Group::WIDTH; }
+
+    size_t findIndex(const K& key, uint64 hash) const
+    {
+        if (_capacity == 0)
+        {
+            return _capacity;
+        }
+
+        const size_t      groupMask = groupCount() - 1;
+        const ControlByte tag       = h2(hash);
+        size_t            group     = h1(hash) & groupMask;
+
+        for (size_t probe = 1;; probe++)
+        {
+            const size_t base = group * Group::WIDTH;
+            const Group  g(_ctrl + base);
+            for (auto match = g.Match(tag); match; match.ClearLowest())
+            {
+                const size_t index = base + match.Lowest();
+                if (KeyEqual{}(_slots[index].first, key))
+                {
+                    return index;
+                }
+            }
+            if (g.MatchEmpty())
+            {
+                return _capacity;
+            }
+            if (probe > groupMask)
+            {
+                return _capacity;
+            }
+            group = (group + probe) & groupMask; // triangular probing: 2의 거듭제곱 그룹 수에서 모든 그룹을 방문한다.
+        }
+    }
+
+    size_t findInsertSlot(uint64 hash) const
+    {
+        const size_t groupMask = groupCount() - 1;
+        size_t       group     = h1(hash) & groupMask;
+
+        for (size_t probe = 1;; probe++)
+        {
+            const size_t base = group * Group::WIDTH;
+            const auto   free = Group(_ctrl + base).MatchEmptyOrDeleted();
+            if (free)
+            {
+                return base + free.Lowest();
+            }
+            group = (group + probe) & groupMask;
+        }
+    }
+
+    // 키가 없다는 것이 보장된 상태에서 호출한다.
+    template <typename... Args>
+    size_t insertUnique(uint64 hash, Args&&... args)
+    {
+        if (_growthLeft == 0)
+        {
+            // 여유분 대부분이 삭제 표식으로 채워진 경우라면 같은 크기로 재해시해 정리만 한다.
+            rehash((_capacity == 0) ? Group::WIDTH : (_size * 32 <= _capacity * 25 ? _capacity : _capacity * 2));
+        }
+
+        const size_t index = findInsertSlot(hash);
+        if (_ctrl[index] == FlatHashMapDetail::CTRL_EMPTY)
+        {
+            _growthLeft--;
+        }
+        new (_slots + index) value_type(std::forward<Args>(args)...);
+        _ctrl[index] = h2(hash);
+        _size++;
+        return index;
+    }
+
+    void eraseAt(size_t index)
+    {
+        _slots[index].~value_type();
+        _size--;
+
+        // 같은 그룹에 빈 슬롯이 있다면 이 그룹에서 프로브가 끝나므로 EMPTY로 되돌릴 수 있다.
+        const size_t base = index & ~(Group::WIDTH - 1);
+        if (Group(_ctrl + base).MatchEmpty())
+        {
+            _ctrl[index] = FlatHashMapDetail::CTRL_EMPTY;
+            _growthLeft++;
+        }
+        else
+        {
+            _ctrl[index] = FlatHashMapDetail::CTRL_DELETED;
+        }
+    }
+
+    size_t nextFull(size_t index) const
+    {
+        while (index < _capacity && _ctrl[index] < 0)
+        {
+            index++;
+        }
+        return index;
+    }
+
+    void rehash(size_t newCapacity)
+    {
+        ControlByte* oldCtrl     = _ctrl;
+        value_type*  oldSlots    = _slots;
+        const size_t oldCapacity = _capacity;
+
+        _ctrl       = static_cast<ControlByte*>(::operator new(newCapacity));
+        _slots      = static_cast<value_type*>(::operator new(sizeof(value_type) * newCapacity));
+        _capacity   = newCapacity;
+        _size       = 0;
+        _growthLeft = maxLoadFor(newCapacity);
+        ::memset(_ctrl, FlatHashMapDetail::CTRL_EMPTY, newCapacity);
+
+        for (size_t i = 0; i < oldCapacity; i++)
+        {
+            if (oldCtrl[i] >= 0)
+            {
+                const uint64 hash  = hashOf(oldSlots[i].first);
+                const size_t index = findInsertSlot(hash);
+                new (_slots + index) value_type(std::move(oldSlots[i]));
+                oldSlots[i].~value_type();
+                _ctrl[index] = h2(hash);
+                _size++;
+                _growthLeft--;
+            }
+        }
+
+        ::operator delete(oldCtrl);
+        ::operator delete(static_cast<void*>(oldSlots));
+    }
+
+    void destroyAll()
+    {
+        if (!std::is_trivially_destructible<value_type>::value)
+        {
+            for (size_t i = 0; i < _capacity; i++)
+            {
+                if (_ctrl[i] >= 0)
+                {
+                    _slots[i].~value_type();
+                }
+            }
+        }
+    }
+
+    void release()
+    {
+        ::operator delete(_ctrl);
+        ::operator delete(static_cast<void*>(_slots));
+        _ctrl       = nullptr;
+        _slots      = nullptr;
+        _capacity   = 0;
+        _size       = 0;
+        _growthLeft = 0;
+    }
+
+    ControlByte* _ctrl       = nullptr;
+    value_type*  _slots      = nullptr;
+    size_t       _capacity   = 0;
+    size_t       _size       = 0;
+    size_t       _growthLeft = 0;
+};
+
+HS_NS_END
+
+#endif
@@ -0,0 +1,204 @@
+//
+//  RingQueue.h
+//  Core
+//
+//  Bounded lock-free ring buffer queues for cross-thread handoff
+//
+#ifndef __HS_RING_QUEUE_H__
+#define __HS_RING_QUEUE_H__
+
+#include "Precompile.h"
+
+#include <atomic>
+
+HS_NS_BEGIN
+
+// Single-producer / single-consumer.
+// TryPush는 생산자 스레드에서만, TryPop/TryPeek/Clear는 소비자 스레드에서만 호출해야 한다.
+template <typename T, size_t Capacity>
+class SPSCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be power of two");
+
+public:
+    SPSCQueue() = default;
+
+    SPSCQueue(const SPSCQueue&)            = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    bool TryPush(const T& value)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cachedHead == Capacity)
+        {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if (tail - _cachedHead == Capacity)
+            {
+                return false;
+            }
+        }
+
+        _buffer[tail & MASK] = value;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& outValue)
+    {
+        if (false == TryPeek(outValue))
+        {
+            return false;
+        }
+
+        _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPeek(T& outValue)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _cachedTail)
+        {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail)
+            {
+                return false;
+            }
+        }
+
+        outValue = _buffer[head & MASK];
+        return true;
+    }
+
+    void Clear()
+    {
+        _cachedTail = _tail.load(std::memory_order_acquire);
+        _head.store(_cachedTail, std::memory_order_release);
+    }
+
+    // 다른 스레드가 동시에 접근 중이면 근사값이다.
+    HS_FORCEINLINE size_t Size() const { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+    HS_FORCEINLINE bool IsEmpty() const { return Size() == 0; }
+    static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<size_t> _head{0}; // consumer
+    size_t _cachedTail = 0;
+
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<size_t> _tail{0}; // producer
+    size_t _cachedHead = 0;
+
+    alignas(HS_CACHE_LINE_SIZE) T _buffer[Capacity];
+};
+
+// Multi-producer / multi-consumer (Vyukov bounded queue).
+// 각 셀의 sequence로 생산/소비 순서를 맞추므로 락 없이 여러 스레드에서 호출할 수 있다.
+template <typename T, size_t Capacity>
+class MPMCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be power of two");
+
+public:
+    MPMCQueue()
+    {
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPMCQueue(const MPMCQueue&)            = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    template <typename U>
+    bool TryPush(U&& value)
+    {
+        Cell* cell;
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell                = &_cells[pos & MASK];
+            const size_t seq    = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPop(T& outValue)
+    {
+        Cell* cell;
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            cell                = &_cells[pos & MASK];
+            const size_t seq    = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // empty
+            }
+            else
+            {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        outValue = std::move(cell->data);
+        cell->sequence.store(pos + Capacity, std::memory_order_release);
+        return true;
+    }
+
+    // 다른 스레드가 동시에 접근 중이면 근사값이다.
+    HS_FORCEINLINE size_t Size() const
+    {
+        const size_t enqueuePos = _enqueuePos.load(std::memory_order_acquire);
+        const size_t dequeuePos = _dequeuePos.load(std::memory_order_acquire);
+        return (enqueuePos > dequeuePos) ? (enqueuePos - dequeuePos) : 0;
+    }
+    HS_FORCEINLINE bool IsEmpty() const { return Size() == 0; }
+    static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    alignas(HS_CACHE_LINE_SIZE) Cell _cells[Capacity];
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<size_t> _enqueuePos{0};
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<size_t> _dequeuePos{0};
+};
+
+HS_NS_END
+
+#endif
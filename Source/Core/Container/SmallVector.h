@@ -0,0 +1,333 @@
+//
+//  SmallVector.h
+//  Core
+//
+//  std::vector-like container with inline storage for the first N elements
+//
+#ifndef __HS_SMALL_VECTOR_H__
+#define __HS_SMALL_VECTOR_H__
+
+#include "Precompile.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+HS_NS_BEGIN
+
+// N개까지는 객체 내부 버퍼를 쓰고, 넘치면 힙으로 옮긴다(이후 clear해도 힙 버퍼는 유지).
+// 원소는 항상 연속 메모리에 놓이므로 해싱/순회 시 std::vector와 동일하게 다룰 수 있다.
+template <typename T, size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector requires inline capacity greater than zero");
+
+public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    SmallVector()
+        : _data(inlineData())
+        , _size(0)
+        , _capacity(N)
+    {
+    }
+
+    explicit SmallVector(size_t count)
+        : SmallVector()
+    {
+        resize(count);
+    }
+
+    SmallVector(size_t count, const T& value)
+        : SmallVector()
+    {
+        resize(count, value);
+    }
+
+    SmallVector(std::initializer_list<T> list)
+        : SmallVector()
+    {
+        assign(list.begin(), list.end());
+    }
+
+    SmallVector(const SmallVector& other)
+        : SmallVector()
+    {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : SmallVector()
+    {
+        moveFrom(std::move(other));
+    }
+
+    ~SmallVector()
+    {
+        destroyRange(_data, _data + _size);
+        releaseHeap();
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            moveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> list)
+    {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    template <typename InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        clear();
+        reserve(static_cast<size_t>(std::distance(first, last)));
+        for (; first != last; ++first)
+        {
+            new (_data + _size) T(*first);
+            _size++;
+        }
+    }
+
+    HS_FORCEINLINE T&       operator[](size_t index) { return _data[index]; }
+    HS_FORCEINLINE const T& operator[](size_t index) const { return _data[index]; }
+
+    HS_FORCEINLINE T&       front() { return _data[0]; }
+    HS_FORCEINLINE const T& front() const { return _data[0]; }
+    HS_FORCEINLINE T&       back() { return _data[_size - 1]; }
+    HS_FORCEINLINE const T& back() const { return _data[_size - 1]; }
+
+    HS_FORCEINLINE T*       data() { return _data; }
+    HS_FORCEINLINE const T* data() const { return _data; }
+
+    HS_FORCEINLINE iterator       begin() { return _data; }
+    HS_FORCEINLINE const_iterator begin() const { return _data; }
+    HS_FORCEINLINE iterator       end() { return _data + _size; }
+    HS_FORCEINLINE const_iterator end() const { return _data + _size; }
+
+    HS_FORCEINLINE size_t size() const { return _size; }
+    HS_FORCEINLINE size_t capacity() const { return _capacity; }
+    HS_FORCEINLINE bool   empty() const { return _size == 0; }
+    HS_FORCEINLINE bool   IsInline() const { return _data == inlineData(); }
+
+    static constexpr size_t GetInlineCapacity() { return N; }
+
+    void reserve(size_t newCapacity)
+    {
+        if (newCapacity > _capacity)
+        {
+            grow(newCapacity);
+        }
+    }
+
+    void resize(size_t newSize)
+    {
+        resizeImpl(newSize, [](T* p) { new (p) T(); });
+    }
+
+    void resize(size_t newSize, const T& value)
+    {
+        resizeImpl(newSize, [&value](T* p) { new (p) T(value); });
+    }
+
+    void clear()
+    {
+        destroyRange(_data, _data + _size);
+        _size = 0;
+    }
+
+    void push_back(const T& value)
+    {
+        if (_size == _capacity)
+        {
+            // value가 자기 자신의 원소일 수 있으므로 먼저 복사해둔다.
+            T copy(value);
+            grow(_capacity * 2);
+            new (_data + _size) T(std::move(copy));
+        }
+        else
+        {
+            new (_data + _size) T(value);
+        }
+        _size++;
+    }
+
+    void push_back(T&& value)
+    {
+        if (_size == _capacity)
+        {
+            T moved(std::move(value));
+            grow(_capacity * 2);
+            new (_data + _size) T(std::move(moved));
+        }
+        else
+        {
+            new (_data + _size) T(std::move(value));
+        }
+        _size++;
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (_size == _capacity)
+        {
+            T value(std::forward<Args>(args)...);
+            grow(_capacity * 2);
+            new (_data + _size) T(std::move(value));
+        }
+        else
+        {
+            new (_data + _size) T(std::forward<Args>(args)...);
+        }
+        return _data[_size++];
+    }
+
+    void pop_back()
+    {
+        _size--;
+        _data[_size].~T();
+    }
+
+    iterator erase(const_iterator position)
+    {
+        T* pos = const_cast<T*>(position);
+        std::move(pos + 1, end(), pos);
+        pop_back();
+        return pos;
+    }
+
+    bool operator==(const SmallVector& rhs) const
+    {
+        if (_size != rhs._size)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < _size; i++)
+        {
+            if (!(_data[i] == rhs._data[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    HS_FORCEINLINE bool operator!=(const SmallVector& rhs) const { return !(*this == rhs); }
+
+private:
+    HS_FORCEINLINE T*       inlineData() { return reinterpret_cast<T*>(_inline); }
+    HS_FORCEINLINE const T* inlineData() const { return reinterpret_cast<const T*>(_inline); }
+
+    static void destroyRange(T* first, T* last)
+    {
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            for (; first != last; ++first)
+            {
+                first->~T();
+            }
+        }
+    }
+
+    void releaseHeap()
+    {
+        if (false == IsInline())
+        {
+            ::operator delete(static_cast<void*>(_data));
+            _data     = inlineData();
+            _capacity = N;
+        }
+    }
+
+    void grow(size_t minCapacity)
+    {
+        size_t newCapacity = (_capacity * 2 > minCapacity) ? _capacity * 2 : minCapacity;
+        T* newData         = static_cast<T*>(::operator new(sizeof(T) * newCapacity));
+        for (size_t i = 0; i < _size; i++)
+        {
+            new (newData + i) T(std::move(_data[i]));
+            _data[i].~T();
+        }
+        releaseHeap();
+        _data     = newData;
+        _capacity = newCapacity;
+    }
+
+    template <typename Construct>
+    void resizeImpl(size_t newSize, Construct&& construct)
+    {
+        if (newSize < _size)
+        {
+            destroyRange(_data + newSize, _data + _size);
+        }
+        else
+        {
+            reserve(newSize);
+            for (size_t i = _size; i < newSize; i++)
+            {
+                construct(_data + i);
+            }
+        }
+        _size = newSize;
+    }
+
+    void moveFrom(SmallVector&& other)
+    {
+        if (other.IsInline())
+        {
+            for (size_t i = 0; i < other._size; i++)
+            {
+                new (_data + i) T(std::move(other._data[i]));
+            }
+            _size = other._size;
+            other.clear();
+        }
+        else
+        {
+            releaseHeap();
+            _data     = other._data;
+            _size     = other._size;
+            _capacity = other._capacity;
+
+            other._data     = other.inlineData();
+            other._size     = 0;
+            other._capacity = N;
+        }
+    }
+
+    T*     _data;
+    size_t _size;
+    size_t _capacity;
+    alignas(T) unsigned char _inline[sizeof(T) * N];
+};
+
+HS_NS_END
+
+#endif
@@ -0,0 +1,88 @@
+//
+//  FileReadBackend.h
+//  Core
+//
+//  Backend interface for FileSystem::SubmitReads
+//
+#ifndef __HS_FILE_READ_BACKEND_H__
+#define __HS_FILE_READ_BACKEND_H__
+
+#include "Precompile.h"
+
+#include "Core/HAL/FileSystem.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+HS_NS_BEGIN
+
+// SubmitReads 한 번에 대응하는 배치. 백엔드가 요청을 끝낼 때마다 Complete를 호출한다.
+class FileReadBatch
+{
+public:
+    FileReadBatch(FileReadRequest* requests, size_t requestCount)
+        : requests(requests)
+        , requestCount(requestCount)
+        , _remaining(requestCount)
+    {
+    }
+
+    HS_FORCEINLINE bool IsDone() const { return _remaining.load(std::memory_order_acquire) == 0; }
+
+    void Complete(FileReadRequest& request, EFileReadStatus status, size_t bytesRead)
+    {
+        request.bytesRead = bytesRead;
+        request.status    = status;
+
+        // 마지막 감소를 잠금 안에서 해야 Release가 이 함수가 끝난 뒤에 배치를 해제할 수 있다.
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            _cv.notify_all();
+        }
+    }
+
+    // 완료 후 해제 직전에 호출한다. 마지막 Complete가 잠금을 놓을 때까지 기다린다.
+    void Release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+        }
+        delete this;
+    }
+
+    // 배치가 끝나거나 timeout이 지날 때까지 기다린다.
+    void WaitFor(std::chrono::microseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, timeout, [this]() { return IsDone(); });
+    }
+
+    FileReadRequest* const requests;
+    const size_t           requestCount;
+
+private:
+    std::atomic<size_t>     _remaining;
+    std::mutex              _mutex;
+    std::condition_variable _cv;
+};
+
+class HS_API FileReadBackend
+{
+public:
+    virtual ~FileReadBackend() = default;
+
+    virtual const char* GetName() const = 0;
+
+    // 배치의 모든 요청을 큐에 넣는다. 열 수 없는 파일은 바로 FAILED로 완료한다.
+    virtual void Submit(FileReadBatch* batch) = 0;
+
+    // 완료된 요청을 처리한다. wait이면 batch가 끝날 때까지 돌아오지 않는다.
+    virtual void Poll(FileReadBatch* batch, bool wait) = 0;
+};
+
+HS_NS_END
+
+#endif /* __HS_FILE_READ_BACKEND_H__ */
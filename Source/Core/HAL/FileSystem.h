@@ -10,6 +10,8 @@
 
 #include "Precompile.h"
 
+#include <vector>
+
 HS_NS_BEGIN
 
 enum class HS_API EFileAccess
@@ -21,6 +23,47 @@ enum class HS_API EFileAccess
 
 typedef void* FileHandle;
 
+// 매핑한 영역을 어떻게 읽을지 OS에 알려주는 힌트. (POSIX는 madvise)
+enum class HS_API EFileAccessPattern
+{
+    NORMAL,
+    SEQUENTIAL, // 앞에서부터 한 번 훑는 경우. 미리 읽기를 크게 잡는다.
+    RANDOM      // 필요한 부분만 띄엄띄엄 읽는 경우. 미리 읽기를 끈다.
+};
+
+// FileSystem::MapFile로 얻은 읽기 전용 매핑. FileSystem::UnmapFile로 해제한다.
+struct HS_API MappedFile
+{
+    const uint8* data = nullptr;
+    size_t       size = 0;
+
+    HS_FORCEINLINE bool IsValid() const { return data != nullptr; }
+};
+
+enum class HS_API EFileReadStatus : uint8
+{
+    PENDING,
+    COMPLETED,
+    FAILED
+};
+
+// FileSystem::SubmitReads에 넘기는 읽기 요청. 배치가 끝날 때까지 요청과 destination이 유효해야 한다.
+struct HS_API FileReadRequest
+{
+    std::string path;
+    uint64      offset      = 0;
+    size_t      size        = 0;
+    void*       destination = nullptr; // nullptr이면 offset부터 파일 끝까지 buffer에 읽는다.
+
+    // 완료 후 채워진다.
+    std::vector<uint8> buffer;
+    size_t             bytesRead = 0;
+    EFileReadStatus    status    = EFileReadStatus::PENDING;
+};
+
+class FileReadBatch;
+class FileReadBackend;
+
 class HS_API FileSystem
 {
 public:
@@ -42,6 +85,18 @@ public:
     static bool IsEOF(FileHandle fileHandle);
     static size_t GetSize(FileHandle fileHandle);
 
+    // 파일 전체를 읽기 전용으로 매핑한다. 페이지 캐시를 그대로 참조하므로 힙으로 복사하지 않는다.
+    // 빈 파일은 성공하지만 data가 nullptr이다.
+    static bool MapFile(const std::string& absolutePath, EFileAccessPattern pattern, MappedFile& outMappedFile);
+    static void UnmapFile(MappedFile& mappedFile);
+
+    // 여러 읽기 요청을 한 번에 제출하고 바로 돌아온다. Linux는 io_uring, 그 외에는 IO 전용 스레드 풀이 처리한다.
+    // 결과는 PollReads가 true를 돌려준 뒤 또는 WaitReads가 돌아온 뒤에 각 요청에서 읽는다.
+    static FileReadBatch* SubmitReads(FileReadRequest* requests, size_t requestCount);
+    static bool PollReads(FileReadBatch* batch);
+    // 배치가 끝날 때까지 기다린 뒤 해제한다. PollReads가 true를 돌려준 배치도 이것으로 해제한다.
+    static void WaitReads(FileReadBatch* batch);
+
     static std::string GetDirectory(const std::string& absolutePath);
     static std::string GetExtension(const std::string& fileNmae);
 
@@ -51,6 +106,10 @@ public:
 
     static std::wstring Utf8ToUtf16(const std::string& utf8);
     static std::string Utf16ToUtf8(const std::wstring& utf16);
+
+private:
+    // 플랫폼 전용 비동기 읽기 백엔드. 지원하지 않으면 nullptr을 돌려준다.
+    static FileReadBackend* createPlatformReadBackend();
 };
 
 HS_NS_END
@@ -1 +1,203 @@
-﻿#include "Core/HAL/FileSystem.h"
+//
+//  FileSystem.cpp
+//  Core
+//
+//  Platform independent part of FileSystem: batched asynchronous reads
+//
+#include "Core/HAL/FileSystem.h"
+#include "Core/HAL/FileReadBackend.h"
+
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+// 플랫폼 백엔드가 없을 때 쓰는 IO 전용 스레드 풀. 블로킹 읽기가 JobSystem 워커를 막지 않도록 따로 둔다.
+class ThreadPoolFileReadBackend final : public FileReadBackend
+{
+public:
+    ThreadPoolFileReadBackend()
+    {
+        const uint32 hardwareCount = std::max(1u, std::thread::hardware_concurrency());
+        const uint32 threadCount   = std::clamp(hardwareCount / 2, 2u, 4u);
+
+        _threads.reserve(threadCount);
+        for (uint32 i = 0; i < threadCount; i++)
+        {
+            _threads.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPoolFileReadBackend() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopping = true;
+        }
+        _cv.notify_all();
+
+        for (std::thread& thread : _threads)
+        {
+            thread.join();
+        }
+    }
+
+    const char* GetName() const override { return "ThreadPool"; }
+
+    void Submit(FileReadBatch* batch) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (size_t i = 0; i < batch->requestCount; i++)
+            {
+                _queue.push_back(Task{batch, &batch->requests[i]});
+            }
+        }
+        _cv.notify_all();
+    }
+
+    void Poll(FileReadBatch* batch, bool wait) override
+    {
+        while (wait && false == batch->IsDone())
+        {
+            batch->WaitFor(std::chrono::milliseconds(10));
+        }
+    }
+
+private:
+    struct Task
+    {
+        FileReadBatch*   batch;
+        FileReadRequest* request;
+    };
+
+    void workerLoop()
+    {
+        while (true)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return _isStopping || false == _queue.empty(); });
+                if (_queue.empty())
+                {
+                    return;
+                }
+                task = _queue.front();
+                _queue.pop_front();
+            }
+
+            execute(task);
+        }
+    }
+
+    static void execute(const Task& task)
+    {
+        FileReadRequest& request = *task.request;
+
+        FileHandle handle = nullptr;
+        if (false == FileSystem::Open(request.path, EFileAccess::READ_ONLY, handle))
+        {
+            task.batch->Complete(request, EFileReadStatus::FAILED, 0);
+            return;
+        }
+
+        void*  destination = request.destination;
+        size_t size        = request.size;
+        if (nullptr == destination)
+        {
+            const size_t fileSize = FileSystem::GetSize(handle);
+            size                  = (fileSize > request.offset) ? fileSize - static_cast<size_t>(request.offset) : 0;
+            request.buffer.resize(size);
+            destination = request.buffer.data();
+        }
+
+        size_t bytesRead = 0;
+        if (size > 0 && FileSystem::SetPos(handle, static_cast<int64>(request.offset)))
+        {
+            bytesRead = FileSystem::Read(handle, destination, size);
+        }
+        FileSystem::Close(handle);
+
+        const bool isSuccess = (size == 0) || (bytesRead > 0);
+        task.batch->Complete(request, isSuccess ? EFileReadStatus::COMPLETED : EFileReadStatus::FAILED, bytesRead);
+    }
+
+    std::mutex               _mutex;
+    std::condition_variable  _cv;
+    std::deque<Task>         _queue;
+    std::vector<std::thread> _threads;
+    bool                     _isStopping = false;
+};
+
+// 처음 SubmitReads에서 하나만 골라 만들고 프로세스가 끝날 때 파괴한다. 플랫폼 백엔드가 있으면 스레드 풀은 만들지 않는다.
+Scoped<FileReadBackend> s_readBackend;
+std::once_flag          s_readBackendOnce;
+} // namespace
+
+static FileReadBackend* get_read_backend()
+{
+    return s_readBackend.get();
+}
+
+FileReadBatch* FileSystem::SubmitReads(FileReadRequest* requests, size_t requestCount)
+{
+    std::call_once(s_readBackendOnce, []()
+    {
+        FileReadBackend* backend = FileSystem::createPlatformReadBackend();
+        if (nullptr == backend)
+        {
+            backend = new ThreadPoolFileReadBackend();
+        }
+        s_readBackend.reset(backend);
+        HS_LOG(info, "FileSystem: async read backend = %s", backend->GetName());
+    });
+
+    FileReadBatch* batch = new FileReadBatch(requests, requestCount);
+    for (size_t i = 0; i < requestCount; i++)
+    {
+        requests[i].bytesRead = 0;
+        requests[i].status    = EFileReadStatus::PENDING;
+    }
+
+    if (requestCount > 0)
+    {
+        get_read_backend()->Submit(batch);
+    }
+
+    return batch;
+}
+
+bool FileSystem::PollReads(FileReadBatch* batch)
+{
+    if (batch->IsDone())
+    {
+        return true;
+    }
+
+    get_read_backend()->Poll(batch, false);
+    return batch->IsDone();
+}
+
+void FileSystem::WaitReads(FileReadBatch* batch)
+{
+    if (nullptr == batch)
+    {
+        return;
+    }
+
+    if (false == batch->IsDone())
+    {
+        get_read_backend()->Poll(batch, true);
+    }
+
+    batch->Release();
+}
+
+HS_NS_END
@@ -1 +1,126 @@
+//
+//  Simd.h
+//  Core
+//
+//  Portable SIMD layer: SSE/AVX2 on x64, NEON on arm64, scalar otherwise
+//
+#ifndef __HS_SIMD_H__
+#define __HS_SIMD_H__
 
+#include "Precompile.h"
+
+// 명령어 집합은 컴파일 옵션으로 정해진다. (x64 기본은 SSE4.1, HS_ENABLE_AVX2=ON이면 AVX2/FMA)
+// Float4는 항상 4 lane, FloatN은 SoA 커널용으로 SIMD_WIDTH lane이다.
+// HS_SIMD_FORCE_SCALAR를 정의하면 스칼라 경로로 빌드한다. (비교용)
+#if defined(HS_SIMD_FORCE_SCALAR)
+#define HS_SIMD_SCALAR 1
+#elif defined(__x86_64__) || defined(_M_X64)
+#define HS_SIMD_SSE 1
+#if defined(__AVX2__)
+#define HS_SIMD_AVX2 1
+#endif
+#include "Platform/x64/SSESimd.h"
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define HS_SIMD_NEON 1
+#include "Platform/arm64/NeonSimd.h"
+#else
+#define HS_SIMD_SCALAR 1
+#endif
+
+#ifndef HS_SIMD_SSE
+#define HS_SIMD_SSE 0
+#endif
+#ifndef HS_SIMD_AVX2
+#define HS_SIMD_AVX2 0
+#endif
+#ifndef HS_SIMD_NEON
+#define HS_SIMD_NEON 0
+#endif
+#ifndef HS_SIMD_SCALAR
+#define HS_SIMD_SCALAR 0
+#endif
+
+#if HS_SIMD_SCALAR
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#endif
+
+HS_NS_BEGIN
+
+#if HS_SIMD_SCALAR
+namespace simd
+{
+struct Float4
+{
+    float v[4];
+};
+
+HS_FORCEINLINE Float4 Load4(const float* p) { Float4 r; ::memcpy(r.v, p, sizeof(r.v)); return r; }
+HS_FORCEINLINE void   Store4(float* p, Float4 v) { ::memcpy(p, v.v, sizeof(v.v)); }
+HS_FORCEINLINE Float4 Set4(float x, float y, float z, float w) { return Float4{{x, y, z, w}}; }
+HS_FORCEINLINE Float4 Splat4(float value) { return Float4{{value, value, value, value}}; }
+
+HS_FORCEINLINE Float4 SplatX(Float4 v) { return Splat4(v.v[0]); }
+HS_FORCEINLINE Float4 SplatY(Float4 v) { return Splat4(v.v[1]); }
+HS_FORCEINLINE Float4 SplatZ(Float4 v) { return Splat4(v.v[2]); }
+HS_FORCEINLINE Float4 SplatW(Float4 v) { return Splat4(v.v[3]); }
+HS_FORCEINLINE float  GetX(Float4 v) { return v.v[0]; }
+
+#define HS_SIMD_SCALAR_OP(name, expr)                 \
+    HS_FORCEINLINE Float4 name(Float4 a, Float4 b)    \
+    {                                                 \
+        Float4 r;                                     \
+        for (int i = 0; i < 4; i++)                   \
+        {                                             \
+            r.v[i] = (expr);                          \
+        }                                             \
+        return r;                                     \
+    }
+
+HS_SIMD_SCALAR_OP(Add, a.v[i] + b.v[i])
+HS_SIMD_SCALAR_OP(Sub, a.v[i] - b.v[i])
+HS_SIMD_SCALAR_OP(Mul, a.v[i] * b.v[i])
+HS_SIMD_SCALAR_OP(Div, a.v[i] / b.v[i])
+HS_SIMD_SCALAR_OP(Min, std::min(a.v[i], b.v[i]))
+HS_SIMD_SCALAR_OP(Max, std::max(a.v[i], b.v[i]))
+
+#undef HS_SIMD_SCALAR_OP
+
+// 비교 결과는 lane 단위의 bool(0 또는 1)로 둔다.
+HS_FORCEINLINE Float4 CmpLt(Float4 a, Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] < b.v[i]) ? 1.0f : 0.0f; return r; }
+HS_FORCEINLINE Float4 CmpGt(Float4 a, Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] > b.v[i]) ? 1.0f : 0.0f; return r; }
+HS_FORCEINLINE Float4 And(Float4 a, Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] != 0.0f && b.v[i] != 0.0f) ? 1.0f : 0.0f; return r; }
+HS_FORCEINLINE Float4 Or(Float4 a, Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (a.v[i] != 0.0f || b.v[i] != 0.0f) ? 1.0f : 0.0f; return r; }
+HS_FORCEINLINE Float4 Select(Float4 mask, Float4 a, Float4 b) { Float4 r; for (int i = 0; i < 4; i++) r.v[i] = (mask.v[i] != 0.0f) ? a.v[i] : b.v[i]; return r; }
+HS_FORCEINLINE uint32 MoveMask(Float4 mask) { uint32 r = 0; for (int i = 0; i < 4; i++) r |= (mask.v[i] != 0.0f) ? (1u << i) : 0u; return r; }
+
+HS_FORCEINLINE Float4 Abs(Float4 v) { for (int i = 0; i < 4; i++) v.v[i] = std::fabs(v.v[i]); return v; }
+HS_FORCEINLINE Float4 Sqrt(Float4 v) { for (int i = 0; i < 4; i++) v.v[i] = std::sqrt(v.v[i]); return v; }
+HS_FORCEINLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return Add(Mul(a, b), c); }
+
+HS_FORCEINLINE float HorizontalMin(Float4 v) { return std::min(std::min(v.v[0], v.v[1]), std::min(v.v[2], v.v[3])); }
+HS_FORCEINLINE float HorizontalMax(Float4 v) { return std::max(std::max(v.v[0], v.v[1]), std::max(v.v[2], v.v[3])); }
+
+using FloatN                = Float4;
+constexpr uint32 SIMD_WIDTH = 4;
+
+HS_FORCEINLINE FloatN LoadN(const float* p) { return Load4(p); }
+HS_FORCEINLINE void   StoreN(float* p, FloatN v) { Store4(p, v); }
+HS_FORCEINLINE FloatN SplatN(float value) { return Splat4(value); }
+} // namespace simd
+#endif
+
+class HS_API Simd
+{
+public:
+    // 빌드에 쓰인 명령어 집합 이름 ("AVX2", "SSE4.1", "NEON", "Scalar")
+    static const char* GetInstructionSetName();
+
+    // 실행 중인 CPU가 빌드에 쓰인 명령어 집합을 지원하는지 확인한다. 시작할 때 한 번 확인한다.
+    static bool IsSupported();
+};
+
+HS_NS_END
+
+#endif /* __HS_SIMD_H__ */
@@ -10,6 +10,14 @@
 
 #include "Precompile.h"
 
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+	#include <intrin.h>
+#endif
+
 HS_NS_BEGIN
 
 //class Hashable
@@ -49,12 +57,13 @@ struct HS_API Hasher
 
 // 위의 Hashable Interface가 더 나은 것 같은데..
 // ref from https://gist.github.com/badboy/6267743.
+// uint64는 플랫폼에 따라 unsigned long long(Windows, macOS) 또는 unsigned long(Linux)이므로 두 타입을 각각 특수화한다.
 template <>
-struct HS_API Hasher<uint64>
+struct HS_API Hasher<unsigned long long>
 {
-	static uint32 Get(const uint64& key)
+	static uint32 Get(const unsigned long long& key)
 	{
-		uint64 hash = key;
+		unsigned long long hash = key;
 
 		hash = (~hash) + (hash << 18); // key = (key << 18) - key - 1;
 		hash = hash ^ (hash >> 31);
@@ -128,20 +137,161 @@ struct HS_API Hasher<uint16>
 	}
 };
 
-HS_FORCEINLINE HS_API uint64 HashCombine64(uint64 a, uint64 b, uint64 c)
+template<>
+struct HS_API Hasher<float>
 {
-	a += b; a -= b; a -= c; a ^= (c >> 13); b -= c; b -= a; b ^= (a << 8);
-	c -= a; c -= b; c ^= (b >> 13); a -= b; a -= c; a ^= (c >> 12); b -= c;
-	b -= a; b ^= (a << 16); c -= a; c -= b; c ^= (b >> 5); a -= b; a -= c;
-	a ^= (c >> 3); b -= c; b -= a; b ^= (a << 10); c -= a; c -= b; c ^= (b >> 15);
+	static uint32 Get(const float& key)
+	{
+		// -0.0f와 0.0f는 같은 값으로 취급한다.
+		const float value = (key == 0.0f) ? 0.0f : key;
+		uint32 bits;
+		::memcpy(&bits, &value, sizeof(bits));
+		return bits;
+	}
+};
 
-	return c;
+// wyhash 계열 64bit 해시. 8바이트 단위로 읽고 48바이트 이상은 3개의 독립 레인으로 처리한다.
+// Runtime 인스턴스는 memcpy 로드/128bit 곱셈을, constexpr 인스턴스는 바이트 조합/이식 가능한 곱셈을 사용하며 결과는 동일하다.
+namespace HashDetail
+{
+constexpr uint64 SECRET[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+template <bool Runtime>
+constexpr void Mum(uint64& a, uint64& b)
+{
+	if constexpr (Runtime)
+	{
+#if defined(__SIZEOF_INT128__)
+		__uint128_t r = static_cast<__uint128_t>(a) * b;
+		a = static_cast<uint64>(r);
+		b = static_cast<uint64>(r >> 64);
+		return;
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+		return;
+#endif
+	}
+
+	const uint64 ha = a >> 32, hb = b >> 32, la = static_cast<uint32>(a), lb = static_cast<uint32>(b);
+	const uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	const uint64 t  = rl + (rm0 << 32);
+	uint64       lo = t + (rm1 << 32);
+	uint64       hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t);
+	a = lo;
+	b = hi;
+}
+
+template <bool Runtime>
+constexpr uint64 Mix(uint64 a, uint64 b)
+{
+	Mum<Runtime>(a, b);
+	return a ^ b;
+}
+
+template <bool Runtime>
+constexpr uint64 Read8(const char* p)
+{
+	if constexpr (Runtime)
+	{
+		uint64 v = 0;
+		::memcpy(&v, p, 8);
+		return v;
+	}
+	uint64 v = 0;
+	for (int i = 7; i >= 0; i--)
+	{
+		v = (v << 8) | static_cast<uint8>(p[i]);
+	}
+	return v;
+}
+
+template <bool Runtime>
+constexpr uint64 Read4(const char* p)
+{
+	if constexpr (Runtime)
+	{
+		uint32 v = 0;
+		::memcpy(&v, p, 4);
+		return v;
+	}
+	uint64 v = 0;
+	for (int i = 3; i >= 0; i--)
+	{
+		v = (v << 8) | static_cast<uint8>(p[i]);
+	}
+	return v;
 }
 
+constexpr uint64 Read3(const char* p, size_t k)
+{
+	return (static_cast<uint64>(static_cast<uint8>(p[0])) << 16) | (static_cast<uint64>(static_cast<uint8>(p[k >> 1])) << 8) | static_cast<uint8>(p[k - 1]);
+}
+
+template <bool Runtime>
+constexpr uint64 WyHash(const char* p, size_t len, uint64 seed)
+{
+	seed ^= Mix<Runtime>(seed ^ SECRET[0], SECRET[1]);
+
+	uint64 a = 0, b = 0;
+	if (len <= 16)
+	{
+		if (len >= 4)
+		{
+			a = (Read4<Runtime>(p) << 32) | Read4<Runtime>(p + ((len >> 3) << 2));
+			b = (Read4<Runtime>(p + len - 4) << 32) | Read4<Runtime>(p + len - 4 - ((len >> 3) << 2));
+		}
+		else if (len > 0)
+		{
+			a = Read3(p, len);
+		}
+	}
+	else
+	{
+		size_t i = len;
+		if (i >= 48)
+		{
+			uint64 see1 = seed, see2 = seed;
+			do
+			{
+				seed = Mix<Runtime>(Read8<Runtime>(p) ^ SECRET[1], Read8<Runtime>(p + 8) ^ seed);
+				see1 = Mix<Runtime>(Read8<Runtime>(p + 16) ^ SECRET[2], Read8<Runtime>(p + 24) ^ see1);
+				see2 = Mix<Runtime>(Read8<Runtime>(p + 32) ^ SECRET[3], Read8<Runtime>(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (i >= 48);
+			seed ^= see1 ^ see2;
+		}
+		while (i > 16)
+		{
+			seed = Mix<Runtime>(Read8<Runtime>(p) ^ SECRET[1], Read8<Runtime>(p + 8) ^ seed);
+			i -= 16;
+			p += 16;
+		}
+		a = Read8<Runtime>(p + i - 16);
+		b = Read8<Runtime>(p + i - 8);
+	}
+
+	a ^= SECRET[1];
+	b ^= seed;
+	Mum<Runtime>(a, b);
+	return Mix<Runtime>(a ^ SECRET[0] ^ len, b ^ SECRET[1]);
+}
+} // namespace HashDetail
+
+HS_FORCEINLINE HS_API uint64 HashBytes64(const void* data, size_t size, uint64 seed = 0)
+{
+	return HashDetail::WyHash<true>(static_cast<const char*>(data), size, seed);
+}
+
+// 두 64bit 값을 섞는다. 필드 단위로 해시를 누적할 때 사용한다.
 HS_FORCEINLINE HS_API uint64 HashCombine64(uint64 a, uint64 c)
 {
-	uint64 b = 0x9e3779b97f4a7c55;
-	return HashCombine64(a, b, c);
+	return HashDetail::Mix<true>(a ^ HashDetail::SECRET[0], c ^ HashDetail::SECRET[1]);
+}
+
+HS_FORCEINLINE HS_API uint64 HashCombine64(uint64 a, uint64 b, uint64 c)
+{
+	return HashCombine64(HashCombine64(a, b), c);
 }
 
 HS_FORCEINLINE HS_API uint32 HashCombine(uint32 a, uint32 b, uint32 c)
@@ -172,30 +322,36 @@ HS_FORCEINLINE HS_API uint32 PointerHash(const void* p)
 	return hash;
 }
 
-// 64bit FNV-1a hash function
+HS_FORCEINLINE HS_API uint64 StringHash64(const char* str, size_t length)
+{
+	return HashDetail::WyHash<true>(str, length, 0);
+}
+
 HS_FORCEINLINE HS_API uint64 StringHash64(const std::string& str)
 {
-	uint64 hash = 14695981039346656037ULL;
-	for (char c : str)
-	{
-		hash ^= static_cast<uint64>(c);
-		hash *= 1099511628211ULL;
-	}
-	return hash;
+	return StringHash64(str.data(), str.size());
 }
 
-// 32bit FNV-1a hash function
 HS_FORCEINLINE HS_API uint32 StringHash(const std::string& str)
 {
-	uint32 hash = 2166136261U;
-	for (char c : str)
-	{
-		hash ^= static_cast<uint32>(c);
-		hash *= 16777619U;
-	}
-	return hash;
+	const uint64 hash = StringHash64(str);
+	return static_cast<uint32>(hash ^ (hash >> 32));
+}
+
+// 컴파일 타임 문자열 해시. StringHash64와 같은 값을 돌려주므로 바인딩 이름 등 상수 키를 미리 계산해 둘 수 있다.
+constexpr uint64 ConstStringHash64(const char* str, size_t length)
+{
+	return HashDetail::WyHash<false>(str, length, 0);
 }
 
+template <size_t N>
+constexpr uint64 ConstStringHash64(const char (&str)[N])
+{
+	return ConstStringHash64(str, N - 1);
+}
+
+#define HS_STRING_HASH(str) (std::integral_constant<uint64, hs::ConstStringHash64(str)>::value)
+
 HS_NS_END
 
 #endif /* __HS_HASH_H__ */
@@ -0,0 +1,195 @@
+//
+//  JobSystem.h
+//  Core
+//
+//  Work-stealing job scheduler with counters, dependencies and ParallelFor
+//
+#ifndef __HS_JOB_SYSTEM_H__
+#define __HS_JOB_SYSTEM_H__
+
+#include "Precompile.h"
+#include "Core/Container/SmallVector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+HS_NS_BEGIN
+
+struct Job;
+
+// 진행 중인 Job 수를 센다. Schedule 시 signal로 넘기면 1 증가하고, 해당 Job이 끝나면 1 감소한다.
+// 0이 되면 이 카운터를 dependency로 건 Job들이 스케줄된다.
+// 카운터를 파괴하기 전에는 반드시 JobSystem::Wait로 완료를 기다려야 한다.
+class HS_API JobCounter
+{
+public:
+    JobCounter() = default;
+    ~JobCounter();
+
+    JobCounter(const JobCounter&)            = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    HS_FORCEINLINE bool  IsDone() const { return _value.load(std::memory_order_acquire) == 0; }
+    HS_FORCEINLINE int32 GetValue() const { return _value.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+    friend struct JobSystemInternal;
+
+    void add(int32 count);
+    void finish();
+
+    std::atomic<int32>   _value{0};
+    std::mutex           _mutex;
+    SmallVector<Job*, 4> _waiters;
+};
+
+// 스케줄러 내부에서 사용하는 Job 레코드. 작은 람다는 storage에 그대로 담기고, 큰 경우만 힙에 할당된다.
+struct Job
+{
+    static constexpr size_t STORAGE_SIZE = 64;
+
+    void (*invoke)(Job* job);
+    void (*destroy)(Job* job);
+    JobCounter* signal;
+    bool        isMainThreadOnly;
+
+    alignas(std::max_align_t) unsigned char storage[STORAGE_SIZE];
+};
+
+struct JobSystemConfig
+{
+    uint32 workerCount      = 0;     // 0이면 (하드웨어 스레드 수 - 1)
+    bool   pinWorkerThreads = false; // Linux에서 워커를 코어에 고정한다.
+};
+
+// 스레드 인덱스 0은 Initialize를 호출한 메인 스레드, 1..N은 워커 스레드이다.
+// 각 스레드는 자신의 deque에 Job을 쌓고, 일이 없으면 다른 스레드의 deque에서 훔쳐 온다.
+// 메인 스레드 전용 Job은 별도 큐에 쌓이며 ProcessMainThreadJobs 또는 메인 스레드의 Wait에서만 실행된다.
+class HS_API JobSystem
+{
+public:
+    static bool Initialize(const JobSystemConfig& config = JobSystemConfig());
+    static void Finalize();
+
+    static bool IsInitialized();
+
+    template <typename Fn>
+    static void Schedule(Fn&& fn, JobCounter* signal = nullptr, JobCounter* dependency = nullptr)
+    {
+        Job* job = allocateJob();
+        bindJob(job, std::forward<Fn>(fn));
+        job->signal           = signal;
+        job->isMainThreadOnly = false;
+        submit(job, dependency);
+    }
+
+    // 플랫폼 API(윈도우, 입력 등)처럼 메인 스레드에서만 호출해야 하는 작업용.
+    template <typename Fn>
+    static void ScheduleOnMainThread(Fn&& fn, JobCounter* signal = nullptr, JobCounter* dependency = nullptr)
+    {
+        Job* job = allocateJob();
+        bindJob(job, std::forward<Fn>(fn));
+        job->signal           = signal;
+        job->isMainThreadOnly = true;
+        submit(job, dependency);
+    }
+
+    // counter가 0이 될 때까지 기다리며, 기다리는 동안 다른 Job을 대신 실행한다.
+    static void Wait(JobCounter& counter);
+
+    // fn(begin, end)를 [0, count) 구간을 나눠 병렬로 호출하고 모두 끝날 때까지 기다린다.
+    // 구간은 절반씩 재귀적으로 분할되므로 큰 덩어리가 먼저 도난당하고, 분할 단위는 스레드 수에 맞춰 정해진다.
+    // 마지막 구간을 빼면 모든 구간의 시작과 길이가 minBatchSize의 배수다. SIMD 커널은 SIMD 폭의 배수를 넘긴다.
+    template <typename Fn>
+    static void ParallelFor(uint32 count, Fn&& fn, uint32 minBatchSize = 1)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const uint32 threadCount = GetThreadCount();
+        uint32       grain       = count / (threadCount * 8);
+        minBatchSize             = (minBatchSize == 0) ? 1 : minBatchSize;
+        grain                    = (grain + minBatchSize - 1) / minBatchSize * minBatchSize;
+        grain                    = (grain == 0) ? minBatchSize : grain;
+
+        if (threadCount <= 1 || count <= grain)
+        {
+            fn(0u, count);
+            return;
+        }
+
+        JobCounter counter;
+        parallelForRange(0, count, grain, fn, counter);
+        Wait(counter);
+    }
+
+    // 메인 스레드 큐에 쌓인 Job을 모두 실행한다. 메인 루프에서 매 프레임 호출한다.
+    static void ProcessMainThreadJobs();
+
+    static uint32 GetWorkerCount();
+    static uint32 GetThreadCount();
+    static uint32 GetCurrentThreadIndex();
+    static bool   IsMainThread();
+
+private:
+    static Job* allocateJob();
+    static void submit(Job* job, JobCounter* dependency);
+
+    template <typename Fn>
+    static void bindJob(Job* job, Fn&& fn)
+    {
+        using F = typename std::decay<Fn>::type;
+
+        if constexpr (sizeof(F) <= Job::STORAGE_SIZE && alignof(F) <= alignof(std::max_align_t))
+        {
+            new (job->storage) F(std::forward<Fn>(fn));
+            job->invoke  = [](Job* j) { (*std::launder(reinterpret_cast<F*>(j->storage)))(); };
+            job->destroy = [](Job* j) { std::launder(reinterpret_cast<F*>(j->storage))->~F(); };
+        }
+        else
+        {
+            F* heapFn = new F(std::forward<Fn>(fn));
+            ::memcpy(job->storage, &heapFn, sizeof(heapFn));
+            job->invoke = [](Job* j)
+            {
+                F* p;
+                ::memcpy(&p, j->storage, sizeof(p));
+                (*p)();
+            };
+            job->destroy = [](Job* j)
+            {
+                F* p;
+                ::memcpy(&p, j->storage, sizeof(p));
+                delete p;
+            };
+        }
+    }
+
+    template <typename Fn>
+    static void parallelForRange(uint32 begin, uint32 end, uint32 grain, Fn& fn, JobCounter& counter)
+    {
+        while (end - begin > grain)
+        {
+            // begin이 grain의 배수로 유지되도록 절반을 grain 단위로 내림한다.
+            uint32 half = (end - begin) / 2 / grain * grain;
+            half        = (half == 0) ? grain : half;
+
+            const uint32 mid = begin + half;
+            Schedule([mid, end, grain, &fn, &counter]() { parallelForRange(mid, end, grain, fn, counter); }, &counter);
+            end = mid;
+        }
+        fn(begin, end);
+    }
+};
+
+HS_NS_END
+
+#endif
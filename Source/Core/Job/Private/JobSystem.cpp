@@ -0,0 +1,643 @@
+//
+//  JobSystem.cpp
+//  Core
+//
+//  Work-stealing job scheduler implementation
+//
+#include "Core/Job/JobSystem.h"
+#include "Core/Container/RingQueue.h"
+#include "Core/Log.h"
+#include "Core/Profile/Profiler.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define HS_CPU_PAUSE() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define HS_CPU_PAUSE() _mm_pause()
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define HS_CPU_PAUSE() __asm__ __volatile__("yield")
+#else
+    #define HS_CPU_PAUSE() std::this_thread::yield()
+#endif
+
+HS_NS_BEGIN
+
+// 스케줄러 내부 함수에서 JobCounter의 private 멤버에 접근하기 위한 통로
+struct JobSystemInternal
+{
+    static void FinishCounter(JobCounter& counter) { counter.finish(); }
+};
+
+namespace
+{
+constexpr uint32 s_invalidThreadIndex = UINT32_MAX;
+constexpr int32  s_spinCountBeforeSleep = 256;
+
+// Chase-Lev work-stealing deque (고정 크기).
+// Push/Pop은 소유 스레드만, Steal은 어느 스레드에서나 호출할 수 있다.
+class WorkStealingDeque
+{
+public:
+    static constexpr int64 CAPACITY = 4096;
+
+    WorkStealingDeque()
+    {
+        for (auto& slot : _buffer)
+        {
+            slot.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    bool Push(Job* job)
+    {
+        const int64 bottom = _bottom.load(std::memory_order_relaxed);
+        const int64 top    = _top.load(std::memory_order_acquire);
+        if (bottom - top >= CAPACITY)
+        {
+            return false;
+        }
+
+        _buffer[bottom & MASK].store(job, std::memory_order_relaxed);
+        _bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    Job* Pop()
+    {
+        const int64 bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 top = _top.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Job* job = _buffer[bottom & MASK].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // 마지막 원소는 Steal과 경쟁한다.
+            if (false == _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                job = nullptr;
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* Steal()
+    {
+        int64 top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64 bottom = _bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom)
+        {
+            return nullptr;
+        }
+
+        Job* job = _buffer[top & MASK].load(std::memory_order_relaxed);
+        if (false == _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        return job;
+    }
+
+private:
+    static constexpr int64 MASK = CAPACITY - 1;
+
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<int64> _top{0};
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<int64> _bottom{0};
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<Job*> _buffer[CAPACITY];
+};
+
+struct JobSystemState
+{
+    uint32 workerCount = 0;
+
+    // [0] = 메인 스레드, [1..N] = 워커
+    std::vector<Scoped<WorkStealingDeque>> deques;
+    std::vector<std::thread>               workers;
+
+    MPMCQueue<Job*, 4096> globalQueue;   // 스케줄러 외부 스레드에서 들어온 Job
+    MPMCQueue<Job*, 1024> mainThreadQueue;
+    MPMCQueue<Job*, 1024> freeJobs;      // 재사용할 Job 레코드
+
+    std::atomic<bool>  isRunning{false};
+    std::atomic<int32> pendingJobs{0};
+    std::atomic<int32> sleepingWorkers{0};
+
+    std::mutex              sleepMutex;
+    std::condition_variable sleepCondition;
+
+    // 대기 Job이 걸려 있는 카운터. Finalize에서 끝내 풀리지 않은 Job을 회수하는 데 쓴다.
+    // 잠금 순서: JobCounter::_mutex -> parkedMutex
+    std::mutex               parkedMutex;
+    std::vector<JobCounter*> parkedCounters;
+};
+
+JobSystemState* s_state = nullptr;
+
+thread_local uint32 s_threadIndex = s_invalidThreadIndex;
+thread_local uint32 s_stealSeed   = 0;
+
+HS_FORCEINLINE uint32 nextRandom()
+{
+    // xorshift32
+    uint32 x = s_stealSeed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_stealSeed = x;
+    return x;
+}
+
+void freeJob(Job* job)
+{
+    if (nullptr == s_state || false == s_state->freeJobs.TryPush(job))
+    {
+        delete job;
+    }
+}
+
+void pushReadyJob(Job* job);
+
+void addParkedCounter(JobCounter* counter)
+{
+    std::lock_guard<std::mutex> lock(s_state->parkedMutex);
+    s_state->parkedCounters.push_back(counter);
+}
+
+void removeParkedCounter(JobCounter* counter)
+{
+    std::lock_guard<std::mutex> lock(s_state->parkedMutex);
+    std::vector<JobCounter*>& counters = s_state->parkedCounters;
+    for (size_t i = 0; i < counters.size(); i++)
+    {
+        if (counters[i] == counter)
+        {
+            counters[i] = counters.back();
+            counters.pop_back();
+            return;
+        }
+    }
+}
+
+void runJob(Job* job)
+{
+    job->invoke(job);
+    job->destroy(job);
+
+    JobCounter* signal = job->signal;
+    freeJob(job);
+
+    if (nullptr != signal)
+    {
+        JobSystemInternal::FinishCounter(*signal);
+    }
+}
+
+void wakeWorkers()
+{
+    if (s_state->sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(s_state->sleepMutex);
+        s_state->sleepCondition.notify_one();
+    }
+}
+
+void pushReadyJob(Job* job)
+{
+    if (job->isMainThreadOnly)
+    {
+        while (false == s_state->mainThreadQueue.TryPush(job))
+        {
+            if (s_threadIndex == 0)
+            {
+                runJob(job); // 큐가 가득 찼고 이미 메인 스레드라면 바로 실행한다.
+                return;
+            }
+            std::this_thread::yield();
+        }
+        return;
+    }
+
+    s_state->pendingJobs.fetch_add(1, std::memory_order_seq_cst);
+
+    const uint32 index = s_threadIndex;
+    const bool pushed  = (index != s_invalidThreadIndex) ? s_state->deques[index]->Push(job) : s_state->globalQueue.TryPush(job);
+    if (false == pushed)
+    {
+        s_state->pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+        runJob(job);
+        return;
+    }
+
+    wakeWorkers();
+}
+
+Job* findJob(uint32 index)
+{
+    Job* job = nullptr;
+
+    if (index == 0 && s_state->mainThreadQueue.TryPop(job))
+    {
+        return job;
+    }
+
+    if (index != s_invalidThreadIndex)
+    {
+        job = s_state->deques[index]->Pop();
+        if (nullptr != job)
+        {
+            s_state->pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    if (s_state->globalQueue.TryPop(job))
+    {
+        s_state->pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    const uint32 dequeCount = static_cast<uint32>(s_state->deques.size());
+    const uint32 start      = nextRandom() % dequeCount;
+    for (uint32 i = 0; i < dequeCount; i++)
+    {
+        const uint32 victim = (start + i) % dequeCount;
+        if (victim == index)
+        {
+            continue;
+        }
+
+        job = s_state->deques[victim]->Steal();
+        if (nullptr != job)
+        {
+            s_state->pendingJobs.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void configureWorkerThread(std::thread& thread, uint32 workerIndex, bool pin)
+{
+#if defined(__linux__)
+    const std::string threadName = "HSWorker" + std::to_string(workerIndex);
+    pthread_setname_np(thread.native_handle(), threadName.c_str());
+
+    if (pin)
+    {
+        const uint32 cpuCount = std::thread::hardware_concurrency();
+        if (cpuCount > 0)
+        {
+            cpu_set_t cpuSet;
+            CPU_ZERO(&cpuSet);
+            CPU_SET(workerIndex % cpuCount, &cpuSet);
+            if (0 != pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet))
+            {
+                HS_LOG(warning, "JobSystem: failed to pin worker %u", workerIndex);
+            }
+        }
+    }
+#else
+    (void)thread;
+    (void)workerIndex;
+    if (pin)
+    {
+        HS_LOG(warning, "JobSystem: worker pinning is only supported on Linux");
+    }
+#endif
+}
+
+void workerMain(uint32 index)
+{
+    s_threadIndex = index;
+    s_stealSeed   = 0x9E3779B9u * (index + 1);
+
+    const std::string threadName = "Worker " + std::to_string(index);
+    Profiler::SetThreadName(threadName.c_str());
+
+    int32 idleSpins = 0;
+    while (s_state->isRunning.load(std::memory_order_acquire))
+    {
+        Job* job = findJob(index);
+        if (nullptr != job)
+        {
+            runJob(job);
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < s_spinCountBeforeSleep)
+        {
+            HS_CPU_PAUSE();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(s_state->sleepMutex);
+        s_state->sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        s_state->sleepCondition.wait_for(lock, std::chrono::milliseconds(10), []()
+        {
+            return s_state->pendingJobs.load(std::memory_order_seq_cst) > 0 || false == s_state->isRunning.load(std::memory_order_acquire);
+        });
+        s_state->sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+        idleSpins = 0;
+    }
+
+    s_threadIndex = s_invalidThreadIndex;
+}
+} // namespace
+
+JobCounter::~JobCounter()
+{
+    HS_ASSERT(_value.load(std::memory_order_acquire) == 0, "JobCounter destroyed while jobs are in flight");
+}
+
+void JobCounter::add(int32 count)
+{
+    _value.fetch_add(count, std::memory_order_acq_rel);
+}
+
+void JobCounter::finish()
+{
+    int32 value = _value.load(std::memory_order_relaxed);
+    while (value > 1)
+    {
+        if (_value.compare_exchange_weak(value, value - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+
+    // 마지막 Job. 0으로 만드는 것과 대기 Job 회수를 같은 락 안에서 처리해야
+    // Wait에서 깨어난 쪽이 카운터를 파괴해도 안전하다.
+    SmallVector<Job*, 4> waiters;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        int32 expected = 1;
+        if (false == _value.compare_exchange_strong(expected, 0, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            _value.fetch_sub(1, std::memory_order_acq_rel);
+            return;
+        }
+        if (false == _waiters.empty() && nullptr != s_state)
+        {
+            removeParkedCounter(this);
+        }
+        waiters = std::move(_waiters);
+        _waiters.clear();
+    }
+
+    for (Job* job : waiters)
+    {
+        pushReadyJob(job);
+    }
+}
+
+bool JobSystem::Initialize(const JobSystemConfig& config)
+{
+    if (nullptr != s_state)
+    {
+        HS_LOG(warning, "JobSystem is already initialized");
+        return true;
+    }
+
+    uint32 workerCount = config.workerCount;
+    if (workerCount == 0)
+    {
+        const uint32 hardwareThreads = std::thread::hardware_concurrency();
+        workerCount                  = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+    }
+
+    s_state              = new JobSystemState();
+    s_state->workerCount = workerCount;
+    s_state->isRunning.store(true, std::memory_order_release);
+
+    s_state->deques.reserve(workerCount + 1);
+    for (uint32 i = 0; i < workerCount + 1; i++)
+    {
+        s_state->deques.push_back(MakeScoped<WorkStealingDeque>());
+    }
+
+    s_threadIndex = 0;
+    s_stealSeed   = 0x9E3779B9u;
+
+    s_state->workers.reserve(workerCount);
+    for (uint32 i = 1; i <= workerCount; i++)
+    {
+        s_state->workers.emplace_back(workerMain, i);
+        configureWorkerThread(s_state->workers.back(), i, config.pinWorkerThreads);
+    }
+
+    HS_LOG(info, "JobSystem initialized with %u workers", workerCount);
+    return true;
+}
+
+void JobSystem::Finalize()
+{
+    if (nullptr == s_state)
+    {
+        return;
+    }
+
+    // 남은 Job을 모두 실행한 뒤 워커를 정지한다.
+    while (Job* job = findJob(s_threadIndex))
+    {
+        runJob(job);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_state->sleepMutex);
+        s_state->isRunning.store(false, std::memory_order_release);
+    }
+    s_state->sleepCondition.notify_all();
+
+    for (auto& worker : s_state->workers)
+    {
+        worker.join();
+    }
+
+    // 워커가 마지막으로 넣은 Job과 카운터에 걸려 대기 중인 Job을 메인 스레드에서 마저 실행한다.
+    // 여기까지 남은 대기 Job은 의존 카운터가 끝내 0이 되지 않는 경우(순환 등)이므로 순서는 지킬 수 없지만,
+    // 버리면 Job 레코드와 캡처한 상태가 새고 signal 카운터를 기다리는 쪽이 멈춘다.
+    uint32 parkedJobCount = 0;
+    for (;;)
+    {
+        while (Job* job = findJob(s_threadIndex))
+        {
+            runJob(job);
+        }
+
+        JobCounter* counter = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(s_state->parkedMutex);
+            if (s_state->parkedCounters.empty())
+            {
+                break;
+            }
+            counter = s_state->parkedCounters.back();
+            s_state->parkedCounters.pop_back();
+        }
+
+        SmallVector<Job*, 4> waiters;
+        {
+            std::lock_guard<std::mutex> lock(counter->_mutex);
+            waiters = std::move(counter->_waiters);
+            counter->_waiters.clear();
+        }
+
+        for (Job* job : waiters)
+        {
+            parkedJobCount++;
+            runJob(job);
+        }
+    }
+
+    if (parkedJobCount > 0)
+    {
+        HS_LOG(warning, "JobSystem: ran %u jobs whose dependency never finished", parkedJobCount);
+    }
+
+    JobSystemState* state = s_state;
+    s_state               = nullptr;
+    Job* job              = nullptr;
+    while (state->freeJobs.TryPop(job))
+    {
+        delete job;
+    }
+    delete state;
+
+    s_threadIndex = s_invalidThreadIndex;
+}
+
+bool JobSystem::IsInitialized()
+{
+    return nullptr != s_state;
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    if (nullptr == s_state)
+    {
+        HS_ASSERT(counter.IsDone(), "JobSystem is not initialized");
+        return;
+    }
+
+    const uint32 index = s_threadIndex;
+    while (false == counter.IsDone())
+    {
+        Job* job = findJob(index);
+        if (nullptr != job)
+        {
+            runJob(job);
+        }
+        else
+        {
+            HS_CPU_PAUSE();
+        }
+    }
+
+    // finish()가 락을 놓을 때까지 기다린 뒤 돌아가야 호출자가 카운터를 파괴할 수 있다.
+    std::lock_guard<std::mutex> lock(counter._mutex);
+}
+
+void JobSystem::ProcessMainThreadJobs()
+{
+    if (nullptr == s_state)
+    {
+        return;
+    }
+    HS_ASSERT(IsMainThread(), "ProcessMainThreadJobs must be called on the main thread");
+
+    Job* job = nullptr;
+    while (s_state->mainThreadQueue.TryPop(job))
+    {
+        runJob(job);
+    }
+}
+
+uint32 JobSystem::GetWorkerCount()
+{
+    return (nullptr != s_state) ? s_state->workerCount : 0;
+}
+
+uint32 JobSystem::GetThreadCount()
+{
+    return GetWorkerCount() + 1;
+}
+
+uint32 JobSystem::GetCurrentThreadIndex()
+{
+    return s_threadIndex;
+}
+
+bool JobSystem::IsMainThread()
+{
+    return s_threadIndex == 0;
+}
+
+Job* JobSystem::allocateJob()
+{
+    Job* job = nullptr;
+    if (nullptr != s_state && s_state->freeJobs.TryPop(job))
+    {
+        return job;
+    }
+    return new Job();
+}
+
+void JobSystem::submit(Job* job, JobCounter* dependency)
+{
+    if (nullptr == s_state)
+    {
+        // 초기화 전에는 즉시 실행한다.
+        if (nullptr != job->signal)
+        {
+            job->signal->add(1);
+        }
+        runJob(job);
+        return;
+    }
+
+    if (nullptr != job->signal)
+    {
+        job->signal->add(1);
+    }
+
+    if (nullptr != dependency)
+    {
+        std::lock_guard<std::mutex> lock(dependency->_mutex);
+        if (dependency->_value.load(std::memory_order_acquire) != 0)
+        {
+            if (dependency->_waiters.empty())
+            {
+                addParkedCounter(dependency);
+            }
+            dependency->_waiters.push_back(job);
+            return;
+        }
+    }
+
+    pushReadyJob(job);
+}
+
+HS_NS_END
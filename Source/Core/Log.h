@@ -11,12 +11,37 @@
 #include "Precompile.h"
 #include "Core/Exception.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <cstdarg>
 #include <stdexcept>
 
+// HS_LOG_MIN_LEVEL보다 낮은 레벨의 HS_LOG는 컴파일 시 제거된다. (인자도 평가되지 않는다)
+#define HS_LOG_LEVEL_DEBUG   0
+#define HS_LOG_LEVEL_INFO    1
+#define HS_LOG_LEVEL_WARNING 2
+#define HS_LOG_LEVEL_ERROR   3
+#define HS_LOG_LEVEL_CRASH   4
+
+#ifndef HS_LOG_MIN_LEVEL
+#ifdef _DEBUG
+#define HS_LOG_MIN_LEVEL HS_LOG_LEVEL_DEBUG
+#else
+#define HS_LOG_MIN_LEVEL HS_LOG_LEVEL_INFO
+#endif
+#endif
+
+// 호출 위치 하나당 1초에 출력할 수 있는 최대 로그 수. 0이면 제한하지 않는다.
+#ifndef HS_LOG_RATE_LIMIT
+#define HS_LOG_RATE_LIMIT 64
+#endif
+
 HS_NS_BEGIN
 
+// Log::Initialize 이후에는 호출 스레드에서 메시지를 링 버퍼에 포맷만 하고,
+// 콘솔/파일 출력은 백그라운드 스레드가 모아서 처리한다.
+// Initialize 전이나 Finalize 후에는 호출 스레드에서 바로 출력한다.
 class HS_API Log
 {
 public:
@@ -30,10 +55,70 @@ public:
         LOG_ASSERT
     };
 
+    // filePath가 nullptr이면 파일로는 기록하지 않는다.
+    static void Initialize(const char* filePath = nullptr);
+    static void Finalize();
+
+    // 지금까지 요청된 로그가 모두 기록될 때까지 기다린다.
+    static void Flush();
+
     static void Print(const char* file, const uint32 line, const Log::EType type, const char* fmt, ...);
+    static void Print(const char* file, const uint32 line, const Log::EType type, const uint32 suppressedCount, const char* fmt, ...);
+
+    static constexpr int32 GetLevel(const EType type)
+    {
+        switch (type)
+        {
+            case EType::LOG_DEBUG:   return HS_LOG_LEVEL_DEBUG;
+            case EType::LOG_INFO:    return HS_LOG_LEVEL_INFO;
+            case EType::LOG_WARNING: return HS_LOG_LEVEL_WARNING;
+            case EType::LOG_ERROR:   return HS_LOG_LEVEL_ERROR;
+            default:                 return HS_LOG_LEVEL_CRASH;
+        }
+    }
+
+    static constexpr bool IsEnabled(const EType type) { return GetLevel(type) >= HS_LOG_MIN_LEVEL; }
+
+private:
+    static void submit(const char* file, const uint32 line, const Log::EType type, const uint32 suppressedCount, const char* fmt, va_list ptr);
+};
+
+// HS_LOG 호출 위치마다 하나씩 생기는 정적 객체. 1초 단위 창에서 HS_LOG_RATE_LIMIT개를 넘는 로그는 버리고,
+// 버린 개수는 다음에 출력되는 로그에 함께 표시한다.
+class LogRateLimiter
+{
+public:
+    constexpr LogRateLimiter() = default;
+
+    HS_FORCEINLINE bool TryAcquire(uint32& outSuppressedCount)
+    {
+#if HS_LOG_RATE_LIMIT > 0
+        const uint32 window = static_cast<uint32>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+
+        uint32 lastWindow = _window.load(std::memory_order_relaxed);
+        if (lastWindow != window && _window.compare_exchange_strong(lastWindow, window, std::memory_order_relaxed))
+        {
+            _count.store(0, std::memory_order_relaxed);
+        }
+
+        if (_count.fetch_add(1, std::memory_order_relaxed) >= HS_LOG_RATE_LIMIT)
+        {
+            _suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        outSuppressedCount = (_suppressed.load(std::memory_order_relaxed) != 0) ? _suppressed.exchange(0, std::memory_order_relaxed) : 0;
+        return true;
+#else
+        outSuppressedCount = 0;
+        return true;
+#endif
+    }
 
 private:
-    static void print(const char* file, const uint32 line, const char* start, const char* tag, const char* end, const char* fmt, va_list ptr);
+    std::atomic<uint32> _window{0};
+    std::atomic<uint32> _count{0};
+    std::atomic<uint32> _suppressed{0};
 };
 
 namespace LogSymbol
@@ -45,14 +130,22 @@ namespace LogSymbol
     constexpr static Log::EType crash = Log::EType::LOG_CRASH;
 };
 
-#define HS_LOG(symbol, fmt, ...)                                                       \
-    do                                                                                 \
-    {                                                                                  \
-        hs::Log::Print(__FILE__, __LINE__, hs::LogSymbol::symbol, fmt, ##__VA_ARGS__); \
-        if (hs::LogSymbol::symbol == hs::Log::EType::LOG_CRASH)                             \
-        {                                                                              \
-            HS_DEBUG_BREAK();                                                          \
-        }                                                                              \
+#define HS_LOG(symbol, fmt, ...)                                                                                  \
+    do                                                                                                            \
+    {                                                                                                             \
+        if constexpr (hs::Log::IsEnabled(hs::LogSymbol::symbol))                                                  \
+        {                                                                                                         \
+            static hs::LogRateLimiter hsLogRateLimiter;                                                           \
+            uint32 hsLogSuppressed = 0;                                                                           \
+            if (hs::LogSymbol::symbol == hs::Log::EType::LOG_CRASH || hsLogRateLimiter.TryAcquire(hsLogSuppressed)) \
+            {                                                                                                     \
+                hs::Log::Print(__FILE__, __LINE__, hs::LogSymbol::symbol, hsLogSuppressed, fmt, ##__VA_ARGS__);   \
+            }                                                                                                     \
+        }                                                                                                         \
+        if (hs::LogSymbol::symbol == hs::Log::EType::LOG_CRASH)                                                   \
+        {                                                                                                         \
+            HS_DEBUG_BREAK();                                                                                     \
+        }                                                                                                         \
     } while (0)
 
 #ifdef _DEBUG
@@ -0,0 +1,459 @@
+//
+//  SimdMath.cpp
+//  Core
+//
+//  Batch math kernels on top of the SIMD layer
+//
+#include "Core/Math/SimdMath.h"
+#include "Core/HAL/Simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+HS_NS_BEGIN
+
+namespace
+{
+static_assert(sizeof(glm::vec3) == sizeof(float) * 3, "glm::vec3 must be tightly packed");
+static_assert(sizeof(glm::mat4) == sizeof(float) * 16, "glm::mat4 must be tightly packed");
+
+HS_FORCEINLINE simd::Float4 load3(const glm::vec3& v)
+{
+    return simd::Set4(v.x, v.y, v.z, 0.0f);
+}
+
+HS_FORCEINLINE void store3(glm::vec3& out, simd::Float4 v)
+{
+    float values[4];
+    simd::Store4(values, v);
+    ::memcpy(&out, values, sizeof(glm::vec3));
+}
+
+// 열 우선 행렬 곱: result.col[j] = sum_k L.col[k] * R[j][k]
+HS_FORCEINLINE void multiply(const simd::Float4 l[4], const glm::mat4& rhs, glm::mat4& out)
+{
+    simd::Float4 result[4];
+    for (int j = 0; j < 4; j++)
+    {
+        const simd::Float4 r = simd::Load4(&rhs[j][0]);
+        simd::Float4 col     = simd::Mul(l[0], simd::SplatX(r));
+        col                  = simd::MulAdd(l[1], simd::SplatY(r), col);
+        col                  = simd::MulAdd(l[2], simd::SplatZ(r), col);
+        col                  = simd::MulAdd(l[3], simd::SplatW(r), col);
+        result[j]            = col;
+    }
+
+    // rhs와 out이 같아도 되도록 모두 계산한 뒤 기록한다.
+    for (int j = 0; j < 4; j++)
+    {
+        simd::Store4(&out[j][0], result[j]);
+    }
+}
+
+HS_FORCEINLINE void load_columns(const glm::mat4& matrix, simd::Float4 outColumns[4])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        outColumns[i] = simd::Load4(&matrix[i][0]);
+    }
+}
+
+HS_FORCEINLINE bool is_sphere_visible(const glm::vec4* planes, uint32 planeCount, float x, float y, float z, float radius)
+{
+    for (uint32 p = 0; p < planeCount; p++)
+    {
+        const glm::vec4& plane = planes[p];
+        // SIMD 경로와 같은 순서로 더한다.
+        const float distance = ((plane.x * x + plane.w) + plane.y * y) + plane.z * z;
+        if (distance + radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+HS_FORCEINLINE bool is_aabb_visible(const glm::vec4* planes, uint32 planeCount, float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    for (uint32 p = 0; p < planeCount; p++)
+    {
+        const glm::vec4& plane = planes[p];
+        const float distance   = ((plane.x * cx + plane.w) + plane.y * cy) + plane.z * cz;
+        const float radius     = (std::fabs(plane.x) * ex + std::fabs(plane.y) * ey) + std::fabs(plane.z) * ez;
+        if (distance + radius < 0.0f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+HS_FORCEINLINE uint32 write_visibility(uint32 outsideMask, uint8* outVisible)
+{
+    uint32 visibleCount = 0;
+    for (uint32 lane = 0; lane < simd::SIMD_WIDTH; lane++)
+    {
+        const uint8 isVisible = ((outsideMask >> lane) & 1u) ? 0 : 1;
+        outVisible[lane]      = isVisible;
+        visibleCount += isVisible;
+    }
+    return visibleCount;
+}
+} // namespace
+
+void SimdMath::MultiplyMatrices(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        simd::Float4 l[4];
+        load_columns(lhs[i], l);
+        multiply(l, rhs[i], outMatrices[i]);
+    }
+}
+
+void SimdMath::MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count)
+{
+    simd::Float4 l[4];
+    load_columns(lhs, l);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        multiply(l, rhs[i], outMatrices[i]);
+    }
+}
+
+void SimdMath::TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* outPoints, size_t count)
+{
+    simd::Float4 m[4];
+    load_columns(matrix, m);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const simd::Float4 p = load3(points[i]);
+        simd::Float4 result  = simd::MulAdd(m[0], simd::SplatX(p), m[3]);
+        result               = simd::MulAdd(m[1], simd::SplatY(p), result);
+        result               = simd::MulAdd(m[2], simd::SplatZ(p), result);
+        store3(outPoints[i], result);
+    }
+}
+
+// Arvo: 중심은 그대로 변환하고, 반지름은 |M| (회전/스케일 부분의 절댓값)로 변환한다.
+void SimdMath::TransformAABBs(const glm::mat4& matrix, const glm::vec3* mins, const glm::vec3* maxs, glm::vec3* outMins, glm::vec3* outMaxs, size_t count)
+{
+    simd::Float4 m[4];
+    load_columns(matrix, m);
+
+    const simd::Float4 absM[3] = {simd::Abs(m[0]), simd::Abs(m[1]), simd::Abs(m[2])};
+    const simd::Float4 half    = simd::Splat4(0.5f);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const simd::Float4 boxMin = load3(mins[i]);
+        const simd::Float4 boxMax = load3(maxs[i]);
+        const simd::Float4 center = simd::Mul(simd::Add(boxMin, boxMax), half);
+        const simd::Float4 extent = simd::Mul(simd::Sub(boxMax, boxMin), half);
+
+        simd::Float4 newCenter = simd::MulAdd(m[0], simd::SplatX(center), m[3]);
+        newCenter              = simd::MulAdd(m[1], simd::SplatY(center), newCenter);
+        newCenter              = simd::MulAdd(m[2], simd::SplatZ(center), newCenter);
+
+        simd::Float4 newExtent = simd::Mul(absM[0], simd::SplatX(extent));
+        newExtent              = simd::MulAdd(absM[1], simd::SplatY(extent), newExtent);
+        newExtent              = simd::MulAdd(absM[2], simd::SplatZ(extent), newExtent);
+
+        store3(outMins[i], simd::Sub(newCenter, newExtent));
+        store3(outMaxs[i], simd::Add(newCenter, newExtent));
+    }
+}
+
+uint32 SimdMath::CullAABBs(const glm::vec4* planes, uint32 planeCount, const AABBSoA& boxes, size_t count, uint8* outVisible)
+{
+    constexpr size_t width = simd::SIMD_WIDTH;
+
+    const simd::FloatN zero = simd::SplatN(0.0f);
+    uint32 visibleCount     = 0;
+    size_t i                = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        const simd::FloatN cx = simd::LoadN(boxes.centerX + i);
+        const simd::FloatN cy = simd::LoadN(boxes.centerY + i);
+        const simd::FloatN cz = simd::LoadN(boxes.centerZ + i);
+        const simd::FloatN ex = simd::LoadN(boxes.extentX + i);
+        const simd::FloatN ey = simd::LoadN(boxes.extentY + i);
+        const simd::FloatN ez = simd::LoadN(boxes.extentZ + i);
+
+        uint32 outsideMask = 0;
+        for (uint32 p = 0; p < planeCount && outsideMask != (1u << width) - 1; p++)
+        {
+            const glm::vec4& plane = planes[p];
+
+            simd::FloatN distance = simd::MulAdd(simd::SplatN(plane.x), cx, simd::SplatN(plane.w));
+            distance              = simd::MulAdd(simd::SplatN(plane.y), cy, distance);
+            distance              = simd::MulAdd(simd::SplatN(plane.z), cz, distance);
+
+            simd::FloatN radius = simd::Mul(simd::SplatN(std::fabs(plane.x)), ex);
+            radius              = simd::MulAdd(simd::SplatN(std::fabs(plane.y)), ey, radius);
+            radius              = simd::MulAdd(simd::SplatN(std::fabs(plane.z)), ez, radius);
+
+            outsideMask |= simd::MoveMask(simd::CmpLt(simd::Add(distance, radius), zero));
+        }
+
+        visibleCount += write_visibility(outsideMask, outVisible + i);
+    }
+
+    for (; i < count; i++)
+    {
+        const bool isVisible = is_aabb_visible(planes, planeCount, boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i], boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]);
+        outVisible[i]        = isVisible ? 1 : 0;
+        visibleCount += isVisible ? 1 : 0;
+    }
+
+    return visibleCount;
+}
+
+uint32 SimdMath::CullSpheres(const glm::vec4* planes, uint32 planeCount, const SphereSoA& spheres, size_t count, uint8* outVisible)
+{
+    constexpr size_t width = simd::SIMD_WIDTH;
+
+    const simd::FloatN zero = simd::SplatN(0.0f);
+    uint32 visibleCount     = 0;
+    size_t i                = 0;
+
+    for (; i + width <= count; i += width)
+    {
+        const simd::FloatN cx     = simd::LoadN(spheres.centerX + i);
+        const simd::FloatN cy     = simd::LoadN(spheres.centerY + i);
+        const simd::FloatN cz     = simd::LoadN(spheres.centerZ + i);
+        const simd::FloatN radius = simd::LoadN(spheres.radius + i);
+
+        uint32 outsideMask = 0;
+        for (uint32 p = 0; p < planeCount && outsideMask != (1u << width) - 1; p++)
+        {
+            const glm::vec4& plane = planes[p];
+
+            simd::FloatN distance = simd::MulAdd(simd::SplatN(plane.x), cx, simd::SplatN(plane.w));
+            distance              = simd::MulAdd(simd::SplatN(plane.y), cy, distance);
+            distance              = simd::MulAdd(simd::SplatN(plane.z), cz, distance);
+
+            outsideMask |= simd::MoveMask(simd::CmpLt(simd::Add(distance, radius), zero));
+        }
+
+        visibleCount += write_visibility(outsideMask, outVisible + i);
+    }
+
+    for (; i < count; i++)
+    {
+        const bool isVisible = is_sphere_visible(planes, planeCount, spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i], spheres.radius[i]);
+        outVisible[i]        = isVisible ? 1 : 0;
+        visibleCount += isVisible ? 1 : 0;
+    }
+
+    return visibleCount;
+}
+
+void SimdMath::MinMax(const float* values, size_t count, float& outMin, float& outMax)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    constexpr size_t width = simd::SIMD_WIDTH;
+
+    float minValue = values[0];
+    float maxValue = values[0];
+    size_t i       = 0;
+
+    if (count >= width)
+    {
+        simd::FloatN minN = simd::LoadN(values);
+        simd::FloatN maxN = minN;
+        for (i = width; i + width <= count; i += width)
+        {
+            const simd::FloatN v = simd::LoadN(values + i);
+            minN                 = simd::Min(minN, v);
+            maxN                 = simd::Max(maxN, v);
+        }
+
+        minValue = simd::HorizontalMin(minN);
+        maxValue = simd::HorizontalMax(maxN);
+    }
+
+    for (; i < count; i++)
+    {
+        minValue = std::min(minValue, values[i]);
+        maxValue = std::max(maxValue, values[i]);
+    }
+
+    outMin = minValue;
+    outMax = maxValue;
+}
+
+// 점 4개(float 12개)를 레지스터 3개로 읽는다. lane마다 담긴 축이 고정되어 있으므로
+// 레지스터별로 min/max를 모은 뒤 마지막에 축끼리 합친다.
+//   a = (x0 y0 z0 x1), b = (y1 z1 x2 y2), c = (z2 x3 y3 z3)
+void SimdMath::MinMax(const glm::vec3* points, size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    glm::vec3 minValue = points[0];
+    glm::vec3 maxValue = points[0];
+    size_t i           = 0;
+
+    if (count >= 4)
+    {
+        const float* data = &points[0].x;
+
+        simd::Float4 minA = simd::Load4(data + 0);
+        simd::Float4 minB = simd::Load4(data + 4);
+        simd::Float4 minC = simd::Load4(data + 8);
+        simd::Float4 maxA = minA;
+        simd::Float4 maxB = minB;
+        simd::Float4 maxC = minC;
+
+        for (i = 4; i + 4 <= count; i += 4)
+        {
+            const float* p       = data + i * 3;
+            const simd::Float4 a = simd::Load4(p + 0);
+            const simd::Float4 b = simd::Load4(p + 4);
+            const simd::Float4 c = simd::Load4(p + 8);
+
+            minA = simd::Min(minA, a);
+            minB = simd::Min(minB, b);
+            minC = simd::Min(minC, c);
+            maxA = simd::Max(maxA, a);
+            maxB = simd::Max(maxB, b);
+            maxC = simd::Max(maxC, c);
+        }
+
+        float lo[12];
+        float hi[12];
+        simd::Store4(lo + 0, minA);
+        simd::Store4(lo + 4, minB);
+        simd::Store4(lo + 8, minC);
+        simd::Store4(hi + 0, maxA);
+        simd::Store4(hi + 4, maxB);
+        simd::Store4(hi + 8, maxC);
+
+        // lo[k]는 축 k % 3의 값이다.
+        for (int k = 0; k < 12; k++)
+        {
+            minValue[k % 3] = std::min(minValue[k % 3], lo[k]);
+            maxValue[k % 3] = std::max(maxValue[k % 3], hi[k]);
+        }
+    }
+
+    for (; i < count; i++)
+    {
+        minValue = glm::min(minValue, points[i]);
+        maxValue = glm::max(maxValue, points[i]);
+    }
+
+    outMin = minValue;
+    outMax = maxValue;
+}
+
+void SimdMathReference::MultiplyMatrices(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        outMatrices[i] = lhs[i] * rhs[i];
+    }
+}
+
+void SimdMathReference::MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        outMatrices[i] = lhs * rhs[i];
+    }
+}
+
+void SimdMathReference::TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* outPoints, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        outPoints[i] = glm::vec3(matrix * glm::vec4(points[i], 1.0f));
+    }
+}
+
+void SimdMathReference::TransformAABBs(const glm::mat4& matrix, const glm::vec3* mins, const glm::vec3* maxs, glm::vec3* outMins, glm::vec3* outMaxs, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        // 여덟 꼭짓점을 모두 변환해서 감싼다.
+        const glm::vec3 boxMin = mins[i];
+        const glm::vec3 boxMax = maxs[i];
+
+        glm::vec3 newMin(HS_FLT_MIN);
+        glm::vec3 newMax(HS_FLT_MAX);
+        for (int corner = 0; corner < 8; corner++)
+        {
+            const glm::vec3 p((corner & 1) ? boxMax.x : boxMin.x, (corner & 2) ? boxMax.y : boxMin.y, (corner & 4) ? boxMax.z : boxMin.z);
+            const glm::vec3 transformed = glm::vec3(matrix * glm::vec4(p, 1.0f));
+            newMin                      = glm::min(newMin, transformed);
+            newMax                      = glm::max(newMax, transformed);
+        }
+
+        outMins[i] = newMin;
+        outMaxs[i] = newMax;
+    }
+}
+
+uint32 SimdMathReference::CullAABBs(const glm::vec4* planes, uint32 planeCount, const AABBSoA& boxes, size_t count, uint8* outVisible)
+{
+    uint32 visibleCount = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const bool isVisible = is_aabb_visible(planes, planeCount, boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i], boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]);
+        outVisible[i]        = isVisible ? 1 : 0;
+        visibleCount += isVisible ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+uint32 SimdMathReference::CullSpheres(const glm::vec4* planes, uint32 planeCount, const SphereSoA& spheres, size_t count, uint8* outVisible)
+{
+    uint32 visibleCount = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const bool isVisible = is_sphere_visible(planes, planeCount, spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i], spheres.radius[i]);
+        outVisible[i]        = isVisible ? 1 : 0;
+        visibleCount += isVisible ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+void SimdMathReference::MinMax(const float* values, size_t count, float& outMin, float& outMax)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    outMin = *std::min_element(values, values + count);
+    outMax = *std::max_element(values, values + count);
+}
+
+void SimdMathReference::MinMax(const glm::vec3* points, size_t count, glm::vec3& outMin, glm::vec3& outMax)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    outMin = points[0];
+    outMax = points[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        outMin = glm::min(outMin, points[i]);
+        outMax = glm::max(outMax, points[i]);
+    }
+}
+
+HS_NS_END
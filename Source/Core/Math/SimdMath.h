@@ -0,0 +1,77 @@
+//
+//  SimdMath.h
+//  Core
+//
+//  Batch math kernels on top of the SIMD layer
+//
+#ifndef __HS_SIMD_MATH_H__
+#define __HS_SIMD_MATH_H__
+
+#include "Precompile.h"
+
+#include "Core/Math/Common.h"
+
+HS_NS_BEGIN
+
+// 컬링 입력. 배열마다 count개의 값이 있다.
+struct AABBSoA
+{
+    const float* centerX;
+    const float* centerY;
+    const float* centerZ;
+    const float* extentX;
+    const float* extentY;
+    const float* extentZ;
+};
+
+struct SphereSoA
+{
+    const float* centerX;
+    const float* centerY;
+    const float* centerZ;
+    const float* radius;
+};
+
+// 평면은 (normal, d)이고 dot(normal, p) + d >= 0인 쪽이 안쪽이다.
+// 출력 배열은 입력과 겹쳐도 된다. (TransformPoints, TransformAABBs, MultiplyMatrices)
+class HS_API SimdMath
+{
+public:
+    // outMatrices[i] = lhs[i] * rhs[i]
+    static void MultiplyMatrices(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count);
+    // outMatrices[i] = lhs * rhs[i]
+    static void MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count);
+
+    static void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* outPoints, size_t count);
+    // 변환한 박스를 다시 감싸는 축 정렬 박스
+    static void TransformAABBs(const glm::mat4& matrix, const glm::vec3* mins, const glm::vec3* maxs, glm::vec3* outMins, glm::vec3* outMaxs, size_t count);
+
+    // outVisible[i]는 모든 평면의 안쪽에 걸쳐 있으면 1, 아니면 0. 보이는 개수를 돌려준다.
+    static uint32 CullAABBs(const glm::vec4* planes, uint32 planeCount, const AABBSoA& boxes, size_t count, uint8* outVisible);
+    static uint32 CullSpheres(const glm::vec4* planes, uint32 planeCount, const SphereSoA& spheres, size_t count, uint8* outVisible);
+
+    // count가 0이면 out 값을 바꾸지 않는다.
+    static void MinMax(const float* values, size_t count, float& outMin, float& outMax);
+    static void MinMax(const glm::vec3* points, size_t count, glm::vec3& outMin, glm::vec3& outMax);
+};
+
+// SimdMath와 같은 결과를 내는 스칼라 구현. 검증과 벤치마크의 기준으로 쓴다.
+class HS_API SimdMathReference
+{
+public:
+    static void MultiplyMatrices(const glm::mat4* lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count);
+    static void MultiplyMatrices(const glm::mat4& lhs, const glm::mat4* rhs, glm::mat4* outMatrices, size_t count);
+
+    static void TransformPoints(const glm::mat4& matrix, const glm::vec3* points, glm::vec3* outPoints, size_t count);
+    static void TransformAABBs(const glm::mat4& matrix, const glm::vec3* mins, const glm::vec3* maxs, glm::vec3* outMins, glm::vec3* outMaxs, size_t count);
+
+    static uint32 CullAABBs(const glm::vec4* planes, uint32 planeCount, const AABBSoA& boxes, size_t count, uint8* outVisible);
+    static uint32 CullSpheres(const glm::vec4* planes, uint32 planeCount, const SphereSoA& spheres, size_t count, uint8* outVisible);
+
+    static void MinMax(const float* values, size_t count, float& outMin, float& outMax);
+    static void MinMax(const glm::vec3* points, size_t count, glm::vec3& outMin, glm::vec3& outMax);
+};
+
+HS_NS_END
+
+#endif /* __HS_SIMD_MATH_H__ */
@@ -0,0 +1,285 @@
+//
+//  HandlePool.h
+//  Core
+//
+//  Dense per-type slot pool addressed by 32-bit generational handles
+//
+#ifndef __HS_HANDLE_POOL_H__
+#define __HS_HANDLE_POOL_H__
+
+#include "Precompile.h"
+#include "Core/Log.h"
+#include "Core/Memory/MemoryPool.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+
+HS_NS_BEGIN
+
+// 핸들 = [generation:16 | index:16]. generation은 1부터 시작하므로 0은 항상 무효 핸들이다.
+// 슬롯은 청크 단위로 할당되어 주소가 고정되며, 반환된 슬롯은 free list로 재사용된다.
+// Create/Destroy는 내부 뮤텍스로 보호되고, Get/IsAlive는 lock-free로 stale 여부를 O(1)에 판별한다.
+template <typename T, uint32 ChunkSize = 256>
+class HandlePool
+{
+public:
+    using Handle = uint32;
+
+    static constexpr Handle INVALID_HANDLE  = 0;
+    static constexpr uint32 INDEX_BITS      = 16;
+    static constexpr uint32 INDEX_MASK      = (1u << INDEX_BITS) - 1;
+    static constexpr uint32 MAX_SLOT_COUNT  = 1u << INDEX_BITS;
+    static constexpr uint32 MAX_CHUNK_COUNT = MAX_SLOT_COUNT / ChunkSize;
+
+    static_assert((ChunkSize & (ChunkSize - 1)) == 0, "ChunkSize must be power of two");
+    static_assert(ChunkSize <= MAX_SLOT_COUNT, "ChunkSize is too large");
+
+    HandlePool()
+        : _chunkCount(0)
+        , _freeHead(INVALID_INDEX)
+        , _liveCount(0)
+    {
+        for (auto& chunk : _chunks)
+        {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~HandlePool()
+    {
+        Clear();
+        for (uint32 i = 0; i < _chunkCount; i++)
+        {
+            MemoryUtils::AlignedFree(_chunks[i].load(std::memory_order_relaxed));
+        }
+    }
+
+    HandlePool(const HandlePool&)            = delete;
+    HandlePool& operator=(const HandlePool&) = delete;
+
+    template <typename... Args>
+    T* Create(Handle& outHandle, Args&&... args)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_freeHead == INVALID_INDEX && false == growChunk())
+        {
+            HS_LOG(error, "HandlePool is full (%u slots)", MAX_SLOT_COUNT);
+            outHandle = INVALID_HANDLE;
+            return nullptr;
+        }
+
+        const uint32 index = _freeHead;
+        Slot& slot         = slotAt(index);
+        _freeHead          = slot.nextFree;
+
+        T* object     = new (slot.storage) T(std::forward<Args>(args)...);
+        slot.nextFree = INVALID_INDEX;
+        slot.isAlive  = true;
+        _liveCount++;
+
+        outHandle = makeHandle(index, slot.generation.load(std::memory_order_relaxed));
+        return object;
+    }
+
+    bool Destroy(Handle handle)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        Slot* slot = resolve(handle);
+        if (nullptr == slot)
+        {
+            HS_LOG(warning, "HandlePool: stale or invalid handle 0x%08x", handle);
+            return false;
+        }
+
+        reinterpret_cast<T*>(slot->storage)->~T();
+        slot->isAlive = false;
+
+        bumpGeneration(*slot);
+
+        slot->nextFree = _freeHead;
+        _freeHead      = getIndex(handle);
+        _liveCount--;
+
+        return true;
+    }
+
+    HS_FORCEINLINE T* Get(Handle handle) const
+    {
+        Slot* slot = resolve(handle);
+        return slot ? reinterpret_cast<T*>(slot->storage) : nullptr;
+    }
+
+    HS_FORCEINLINE bool IsAlive(Handle handle) const { return nullptr != resolve(handle); }
+
+    // 객체 주소로 살아있는 슬롯의 핸들을 찾는다. 객체 메모리는 읽지 않으므로 이미 반환된 포인터를 넘겨도 안전하다.
+    // 풀에 속하지 않은 주소이거나 슬롯이 비어 있으면 INVALID_HANDLE
+    Handle FindHandle(const T* object)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        const uintptr_t address = reinterpret_cast<uintptr_t>(object);
+        for (uint32 c = 0; c < _chunkCount; c++)
+        {
+            Slot* chunk           = _chunks[c].load(std::memory_order_relaxed);
+            const uintptr_t begin = reinterpret_cast<uintptr_t>(chunk);
+            if (address < begin || address >= begin + sizeof(Slot) * ChunkSize)
+            {
+                continue;
+            }
+
+            const uintptr_t offset = address - begin;
+            if (offset % sizeof(Slot) != 0)
+            {
+                return INVALID_HANDLE;
+            }
+
+            const uint32 i = static_cast<uint32>(offset / sizeof(Slot));
+            if (false == chunk[i].isAlive)
+            {
+                return INVALID_HANDLE;
+            }
+            return makeHandle(c * ChunkSize + i, chunk[i].generation.load(std::memory_order_relaxed));
+        }
+
+        return INVALID_HANDLE;
+    }
+
+    // 살아있는 슬롯을 인덱스 순서대로 순회한다. 순회 중 Create/Destroy 호출은 허용되지 않는다.
+    template <typename Fn>
+    void ForEach(Fn&& fn)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        for (uint32 c = 0; c < _chunkCount; c++)
+        {
+            Slot* chunk = _chunks[c].load(std::memory_order_relaxed);
+            for (uint32 i = 0; i < ChunkSize; i++)
+            {
+                if (chunk[i].isAlive)
+                {
+                    fn(*reinterpret_cast<T*>(chunk[i].storage));
+                }
+            }
+        }
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _freeHead = INVALID_INDEX;
+        for (uint32 c = _chunkCount; c-- > 0;)
+        {
+            Slot* chunk = _chunks[c].load(std::memory_order_relaxed);
+            for (uint32 i = ChunkSize; i-- > 0;)
+            {
+                Slot& slot = chunk[i];
+                if (slot.isAlive)
+                {
+                    reinterpret_cast<T*>(slot.storage)->~T();
+                    slot.isAlive = false;
+                    bumpGeneration(slot);
+                }
+                slot.nextFree = _freeHead;
+                _freeHead     = c * ChunkSize + i;
+            }
+        }
+        _liveCount = 0;
+    }
+
+    HS_FORCEINLINE uint32 GetLiveCount() const { return _liveCount; }
+    HS_FORCEINLINE uint32 GetCapacity() const { return _chunkCount * ChunkSize; }
+
+    static HS_FORCEINLINE uint32 GetIndex(Handle handle) { return getIndex(handle); }
+    static HS_FORCEINLINE uint16 GetGeneration(Handle handle) { return static_cast<uint16>(handle >> INDEX_BITS); }
+
+private:
+    static constexpr uint32 INVALID_INDEX = UINT32_MAX;
+
+    struct Slot
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        std::atomic<uint16> generation;
+        bool isAlive;
+        uint32 nextFree;
+    };
+
+    static HS_FORCEINLINE uint32 getIndex(Handle handle) { return handle & INDEX_MASK; }
+    static HS_FORCEINLINE Handle makeHandle(uint32 index, uint16 generation) { return (static_cast<uint32>(generation) << INDEX_BITS) | index; }
+
+    HS_FORCEINLINE Slot& slotAt(uint32 index) const
+    {
+        return _chunks[index / ChunkSize].load(std::memory_order_acquire)[index & (ChunkSize - 1)];
+    }
+
+    HS_FORCEINLINE Slot* resolve(Handle handle) const
+    {
+        if (handle == INVALID_HANDLE)
+        {
+            return nullptr;
+        }
+
+        const uint32 index = getIndex(handle);
+        Slot* chunk        = _chunks[index / ChunkSize].load(std::memory_order_acquire);
+        if (nullptr == chunk)
+        {
+            return nullptr;
+        }
+
+        Slot& slot = chunk[index & (ChunkSize - 1)];
+        return (slot.generation.load(std::memory_order_acquire) == GetGeneration(handle)) ? &slot : nullptr;
+    }
+
+    static HS_FORCEINLINE void bumpGeneration(Slot& slot)
+    {
+        uint16 nextGeneration = static_cast<uint16>(slot.generation.load(std::memory_order_relaxed) + 1);
+        if (nextGeneration == 0)
+        {
+            nextGeneration = 1;
+        }
+        slot.generation.store(nextGeneration, std::memory_order_release);
+    }
+
+    bool growChunk()
+    {
+        if (_chunkCount >= MAX_CHUNK_COUNT)
+        {
+            return false;
+        }
+
+        Slot* chunk = static_cast<Slot*>(MemoryUtils::AlignedAlloc(sizeof(Slot) * ChunkSize, alignof(Slot) < 64 ? 64 : alignof(Slot)));
+        if (nullptr == chunk)
+        {
+            return false;
+        }
+
+        const uint32 baseIndex = _chunkCount * ChunkSize;
+        for (uint32 i = 0; i < ChunkSize; i++)
+        {
+            Slot* slot = new (&chunk[i]) Slot;
+            slot->generation.store(1, std::memory_order_relaxed);
+            slot->isAlive  = false;
+            slot->nextFree = (i + 1 < ChunkSize) ? baseIndex + i + 1 : _freeHead;
+        }
+        _freeHead = baseIndex;
+
+        _chunks[_chunkCount].store(chunk, std::memory_order_release);
+        _chunkCount++;
+
+        return true;
+    }
+
+    std::atomic<Slot*> _chunks[MAX_CHUNK_COUNT];
+    uint32 _chunkCount;
+    uint32 _freeHead;
+    uint32 _liveCount;
+
+    std::mutex _mutex;
+};
+
+HS_NS_END
+
+#endif
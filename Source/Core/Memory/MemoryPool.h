@@ -12,14 +12,13 @@
 #include "Core/Log.h"
 
 #include <atomic>
-#include <array>
+#include <cstddef>
+#include <vector>
+#include <mutex>
+#include <thread>
 
 HS_NS_BEGIN
 
-// Forward declarations
-class LinearAllocator;
-class StackAllocator;
-
 // Platform-specific aligned allocation utilities
 namespace MemoryUtils
 {
@@ -60,6 +59,147 @@ namespace MemoryUtils
     }
 }
 
+// 스레드 세이프한 bump 할당기. Allocate는 여러 스레드에서 동시에 호출 가능하나 Reset은 할당이 없는 시점에만 호출해야 한다.
+// 용량을 넘으면 힙으로 폴백하고, 다음 Reset에서 최대 사용량만큼 버퍼를 키워 이후 프레임에서는 힙을 타지 않도록 한다.
+class HS_API LinearAllocator
+{
+public:
+    explicit LinearAllocator(size_t capacity);
+    ~LinearAllocator();
+
+    LinearAllocator(const LinearAllocator&)            = delete;
+    LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    HS_FORCEINLINE T* AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "LinearAllocator never runs destructors");
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void Reset();
+
+    HS_FORCEINLINE size_t GetCapacity() const { return _capacity; }
+    HS_FORCEINLINE size_t GetUsedSize() const { return _offset.load(std::memory_order_relaxed); }
+    HS_FORCEINLINE size_t GetPeakSize() const { return _peak; }
+
+private:
+    void* allocateOverflow(size_t size, size_t alignment);
+
+    uint8* _buffer;
+    size_t _capacity;
+    std::atomic<size_t> _offset;
+    size_t _peak;
+
+    std::mutex _overflowMutex;
+    std::vector<void*> _overflowBlocks;
+    size_t _overflowSize;
+};
+
+// 소유 스레드 전용 LIFO 할당기. 함수 스코프 임시 버퍼는 ScopedStackMarker와 함께 GetThreadLocal()을 사용한다.
+class HS_API StackAllocator
+{
+public:
+    struct Marker
+    {
+        size_t offset;
+        size_t overflowCount;
+    };
+
+    explicit StackAllocator(size_t capacity);
+    ~StackAllocator();
+
+    StackAllocator(const StackAllocator&)            = delete;
+    StackAllocator& operator=(const StackAllocator&) = delete;
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template <typename T>
+    HS_FORCEINLINE T* AllocateArray(size_t count)
+    {
+        static_assert(std::is_trivially_destructible<T>::value, "StackAllocator never runs destructors");
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    HS_FORCEINLINE Marker GetMarker() const { return Marker{_offset, _overflowBlocks.size()}; }
+    void FreeToMarker(const Marker& marker);
+    void Reset();
+
+    HS_FORCEINLINE size_t GetCapacity() const { return _capacity; }
+    HS_FORCEINLINE size_t GetUsedSize() const { return _offset; }
+
+    static StackAllocator& GetThreadLocal();
+
+private:
+    uint8* _buffer;
+    size_t _capacity;
+    size_t _offset;
+
+    std::vector<void*> _overflowBlocks;
+    std::thread::id _ownerThread;
+    bool _overflowWarned; // Reset 때까지 넘침 경고는 한 번만
+};
+
+class ScopedStackMarker
+{
+public:
+    explicit ScopedStackMarker(StackAllocator& allocator)
+        : _allocator(allocator)
+        , _marker(allocator.GetMarker())
+    {
+    }
+    ~ScopedStackMarker() { _allocator.FreeToMarker(_marker); }
+
+    ScopedStackMarker(const ScopedStackMarker&)            = delete;
+    ScopedStackMarker& operator=(const ScopedStackMarker&) = delete;
+
+private:
+    StackAllocator& _allocator;
+    StackAllocator::Marker _marker;
+};
+
+// In-flight 프레임 수만큼 LinearAllocator를 링으로 돌린다.
+// BeginFrame은 해당 슬롯을 GPU가 다 썼다는 게 보장된 뒤(펜스 대기 이후)에 호출해야 한다.
+class HS_API FrameAllocator
+{
+public:
+    static constexpr uint32 DEFAULT_FRAMES_IN_FLIGHT = 3;
+    static constexpr size_t DEFAULT_FRAME_CAPACITY = 1 << 20;
+
+    static FrameAllocator& Get();
+
+    // 스왑체인의 최대 프레임 수에 맞춘다. 쓰던 슬롯이 사라지지 않도록 슬롯은 늘리기만 한다.
+    // 모든 프레임이 끝난 뒤(초기화나 스왑체인 재생성 직후)에 호출해야 한다.
+    void SetFrameCount(uint32 frameCount);
+    HS_FORCEINLINE uint32 GetFrameCount() const { return _frameCount; }
+
+    void BeginFrame(uint32 frameIndex);
+
+    HS_FORCEINLINE void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        return _frames[_currentSlot]->Allocate(size, alignment);
+    }
+
+    template <typename T>
+    HS_FORCEINLINE T* AllocateArray(size_t count)
+    {
+        return _frames[_currentSlot]->AllocateArray<T>(count);
+    }
+
+    HS_FORCEINLINE uint32 GetCurrentSlot() const { return _currentSlot; }
+    HS_FORCEINLINE const LinearAllocator& GetFrame(uint32 slot) const { return *_frames[slot % _frameCount]; }
+
+private:
+    explicit FrameAllocator(size_t capacityPerFrame);
+
+    std::vector<Scoped<LinearAllocator>> _frames;
+    size_t _capacityPerFrame;
+    uint32 _frameCount;
+    uint32 _currentSlot;
+};
+
 HS_NS_END
 
 #endif // __HS_CORE_MEMORY_POOL_H__
\ No newline at end of file
@@ -2,12 +2,210 @@
 //  MemoryPool.cpp
 //  Core
 //
-//  Implementation of high-performance memory `locators
+//  Implementation of high-performance memory allocators
 //
 #include "Core/Memory/MemoryPool.h"
 #include "Core/Log.h"
 
 HS_NS_BEGIN
 
+namespace
+{
+constexpr size_t s_bufferAlignment = 64;
+constexpr size_t s_defaultThreadStackCapacity = 256 * 1024;
 
-HS_NS_END
\ No newline at end of file
+HS_FORCEINLINE uintptr_t alignUp(uintptr_t value, size_t alignment)
+{
+    return (value + (alignment - 1)) & ~(static_cast<uintptr_t>(alignment) - 1);
+}
+
+HS_FORCEINLINE size_t nextCapacity(size_t required)
+{
+    size_t capacity = s_bufferAlignment;
+    while (capacity < required)
+    {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+} // namespace
+
+LinearAllocator::LinearAllocator(size_t capacity)
+    : _buffer(static_cast<uint8*>(MemoryUtils::AlignedAlloc(capacity, s_bufferAlignment)))
+    , _capacity(capacity)
+    , _offset(0)
+    , _peak(0)
+    , _overflowSize(0)
+{
+    HS_ASSERT(_buffer, "Failed to allocate LinearAllocator buffer (%zu bytes)", capacity);
+}
+
+LinearAllocator::~LinearAllocator()
+{
+    Reset();
+    MemoryUtils::AlignedFree(_buffer);
+    _buffer = nullptr;
+}
+
+void* LinearAllocator::Allocate(size_t size, size_t alignment)
+{
+    HS_ASSERT((alignment & (alignment - 1)) == 0, "Alignment must be power of two");
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(_buffer);
+    size_t current       = _offset.load(std::memory_order_relaxed);
+    size_t alignedOffset;
+    size_t nextOffset;
+    do
+    {
+        alignedOffset = static_cast<size_t>(alignUp(base + current, alignment) - base);
+        nextOffset    = alignedOffset + size;
+        if (nextOffset > _capacity)
+        {
+            return allocateOverflow(size, alignment);
+        }
+    } while (!_offset.compare_exchange_weak(current, nextOffset, std::memory_order_relaxed));
+
+    return _buffer + alignedOffset;
+}
+
+void* LinearAllocator::allocateOverflow(size_t size, size_t alignment)
+{
+    void* block = MemoryUtils::AlignedAlloc(size, alignment < s_bufferAlignment ? s_bufferAlignment : alignment);
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    if (_overflowBlocks.empty())
+    {
+        HS_LOG(warning, "LinearAllocator overflow (capacity %zu bytes), falling back to heap until next reset", _capacity);
+    }
+    _overflowBlocks.push_back(block);
+    _overflowSize += size + alignment;
+
+    return block;
+}
+
+void LinearAllocator::Reset()
+{
+    const size_t used = _offset.load(std::memory_order_relaxed) + _overflowSize;
+    if (used > _peak)
+    {
+        _peak = used;
+    }
+
+    if (false == _overflowBlocks.empty())
+    {
+        for (void* block : _overflowBlocks)
+        {
+            MemoryUtils::AlignedFree(block);
+        }
+        _overflowBlocks.clear();
+        _overflowSize = 0;
+
+        // 다음 프레임부터는 힙 폴백이 일어나지 않도록 최대 사용량에 맞춰 키운다.
+        const size_t newCapacity = nextCapacity(_peak);
+        MemoryUtils::AlignedFree(_buffer);
+        _buffer   = static_cast<uint8*>(MemoryUtils::AlignedAlloc(newCapacity, s_bufferAlignment));
+        _capacity = newCapacity;
+    }
+
+    _offset.store(0, std::memory_order_relaxed);
+}
+
+StackAllocator::StackAllocator(size_t capacity)
+    : _buffer(static_cast<uint8*>(MemoryUtils::AlignedAlloc(capacity, s_bufferAlignment)))
+    , _capacity(capacity)
+    , _offset(0)
+    , _ownerThread(std::this_thread::get_id())
+    , _overflowWarned(false)
+{
+    HS_ASSERT(_buffer, "Failed to allocate StackAllocator buffer (%zu bytes)", capacity);
+}
+
+StackAllocator::~StackAllocator()
+{
+    Reset();
+    MemoryUtils::AlignedFree(_buffer);
+    _buffer = nullptr;
+}
+
+void* StackAllocator::Allocate(size_t size, size_t alignment)
+{
+    HS_ASSERT(std::this_thread::get_id() == _ownerThread, "StackAllocator used from non-owner thread");
+    HS_ASSERT((alignment & (alignment - 1)) == 0, "Alignment must be power of two");
+
+    const uintptr_t base        = reinterpret_cast<uintptr_t>(_buffer);
+    const size_t alignedOffset  = static_cast<size_t>(alignUp(base + _offset, alignment) - base);
+    const size_t nextOffset     = alignedOffset + size;
+    if (nextOffset > _capacity)
+    {
+        if (false == _overflowWarned)
+        {
+            HS_LOG(warning, "StackAllocator overflow (capacity %zu bytes, requested %zu bytes), falling back to heap until next reset", _capacity, size);
+            _overflowWarned = true;
+        }
+        void* block = MemoryUtils::AlignedAlloc(size, alignment < s_bufferAlignment ? s_bufferAlignment : alignment);
+        _overflowBlocks.push_back(block);
+        return block;
+    }
+
+    _offset = nextOffset;
+    return _buffer + alignedOffset;
+}
+
+void StackAllocator::FreeToMarker(const Marker& marker)
+{
+    HS_ASSERT(std::this_thread::get_id() == _ownerThread, "StackAllocator used from non-owner thread");
+    HS_ASSERT(marker.offset <= _offset, "Marker is above the current stack top");
+
+    while (_overflowBlocks.size() > marker.overflowCount)
+    {
+        MemoryUtils::AlignedFree(_overflowBlocks.back());
+        _overflowBlocks.pop_back();
+    }
+    _offset = marker.offset;
+}
+
+void StackAllocator::Reset()
+{
+    FreeToMarker(Marker{0, 0});
+    _overflowWarned = false;
+}
+
+StackAllocator& StackAllocator::GetThreadLocal()
+{
+    thread_local StackAllocator s_threadStack(s_defaultThreadStackCapacity);
+    return s_threadStack;
+}
+
+FrameAllocator::FrameAllocator(size_t capacityPerFrame)
+    : _capacityPerFrame(capacityPerFrame)
+    , _frameCount(0)
+    , _currentSlot(0)
+{
+    SetFrameCount(DEFAULT_FRAMES_IN_FLIGHT);
+}
+
+void FrameAllocator::SetFrameCount(uint32 frameCount)
+{
+    HS_ASSERT(frameCount > 0, "Frame count must be positive");
+
+    while (_frames.size() < frameCount)
+    {
+        _frames.push_back(MakeScoped<LinearAllocator>(_capacityPerFrame));
+    }
+    _frameCount  = frameCount;
+    _currentSlot = _currentSlot % _frameCount;
+}
+
+FrameAllocator& FrameAllocator::Get()
+{
+    static FrameAllocator s_instance(DEFAULT_FRAME_CAPACITY);
+    return s_instance;
+}
+
+void FrameAllocator::BeginFrame(uint32 frameIndex)
+{
+    _currentSlot = frameIndex % _frameCount;
+    _frames[_currentSlot]->Reset();
+}
+
+HS_NS_END
@@ -0,0 +1,64 @@
+//
+//  Name.h
+//  Core
+//
+//  Interned string handle with a 32-bit id
+//
+#ifndef __HS_NAME_H__
+#define __HS_NAME_H__
+
+#include "Precompile.h"
+#include "Core/Hash.h"
+
+#include <string>
+
+HS_NS_BEGIN
+
+// 전역 이름 테이블에 등록된 문자열을 32bit id로 가리킨다.
+// 같은 문자열은 항상 같은 id를 가지므로 비교/해싱은 정수 연산이고, 문자열 본문은 테이블에 한 번만 저장된다.
+// 등록된 문자열은 프로세스가 끝날 때까지 해제되지 않으므로 c_str()의 포인터는 언제든 유효하다.
+// 생성(등록)은 여러 스레드에서 동시에 호출할 수 있다.
+class HS_API Name
+{
+public:
+    static constexpr uint32 NONE_ID = 0; // 빈 문자열
+
+    Name() = default;
+    explicit Name(const char* str);
+    explicit Name(const std::string& str);
+    Name(const char* str, size_t length);
+
+    // 이미 등록된 이름만 찾는다. 없으면 NONE을 돌려준다.
+    static Name Find(const char* str, size_t length);
+    static Name Find(const std::string& str) { return Find(str.data(), str.size()); }
+
+    HS_FORCEINLINE uint32 GetId() const { return _id; }
+    HS_FORCEINLINE bool   IsNone() const { return _id == NONE_ID; }
+
+    // StringHash64(문자열)와 같은 값. 등록 시 한 번만 계산된다.
+    uint64      GetHash() const;
+    const char* c_str() const;
+    uint32      GetLength() const;
+
+    HS_FORCEINLINE bool operator==(const Name& rhs) const { return _id == rhs._id; }
+    HS_FORCEINLINE bool operator!=(const Name& rhs) const { return _id != rhs._id; }
+    HS_FORCEINLINE bool operator<(const Name& rhs) const { return _id < rhs._id; }
+
+    static uint32 GetRegisteredCount();
+
+private:
+    uint32 _id = NONE_ID;
+};
+
+template <>
+struct Hasher<Name>
+{
+    static uint32 Get(const Name& key)
+    {
+        return key.GetId();
+    }
+};
+
+HS_NS_END
+
+#endif
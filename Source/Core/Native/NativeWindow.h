@@ -11,6 +11,7 @@
 #include "Precompile.h"
 
 #include "Core/Native/NativeEvent.h"
+#include "Core/Container/RingQueue.h"
 
 HS_NS_BEGIN
 
@@ -92,6 +93,9 @@ struct HS_API NativeWindow
 	bool useHDR : 1;
 	
 	bool futureUse : 4; // padding.
+
+	// OS 이벤트 펌프(생산자) -> 엔진 루프(소비자). 창마다 인라인으로 두어 push/pop에 할당이 없다.
+	SPSCQueue<NativeEvent, 512> eventQueue;
 };
 
 bool HS_API CreateNativeWindow(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow);
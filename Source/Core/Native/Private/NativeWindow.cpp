@@ -4,10 +4,11 @@
 #include "Platform/Win/WinWindow.h"
 #elif defined(__APPLE__)
 // #include "Platform/Mac/MacWindow.h"
+#elif defined(__LINUX__)
+#include "Platform/Linux/LinuxWindow.h"
 #endif
 
-#include <queue>
-#include <cassert>
+#include "Core/Log.h"
 
 HS_NS_BEGIN
 
@@ -18,21 +19,11 @@ void PollNativeEventInternal(NativeWindow& nativeWindow);
 void SetNativeWindowSizeInternal(uint16 width, uint16 height);
 void GetNativeWindowSizeInternal(uint16& outWidth, uint16& outHeight);
 
-static std::unordered_map<const NativeWindow*, std::queue<NativeEvent>> s_eventQueueTable;
-
 bool CreateNativeWindow(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow)
 {
-    assert(s_eventQueueTable.find(&outNativeWindow) == s_eventQueueTable.end());
-    s_eventQueueTable.insert(std::make_pair(&outNativeWindow, std::queue<NativeEvent>()));
-
-    bool result = CreateNativeWindowInternal(name, width, height, flag, outNativeWindow);
+    outNativeWindow.eventQueue.Clear();
 
-    if (!result)
-    {
-        s_eventQueueTable.erase(&outNativeWindow);
-    }
-
-    return result;
+    return CreateNativeWindowInternal(name, width, height, flag, outNativeWindow);
 }
 
 void DestroyNativeWindow(NativeWindow& nativeWindow)
@@ -62,7 +53,7 @@ void GetNativeWindowSize(uint16& outWidth, uint16& outHeight)
 
 bool PeekNativeEvent(NativeWindow* pWindow, NativeEvent& outEvent)
 {
-    if (pWindow == nullptr || s_eventQueueTable.find(pWindow) == s_eventQueueTable.end())
+    if (pWindow == nullptr)
     {
         return false;
     }
@@ -71,35 +62,29 @@ bool PeekNativeEvent(NativeWindow* pWindow, NativeEvent& outEvent)
 
     outEvent = NativeEvent::Type::NONE;
 
-    auto& eventQueue = s_eventQueueTable[pWindow];
-    if (eventQueue.empty())
-    {
-        return false;
-    }
-
-    outEvent = eventQueue.front();
-
-    return true;
+    return pWindow->eventQueue.TryPeek(outEvent);
 }
 
 void PushNativeEvent(const NativeWindow* pWindow, NativeEvent event)
 {
-    assert(pWindow && s_eventQueueTable.find(pWindow) != s_eventQueueTable.end());
-
-    auto& eventQueue = s_eventQueueTable[pWindow];
+    HS_ASSERT(pWindow, "NativeWindow is nullptr");
 
-    eventQueue.push(event);
+    // 이벤트 큐는 소비자(엔진 루프)와 공유하는 상태이므로 const 창에서도 push를 허용한다.
+    NativeWindow* window = const_cast<NativeWindow*>(pWindow);
+    if (false == window->eventQueue.TryPush(event))
+    {
+        HS_LOG(warning, "Native event queue is full. event(0x%02x) dropped.", static_cast<uint32>(event.type));
+    }
 }
 
 NativeEvent PopNativeEvent(const NativeWindow* pWindow)
 {
-    assert(pWindow && s_eventQueueTable.find(pWindow) != s_eventQueueTable.end());
-
-    auto& eventQueue = s_eventQueueTable[pWindow];
+    HS_ASSERT(pWindow, "NativeWindow is nullptr");
 
-    NativeEvent event = eventQueue.front();
+    NativeWindow* window = const_cast<NativeWindow*>(pWindow);
 
-    eventQueue.pop();
+    NativeEvent event = NativeEvent::Type::NONE;
+    window->eventQueue.TryPop(event);
 
     return event;
 }
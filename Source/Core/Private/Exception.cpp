@@ -8,7 +8,7 @@
 
 HS_NS_BEGIN
 
-#if defined(__APPLE__)
+#if !defined(_MSC_VER)
 static int _vscprintf(const char* format, va_list pargs)
 {
 	int retval;
@@ -1,5 +1,10 @@
 #include "Core/Log.h"
 
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
 HS_NS_BEGIN
 #if defined(__APPLE__)
 static const char* log_color_red = "🔴";
@@ -27,87 +32,466 @@ static const char* log_tag_crash = "[CRASH]";
 static const char* log_tag_assert = "[ASSERT]";
 static const char* log_tag_invalid = "[??????]";
 
-void Log::Print(const char* file, const uint32 line, const Log::EType type, const char* fmt, ...)
+namespace
 {
-    const char* start = nullptr;
-    const char* end = log_color_reset;
-    const char* tag = nullptr;
+constexpr size_t s_logRingCapacity   = 2048;
+constexpr size_t s_inlineMessageSize = 400;
+constexpr size_t s_maxRecordsPerBatch = 256;
+
+struct LogRecord
+{
+    Log::EType  type;
+    uint32      line;
+    uint32      suppressedCount;
+    uint32      threadId;
+    const char* file;
+    uint64      timestamp;   // Initialize 이후 경과 시간(ns)
+    char*       heapMessage; // inline 버퍼에 들어가지 않는 긴 메시지
+    char        message[s_inlineMessageSize];
+
+    const char* GetMessage() const { return (nullptr != heapMessage) ? heapMessage : message; }
+};
+
+// Vyukov bounded queue를 레코드 제자리 쓰기/읽기용으로 바꾼 것.
+// 생산자는 여러 스레드, 소비자는 writer 스레드 하나뿐이다.
+class LogRing
+{
+public:
+    LogRing()
+    {
+        for (size_t i = 0; i < s_logRingCapacity; i++)
+        {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LogRecord* TryBeginWrite(size_t& outPos)
+    {
+        size_t pos = _writePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell          = _cells[pos & MASK];
+            const size_t seq    = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (_writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    outPos = pos;
+                    return &cell.record;
+                }
+            }
+            else if (diff < 0)
+            {
+                return nullptr; // full
+            }
+            else
+            {
+                pos = _writePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    HS_FORCEINLINE void EndWrite(size_t pos)
+    {
+        _cells[pos & MASK].sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    HS_FORCEINLINE LogRecord* TryBeginRead()
+    {
+        Cell& cell = _cells[_readPos & MASK];
+        return (cell.sequence.load(std::memory_order_acquire) == _readPos + 1) ? &cell.record : nullptr;
+    }
 
+    HS_FORCEINLINE void EndRead()
+    {
+        _cells[_readPos & MASK].sequence.store(_readPos + s_logRingCapacity, std::memory_order_release);
+        _readPos++;
+    }
+
+    HS_FORCEINLINE size_t GetWritePos() const { return _writePos.load(std::memory_order_acquire); }
+    HS_FORCEINLINE size_t GetReadPos() const { return _readPos; }
+
+private:
+    static constexpr size_t MASK = s_logRingCapacity - 1;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        LogRecord           record;
+    };
+
+    Cell _cells[s_logRingCapacity];
+    alignas(HS_CACHE_LINE_SIZE) std::atomic<size_t> _writePos{0};
+    alignas(HS_CACHE_LINE_SIZE) size_t _readPos = 0; // writer 스레드 전용
+};
+
+struct Logger
+{
+    LogRing ring;
+
+    std::atomic<bool>   isActive{false};  // 비동기 경로 사용 여부
+    std::atomic<bool>   isRunning{false}; // writer 스레드 종료 요청
+    std::atomic<bool>   isWriterSleeping{false};
+    std::atomic<uint32> producerCount{0}; // isActive를 확인한 뒤 아직 링 쓰기를 마치지 않은 생산자 수
+    std::atomic<size_t> writtenPos{0};    // 출력까지 끝난 레코드 위치
+    std::atomic<uint64> droppedCount{0};
+
+    std::thread             writer;
+    std::mutex              mutex;
+    std::condition_variable condition;
+
+    FILE*                                 file = nullptr;
+    std::chrono::steady_clock::time_point epoch;
+};
+
+// Finalize 이후에도 다른 스레드가 Print를 호출할 수 있으므로 해제하지 않는다.
+Logger* s_logger = nullptr;
+
+std::atomic<uint32> s_threadIdCounter{0};
+thread_local uint32 s_logThreadId = 0;
+
+HS_FORCEINLINE uint32 getThreadId()
+{
+    if (s_logThreadId == 0)
+    {
+        s_logThreadId = s_threadIdCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+    return s_logThreadId;
+}
+
+void getStyle(const Log::EType type, const char*& outStart, const char*& outTag)
+{
     switch (type)
     {
-        case EType::LOG_INFO:
+        case Log::EType::LOG_INFO:
         {
-            start = log_color_green;
-            tag = log_tag_info;
+            outStart = log_color_green;
+            outTag   = log_tag_info;
+            break;
         }
-        break;
-        case EType::LOG_DEBUG:
+        case Log::EType::LOG_DEBUG:
         {
-            start = log_color_white;
-            tag = log_tag_debug;
+            outStart = log_color_white;
+            outTag   = log_tag_debug;
             break;
         }
-        case EType::LOG_WARNING:
+        case Log::EType::LOG_WARNING:
         {
-            start = log_color_yellow;
-            tag = log_tag_warning;
+            outStart = log_color_yellow;
+            outTag   = log_tag_warning;
             break;
         }
-        case EType::LOG_ERROR:
+        case Log::EType::LOG_ERROR:
         {
-            start = log_color_red;
-            tag = log_tag_error;
+            outStart = log_color_red;
+            outTag   = log_tag_error;
             break;
         }
-        case EType::LOG_CRASH:
+        case Log::EType::LOG_CRASH:
         {
-            start = log_color_red;
-            tag = log_tag_crash;
+            outStart = log_color_red;
+            outTag   = log_tag_crash;
             break;
         }
-        case EType::LOG_ASSERT:
+        case Log::EType::LOG_ASSERT:
         {
-            start = log_color_magenta;
-            tag = log_tag_assert;
+            outStart = log_color_magenta;
+            outTag   = log_tag_assert;
             break;
         }
         default:
         {
-            start = log_color_white;
-            tag = log_tag_invalid;
+            outStart = log_color_white;
+            outTag   = log_tag_invalid;
             break;
         }
     }
+}
+
+void formatRecord(LogRecord& record, const char* file, const uint32 line, const Log::EType type, const uint32 suppressedCount, const char* fmt, va_list ptr)
+{
+    record.type            = type;
+    record.line            = line;
+    record.suppressedCount = suppressedCount;
+    record.threadId        = getThreadId();
+    record.file            = file;
+    record.heapMessage     = nullptr;
+    record.timestamp       = (nullptr != s_logger) ? static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_logger->epoch).count()) : 0;
+
+    va_list copy;
+    va_copy(copy, ptr);
+    const int length = vsnprintf(record.message, s_inlineMessageSize, fmt, copy);
+    va_end(copy);
+
+    if (length >= static_cast<int>(s_inlineMessageSize))
+    {
+        record.heapMessage = new char[length + 1];
+        vsnprintf(record.heapMessage, length + 1, fmt, ptr);
+    }
+    else if (length < 0)
+    {
+        record.message[0] = '\0';
+    }
+}
+
+void writeRecord(const LogRecord& record, FILE* file)
+{
+    const char* start = nullptr;
+    const char* tag   = nullptr;
+    getStyle(record.type, start, tag);
+
+    if (record.suppressedCount > 0)
+    {
+        fprintf(stdout, " %s%s %s (%s:%u) [%u similar messages suppressed]%s\n", start, tag, record.GetMessage(), record.file, record.line, record.suppressedCount, log_color_reset);
+    }
+    else
+    {
+        fprintf(stdout, " %s%s %s (%s:%u)%s\n", start, tag, record.GetMessage(), record.file, record.line, log_color_reset);
+    }
+
+    if (nullptr != file)
+    {
+        fprintf(file, "[%12.6f] [T%02u] %s %s (%s:%u)", static_cast<double>(record.timestamp) * 1e-9, record.threadId, tag, record.GetMessage(), record.file, record.line);
+        if (record.suppressedCount > 0)
+        {
+            fprintf(file, " [%u similar messages suppressed]", record.suppressedCount);
+        }
+        fputc('\n', file);
+    }
+}
+
+// 링에 쌓인 레코드를 출력한다. writer 스레드(또는 writer가 종료된 뒤의 Finalize)에서만 호출한다.
+size_t drainRing(Logger& logger)
+{
+    size_t count = 0;
+    while (count < s_maxRecordsPerBatch)
+    {
+        LogRecord* record = logger.ring.TryBeginRead();
+        if (nullptr == record)
+        {
+            break;
+        }
+
+        writeRecord(*record, logger.file);
+        delete[] record->heapMessage;
+        record->heapMessage = nullptr;
+
+        logger.ring.EndRead();
+        count++;
+    }
 
+    const uint64 dropped = logger.droppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+    {
+        fprintf(stdout, " %s[WARNING] Log ring buffer was full, %llu messages dropped%s\n", log_color_yellow, static_cast<unsigned long long>(dropped), log_color_reset);
+        if (nullptr != logger.file)
+        {
+            fprintf(logger.file, "[WARNING] Log ring buffer was full, %llu messages dropped\n", static_cast<unsigned long long>(dropped));
+        }
+    }
+
+    if (count > 0 || dropped > 0)
+    {
+        fflush(stdout);
+        if (nullptr != logger.file)
+        {
+            fflush(logger.file);
+        }
+        logger.writtenPos.store(logger.ring.GetReadPos(), std::memory_order_release);
+    }
+
+    return count;
+}
+
+void writerMain(Logger* logger)
+{
+    for (;;)
+    {
+        if (drainRing(*logger) > 0)
+        {
+            continue;
+        }
+
+        if (false == logger->isRunning.load(std::memory_order_acquire))
+        {
+            break;
+        }
+
+        std::unique_lock<std::mutex> lock(logger->mutex);
+        logger->isWriterSleeping.store(true, std::memory_order_seq_cst);
+        logger->condition.wait_for(lock, std::chrono::milliseconds(50), [logger]()
+        {
+            return nullptr != logger->ring.TryBeginRead() || false == logger->isRunning.load(std::memory_order_acquire);
+        });
+        logger->isWriterSleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+void wakeWriter(Logger& logger)
+{
+    // 잠든 writer는 처음 도착한 생산자 하나만 깨운다.
+    if (logger.isWriterSleeping.load(std::memory_order_seq_cst) && logger.isWriterSleeping.exchange(false, std::memory_order_seq_cst))
+    {
+        std::lock_guard<std::mutex> lock(logger.mutex);
+        logger.condition.notify_one();
+    }
+}
+} // namespace
+
+void Log::Initialize(const char* filePath)
+{
+    if (nullptr == s_logger)
+    {
+        s_logger = new Logger();
+    }
+    else if (s_logger->isActive.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    Logger& logger = *s_logger;
+    logger.epoch   = std::chrono::steady_clock::now();
+
+    if (nullptr != filePath)
+    {
+        logger.file = fopen(filePath, "w");
+        if (nullptr == logger.file)
+        {
+            fprintf(stdout, " %s%s Fail to open log file: %s%s\n", log_color_yellow, log_tag_warning, filePath, log_color_reset);
+        }
+    }
+
+    logger.isRunning.store(true, std::memory_order_release);
+    logger.writer = std::thread(writerMain, s_logger);
+    logger.isActive.store(true, std::memory_order_release);
+}
+
+void Log::Finalize()
+{
+    if (nullptr == s_logger || false == s_logger->isActive.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    Logger& logger = *s_logger;
+    logger.isActive.store(false, std::memory_order_seq_cst);
+
+    // isActive를 보기 전에 producerCount를 올리므로, 여기서 0을 보면 이후 생산자는 모두 동기 경로로 간다.
+    // writer는 아직 돌고 있으므로 링이 가득 차서 기다리는 생산자도 빠져나온다.
+    while (logger.producerCount.load(std::memory_order_seq_cst) > 0)
+    {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(logger.mutex);
+        logger.isRunning.store(false, std::memory_order_release);
+    }
+    logger.condition.notify_one();
+    logger.writer.join();
+
+    // writer 종료 직전에 쓰기를 마친 레코드
+    while (drainRing(logger) > 0)
+    {
+    }
+
+    if (nullptr != logger.file)
+    {
+        fclose(logger.file);
+        logger.file = nullptr;
+    }
+}
+
+void Log::Flush()
+{
+    if (nullptr == s_logger || false == s_logger->isActive.load(std::memory_order_acquire))
+    {
+        fflush(stdout);
+        return;
+    }
+
+    Logger& logger     = *s_logger;
+    const size_t target = logger.ring.GetWritePos();
+    {
+        std::lock_guard<std::mutex> lock(logger.mutex);
+        logger.condition.notify_one();
+    }
+
+    while (logger.writtenPos.load(std::memory_order_acquire) < target && logger.isRunning.load(std::memory_order_acquire))
+    {
+        std::this_thread::yield();
+    }
+}
+
+void Log::Print(const char* file, const uint32 line, const Log::EType type, const char* fmt, ...)
+{
+    va_list ptr;
+    va_start(ptr, fmt);
+    submit(file, line, type, 0, fmt, ptr);
+    va_end(ptr);
+}
+
+void Log::Print(const char* file, const uint32 line, const Log::EType type, const uint32 suppressedCount, const char* fmt, ...)
+{
     va_list ptr;
     va_start(ptr, fmt);
-    print(file, line, start, tag, end, fmt, ptr);
+    submit(file, line, type, suppressedCount, fmt, ptr);
     va_end(ptr);
 }
 
-void Log::print(const char* file, const uint32 line, const char* start, const char* tag, const char* end, const char* fmt, va_list ptr)
-{
-    fprintf(stdout, " %s%s ",start, tag);
-    vfprintf(stdout, fmt, ptr);
-    fprintf(stdout, " (%s:%u)%s\n", file, line, end);
-    fflush(stdout);
-
-    //Also write to log file for debugging
-    //static FILE* logFile = nullptr;
-    //if (logFile == nullptr)
-    //{
-    //    logFile = fopen("hsmr_debug.log", "w");
-    //}
-    //if (logFile)
-    //{
-    //    fprintf(logFile, " %s ", tag);
-    //    va_list ptr_copy;
-    //    va_copy(ptr_copy, ptr);
-    //    vfprintf(logFile, fmt, ptr_copy);
-    //    va_end(ptr_copy);
-    //    fprintf(logFile, " (%s:%u)\n", file, line);
-    //    fflush(logFile);
-    //}
+void Log::submit(const char* file, const uint32 line, const Log::EType type, const uint32 suppressedCount, const char* fmt, va_list ptr)
+{
+    const bool isFatal = (type == EType::LOG_CRASH || type == EType::LOG_ASSERT);
+
+    bool isAsync = false;
+    if (nullptr != s_logger)
+    {
+        s_logger->producerCount.fetch_add(1, std::memory_order_seq_cst);
+        isAsync = s_logger->isActive.load(std::memory_order_seq_cst);
+        if (false == isAsync)
+        {
+            s_logger->producerCount.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    if (false == isAsync)
+    {
+        LogRecord record;
+        formatRecord(record, file, line, type, suppressedCount, fmt, ptr);
+        writeRecord(record, nullptr);
+        fflush(stdout);
+        delete[] record.heapMessage;
+        return;
+    }
+
+    Logger& logger   = *s_logger;
+    size_t pos       = 0;
+    LogRecord* record = logger.ring.TryBeginWrite(pos);
+    while (nullptr == record)
+    {
+        // 링이 가득 찼다. info/debug는 버리고, 그 이상은 writer가 비울 때까지 기다린다.
+        if (GetLevel(type) < HS_LOG_LEVEL_WARNING)
+        {
+            logger.droppedCount.fetch_add(1, std::memory_order_relaxed);
+            logger.producerCount.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+        wakeWriter(logger);
+        std::this_thread::yield();
+        record = logger.ring.TryBeginWrite(pos);
+    }
+
+    formatRecord(*record, file, line, type, suppressedCount, fmt, ptr);
+    logger.ring.EndWrite(pos);
+    wakeWriter(logger);
+    logger.producerCount.fetch_sub(1, std::memory_order_release);
+
+    // 직후에 프로세스가 중단될 수 있으므로 출력이 끝날 때까지 기다린다.
+    if (isFatal)
+    {
+        Flush();
+    }
 }
 
 HS_NS_END
@@ -0,0 +1,226 @@
+//
+//  Name.cpp
+//  Core
+//
+//  Global thread-safe string interning table
+//
+#include "Core/Name.h"
+#include "Core/Log.h"
+#include "Core/Container/FlatHashMap.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 s_entryChunkSize  = 4096;
+constexpr uint32 s_maxEntryChunks  = 4096; // 최대 16M개 이름
+constexpr size_t s_stringBlockSize = 64 * 1024;
+
+struct NameEntry
+{
+    const char* str;
+    uint32      length;
+    uint64      hash;
+};
+
+struct NameKey
+{
+    const char* str;
+    uint32      length;
+    uint64      hash;
+
+    bool operator==(const NameKey& rhs) const
+    {
+        return hash == rhs.hash && length == rhs.length && 0 == ::memcmp(str, rhs.str, length);
+    }
+};
+
+struct NameKeyHash
+{
+    HS_FORCEINLINE uint64 operator()(const NameKey& key) const { return key.hash; }
+};
+
+// 엔트리는 청크 단위로 할당해 주소를 고정하고, id -> 엔트리 조회는 락 없이 수행한다.
+class NameTable
+{
+public:
+    NameTable()
+    {
+        for (auto& chunk : _chunks)
+        {
+            chunk.store(nullptr, std::memory_order_relaxed);
+        }
+
+        // id 0 = 빈 문자열
+        addEntry(NameKey{"", 0, StringHash64("", 0)});
+    }
+
+    uint32 FindOrAdd(const char* str, size_t length)
+    {
+        if (length == 0)
+        {
+            return Name::NONE_ID;
+        }
+
+        const NameKey key{str, static_cast<uint32>(length), StringHash64(str, length)};
+        {
+            std::shared_lock<std::shared_mutex> lock(_mutex);
+            auto it = _lookup.find(key);
+            if (it != _lookup.end())
+            {
+                return it->second;
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(_mutex);
+        auto it = _lookup.find(key);
+        if (it != _lookup.end())
+        {
+            return it->second;
+        }
+
+        return addEntry(NameKey{storeString(str, length), key.length, key.hash});
+    }
+
+    uint32 Find(const char* str, size_t length)
+    {
+        if (length == 0)
+        {
+            return Name::NONE_ID;
+        }
+
+        const NameKey key{str, static_cast<uint32>(length), StringHash64(str, length)};
+
+        std::shared_lock<std::shared_mutex> lock(_mutex);
+        auto it = _lookup.find(key);
+        return (it != _lookup.end()) ? it->second : Name::NONE_ID;
+    }
+
+    HS_FORCEINLINE const NameEntry& GetEntry(uint32 id) const
+    {
+        const NameEntry* chunk = _chunks[id / s_entryChunkSize].load(std::memory_order_acquire);
+        return chunk[id % s_entryChunkSize];
+    }
+
+    HS_FORCEINLINE uint32 GetCount() const { return _count.load(std::memory_order_acquire); }
+
+private:
+    // 쓰기 락을 잡은 상태에서 호출된다.
+    uint32 addEntry(const NameKey& key)
+    {
+        const uint32 id         = _count.load(std::memory_order_relaxed);
+        const uint32 chunkIndex = id / s_entryChunkSize;
+        if (chunkIndex >= s_maxEntryChunks)
+        {
+            HS_LOG(crash, "NameTable is full");
+            return Name::NONE_ID;
+        }
+
+        NameEntry* chunk = _chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (nullptr == chunk)
+        {
+            chunk = new NameEntry[s_entryChunkSize];
+            _chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+
+        chunk[id % s_entryChunkSize] = NameEntry{key.str, key.length, key.hash};
+        _lookup.insert(std::make_pair(key, id));
+        _count.store(id + 1, std::memory_order_release);
+
+        return id;
+    }
+
+    const char* storeString(const char* str, size_t length)
+    {
+        const size_t size = length + 1;
+        if (size > s_stringBlockSize / 4)
+        {
+            char* dedicated = new char[size];
+            ::memcpy(dedicated, str, length);
+            dedicated[length] = '\0';
+            _blocks.push_back(dedicated);
+            return dedicated;
+        }
+
+        if (_blockOffset + size > s_stringBlockSize || _currentBlock == nullptr)
+        {
+            _currentBlock = new char[s_stringBlockSize];
+            _blockOffset  = 0;
+            _blocks.push_back(_currentBlock);
+        }
+
+        char* dst = _currentBlock + _blockOffset;
+        ::memcpy(dst, str, length);
+        dst[length] = '\0';
+        _blockOffset += size;
+        return dst;
+    }
+
+    std::atomic<NameEntry*> _chunks[s_maxEntryChunks];
+    std::atomic<uint32>     _count{0};
+
+    FlatHashMap<NameKey, uint32, NameKeyHash> _lookup;
+    std::shared_mutex                         _mutex;
+
+    std::vector<char*> _blocks;
+    char*              _currentBlock = nullptr;
+    size_t             _blockOffset  = 0;
+};
+
+// 정적 객체 소멸 중에도 Name이 사용될 수 있으므로 테이블은 해제하지 않는다.
+NameTable& getNameTable()
+{
+    static NameTable* s_table = new NameTable();
+    return *s_table;
+}
+} // namespace
+
+Name::Name(const char* str)
+    : _id((nullptr != str) ? getNameTable().FindOrAdd(str, ::strlen(str)) : NONE_ID)
+{
+}
+
+Name::Name(const std::string& str)
+    : _id(getNameTable().FindOrAdd(str.data(), str.size()))
+{
+}
+
+Name::Name(const char* str, size_t length)
+    : _id(getNameTable().FindOrAdd(str, length))
+{
+}
+
+Name Name::Find(const char* str, size_t length)
+{
+    Name name;
+    name._id = getNameTable().Find(str, length);
+    return name;
+}
+
+uint64 Name::GetHash() const
+{
+    return getNameTable().GetEntry(_id).hash;
+}
+
+const char* Name::c_str() const
+{
+    return getNameTable().GetEntry(_id).str;
+}
+
+uint32 Name::GetLength() const
+{
+    return getNameTable().GetEntry(_id).length;
+}
+
+uint32 Name::GetRegisteredCount()
+{
+    return getNameTable().GetCount();
+}
+
+HS_NS_END
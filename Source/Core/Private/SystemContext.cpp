@@ -1,4 +1,6 @@
 #include "Core/SystemContext.h"
+#include "Core/HAL/Simd.h"
+#include "Core/Log.h"
 
 HS_NS_BEGIN
 
@@ -23,6 +25,13 @@ bool SystemContext::Init()
 {
     if (s_instance == nullptr)
     {
+        // 빌드에 쓰인 명령어 집합을 CPU가 지원하지 않으면 첫 SIMD 커널에서 잘못된 명령어로 죽으므로 미리 알린다.
+        if (false == Simd::IsSupported())
+        {
+            HS_LOG(crash, "This CPU does not support %s. Rebuild without HS_ENABLE_AVX2.", Simd::GetInstructionSetName());
+            return false;
+        }
+
         s_instance = new SystemContext();
         return true;
     }
@@ -0,0 +1,316 @@
+//
+//  Profiler.cpp
+//  Core
+//
+//  Scoped CPU profiler implementation
+//
+#include "Core/Profile/Profiler.h"
+#include "Core/Container/RingQueue.h"
+#include "Core/Log.h"
+
+#include "json.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr size_t s_threadBufferCapacity = 16384;
+
+struct ThreadBuffer
+{
+    SPSCQueue<ProfileEvent, s_threadBufferCapacity> events; // 생산자 = 소유 스레드, 소비자 = EndFrame
+    uint16                                          index = 0;
+    uint16                                          depth = 0; // 소유 스레드 전용
+    std::string                                     name;      // ProfilerState::mutex 보호
+    std::atomic<bool>                               isRetired{false};
+};
+
+struct ProfilerState
+{
+    std::mutex mutex;
+
+    std::vector<Scoped<ThreadBuffer>> threads;
+    uint16                            nextThreadIndex = 0;
+
+    ProfileFrame frames[Profiler::HISTORY_COUNT];
+    uint64       frameCount   = 0;
+    uint64       frameBeginNs = 0;
+
+    std::atomic<bool>   isEnabled{true};
+    std::atomic<uint64> droppedCount{0};
+};
+
+// 스레드 종료나 정적 객체 소멸 중에도 스코프가 끝날 수 있으므로 해제하지 않는다.
+ProfilerState& getState()
+{
+    static ProfilerState* s_state = new ProfilerState();
+    return *s_state;
+}
+
+// 스레드가 끝나면 버퍼를 retire로 표시하고, EndFrame이 남은 이벤트를 모은 뒤 제거한다.
+struct ThreadBufferOwner
+{
+    ThreadBuffer* buffer = nullptr;
+
+    ~ThreadBufferOwner()
+    {
+        if (nullptr != buffer)
+        {
+            buffer->isRetired.store(true, std::memory_order_release);
+            buffer = nullptr;
+        }
+    }
+};
+
+thread_local ThreadBufferOwner t_threadBuffer;
+
+ThreadBuffer* getThreadBuffer()
+{
+    ThreadBuffer* buffer = t_threadBuffer.buffer;
+    if (nullptr != buffer)
+    {
+        return buffer;
+    }
+
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto newBuffer   = MakeScoped<ThreadBuffer>();
+    newBuffer->index = state.nextThreadIndex++;
+    newBuffer->name  = "Thread " + std::to_string(newBuffer->index);
+
+    buffer = newBuffer.get();
+    state.threads.push_back(std::move(newBuffer));
+    t_threadBuffer.buffer = buffer;
+    return buffer;
+}
+} // namespace
+
+void Profiler::SetEnabled(bool enabled)
+{
+    getState().isEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::IsEnabled()
+{
+    return getState().isEnabled.load(std::memory_order_relaxed);
+}
+
+void Profiler::SetThreadName(const char* name)
+{
+    ThreadBuffer* buffer = getThreadBuffer();
+
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    buffer->name = (nullptr != name) ? name : "";
+}
+
+uint64 Profiler::GetTimestamp()
+{
+    return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64 Profiler::beginScope()
+{
+    if (false == getState().isEnabled.load(std::memory_order_relaxed))
+    {
+        return 0;
+    }
+
+    getThreadBuffer()->depth++;
+    return GetTimestamp();
+}
+
+void Profiler::endScope(const char* name, uint64 beginNs)
+{
+    const uint64 endNs   = GetTimestamp();
+    ThreadBuffer* buffer = getThreadBuffer();
+    buffer->depth--;
+
+    const ProfileEvent event{name, beginNs, endNs, buffer->depth, buffer->index};
+    if (false == buffer->events.TryPush(event))
+    {
+        getState().droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::EndFrame()
+{
+    const uint64 nowNs   = GetTimestamp();
+    ProfilerState& state = getState();
+
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    ProfileFrame& frame = state.frames[state.frameCount % HISTORY_COUNT];
+    frame.frameIndex    = state.frameCount;
+    frame.beginNs       = (state.frameBeginNs != 0) ? state.frameBeginNs : nowNs;
+    frame.endNs         = nowNs;
+    frame.events.clear();
+
+    for (auto it = state.threads.begin(); it != state.threads.end();)
+    {
+        ThreadBuffer& buffer = **it;
+        const bool isRetired = buffer.isRetired.load(std::memory_order_acquire);
+
+        ProfileEvent event;
+        while (buffer.events.TryPop(event))
+        {
+            frame.events.push_back(event);
+        }
+
+        it = isRetired ? state.threads.erase(it) : it + 1;
+    }
+
+    std::sort(frame.events.begin(), frame.events.end(), [](const ProfileEvent& lhs, const ProfileEvent& rhs)
+    {
+        return (lhs.threadIndex != rhs.threadIndex) ? (lhs.threadIndex < rhs.threadIndex) : (lhs.beginNs < rhs.beginNs);
+    });
+
+    const uint64 dropped = state.droppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+    {
+        HS_LOG(warning, "Profiler: %llu events dropped (thread buffer full)", static_cast<unsigned long long>(dropped));
+    }
+
+    state.frameCount++;
+    state.frameBeginNs = nowNs;
+}
+
+bool Profiler::GetFrame(uint64 frameIndex, ProfileFrame& outFrame)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (frameIndex >= state.frameCount || state.frameCount - frameIndex > HISTORY_COUNT)
+    {
+        return false;
+    }
+
+    outFrame = state.frames[frameIndex % HISTORY_COUNT];
+    return true;
+}
+
+bool Profiler::GetLatestFrame(ProfileFrame& outFrame)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if (state.frameCount == 0)
+    {
+        return false;
+    }
+
+    outFrame = state.frames[(state.frameCount - 1) % HISTORY_COUNT];
+    return true;
+}
+
+uint64 Profiler::GetFrameTimes(std::vector<float>& outFrameTimesMs)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    const uint64 count = std::min<uint64>(state.frameCount, HISTORY_COUNT);
+    outFrameTimesMs.resize(static_cast<size_t>(count));
+
+    // 오래된 프레임부터
+    for (uint64 i = 0; i < count; i++)
+    {
+        const ProfileFrame& frame = state.frames[(state.frameCount - count + i) % HISTORY_COUNT];
+        outFrameTimesMs[i]        = static_cast<float>(static_cast<double>(frame.endNs - frame.beginNs) * 1e-6);
+    }
+
+    return state.frameCount - count;
+}
+
+void Profiler::GetThreads(std::vector<ProfileThreadInfo>& outThreads)
+{
+    ProfilerState& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    outThreads.clear();
+    outThreads.reserve(state.threads.size());
+    for (const auto& thread : state.threads)
+    {
+        outThreads.push_back(ProfileThreadInfo{thread->index, thread->name});
+    }
+}
+
+bool Profiler::ExportChromeTrace(const std::string& path)
+{
+    using json = nlohmann::json;
+
+    ProfilerState& state = getState();
+    json events          = json::array();
+
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        const uint64 count = std::min<uint64>(state.frameCount, HISTORY_COUNT);
+        if (count == 0)
+        {
+            HS_LOG(warning, "Profiler: no frames to export");
+            return false;
+        }
+
+        const uint64 originNs = state.frames[(state.frameCount - count) % HISTORY_COUNT].beginNs;
+        auto toMicroseconds   = [originNs](uint64 ns) { return static_cast<double>(ns - originNs) * 1e-3; };
+
+        // tid 0은 프레임 구간 표시용, 스레드는 index + 1
+        events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 0}, {"tid", 0}, {"args", {{"name", "Frames"}}}});
+        for (const auto& thread : state.threads)
+        {
+            events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 0}, {"tid", thread->index + 1}, {"args", {{"name", thread->name}}}});
+        }
+
+        for (uint64 i = 0; i < count; i++)
+        {
+            const ProfileFrame& frame = state.frames[(state.frameCount - count + i) % HISTORY_COUNT];
+            events.push_back({{"name", "Frame " + std::to_string(frame.frameIndex)},
+                              {"cat", "frame"},
+                              {"ph", "X"},
+                              {"pid", 0},
+                              {"tid", 0},
+                              {"ts", toMicroseconds(frame.beginNs)},
+                              {"dur", static_cast<double>(frame.endNs - frame.beginNs) * 1e-3}});
+
+            for (const ProfileEvent& event : frame.events)
+            {
+                if (event.beginNs < originNs)
+                {
+                    continue;
+                }
+
+                events.push_back({{"name", event.name},
+                                  {"cat", "cpu"},
+                                  {"ph", "X"},
+                                  {"pid", 0},
+                                  {"tid", event.threadIndex + 1},
+                                  {"ts", toMicroseconds(event.beginNs)},
+                                  {"dur", static_cast<double>(event.endNs - event.beginNs) * 1e-3}});
+            }
+        }
+    }
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (false == file.is_open())
+    {
+        HS_LOG(error, "Profiler: fail to open %s", path.c_str());
+        return false;
+    }
+
+    json trace;
+    trace["traceEvents"]     = std::move(events);
+    trace["displayTimeUnit"] = "ms";
+    file << trace.dump();
+
+    HS_LOG(info, "Profiler: trace exported to %s", path.c_str());
+    return true;
+}
+
+HS_NS_END
@@ -0,0 +1,122 @@
+//
+//  Profiler.h
+//  Core
+//
+//  Hierarchical scoped CPU profiler with per-frame collection and Chrome trace export
+//
+#ifndef __HS_PROFILER_H__
+#define __HS_PROFILER_H__
+
+#include "Precompile.h"
+
+#include <string>
+#include <vector>
+
+#ifndef HS_PROFILE_ENABLED
+#if defined(_RELEASE)
+#define HS_PROFILE_ENABLED 0
+#else
+#define HS_PROFILE_ENABLED 1
+#endif
+#endif
+
+HS_NS_BEGIN
+
+struct ProfileEvent
+{
+    const char* name; // 문자열 리터럴처럼 프로그램이 끝날 때까지 유효한 문자열이어야 한다.
+    uint64      beginNs;
+    uint64      endNs;
+    uint16      depth;
+    uint16      threadIndex;
+};
+
+struct ProfileThreadInfo
+{
+    uint16      index;
+    std::string name;
+};
+
+struct ProfileFrame
+{
+    uint64                    frameIndex = 0;
+    uint64                    beginNs    = 0;
+    uint64                    endNs      = 0;
+    std::vector<ProfileEvent> events; // 스레드, 시작 시각 순으로 정렬되어 있다.
+};
+
+// 각 스레드는 자신의 lock-free 버퍼에 완료된 스코프를 기록하고,
+// 메인 루프의 EndFrame이 모든 버퍼를 모아 프레임 단위로 보관한다. 최근 HISTORY_COUNT 프레임만 유지한다.
+// 시각은 steady clock 기준 ns이다.
+class HS_API Profiler
+{
+public:
+    static constexpr uint32 HISTORY_COUNT = 240;
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+
+    // 호출한 스레드의 이름을 지정한다. 타임라인과 트레이스에 표시된다.
+    static void SetThreadName(const char* name);
+
+    // 현재 프레임을 닫고 다음 프레임을 시작한다. 메인 루프에서 매 프레임 한 번 호출한다.
+    static void EndFrame();
+
+    // 보관 기간이 지난 프레임이면 false를 돌려준다.
+    static bool GetFrame(uint64 frameIndex, ProfileFrame& outFrame);
+    static bool GetLatestFrame(ProfileFrame& outFrame);
+    // 보관 중인 프레임의 시간을 오래된 순으로 채우고, 첫 프레임의 index를 돌려준다.
+    static uint64 GetFrameTimes(std::vector<float>& outFrameTimesMs);
+    static void GetThreads(std::vector<ProfileThreadInfo>& outThreads);
+
+    // 보관 중인 프레임을 Chrome trace(JSON) 형식으로 저장한다. chrome://tracing 또는 Perfetto에서 열 수 있다.
+    static bool ExportChromeTrace(const std::string& path);
+
+    static uint64 GetTimestamp();
+
+private:
+    friend class ProfileScope;
+
+    static uint64 beginScope();
+    static void   endScope(const char* name, uint64 beginNs);
+};
+
+class ProfileScope
+{
+public:
+    explicit ProfileScope(const char* name)
+        : _name(name)
+        , _beginNs(Profiler::beginScope())
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (_beginNs != 0)
+        {
+            Profiler::endScope(_name, _beginNs);
+        }
+    }
+
+    ProfileScope(const ProfileScope&)            = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* _name;
+    uint64      _beginNs;
+};
+
+#define HS_PROFILE_CONCAT_INNER(a, b) a##b
+#define HS_PROFILE_CONCAT(a, b)       HS_PROFILE_CONCAT_INNER(a, b)
+
+#if HS_PROFILE_ENABLED
+#define HS_PROFILE_SCOPE(name) hs::ProfileScope HS_PROFILE_CONCAT(hsProfileScope, __LINE__)(name)
+#define HS_PROFILE_FUNCTION()  HS_PROFILE_SCOPE(__FUNCTION__)
+#else
+#define HS_PROFILE_SCOPE(name)
+#define HS_PROFILE_FUNCTION()
+#endif
+
+HS_NS_END
+
+#endif
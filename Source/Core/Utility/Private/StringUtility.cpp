@@ -9,8 +9,11 @@ std::string Format(const char* fmt, ...)
 	va_list args;
 	va_start(args, fmt);
 
-	// Get the size of the formatted string
-	int size = vsnprintf(nullptr, 0, fmt, args);
+	// Get the size of the formatted string. 길이를 재는 호출이 args를 소비하므로 복사본으로 잰다.
+	va_list sizeArgs;
+	va_copy(sizeArgs, args);
+	int size = vsnprintf(nullptr, 0, fmt, sizeArgs);
+	va_end(sizeArgs);
 	if (size < 0)
 	{
 		va_end(args);
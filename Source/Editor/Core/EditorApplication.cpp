@@ -2,6 +2,8 @@
 
 #include "Core/Log.h"
 #include "Core/HAL/Timer.h"
+#include "Core/Job/JobSystem.h"
+#include "Core/Profile/Profiler.h"
 #include "Core/Native/NativeWindow.h"
 
 #include "Engine/EngineContext.h"
@@ -23,6 +25,9 @@ EditorApplication::EditorApplication(const char* appName) noexcept
 {
 	_guiContext = new GUIContext();
 
+	Log::Initialize("hsmr_debug.log");
+	Profiler::SetThreadName("Main");
+	JobSystem::Initialize();
 	ObjectManager::Initialize();
 
 	EWindowFlags windowFlags = EWindowFlags::NONE;
@@ -62,6 +67,8 @@ void EditorApplication::Shutdown()
 	//...
 
 	ObjectManager::Finalize();
+	JobSystem::Finalize();
+	Log::Finalize();
 }
 
 void EditorApplication::Run()
@@ -74,7 +81,11 @@ void EditorApplication::Run()
 #if defined(__APPLE__)
 		AutoReleasePool pool;
 #endif
-		_window->ProcessEvent();
+		{
+			HS_PROFILE_SCOPE("ProcessEvent");
+			_window->ProcessEvent();
+			JobSystem::ProcessMainThreadJobs();
+		}
 
 		if (!_window->IsOpened())
 		{
@@ -85,15 +96,28 @@ void EditorApplication::Run()
         _deltaTime    = curTime - lastTime;
         lastTime      = curTime;
         
-		_window->NextFrame();
-
-		_window->Update(_deltaTime);
-
-		_window->Render();
-
-		_window->Present();
+		{
+			HS_PROFILE_SCOPE("NextFrame");
+			_window->NextFrame();
+		}
+		{
+			HS_PROFILE_SCOPE("Update");
+			_window->Update(_deltaTime);
+		}
+		{
+			HS_PROFILE_SCOPE("Render");
+			_window->Render();
+		}
+		{
+			HS_PROFILE_SCOPE("Present");
+			_window->Present();
+		}
+		{
+			HS_PROFILE_SCOPE("Flush");
+			_window->Flush();
+		}
 
-		_window->Flush();
+		Profiler::EndFrame();
 	}
 
 	Shutdown();
@@ -21,6 +21,10 @@
 
 #include "Editor/Core/EditorCamera.h"
 
+#if defined(__LINUX__)
+#include <cstdlib>
+#endif
+
 HS_NS_EDITOR_BEGIN
 
 EditorWindow::EditorWindow(Application* ownerApp, const char* name, uint32 width, uint32 height, EWindowFlags flags)
@@ -41,10 +45,20 @@ bool EditorWindow::onInitialize()
 	scInfo.useStencil = false;
     scInfo.enableVSync  = true;
 
-#if __WINDOWS__
-	_rhiContext = RHIContext::Create(ERHIPlatform::VULKAN);
-#else
+#if defined(__LINUX__)
+	// Linux Vulkan 백엔드는 창 surface 없이 offscreen으로만 그리고, 지정된 경우 프레임을 파일로 읽어온다.
+	scInfo.isOffscreen = true;
+	scInfo.readbackDirectory = ::getenv("HS_HEADLESS_READBACK_DIR");
+	if (const char* interval = ::getenv("HS_HEADLESS_READBACK_INTERVAL"))
+	{
+		scInfo.readbackInterval = static_cast<uint32>(::strtoul(interval, nullptr, 10));
+	}
+#endif
+
+#if __APPLE__
 	_rhiContext = RHIContext::Create(ERHIPlatform::METAL);
+#else
+	_rhiContext = RHIContext::Create(ERHIPlatform::VULKAN);
 #endif
 
 	_swapchain = _rhiContext->CreateSwapchain(scInfo);
@@ -214,6 +228,7 @@ void EditorWindow::setupPanels()
 
 	_profilerPanel = MakeScoped<ProfilerPanel>(this);
 	_profilerPanel->Setup();
+	static_cast<ProfilerPanel*>(_profilerPanel.get())->SetGPUProfiler(_renderer->GetGPUProfiler());
 	_basePanel->InsertPanel(_profilerPanel.get());
 
 	//_hierarchyPanel = MakeScoped<HierarchyPanel>(this);
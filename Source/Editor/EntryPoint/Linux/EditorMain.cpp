@@ -0,0 +1,24 @@
+#include "Editor/EntryPoint/EditorMain.h"
+
+#include "Editor/Core/EditorApplication.h"
+#include "Engine/Window.h"
+
+#include "Core/Log.h"
+
+using namespace hs;
+
+int hs_editor_main(int argc, char* argv[])
+{
+	if (!SystemContext::Init())
+	{
+		return EXIT_FAILURE;
+	}
+
+	hs::Application* app = new hs::editor::EditorApplication("HSMR");
+
+	app->Run();
+
+	app->Shutdown();
+
+	return 0;
+}
@@ -10,16 +10,21 @@
 #include "RHI/Vulkan/VulkanCommandHandle.h"
 #include "RHI/Vulkan/VulkanResourceHandle.h"
 
-#include "ImGui/imgui_impl_win32.h"
 #include "ImGui/imgui_impl_vulkan.h"
 
+#if defined(__WINDOWS__)
+#include "ImGui/imgui_impl_win32.h"
 #include "Platform/Win/WinWindow.h"
+#endif
 
+#include <chrono>
 #include <unordered_map>
 
 using namespace hs;
 
+#if defined(__WINDOWS__)
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
+#endif
 
 
 HS_NS_EDITOR_BEGIN
@@ -28,6 +33,30 @@ static VkPipelineCache s_pipelineCacheVk = VK_NULL_HANDLE;
 static VkDescriptorPool s_descriptorPool = VK_NULL_HANDLE;
 static SamplerVulkan* s_samplerVK;
 
+#if defined(__LINUX__)
+// Linux용 ImGui 플랫폼 백엔드가 없으므로 화면 크기와 프레임 시간만 채운다. 입력은 받지 않는다. (무인 실행용)
+static std::chrono::steady_clock::time_point s_lastFrameTime;
+
+static void init_headless_platform()
+{
+	ImGuiIO& io = ImGui::GetIO();
+	io.BackendPlatformName = "imgui_impl_hsmr_headless";
+	s_lastFrameTime = std::chrono::steady_clock::now();
+}
+
+static void new_headless_platform_frame(hs::Swapchain* swapchain)
+{
+	ImGuiIO& io = ImGui::GetIO();
+	io.DisplaySize = ImVec2(static_cast<float>(swapchain->GetWidth()), static_cast<float>(swapchain->GetHeight()));
+	io.DisplayFramebufferScale = ImVec2(1.0f, 1.0f);
+
+	const auto now = std::chrono::steady_clock::now();
+	const float deltaTime = std::chrono::duration<float>(now - s_lastFrameTime).count();
+	io.DeltaTime = (deltaTime > 0.0f) ? deltaTime : 1.0f / 60.0f;
+	s_lastFrameTime = now;
+}
+#endif
+
 Swapchain* ImGuiExtension::s_currentSwapchain = nullptr;
 uint8 ImGuiExtension::s_currentImageIndex = 0;
 std::vector<std::vector<void*>> ImGuiExtension::s_AddedTexturesPerFrame;
@@ -81,10 +110,14 @@ void ImGuiExtension::InitializeBackend(hs::Swapchain* swapchain)
 	s_AddedTexturesPerFrame.resize(s_currentSwapchain->GetMaxFrameCount());
 
 	SwapchainVulkan* swapchainVK = static_cast<SwapchainVulkan*>(swapchain);
+#if defined(__WINDOWS__)
 	const NativeWindow* nativeWindow = swapchainVK->GetInfo().nativeWindow;
 	HWND hWnd = (HWND)nativeWindow->handle;
 
 	ImGui_ImplWin32_Init(hWnd);
+#else
+	init_headless_platform();
+#endif
 
 	VulkanContext* rhiContextVK = static_cast<VulkanContext*>(RHIContext::Get());
 	const VulkanDevice* rhiDeviceVK = rhiContextVK->GetDevice();
@@ -140,7 +173,11 @@ void ImGuiExtension::InitializeBackend(hs::Swapchain* swapchain)
 
 void ImGuiExtension::SetProcessEventHandler(void** fnHandler)
 {
+#if defined(__WINDOWS__)
 	*fnHandler = static_cast<void*>(ImGui_ImplWin32_WndProcHandler);
+#else
+	*fnHandler = nullptr;
+#endif
 }
 
 void ImGuiExtension::BeginRender(hs::Swapchain* swapchain)
@@ -173,7 +210,11 @@ void ImGuiExtension::BeginRender(hs::Swapchain* swapchain)
 	}
 
 	ImGui_ImplVulkan_NewFrame();
+#if defined(__WINDOWS__)
 	ImGui_ImplWin32_NewFrame();
+#else
+	new_headless_platform_frame(swapchain);
+#endif
 	ImGui::NewFrame();
 }
 
@@ -202,7 +243,9 @@ void ImGuiExtension::FinalizeBackend()
 	VulkanContext* rhiContextVK = static_cast<VulkanContext*>(RHIContext::Get());
 	rhiContextVK->WaitForIdle();
 	ImGui_ImplVulkan_Shutdown();
+#if defined(__WINDOWS__)
 	ImGui_ImplWin32_Shutdown();
+#endif
 
 	// Destroy the pipeline cache
 	if (s_pipelineCacheVk != VK_NULL_HANDLE)
@@ -6,11 +6,17 @@
 //
 #include "Editor/Panel/ProfilerPanel.h"
 
-#include "Core/HAL/Timer.h"
+#include "Core/Hash.h"
 #include "Editor/GUI/ImGuiExtension.h"
 
+#include <algorithm>
+#include <cstring>
+
 HS_NS_EDITOR_BEGIN
 
+static constexpr const char* s_traceFileName = "hsmr_trace.json";
+static constexpr float s_threadLabelWidth = 90.0f;
+
 ProfilerPanel::ProfilerPanel(Window* window)
 	: Panel(window)
 {
@@ -24,32 +30,205 @@ ProfilerPanel::~ProfilerPanel()
 
 bool ProfilerPanel::Setup()
 {
-	Timer::Start();
-
 	return true;
 }
 
 void ProfilerPanel::Cleanup()
 {
-	Timer::Stop();
 }
 
 void ProfilerPanel::Draw()
 {
-	static bool open = true;
+	if (false == _isPaused)
+	{
+		Profiler::GetLatestFrame(_frame);
+		_firstFrameIndex = Profiler::GetFrameTimes(_frameTimes);
+		Profiler::GetThreads(_threads);
 
-	ImGuiWindowFlags windowFlags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoDocking | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+		if (nullptr != _gpuProfiler)
+		{
+			_gpuResults = _gpuProfiler->GetResults();
+		}
+	}
 
-	ImGui::SetNextWindowBgAlpha(0.35f);
-	if (ImGui::Begin("Profiler Overlay", &open, windowFlags))
+	if (ImGui::Begin("Profiler"))
 	{
-		double elapsedTime = Timer::GetElapsedMilliseconds();
-		double delta = elapsedTime - _lastFrameTime;
-		ImGui::Text("Frame: %.1f FPS (%.3f ms/frame)", 1000.0f / delta, delta);
-		_lastFrameTime = elapsedTime;
+		const double frameMs = static_cast<double>(_frame.endNs - _frame.beginNs) * 1e-6;
+		ImGui::Text("Frame %llu: %.1f FPS (%.3f ms/frame)", static_cast<unsigned long long>(_frame.frameIndex), (frameMs > 0.0) ? 1000.0 / frameMs : 0.0, frameMs);
+
+		ImGui::Checkbox("Pause", &_isPaused);
+		ImGui::SameLine();
+		if (ImGui::Button("Export Chrome Trace"))
+		{
+			Profiler::ExportChromeTrace(s_traceFileName);
+		}
+
+		drawFrameHistory();
+		drawTimeline();
+		drawGPUPasses();
 	}
 	ImGui::End();
 }
 
+void ProfilerPanel::drawFrameHistory()
+{
+	if (_frameTimes.empty())
+	{
+		return;
+	}
+
+	const int count = static_cast<int>(_frameTimes.size());
+	ImGui::PlotHistogram("##FrameTimes", _frameTimes.data(), count, 0, nullptr, 0.0f, 33.3f, ImVec2(-1.0f, 60.0f));
+
+	// 일시정지 중에는 히스토그램을 클릭해 해당 프레임의 타임라인을 볼 수 있다.
+	if (_isPaused && ImGui::IsItemClicked())
+	{
+		const ImVec2 min = ImGui::GetItemRectMin();
+		const ImVec2 max = ImGui::GetItemRectMax();
+		const float t = (ImGui::GetIO().MousePos.x - min.x) / std::max(1.0f, max.x - min.x);
+		const int index = std::clamp(static_cast<int>(t * count), 0, count - 1);
+
+		Profiler::GetFrame(_firstFrameIndex + index, _frame);
+	}
+}
+
+void ProfilerPanel::drawTimeline()
+{
+	const uint64 frameNs = std::max<uint64>(1, _frame.endNs - _frame.beginNs);
+
+	ImDrawList* drawList = ImGui::GetWindowDrawList();
+	const ImVec2 origin = ImGui::GetCursorScreenPos();
+	const float width = ImGui::GetContentRegionAvail().x;
+	const float timelineWidth = std::max(1.0f, width - s_threadLabelWidth);
+	const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+	const double nsToPixel = static_cast<double>(timelineWidth) / static_cast<double>(frameNs);
+
+	auto toX = [&](uint64 ns)
+	{
+		const uint64 clamped = std::clamp(ns, _frame.beginNs, _frame.endNs);
+		return origin.x + s_threadLabelWidth + static_cast<float>(static_cast<double>(clamped - _frame.beginNs) * nsToPixel);
+	};
+
+	float y = origin.y;
+	const auto& events = _frame.events;
+	for (size_t begin = 0; begin < events.size();)
+	{
+		// 이벤트는 스레드별로 모여 있다.
+		const uint16 threadIndex = events[begin].threadIndex;
+		size_t end = begin;
+		uint16 maxDepth = 0;
+		while (end < events.size() && events[end].threadIndex == threadIndex)
+		{
+			maxDepth = std::max(maxDepth, events[end].depth);
+			end++;
+		}
+
+		const char* threadName = "Thread";
+		for (const auto& thread : _threads)
+		{
+			if (thread.index == threadIndex)
+			{
+				threadName = thread.name.c_str();
+				break;
+			}
+		}
+		drawList->AddText(ImVec2(origin.x, y), ImGui::GetColorU32(ImGuiCol_Text), threadName);
+
+		for (size_t i = begin; i < end; i++)
+		{
+			const ProfileEvent& event = events[i];
+
+			const float x0 = toX(event.beginNs);
+			const float x1 = std::max(toX(event.endNs), x0 + 1.0f);
+			const float y0 = y + static_cast<float>(event.depth) * rowHeight;
+			const float y1 = y0 + rowHeight - 1.0f;
+
+			const size_t nameLength = ::strlen(event.name);
+			const uint64 hash = StringHash64(event.name, nameLength);
+			const ImU32 color = ImColor::HSV(static_cast<float>(hash % 360) / 360.0f, 0.55f, 0.75f);
+
+			drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), color);
+
+			const ImVec2 textSize = ImGui::CalcTextSize(event.name, event.name + nameLength);
+			if (x1 - x0 > textSize.x + 4.0f)
+			{
+				drawList->AddText(ImVec2(x0 + 2.0f, y0), IM_COL32(0, 0, 0, 255), event.name, event.name + nameLength);
+			}
+
+			if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y1)))
+			{
+				ImGui::SetTooltip("%s\n%.3f ms", event.name, static_cast<double>(event.endNs - event.beginNs) * 1e-6);
+			}
+		}
+
+		y += static_cast<float>(maxDepth + 1) * rowHeight + 4.0f;
+		begin = end;
+	}
+
+	ImGui::Dummy(ImVec2(width, std::max(rowHeight, y - origin.y)));
+}
+
+void ProfilerPanel::drawGPUPasses()
+{
+	if (nullptr == _gpuProfiler || false == _gpuProfiler->IsEnabled())
+	{
+		return;
+	}
+
+	// GPU 결과는 프레임 슬롯 수만큼 늦게 나오므로 위의 CPU 프레임과 같은 프레임이 아니다.
+	if (false == ImGui::CollapsingHeader("GPU Passes", ImGuiTreeNodeFlags_DefaultOpen))
+	{
+		return;
+	}
+
+	const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+	if (false == ImGui::BeginTable("##GPUPasses", 6, flags))
+	{
+		return;
+	}
+
+	ImGui::TableSetupColumn("Pass");
+	ImGui::TableSetupColumn("GPU ms");
+	ImGui::TableSetupColumn("IA Vertices");
+	ImGui::TableSetupColumn("IA Primitives");
+	ImGui::TableSetupColumn("VS Invocations");
+	ImGui::TableSetupColumn("FS Invocations");
+	ImGui::TableHeadersRow();
+
+	double totalMs = 0.0;
+	for (const GPUScopeResult& result : _gpuResults)
+	{
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn();
+		ImGui::TextUnformatted(result.name);
+		ImGui::TableNextColumn();
+		ImGui::Text("%.3f", result.gpuMs);
+
+		const uint64 values[] = {result.statistics.inputAssemblyVertices, result.statistics.inputAssemblyPrimitives, result.statistics.vertexShaderInvocations, result.statistics.fragmentShaderInvocations};
+		for (const uint64 value : values)
+		{
+			ImGui::TableNextColumn();
+			if (result.hasStatistics)
+			{
+				ImGui::Text("%llu", static_cast<unsigned long long>(value));
+			}
+			else
+			{
+				ImGui::TextDisabled("-");
+			}
+		}
+
+		totalMs += result.gpuMs;
+	}
+
+	ImGui::TableNextRow();
+	ImGui::TableNextColumn();
+	ImGui::TextUnformatted("Total");
+	ImGui::TableNextColumn();
+	ImGui::Text("%.3f", totalMs);
+
+	ImGui::EndTable();
+}
+
 
 HS_NS_EDITOR_END
\ No newline at end of file
@@ -10,6 +10,10 @@
 #include "Precompile.h"
 
 #include "Editor/Panel/Panel.h"
+#include "Core/Profile/Profiler.h"
+#include "Engine/Renderer/GPUProfiler.h"
+
+#include <vector>
 
 HS_NS_EDITOR_BEGIN
 
@@ -24,10 +28,22 @@ public:
 
 	void Draw() override;
 
+	HS_FORCEINLINE void SetGPUProfiler(const GPUProfiler* gpuProfiler) { _gpuProfiler = gpuProfiler; }
 
 private:
-	double _lastFrameTime = 0.0;
+	void drawFrameHistory();
+	void drawTimeline();
+	void drawGPUPasses();
+
+	ProfileFrame _frame;
+	std::vector<float> _frameTimes;
+	std::vector<ProfileThreadInfo> _threads;
+	uint64 _firstFrameIndex = 0;
+
+	const GPUProfiler* _gpuProfiler = nullptr;
+	std::vector<GPUScopeResult> _gpuResults;
 
+	bool _isPaused = false;
 };
 
 HS_NS_EDITOR_END
@@ -0,0 +1,88 @@
+//
+//  GPUProfiler.h
+//  Engine
+//
+//  Per-pass GPU timing and pipeline statistics using RHI query pools
+//
+#ifndef __HS_GPU_PROFILER_H__
+#define __HS_GPU_PROFILER_H__
+
+#include "Precompile.h"
+
+#include "RHI/RHIDefinition.h"
+
+#include <vector>
+
+namespace hs { class RHIContext; }
+namespace hs { class RHICommandBuffer; }
+namespace hs { class RHIQueryPool; }
+
+HS_NS_BEGIN
+
+struct GPUScopeResult
+{
+    const char*        name; // 문자열 리터럴처럼 프로그램이 끝날 때까지 유효한 문자열이어야 한다.
+    double             gpuMs;
+    PipelineStatistics statistics;
+    bool               hasStatistics;
+};
+
+// 프레임 슬롯(frames in flight)마다 쿼리 풀을 따로 두고, 슬롯을 다시 쓸 때 펜스를 기다린 뒤이므로
+// 이전 결과를 기다림 없이 읽는다. 결과는 슬롯 수만큼 늦게 나온다.
+// 슬롯 수는 스왑체인의 최대 프레임 수와 같아야 한다. (SetFrameCount)
+// 스코프는 중첩할 수 없고, 렌더 패스 밖에서 열고 닫아야 한다.
+class HS_API GPUProfiler
+{
+public:
+    static constexpr uint32 DEFAULT_FRAMES_IN_FLIGHT = 3;
+    static constexpr uint32 MAX_SCOPES               = 64;
+
+    GPUProfiler(RHIContext* rhiContext);
+    ~GPUProfiler();
+
+    bool Initialize();
+    void Finalize();
+
+    // 슬롯 수를 늘린다. 줄이지는 않는다. 진행 중인 프레임이 없을 때만 호출해야 한다.
+    void SetFrameCount(uint32 frameCount);
+    HS_FORCEINLINE uint32 GetFrameCount() const { return static_cast<uint32>(_frames.size()); }
+
+    // 슬롯의 펜스를 기다린 뒤 호출한다. 슬롯에 남아 있던 지난 결과를 읽어온다.
+    void BeginFrame(uint32 frameSlot);
+
+    // 커맨드 버퍼 Begin 직후, 첫 스코프 전에 호출한다.
+    void Reset(RHICommandBuffer* cmdBuffer);
+
+    void BeginScope(RHICommandBuffer* cmdBuffer, const char* name);
+    void EndScope(RHICommandBuffer* cmdBuffer);
+
+    HS_FORCEINLINE bool IsEnabled() const { return _isEnabled; }
+    HS_FORCEINLINE const std::vector<GPUScopeResult>& GetResults() const { return _results; }
+
+private:
+    struct FrameQueries
+    {
+        RHIQueryPool*            timestampPool  = nullptr;
+        RHIQueryPool*            statisticsPool = nullptr;
+        std::vector<const char*> scopeNames;
+        bool                     isReset = false;
+    };
+
+    bool createFrameQueries(FrameQueries& frame);
+
+    RHIContext*               _rhiContext;
+    std::vector<FrameQueries> _frames;
+    uint32                    _curFrameSlot = 0;
+    bool                      _isScopeOpen     = false;
+    bool                      _isEnabled       = false;
+    double                    _timestampPeriod = 0.0;
+
+    std::vector<GPUScopeResult> _results;
+
+    std::vector<uint64>             _timestampData;
+    std::vector<PipelineStatistics> _statisticsData;
+};
+
+HS_NS_END
+
+#endif
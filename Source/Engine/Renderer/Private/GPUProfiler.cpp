@@ -0,0 +1,218 @@
+//
+//  GPUProfiler.cpp
+//  Engine
+//
+//  Per-pass GPU timing and pipeline statistics using RHI query pools
+//
+#include "Engine/Renderer/GPUProfiler.h"
+
+#include "Core/Log.h"
+
+#include "RHI/RHIContext.h"
+#include "RHI/CommandHandle.h"
+#include "RHI/RenderHandle.h"
+
+HS_NS_BEGIN
+
+GPUProfiler::GPUProfiler(RHIContext* rhiContext)
+    : _rhiContext(rhiContext)
+{
+}
+
+GPUProfiler::~GPUProfiler()
+{
+    Finalize();
+}
+
+bool GPUProfiler::Initialize()
+{
+    _timestampPeriod = _rhiContext->GetTimestampPeriod();
+    if (_timestampPeriod <= 0.0)
+    {
+        HS_LOG(warning, "GPUProfiler: timestamp query is not supported on this device");
+        return false;
+    }
+
+    _timestampData.resize(MAX_SCOPES * 2);
+    _statisticsData.resize(MAX_SCOPES);
+    _isEnabled = true;
+
+    SetFrameCount(DEFAULT_FRAMES_IN_FLIGHT);
+
+    return _isEnabled;
+}
+
+void GPUProfiler::Finalize()
+{
+    for (FrameQueries& frame : _frames)
+    {
+        if (nullptr != frame.timestampPool)
+        {
+            _rhiContext->DestroyQueryPool(frame.timestampPool);
+            frame.timestampPool = nullptr;
+        }
+        if (nullptr != frame.statisticsPool)
+        {
+            _rhiContext->DestroyQueryPool(frame.statisticsPool);
+            frame.statisticsPool = nullptr;
+        }
+        frame.scopeNames.clear();
+        frame.isReset = false;
+    }
+
+    _frames.clear();
+    _curFrameSlot = 0;
+    _results.clear();
+    _isEnabled = false;
+}
+
+void GPUProfiler::SetFrameCount(uint32 frameCount)
+{
+    if (false == _isEnabled)
+    {
+        return;
+    }
+
+    _frames.reserve(frameCount);
+    while (_frames.size() < frameCount)
+    {
+        _frames.emplace_back();
+        if (false == createFrameQueries(_frames.back()))
+        {
+            Finalize();
+            return;
+        }
+    }
+}
+
+bool GPUProfiler::createFrameQueries(FrameQueries& frame)
+{
+    QueryPoolInfo timestampInfo{};
+    timestampInfo.type       = EQueryType::TIMESTAMP;
+    timestampInfo.queryCount = MAX_SCOPES * 2;
+    frame.timestampPool      = _rhiContext->CreateQueryPool("GPUProfiler Timestamp", timestampInfo);
+
+    if (_rhiContext->IsPipelineStatisticsSupported())
+    {
+        QueryPoolInfo statisticsInfo{};
+        statisticsInfo.type       = EQueryType::PIPELINE_STATISTICS;
+        statisticsInfo.queryCount = MAX_SCOPES;
+        frame.statisticsPool      = _rhiContext->CreateQueryPool("GPUProfiler Statistics", statisticsInfo);
+    }
+
+    frame.scopeNames.reserve(MAX_SCOPES);
+
+    return nullptr != frame.timestampPool;
+}
+
+void GPUProfiler::BeginFrame(uint32 frameSlot)
+{
+    if (false == _isEnabled)
+    {
+        return;
+    }
+
+    _curFrameSlot       = frameSlot % static_cast<uint32>(_frames.size());
+    FrameQueries& frame = _frames[_curFrameSlot];
+    frame.isReset       = false;
+
+    const uint32 scopeCount = static_cast<uint32>(frame.scopeNames.size());
+    if (scopeCount == 0)
+    {
+        return;
+    }
+
+    // 아직 결과가 없으면 지난 결과를 그대로 둔다.
+    if (false == _rhiContext->GetQueryResults(frame.timestampPool, 0, scopeCount * 2, _timestampData.data(), sizeof(uint64) * scopeCount * 2))
+    {
+        frame.scopeNames.clear();
+        return;
+    }
+
+    const bool hasStatistics = (nullptr != frame.statisticsPool) &&
+                               _rhiContext->GetQueryResults(frame.statisticsPool, 0, scopeCount, _statisticsData.data(), sizeof(PipelineStatistics) * scopeCount);
+
+    const double tickToMs = _timestampPeriod * 1e-6;
+
+    _results.resize(scopeCount);
+    for (uint32 i = 0; i < scopeCount; i++)
+    {
+        const uint64 begin = _timestampData[i * 2];
+        const uint64 end   = _timestampData[i * 2 + 1];
+
+        GPUScopeResult& result = _results[i];
+        result.name            = frame.scopeNames[i];
+        result.gpuMs           = (end > begin) ? static_cast<double>(end - begin) * tickToMs : 0.0;
+        result.statistics      = hasStatistics ? _statisticsData[i] : PipelineStatistics{};
+        result.hasStatistics   = hasStatistics;
+    }
+
+    frame.scopeNames.clear();
+}
+
+void GPUProfiler::Reset(RHICommandBuffer* cmdBuffer)
+{
+    if (false == _isEnabled)
+    {
+        return;
+    }
+
+    FrameQueries& frame = _frames[_curFrameSlot];
+    cmdBuffer->ResetQueryPool(frame.timestampPool, 0, MAX_SCOPES * 2);
+    if (nullptr != frame.statisticsPool)
+    {
+        cmdBuffer->ResetQueryPool(frame.statisticsPool, 0, MAX_SCOPES);
+    }
+
+    frame.scopeNames.clear();
+    frame.isReset = true;
+}
+
+void GPUProfiler::BeginScope(RHICommandBuffer* cmdBuffer, const char* name)
+{
+    cmdBuffer->PushDebugMark(name, nullptr);
+
+    if (false == _isEnabled)
+    {
+        return;
+    }
+
+    FrameQueries& frame = _frames[_curFrameSlot];
+    if (false == frame.isReset || frame.scopeNames.size() >= MAX_SCOPES)
+    {
+        return;
+    }
+
+    HS_ASSERT(false == _isScopeOpen, "GPUProfiler scopes can't be nested");
+
+    const uint32 scopeIndex = static_cast<uint32>(frame.scopeNames.size());
+    cmdBuffer->WriteTimestamp(frame.timestampPool, scopeIndex * 2);
+    if (nullptr != frame.statisticsPool)
+    {
+        cmdBuffer->BeginQuery(frame.statisticsPool, scopeIndex);
+    }
+
+    frame.scopeNames.push_back(name);
+    _isScopeOpen = true;
+}
+
+void GPUProfiler::EndScope(RHICommandBuffer* cmdBuffer)
+{
+    if (_isScopeOpen)
+    {
+        FrameQueries& frame     = _frames[_curFrameSlot];
+        const uint32 scopeIndex = static_cast<uint32>(frame.scopeNames.size()) - 1;
+
+        if (nullptr != frame.statisticsPool)
+        {
+            cmdBuffer->EndQuery(frame.statisticsPool, scopeIndex);
+        }
+        cmdBuffer->WriteTimestamp(frame.timestampPool, scopeIndex * 2 + 1);
+
+        _isScopeOpen = false;
+    }
+
+    cmdBuffer->PopDebugMark();
+}
+
+HS_NS_END
@@ -7,8 +7,11 @@
 #include "Renderer/RenderPath.h"
 
 #include "Core/Log.h"
+#include "Core/Memory/MemoryPool.h"
+#include "Core/Profile/Profiler.h"
 
 #include "RHI/Swapchain.h"
+#include "Renderer/GPUProfiler.h"
 #include "Renderer/RenderPass/RenderPass.h"
 
 HS_NS_BEGIN
@@ -60,43 +63,53 @@ RenderPath::RHIHandleCache::~RHIHandleCache()
 
 RHIRenderPass* RenderPath::RHIHandleCache::GetRenderPass(const RenderPassInfo& info)
 {
-    uint32 hash = Hasher<RenderPassInfo>::Get(info);
-
-    if (_renderPassCache.find(hash) == _renderPassCache.end())
+    auto it = _renderPassCache.find(info);
+    if (it != _renderPassCache.end())
     {
-        RHIRenderPass* renderPass = _renderer->GetRHIContext()->CreateRenderPass("RenderPass", info);
-
-        _renderPassCache.insert(std::make_pair(hash, renderPass));
+        return it->second;
     }
 
-    return _renderPassCache[hash];
+    RHIRenderPass* renderPass = _renderer->GetRHIContext()->CreateRenderPass("RenderPass", info);
+    _renderPassCache.insert(std::make_pair(info, renderPass));
+
+    return renderPass;
 }
 
 RHIFramebuffer* RenderPath::RHIHandleCache::GetFramebuffer(RHIRenderPass* renderPass, RenderTarget* renderTarget)
 {
-    uint32 hash = HashCombine(Hasher<RenderTarget>::Get(*renderTarget), Hasher<RHIRenderPass>::Get(*renderPass));
-
-    if (_framebufferCache.find(hash) == _framebufferCache.end())
+    FramebufferInfo fbInfo{};
+    fbInfo.width                  = renderTarget->GetWidth();
+    fbInfo.height                 = renderTarget->GetHeight();
+    fbInfo.colorBuffers           = renderTarget->GetColorTextures();
+    fbInfo.depthStencilBuffer     = renderTarget->GetDepthStencilTexture();
+    fbInfo.resolveBuffer          = nullptr;
+    fbInfo.isSwapchainFramebuffer = renderPass->info.isSwapchainRenderPass;
+    fbInfo.renderPass             = renderPass;
+
+    auto it = _framebufferCache.find(fbInfo);
+    if (it != _framebufferCache.end())
     {
-        FramebufferInfo fbInfo{};
-        fbInfo.width                  = renderTarget->GetWidth();
-        fbInfo.height                 = renderTarget->GetHeight();
-        fbInfo.colorBuffers           = renderTarget->GetColorTextures(); // COPY?!
-        fbInfo.depthStencilBuffer     = renderTarget->GetDepthStencilTexture();
-        fbInfo.isSwapchainFramebuffer = renderPass->info.isSwapchainRenderPass;
-        fbInfo.renderPass             = renderPass;
-
-        RHIFramebuffer* fb = _renderer->GetRHIContext()->CreateFramebuffer("Framebuffer", fbInfo);
-
-        _framebufferCache.insert(std::make_pair(hash, fb));
+        return it->second;
     }
 
-    return _framebufferCache[hash];
+    RHIFramebuffer* fb = _renderer->GetRHIContext()->CreateFramebuffer("Framebuffer", fbInfo);
+    _framebufferCache.insert(std::make_pair(fbInfo, fb));
+
+    return fb;
 }
 
 RHIGraphicsPipeline* RenderPath::RHIHandleCache::GetGraphicsPipeline(const GraphicsPipelineInfo& info)
 {
-    return nullptr;
+    auto it = _gPipelineCache.find(info);
+    if (it != _gPipelineCache.end())
+    {
+        return it->second;
+    }
+
+    RHIGraphicsPipeline* pipeline = _renderer->GetRHIContext()->CreateGraphicsPipeline("GraphicsPipeline", info);
+    _gPipelineCache.insert(std::make_pair(info, pipeline));
+
+    return pipeline;
 }
 
 RenderPath::RenderPath(RHIContext* context)
@@ -115,6 +128,11 @@ RenderPath::~RenderPath()
 bool RenderPath::Initialize()
 {
     _rhiHandleCache = new RHIHandleCache(this);
+
+    // 타임스탬프를 지원하지 않으면 GPU 시간 측정 없이 동작한다.
+    _gpuProfiler = new GPUProfiler(_rhiContext);
+    _gpuProfiler->Initialize();
+
     _isInitialized = true;
 
     return _isInitialized;
@@ -122,29 +140,52 @@ bool RenderPath::Initialize()
 
 void RenderPath::NextFrame(Swapchain* swapchain)
 {
+    HS_PROFILE_SCOPE("RenderPath::NextFrame");
+
     frameIndex = _rhiContext->AcquireNextImage(swapchain);
     if (frameIndex == UINT32_MAX)
     {
         _rhiContext->Restore(swapchain);
         return;
     }
+    // 스왑체인이 처음 쓰이거나 다시 만들어진 직후에만 바뀐다. 이때는 진행 중인 프레임이 없다.
+    if (FrameAllocator::Get().GetFrameCount() != swapchain->GetMaxFrameCount())
+    {
+        FrameAllocator::Get().SetFrameCount(swapchain->GetMaxFrameCount());
+    }
+    if (_gpuProfiler->GetFrameCount() < swapchain->GetMaxFrameCount())
+    {
+        _gpuProfiler->SetFrameCount(swapchain->GetMaxFrameCount());
+    }
+
+    // AcquireNextImage가 이번 프레임 슬롯의 펜스를 기다린 뒤이므로 해당 슬롯의 프레임 메모리를 재사용해도 안전하다.
+    FrameAllocator::Get().BeginFrame(swapchain->GetCurrentFrameIndex());
+    _gpuProfiler->BeginFrame(swapchain->GetCurrentFrameIndex());
     _curCommandBuffer = swapchain->GetCommandBufferForCurrentFrame();
 }
 
 void RenderPath::Render(const RenderParameter& param, RenderTarget* renderTarget)
 {
+    HS_PROFILE_SCOPE("RenderPath::Render");
+
     for (auto* pass : _rendererPasses)
     {
         pass->OnBeforeRendering(frameIndex);
     }
 
+    _gpuProfiler->Reset(_curCommandBuffer);
+
     for (auto* pass : _rendererPasses)
     {
+        HS_PROFILE_SCOPE("RenderPass");
+
         pass->Configure(renderTarget);
 
         RHIRenderPass* renderPass = GetHandleCache()->GetRenderPass(pass->GetFixedSettingForCurrentPass());
 
+        _gpuProfiler->BeginScope(_curCommandBuffer, pass->name);
         pass->Execute(_curCommandBuffer, renderPass);
+        _gpuProfiler->EndScope(_curCommandBuffer);
     }
 
     for (auto* pass : _rendererPasses)
@@ -166,6 +207,13 @@ void RenderPath::Shutdown()
     _rendererPasses.clear();
     _curCommandBuffer = nullptr;
 
+    if (nullptr != _gpuProfiler)
+    {
+        _rhiContext->WaitForIdle();
+        delete _gpuProfiler;
+        _gpuProfiler = nullptr;
+    }
+
     _isInitialized = false;
 }
 
@@ -33,6 +33,8 @@ void ForwardOpaquePass::Configure(RenderTarget* renderTarget)
 
 	const RenderTargetInfo& rtInfo = _currentRenderTarget->GetInfo();
 
+	// 매 프레임 다시 구성하므로 이전 프레임의 attachment를 비운다(용량은 유지되어 재할당 없음).
+	_renderPassInfo.colorAttachments.clear();
 	_renderPassInfo.colorAttachmentCount = 1;
 	Attachment ca{};
 	ca.format = rtInfo.colorTextureInfos[0].format;
@@ -145,6 +147,9 @@ void ForwardOpaquePass::createResourceHandles()
 	SystemContext* systemContext = SystemContext::Get();
 	std::string libPath = systemContext->assetDirectory + "Shaders\\Basic.vert.spv";
 	const char* entryName = "main";
+#else
+	std::string libPath = SystemContext::Get()->assetDirectory + "Shaders/Basic.vert.spv";
+	const char* entryName = "main";
 #endif
 
 	ShaderInfo vsInfo{};
@@ -162,6 +167,8 @@ void ForwardOpaquePass::createResourceHandles()
 
 #elif __WINDOWS__
 	libPath = SystemContext::Get()->assetDirectory + std::string("Shaders\\Basic.frag.spv");
+#else
+	libPath = SystemContext::Get()->assetDirectory + std::string("Shaders/Basic.frag.spv");
 #endif
 	ShaderInfo fsInfo{};
 	fsInfo.entryName = entryName;
@@ -13,14 +13,15 @@
 #include "Engine/Renderer/RendererDefinition.h"
 #include "RHI/RHIDefinition.h"
 #include "RHI/RHIContext.h"
+#include "Core/Container/FlatHashMap.h"
 
 #include <vector>
-#include <unordered_map>
 
 /*#include "Renderer/RenderPass/RenderPass.h"*/ namespace hs { class RenderPass; }
 /*#include "RHI/Swapchain.h"*/ namespace hs { class Swapchain; }
 /*#include "RHI/RenderHandle.h"*/ namespace hs { class RHIFramebuffer; }
 /*#include "Platform/NativeWindow.h"*/ namespace hs { struct NativeWindow; }
+/*#include "Renderer/GPUProfiler.h"*/ namespace hs { class GPUProfiler; }
 
 HS_NS_BEGIN
 
@@ -42,9 +43,10 @@ public:
     private:
         RenderPath* _renderer;
 
-        std::unordered_map<uint32, RHIRenderPass*> _renderPassCache;
-        std::unordered_map<uint32, RHIFramebuffer*> _framebufferCache;
-        std::unordered_map<uint32, RHIGraphicsPipeline*> _gPipelineCache;
+        // 64bit 해시로 찾은 뒤 키 전체를 비교하므로 해시 충돌 시에도 다른 객체를 돌려주지 않는다.
+        FlatHashMap<RenderPassInfo, RHIRenderPass*> _renderPassCache;
+        FlatHashMap<FramebufferInfo, RHIFramebuffer*> _framebufferCache;
+        FlatHashMap<GraphicsPipelineInfo, RHIGraphicsPipeline*> _gPipelineCache;
     };
 
     RenderPath(RHIContext* rhiContext);
@@ -72,9 +74,12 @@ public:
 
     HS_FORCEINLINE RHIHandleCache* GetHandleCache() const { return _rhiHandleCache; }
 
+    HS_FORCEINLINE const GPUProfiler* GetGPUProfiler() const { return _gpuProfiler; }
+
 protected:
     RHIContext* _rhiContext;
     RHIHandleCache* _rhiHandleCache;
+    GPUProfiler* _gpuProfiler = nullptr;
     RHICommandBuffer*  _curCommandBuffer; // TODO: Multi-CommandBuffer 구현 필요
 
     std::vector<RenderPass*> _rendererPasses;
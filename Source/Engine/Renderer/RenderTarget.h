@@ -32,8 +32,8 @@ public:
     RHITexture* GetColorTexture(uint32 index) const { return _colorTextures[index]; }
     RHITexture* GetDepthStencilTexture() const { return _depthStencilTexture; }
 
-    const std::vector<RHITexture*>& GetColorTextures() const { return _colorTextures; }
-    size_t                       GetColorTextureCount() const { return _colorTextures.size(); }
+    const SmallVector<RHITexture*, MAX_COLOR_ATTACHMENTS>& GetColorTextures() const { return _colorTextures; }
+    size_t                                                 GetColorTextureCount() const { return _colorTextures.size(); }
 
     const TextureInfo& GetColorTextureInfo(uint32 index) const { return _colorTextures[index]->info; }
     const TextureInfo& GetDepthStencilTextureInfo() const { return _depthStencilTexture->info; }
@@ -41,9 +41,9 @@ public:
     const RenderTargetInfo& GetInfo() const { return _info; }
 
 private:
-    RenderTargetInfo      _info;
-    std::vector<RHITexture*> _colorTextures;
-    RHITexture*              _depthStencilTexture;
+    RenderTargetInfo                                _info;
+    SmallVector<RHITexture*, MAX_COLOR_ATTACHMENTS> _colorTextures;
+    RHITexture*                                     _depthStencilTexture;
 };
 
 template <>
@@ -48,19 +48,20 @@ HS_NS_END
 template <>
 struct hs::Hasher<hs::RenderTargetInfo>
 {
-    static uint32 Get(hs::RenderTargetInfo& key)
+    static uint32 Get(const hs::RenderTargetInfo& key)
     {
         uint32 hash = HashCombine(key.colorTextureCount, key.useDepthStencilTexture, key.isSwapchainTarget);
 
-        for (size_t i = 0; i < key.colorTextureCount / 2; i += 2)
+        size_t i = 0;
+        for (; i + 1 < key.colorTextureCount; i += 2)
         {
             hash = HashCombine(hash,
                 hs::Hasher<hs::TextureInfo>::Get(key.colorTextureInfos[i]),
                 hs::Hasher<hs::TextureInfo>::Get(key.colorTextureInfos[i + 1]));
         }
-        if (key.colorTextureCount % 2 != 0)
+        if (i < key.colorTextureCount)
         {
-            hash = HashCombine(hash, hs::Hasher<hs::TextureInfo>::Get(key.colorTextureInfos.back()));
+            hash = HashCombine(hash, hs::Hasher<hs::TextureInfo>::Get(key.colorTextureInfos[i]));
         }
 
         hash = HashCombine(hash, key.width, key.height);
@@ -13,7 +13,8 @@
 #include "Resource/ResourceDefinition.h"
 
 #include "Core/Math/Common.h"
-#include <unordered_map>
+#include "Core/Container/FlatHashMap.h"
+
 #include <string>
 
 HS_NS_BEGIN
@@ -105,7 +106,7 @@ private:
     Shader* _shader;
     
     // Textures
-    std::unordered_map<EMaterialTextureType, Image*> _textures;
+    FlatHashMap<EMaterialTextureType, Image*> _textures;
     
     // Basic material properties
     glm::vec4 _diffuseColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
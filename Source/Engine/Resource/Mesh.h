@@ -10,6 +10,8 @@
 #include "Precompile.h"
 
 #include "Resource/Object.h"
+#include "Resource/Meshlet.h"
+#include "Resource/MeshSimplifier.h"
 
 #include "Core/Math/Common.h"
 
@@ -26,14 +28,21 @@ public:
     HS_FORCEINLINE void AddSubMesh(Mesh* subMesh) { _subMeshes.push_back(subMesh); }
 
     HS_FORCEINLINE void  SetPosition(std::vector<float>&& position) { _position = std::move(position); CalculateBounds(); }
-    HS_FORCEINLINE void  SetPosition(const std::vector<float>& position) { _position = position; }
+    HS_FORCEINLINE void  SetPosition(const std::vector<float>& position) { _position = position; CalculateBounds(); }
     HS_FORCEINLINE const std::vector<float>& GetPosition() const { return _position; }
+    // 쿠킹된 데이터처럼 바운드를 이미 알고 있으면 다시 계산하지 않는다.
+    HS_FORCEINLINE void  SetPosition(std::vector<float>&& position, const glm::vec3& boundMin, const glm::vec3& boundMax)
+    {
+        _position  = std::move(position);
+        _bound.min = glm::vec4(boundMin, 1.0f);
+        _bound.max = glm::vec4(boundMax, 1.0f);
+    }
 
     HS_FORCEINLINE void  SetTexCoord(std::vector<float>&& texcoord, int index) { _texcoord[index] = std::move(texcoord); }
     HS_FORCEINLINE void  SetTexCoord(const std::vector<float>& texcoord, int index) { _texcoord[index] = texcoord; }
     HS_FORCEINLINE const std::vector<float>& GetTexCoord(int index) const
     {
-        HS_ASSERT(0 >= index && index <= 8, "out of range");
+        HS_ASSERT(0 <= index && index < 8, "out of range");
         return _texcoord[index];
     }
 
@@ -57,6 +66,14 @@ public:
     HS_FORCEINLINE void  SetIndices(const std::vector<uint32>& indices) { _indices = indices; }
     HS_FORCEINLINE const std::vector<uint32>& GetIndices() const { return _indices; }
 
+    // MeshletBuilder 결과. 인덱스나 정점 순서를 바꾸면 다시 만들어야 한다.
+    HS_FORCEINLINE void  SetMeshlets(MeshletData&& meshlets) { _meshlets = std::move(meshlets); }
+    HS_FORCEINLINE const MeshletData& GetMeshlets() const { return _meshlets; }
+
+    // LOD1부터 거친 순서. LOD0은 GetIndices()다. 정점 순서를 바꾸면 다시 만들어야 한다.
+    HS_FORCEINLINE void  SetLODs(std::vector<MeshLOD>&& lods) { _lods = std::move(lods); }
+    HS_FORCEINLINE const std::vector<MeshLOD>& GetLODs() const { return _lods; }
+
     // Utility methods
     HS_FORCEINLINE uint32 GetVertexCount() const { return static_cast<uint32>(_position.size() / 3); }
     HS_FORCEINLINE uint32 GetTriangleCount() const { return static_cast<uint32>(_indices.size() / 3); }
@@ -69,14 +86,21 @@ public:
     HS_FORCEINLINE bool HasColors() const { return !_color.empty(); }
     HS_FORCEINLINE bool HasTangents() const { return !_tangent.empty(); }
     HS_FORCEINLINE bool HasIndices() const { return !_indices.empty(); }
+    HS_FORCEINLINE bool HasMeshlets() const { return !_meshlets.IsEmpty(); }
+    HS_FORCEINLINE bool HasLODs() const { return !_lods.empty(); }
+
+    // SetPosition에서 갱신되는 로컬 공간 AABB
+    HS_FORCEINLINE glm::vec3 GetBoundMin() const { return glm::vec3(_bound.min); }
+    HS_FORCEINLINE glm::vec3 GetBoundMax() const { return glm::vec3(_bound.max); }
     
     // Material management
     void SetMaterialIndex(int32 index) { _materialIndex = index; }
     HS_FORCEINLINE int32 GetMaterialIndex() const { return _materialIndex; }
 
+    // 삼각형 구간을 여러 스레드에 나눠 처리하지만, 정점마다 인접 삼각형 순서대로 더하므로 스레드 수와 무관하게 같은 결과가 나온다.
     void CalculateBounds();
     void CalculateNormal();
-    void CalculateTangent();
+    void CalculateTangent(); // 법선이 없으면 먼저 계산한다.
 
 private:
     std::vector<float> _position;
@@ -91,6 +115,8 @@ private:
 
     std::vector<Mesh*>  _subMeshes;
     std::vector<uint32> _indices;
+    MeshletData         _meshlets;
+    std::vector<MeshLOD> _lods;
     
     struct Bound{
         glm::vec4 min;
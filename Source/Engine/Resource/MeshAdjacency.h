@@ -0,0 +1,28 @@
+//
+//  MeshAdjacency.h
+//  HSMR
+//
+//  Vertex to triangle adjacency shared by Mesh, MeshOptimizer and MeshSimplifier
+//
+#ifndef __HS_MESH_ADJACENCY_H__
+#define __HS_MESH_ADJACENCY_H__
+
+#include "Precompile.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+// 정점 -> 인접 삼각형 목록 (CSR). 삼각형 번호는 오름차순이므로 이 순서로 더하면 결과가 결정적이다.
+struct VertexAdjacency
+{
+    std::vector<uint32> offsets; // vertexCount + 1
+    std::vector<uint32> triangles;
+};
+
+// 3개 단위로 남는 꼬리 인덱스는 무시한다. 인덱스가 정점 범위를 벗어나면 false
+bool BuildVertexAdjacency(const std::vector<uint32>& indices, uint32 vertexCount, VertexAdjacency& outAdjacency);
+
+HS_NS_END
+
+#endif
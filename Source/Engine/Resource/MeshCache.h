@@ -0,0 +1,136 @@
+//
+//  MeshCache.h
+//  HSMR
+//
+//  Cooked binary mesh (.hsmesh) used as a persistent import cache
+//
+#ifndef __HS_MESH_CACHE_H__
+#define __HS_MESH_CACHE_H__
+
+#include "Precompile.h"
+
+#include "Resource/Mesh.h"
+
+#include <string>
+#include <vector>
+
+HS_NS_BEGIN
+
+// 파일 배치: [MeshCacheHeader][MeshCacheNode 테이블][MeshCacheStream 테이블][MeshCacheDependency 테이블]
+//           [MeshCacheString 테이블(머티리얼)][문자열][스트림 데이터...]
+// 스트림 데이터는 16바이트 정렬이고 모든 위치는 파일 시작 기준 오프셋이므로 매핑한 그대로 읽는다.
+// 모든 값은 little-endian이다.
+struct MeshCacheHeader
+{
+    static constexpr uint32 MAGIC   = 0x534D5348; // "HSMS"
+    static constexpr uint32 VERSION = 1;
+
+    uint32 magic;
+    uint32 version;
+    uint64 key;      // 원본 파일 해시와 임포트 옵션으로 만든 키. 다르면 캐시를 버린다.
+    uint64 fileSize;
+    uint32 nodeCount;
+    uint32 streamCount;
+    uint32 dependencyCount;
+    uint32 materialCount;
+    uint64 nodeTableOffset;
+    uint64 streamTableOffset;
+    uint64 dependencyTableOffset;
+    uint64 materialTableOffset;
+    uint64 stringTableOffset;
+    uint64 stringTableSize;
+};
+
+// 메시 트리를 전위 순회 순서로 펼친다. 부모는 항상 자식보다 앞에 있다.
+struct MeshCacheNode
+{
+    static constexpr uint32 NO_PARENT = ~0u;
+
+    uint32 nameOffset;
+    uint32 nameLength;
+    uint32 parentIndex;
+    int32  materialIndex;
+    uint32 firstStream;
+    uint32 streamCount;
+    uint32 vertexCount;
+    uint32 reserved;
+    float  boundMin[4];
+    float  boundMax[4];
+};
+
+enum class EMeshCacheStream : uint32
+{
+    POSITION,
+    NORMAL,
+    TEXCOORD, // index = 세트 번호
+    COLOR,
+    TANGENT,
+    BITANGENT,
+    INDEX,
+    LOD_INDEX, // index = LOD 단계(1부터), param = 누적 오차
+    MESHLET,
+    MESHLET_VERTEX,
+    MESHLET_TRIANGLE,
+};
+
+struct MeshCacheStream
+{
+    EMeshCacheStream type;
+    uint32           index;
+    float            param;
+    uint32           reserved;
+    uint64           offset;
+    uint64           size;
+};
+
+// 임포터가 원본 외에 읽은 파일(.mtl, .bin 등). 내용이 바뀌면 캐시를 버린다.
+struct MeshCacheDependencyEntry
+{
+    uint32 pathOffset;
+    uint32 pathLength;
+    uint64 size;
+    uint64 hash; // HashBytes64(내용)
+};
+
+struct MeshCacheString
+{
+    uint32 offset;
+    uint32 length;
+};
+
+static_assert(sizeof(MeshCacheHeader) == 88, "MeshCacheHeader layout");
+static_assert(sizeof(MeshCacheNode) == 64, "MeshCacheNode layout");
+static_assert(sizeof(MeshCacheStream) == 32, "MeshCacheStream layout");
+static_assert(sizeof(MeshCacheDependencyEntry) == 24, "MeshCacheDependencyEntry layout");
+static_assert(sizeof(MeshCacheString) == 8, "MeshCacheString layout");
+
+struct MeshCacheDependency
+{
+    std::string path;
+    uint64      size = 0;
+    uint64      hash = 0;
+};
+
+struct MeshCacheContent
+{
+    Scoped<Mesh>                     mesh;
+    std::vector<std::string>         materialNames; // Mesh::GetMaterialIndex가 가리키는 머티리얼 이름
+    std::vector<MeshCacheDependency> dependencies;
+};
+
+class HS_API MeshCache
+{
+public:
+    // 원본 옆에 둔다. (model.fbx -> model.fbx.hsmesh)
+    static std::string GetCachePath(const std::string& sourcePath) { return sourcePath + ".hsmesh"; }
+
+    // 임시 파일에 다 쓴 뒤 바꿔치기하므로, 도중에 실패해도 이전 캐시가 깨지지 않는다.
+    static bool Write(const std::string& absolutePath, uint64 key, const Mesh* mesh, const std::vector<std::string>& materialNames, const std::vector<MeshCacheDependency>& dependencies);
+
+    // 파일이 없거나, 버전이나 키가 다르거나, 테이블이 파일 범위를 벗어나면 false
+    static bool Read(const std::string& absolutePath, uint64 key, MeshCacheContent& outContent);
+};
+
+HS_NS_END
+
+#endif
@@ -0,0 +1,63 @@
+//
+//  MeshOptimizer.h
+//  HSMR
+//
+//  Reorders Mesh index and vertex streams for the post-transform cache, overdraw and vertex fetch
+//
+#ifndef __HS_MESH_OPTIMIZER_H__
+#define __HS_MESH_OPTIMIZER_H__
+
+#include "Precompile.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+class Mesh;
+
+struct MeshOptimizeInfo
+{
+    bool weldVertices        = true; // 모든 속성이 비트 단위로 같은 정점을 합친다.
+    bool optimizeVertexCache = true; // Tipsify 순서로 삼각형을 다시 배치한다.
+    bool optimizeOverdraw    = true; // 캐시 순서를 지키는 클러스터 단위로 바깥쪽을 향한 면부터 그린다.
+    bool optimizeVertexFetch = true; // 정점을 인덱스에서 처음 쓰이는 순서로 옮기고, 쓰이지 않는 정점은 버린다.
+
+    uint32 cacheSize         = 16;    // 캐시 최적화와 ACMR/ATVR 측정에 쓰는 FIFO 크기
+    float  overdrawThreshold = 1.05f; // 클러스터를 나눌 때 허용하는 ACMR 배수. 클수록 클러스터가 작아진다.
+};
+
+// FIFO 캐시 시뮬레이션 결과. ACMR은 삼각형당, ATVR은 참조된 정점당 캐시 미스 수다.
+struct VertexCacheStats
+{
+    uint32 missCount = 0;
+    float  acmr      = 0.0f;
+    float  atvr      = 0.0f;
+};
+
+struct MeshOptimizeResult
+{
+    uint32 vertexCountBefore = 0;
+    uint32 vertexCountAfter  = 0;
+
+    VertexCacheStats before;
+    VertexCacheStats after;
+
+    bool isOptimized     = false; // 인덱스가 범위를 벗어나는 등 입력이 잘못되면 false이고 메시는 그대로다.
+    bool fitsUInt16Index = false; // 정점이 65536개 이하라 16bit 인덱스로 올릴 수 있다.
+};
+
+class HS_API MeshOptimizer
+{
+public:
+    // 서브메시는 건드리지 않는다. 호출자가 각각 넘겨야 한다.
+    static MeshOptimizeResult Optimize(Mesh* mesh, const MeshOptimizeInfo& info = MeshOptimizeInfo{});
+
+    // 정점 순서는 그대로 두고 삼각형 순서만 바꾼다. LOD처럼 정점 버퍼를 공유하는 인덱스 목록에 쓴다.
+    static void OptimizeVertexCache(std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize = 16);
+
+    static VertexCacheStats AnalyzeVertexCache(const std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize);
+};
+
+HS_NS_END
+
+#endif
@@ -0,0 +1,49 @@
+//
+//  MeshSimplifier.h
+//  HSMR
+//
+//  Quadric-error edge collapse simplification and LOD chain generation
+//
+#ifndef __HS_MESH_SIMPLIFIER_H__
+#define __HS_MESH_SIMPLIFIER_H__
+
+#include "Precompile.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+class Mesh;
+
+// LOD 한 단계. 정점 버퍼는 원본(LOD0)과 공유한다.
+struct MeshLOD
+{
+    std::vector<uint32> indices;
+    float               error = 0.0f; // 원본 표면에서 벗어난 거리의 보수적 상한 (오브젝트 공간). 화면 오차 한계에 그대로 쓴다.
+};
+
+struct MeshLODInfo
+{
+    uint32 maxLevelCount     = 4;     // LOD0(원본)을 뺀 단계 수
+    float  reductionPerLevel = 0.5f;  // 단계마다 남길 삼각형 비율
+    float  maxError          = 0.02f; // 메시 바운드 반지름 대비 허용 오차. 넘으면 체인을 멈춘다.
+    uint32 minTriangleCount  = 64;    // 이보다 작은 단계는 만들지 않는다.
+};
+
+class HS_API MeshSimplifier
+{
+public:
+    // 정점은 그대로 두고 인덱스만 줄인다(half-edge collapse). 결과는 원본 정점 버퍼를 그대로 참조한다.
+    // 속성 이음새(같은 위치에 정점이 여럿)와 열린 경계의 정점은 움직이지 않는다.
+    // maxError는 오브젝트 공간 거리이고, outError에는 생긴 오차의 상한을 돌려준다. 접는 순서는 쿼드릭 비용을 따르지만
+    // 오차는 접힌 삼각형 평면까지의 최대 거리를 주변 오차에 더해 누적하므로 평균이 아니라 최대를 넘지 않는다.
+    static std::vector<uint32> Simplify(const Mesh* mesh, const std::vector<uint32>& indices, size_t targetIndexCount, float maxError, float* outError = nullptr);
+
+    // 메시와 서브메시마다 LOD 체인을 만들어 Mesh::SetLODs로 저장한다. 각 단계는 바로 앞 단계에서 줄이고,
+    // 오차는 앞 단계 오차에 더해 누적한다.
+    static void BuildLODChain(Mesh* mesh, const MeshLODInfo& info = MeshLODInfo{});
+};
+
+HS_NS_END
+
+#endif
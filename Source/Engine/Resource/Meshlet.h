@@ -0,0 +1,78 @@
+//
+//  Meshlet.h
+//  HSMR
+//
+//  Small triangle clusters with culling bounds, built from a Mesh index stream
+//
+#ifndef __HS_MESHLET_H__
+#define __HS_MESHLET_H__
+
+#include "Precompile.h"
+
+#include "Core/Math/Common.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+class Mesh;
+
+// GPU 버퍼에 그대로 올리므로 16바이트 단위로 맞춘다. (48 bytes)
+struct Meshlet
+{
+    glm::vec4 boundingSphere; // xyz = 중심, w = 반지름 (오브젝트 공간)
+    glm::vec4 cone;           // xyz = 법선 콘 축, w = cutoff. w가 1이면 뒷면 컬링을 하지 않는다.
+
+    uint32 vertexOffset;   // MeshletData::vertices 시작 위치
+    uint32 triangleOffset; // MeshletData::triangles 시작 바이트. 4바이트 정렬
+    uint32 vertexCount;
+    uint32 triangleCount;
+};
+
+struct MeshletData
+{
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32>  vertices;  // 클러스터 로컬 정점 -> 메시 정점 번호
+    std::vector<uint8>   triangles; // 삼각형마다 로컬 정점 번호 3개
+
+    HS_FORCEINLINE bool IsEmpty() const { return meshlets.empty(); }
+};
+
+struct MeshletBuildInfo
+{
+    uint32 maxVertices  = 64;  // 로컬 인덱스가 8bit이므로 256 이하
+    uint32 maxTriangles = 124; // 124 * 3 바이트가 4바이트 정렬된다.
+};
+
+class HS_API MeshletBuilder
+{
+public:
+    // 인덱스를 앞에서부터 훑으며 채운다. MeshOptimizer로 캐시 순서를 맞춘 뒤 부르면 클러스터가 조밀해진다.
+    static MeshletData Build(const Mesh* mesh, const MeshletBuildInfo& info = MeshletBuildInfo{});
+};
+
+// cameraPosition은 오브젝트 공간 좌표다. 클러스터의 모든 면이 카메라 반대쪽을 향하면 true
+HS_FORCEINLINE bool IsMeshletBackFacing(const Meshlet& meshlet, const glm::vec3& cameraPosition)
+{
+    const glm::vec3 center   = glm::vec3(meshlet.boundingSphere);
+    const glm::vec3 toCenter = center - cameraPosition;
+    return glm::dot(toCenter, glm::vec3(meshlet.cone)) >= meshlet.cone.w * glm::length(toCenter) + meshlet.boundingSphere.w;
+}
+
+// 평면은 (법선, d) 형식이고 법선이 안쪽을 향한다. 구가 한 평면이라도 완전히 바깥에 있으면 true
+HS_FORCEINLINE bool IsMeshletOutsidePlanes(const Meshlet& meshlet, const glm::vec4* planes, uint32 planeCount)
+{
+    const glm::vec3 center = glm::vec3(meshlet.boundingSphere);
+    for (uint32 i = 0; i < planeCount; ++i)
+    {
+        if (glm::dot(glm::vec3(planes[i]), center) + planes[i].w < -meshlet.boundingSphere.w)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+HS_NS_END
+
+#endif
@@ -9,6 +9,7 @@
 
 #include "Precompile.h"
 #include "Core/Log.h"
+#include "Core/Name.h"
 
 HS_NS_BEGIN
 
@@ -63,7 +64,7 @@ public:
 	Object::EType GetType() const { return _type; }
 	bool IsValid() const { return _isValid; }
 
-	const char* name;
+	Name name;
 
 	uint64 GetObjectId() const { return _objectId; }
 
@@ -28,6 +28,8 @@ public:
 	static void Finalize();
 
 	static Scoped<Image> LoadImageFromFile(const std::string& path, bool isAbsolutePath = false);
+	// 파일을 한 번에 비동기로 읽고 디코딩은 병렬로 한다. 실패한 항목은 nullptr이다.
+	static std::vector<Scoped<Image>> LoadImagesFromFiles(const std::vector<std::string>& paths, bool isAbsolutePath = false);
 	static void FreeImage(Image* image);
 
 	static Scoped<Mesh> LoadMeshFromFile(const std::string& path, bool isAbsolutePath = false);
@@ -43,7 +43,8 @@ Image* Material::GetTexture(EMaterialTextureType type) const
 
 bool Material::HasTexture(EMaterialTextureType type) const
 {
-    return _textures.find(type) != _textures.end() && _textures.at(type) != nullptr;
+    auto it = _textures.find(type);
+    return it != _textures.end() && it->second != nullptr;
 }
 
 // Shader variant support
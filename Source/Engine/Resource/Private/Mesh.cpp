@@ -5,43 +5,209 @@
 //  Created by Yongsik Im on 2/5/25.
 //
 #include "Resource/Mesh.h"
+#include "Resource/MeshAdjacency.h"
 #include <limits>
 #include <algorithm>
 
+#include "Core/HAL/Simd.h"
+#include "Core/Job/JobSystem.h"
+#include "Core/Log.h"
 #include "Core/Math/Common.h"
+#include "Core/Math/SimdMath.h"
+#include "Core/Profile/Profiler.h"
 
 HS_NS_BEGIN
 
+namespace
+{
+constexpr uint32 s_vertexBatchSize   = 4096;
+constexpr uint32 s_triangleBatchSize = 2048;
+static_assert(s_triangleBatchSize % simd::SIMD_WIDTH == 0, "ParallelFor chunks must not split a SIMD batch");
+
+// 삼각형 width개의 꼭짓점을 lane별로 모은다. lanes[k][lane]
+template <uint32 COMPONENTS>
+HS_FORCEINLINE void gather_triangles(const float* attribute, const uint32* indices, uint32 firstTriangle, float (*lanes)[simd::SIMD_WIDTH])
+{
+    for (uint32 lane = 0; lane < simd::SIMD_WIDTH; lane++)
+    {
+        const uint32* triangle = indices + (firstTriangle + lane) * 3;
+        for (uint32 corner = 0; corner < 3; corner++)
+        {
+            const float* value = attribute + triangle[corner] * COMPONENTS;
+            for (uint32 c = 0; c < COMPONENTS; c++)
+            {
+                lanes[corner * COMPONENTS + c][lane] = value[c];
+            }
+        }
+    }
+}
+
+// glm::normalize(glm::cross(e1, e2))와 같은 순서로 계산한다. (FMA를 쓰지 않아 스칼라 경로와 비트 단위로 같다)
+// 넓이가 0인 삼각형은 0 벡터가 된다.
+void compute_face_normals(const float* positions, const uint32* indices, uint32 begin, uint32 end, glm::vec3* outNormals)
+{
+    constexpr uint32 width = simd::SIMD_WIDTH;
+
+    const simd::FloatN zero = simd::SplatN(0.0f);
+    const simd::FloatN one  = simd::SplatN(1.0f);
+
+    uint32 t = begin;
+    for (; t + width <= end; t += width)
+    {
+        float lanes[9][width];
+        gather_triangles<3>(positions, indices, t, lanes);
+
+        const simd::FloatN p0x = simd::LoadN(lanes[0]), p0y = simd::LoadN(lanes[1]), p0z = simd::LoadN(lanes[2]);
+        const simd::FloatN e1x = simd::Sub(simd::LoadN(lanes[3]), p0x);
+        const simd::FloatN e1y = simd::Sub(simd::LoadN(lanes[4]), p0y);
+        const simd::FloatN e1z = simd::Sub(simd::LoadN(lanes[5]), p0z);
+        const simd::FloatN e2x = simd::Sub(simd::LoadN(lanes[6]), p0x);
+        const simd::FloatN e2y = simd::Sub(simd::LoadN(lanes[7]), p0y);
+        const simd::FloatN e2z = simd::Sub(simd::LoadN(lanes[8]), p0z);
+
+        const simd::FloatN nx = simd::Sub(simd::Mul(e1y, e2z), simd::Mul(e2y, e1z));
+        const simd::FloatN ny = simd::Sub(simd::Mul(e1z, e2x), simd::Mul(e2z, e1x));
+        const simd::FloatN nz = simd::Sub(simd::Mul(e1x, e2y), simd::Mul(e2x, e1y));
+
+        const simd::FloatN lengthSq  = simd::Add(simd::Add(simd::Mul(nx, nx), simd::Mul(ny, ny)), simd::Mul(nz, nz));
+        const simd::FloatN isValid   = simd::CmpGt(lengthSq, zero);
+        const simd::FloatN invLength = simd::Select(isValid, simd::Div(one, simd::Sqrt(lengthSq)), zero);
+
+        float out[3][width];
+        simd::StoreN(out[0], simd::Mul(nx, invLength));
+        simd::StoreN(out[1], simd::Mul(ny, invLength));
+        simd::StoreN(out[2], simd::Mul(nz, invLength));
+
+        for (uint32 lane = 0; lane < width; lane++)
+        {
+            outNormals[t + lane] = glm::vec3(out[0][lane], out[1][lane], out[2][lane]);
+        }
+    }
+
+    for (; t < end; t++)
+    {
+        const uint32* triangle = indices + t * 3;
+        const glm::vec3 p0     = glm::make_vec3(positions + triangle[0] * 3);
+        const glm::vec3 p1     = glm::make_vec3(positions + triangle[1] * 3);
+        const glm::vec3 p2     = glm::make_vec3(positions + triangle[2] * 3);
+
+        const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        const float lengthSq   = glm::dot(normal, normal);
+        outNormals[t]          = (lengthSq > 0.0f) ? normal * (1.0f / std::sqrt(lengthSq)) : glm::vec3(0.0f);
+    }
+}
+
+// UV 넓이가 0인 삼각형은 0 벡터가 된다.
+void compute_face_tangents(const float* positions, const float* texcoords, const uint32* indices, uint32 begin, uint32 end, glm::vec3* outTangents, glm::vec3* outBitangents)
+{
+    constexpr uint32 width = simd::SIMD_WIDTH;
+
+    const simd::FloatN zero    = simd::SplatN(0.0f);
+    const simd::FloatN one     = simd::SplatN(1.0f);
+    const simd::FloatN epsilon = simd::SplatN(std::numeric_limits<float>::min());
+
+    uint32 t = begin;
+    for (; t + width <= end; t += width)
+    {
+        float positionLanes[9][width];
+        float uvLanes[6][width];
+        gather_triangles<3>(positions, indices, t, positionLanes);
+        gather_triangles<2>(texcoords, indices, t, uvLanes);
+
+        const simd::FloatN p0x = simd::LoadN(positionLanes[0]), p0y = simd::LoadN(positionLanes[1]), p0z = simd::LoadN(positionLanes[2]);
+        const simd::FloatN d1x = simd::Sub(simd::LoadN(positionLanes[3]), p0x);
+        const simd::FloatN d1y = simd::Sub(simd::LoadN(positionLanes[4]), p0y);
+        const simd::FloatN d1z = simd::Sub(simd::LoadN(positionLanes[5]), p0z);
+        const simd::FloatN d2x = simd::Sub(simd::LoadN(positionLanes[6]), p0x);
+        const simd::FloatN d2y = simd::Sub(simd::LoadN(positionLanes[7]), p0y);
+        const simd::FloatN d2z = simd::Sub(simd::LoadN(positionLanes[8]), p0z);
+
+        const simd::FloatN uv0x = simd::LoadN(uvLanes[0]), uv0y = simd::LoadN(uvLanes[1]);
+        const simd::FloatN du1  = simd::Sub(simd::LoadN(uvLanes[2]), uv0x);
+        const simd::FloatN dv1  = simd::Sub(simd::LoadN(uvLanes[3]), uv0y);
+        const simd::FloatN du2  = simd::Sub(simd::LoadN(uvLanes[4]), uv0x);
+        const simd::FloatN dv2  = simd::Sub(simd::LoadN(uvLanes[5]), uv0y);
+
+        const simd::FloatN det     = simd::Sub(simd::Mul(du1, dv2), simd::Mul(dv1, du2));
+        const simd::FloatN isValid = simd::CmpGt(simd::Abs(det), epsilon);
+        const simd::FloatN r       = simd::Select(isValid, simd::Div(one, det), zero);
+
+        float out[6][width];
+        simd::StoreN(out[0], simd::Mul(simd::Sub(simd::Mul(d1x, dv2), simd::Mul(d2x, dv1)), r));
+        simd::StoreN(out[1], simd::Mul(simd::Sub(simd::Mul(d1y, dv2), simd::Mul(d2y, dv1)), r));
+        simd::StoreN(out[2], simd::Mul(simd::Sub(simd::Mul(d1z, dv2), simd::Mul(d2z, dv1)), r));
+        simd::StoreN(out[3], simd::Mul(simd::Sub(simd::Mul(d2x, du1), simd::Mul(d1x, du2)), r));
+        simd::StoreN(out[4], simd::Mul(simd::Sub(simd::Mul(d2y, du1), simd::Mul(d1y, du2)), r));
+        simd::StoreN(out[5], simd::Mul(simd::Sub(simd::Mul(d2z, du1), simd::Mul(d1z, du2)), r));
+
+        for (uint32 lane = 0; lane < width; lane++)
+        {
+            outTangents[t + lane]   = glm::vec3(out[0][lane], out[1][lane], out[2][lane]);
+            outBitangents[t + lane] = glm::vec3(out[3][lane], out[4][lane], out[5][lane]);
+        }
+    }
+
+    for (; t < end; t++)
+    {
+        const uint32* triangle = indices + t * 3;
+        const glm::vec3 p0     = glm::make_vec3(positions + triangle[0] * 3);
+        const glm::vec2 uv0    = glm::make_vec2(texcoords + triangle[0] * 2);
+        const glm::vec3 d1     = glm::make_vec3(positions + triangle[1] * 3) - p0;
+        const glm::vec3 d2     = glm::make_vec3(positions + triangle[2] * 3) - p0;
+        const glm::vec2 duv1   = glm::make_vec2(texcoords + triangle[1] * 2) - uv0;
+        const glm::vec2 duv2   = glm::make_vec2(texcoords + triangle[2] * 2) - uv0;
+
+        const float det = duv1.x * duv2.y - duv1.y * duv2.x;
+        const float r   = (std::fabs(det) > std::numeric_limits<float>::min()) ? 1.0f / det : 0.0f;
+
+        outTangents[t]   = (d1 * duv2.y - d2 * duv1.y) * r;
+        outBitangents[t] = (d2 * duv1.x - d1 * duv2.x) * r;
+    }
+}
+} // namespace
+
 Mesh::~Mesh()
 {
 }
 
 void Mesh::CalculateBounds()
 {
-	if (_position.empty())
-	{
-		_bound.min = { 0.0f, 0.0f, 0.0f, 1.0f };
-		_bound.max = { 0.0f, 0.0f, 0.0f, 1.0f };
-		return;
-	}
-
-    float minX, minY, minZ;
-    float maxX, maxY, maxZ;
-    minX = minY = minZ = HS_FLT_MIN;
-    maxX = maxY = maxZ = HS_FLT_MAX;
-
-    for (int i = 0; i < _position.size(); i += 4)
-    {
-        minX = std::min(minX, _position[i + 0]);
-        minY = std::min(minX, _position[i + 1]);
-        minZ = std::min(minX, _position[i + 2]);
-        maxX = std::max(minX, _position[i + 0]);
-        maxY = std::max(minX, _position[i + 1]);
-        maxZ = std::max(minX, _position[i + 2]);
+    const size_t vertexCount = _position.size() / 3;
+    if (vertexCount == 0)
+    {
+        _bound.min = { 0.0f, 0.0f, 0.0f, 1.0f };
+        _bound.max = { 0.0f, 0.0f, 0.0f, 1.0f };
+        return;
+    }
+
+    const glm::vec3* points = reinterpret_cast<const glm::vec3*>(_position.data());
+
+    // min/max는 순서와 무관하므로 구간별 결과를 합쳐도 결정적이다.
+    constexpr uint32 chunkSize = 64 * 1024;
+    const uint32 chunkCount    = static_cast<uint32>((vertexCount + chunkSize - 1) / chunkSize);
+
+    std::vector<glm::vec3> chunkMins(chunkCount);
+    std::vector<glm::vec3> chunkMaxs(chunkCount);
+    JobSystem::ParallelFor(chunkCount, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 c = begin; c < end; c++)
+        {
+            const size_t first = static_cast<size_t>(c) * chunkSize;
+            const size_t count = std::min<size_t>(chunkSize, vertexCount - first);
+            SimdMath::MinMax(points + first, count, chunkMins[c], chunkMaxs[c]);
+        }
+    });
+
+    glm::vec3 minValue = chunkMins[0];
+    glm::vec3 maxValue = chunkMaxs[0];
+    for (uint32 c = 1; c < chunkCount; c++)
+    {
+        minValue = glm::min(minValue, chunkMins[c]);
+        maxValue = glm::max(maxValue, chunkMaxs[c]);
     }
 
-    _bound.min = {minX, minY, minZ, 1.0f};
-    _bound.max = {maxX, maxY, maxZ, 1.0f};
+    _bound.min = glm::vec4(minValue, 1.0f);
+    _bound.max = glm::vec4(maxValue, 1.0f);
 }
 
 void Mesh::CalculateNormal()
@@ -51,117 +217,113 @@ void Mesh::CalculateNormal()
         return;
     }
 
-    size_t vertexCount = _position.size() / 3;
-    _normal.clear();
-    _normal.resize(vertexCount * 3, 0.0f);
+    HS_PROFILE_SCOPE("Mesh::CalculateNormal");
+
+    const uint32 vertexCount   = GetVertexCount();
+    const uint32 triangleCount = GetTriangleCount();
 
-    // 면 법선을 계산하고 정점에 누적
-    for (size_t i = 0; i < _indices.size(); i += 3)
+    VertexAdjacency adjacency;
+    if (false == BuildVertexAdjacency(_indices, vertexCount, adjacency))
     {
-        uint32 i0 = _indices[i];
-        uint32 i1 = _indices[i + 1];
-        uint32 i2 = _indices[i + 2];
+        return;
+    }
 
-        glm::vec3 v0(_position[i0 * 3], _position[i0 * 3 + 1], _position[i0 * 3 + 2]);
-        glm::vec3 v1(_position[i1 * 3], _position[i1 * 3 + 1], _position[i1 * 3 + 2]);
-        glm::vec3 v2(_position[i2 * 3], _position[i2 * 3 + 1], _position[i2 * 3 + 2]);
-        
-        glm::vec3 faceNormal = glm::normalize(glm::cross(v1 - v0, v2 - v0));
+    // 면 법선
+    std::vector<glm::vec3> faceNormals(triangleCount);
+    JobSystem::ParallelFor(triangleCount, [&](uint32 begin, uint32 end)
+    {
+        compute_face_normals(_position.data(), _indices.data(), begin, end, faceNormals.data());
+    }, s_triangleBatchSize);
 
-        // 각 정점에 면 법선 누적
-        _normal[i0 * 3] += faceNormal.x;
-        _normal[i0 * 3 + 1] += faceNormal.y;
-        _normal[i0 * 3 + 2] += faceNormal.z;
+    // 정점 법선: 인접한 면 법선을 삼각형 순서대로 더한 뒤 정규화
+    _normal.resize(static_cast<size_t>(vertexCount) * 3);
+    JobSystem::ParallelFor(vertexCount, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 v = begin; v < end; v++)
+        {
+            glm::vec3 normal(0.0f);
+            for (uint32 a = adjacency.offsets[v]; a < adjacency.offsets[v + 1]; a++)
+            {
+                normal += faceNormals[adjacency.triangles[a]];
+            }
+
+            const float lengthSq = glm::dot(normal, normal);
+            normal               = (lengthSq > 0.0f) ? normal * (1.0f / std::sqrt(lengthSq)) : glm::vec3(0.0f);
 
-        _normal[i1 * 3] += faceNormal.x;
-        _normal[i1 * 3 + 1] += faceNormal.y;
-        _normal[i1 * 3 + 2] += faceNormal.z;
+            _normal[v * 3]     = normal.x;
+            _normal[v * 3 + 1] = normal.y;
+            _normal[v * 3 + 2] = normal.z;
+        }
+    }, s_vertexBatchSize);
+}
 
-        _normal[i2 * 3] += faceNormal.x;
-        _normal[i2 * 3 + 1] += faceNormal.y;
-        _normal[i2 * 3 + 2] += faceNormal.z;
+void Mesh::CalculateTangent()
+{
+    if (_position.empty() || _indices.empty() || _texcoord[0].size() < _position.size() / 3 * 2)
+    {
+        return;
     }
 
-    // 정점 법선 정규화
-    for (size_t i = 0; i < _normal.size(); i += 3)
+    HS_PROFILE_SCOPE("Mesh::CalculateTangent");
+
+    if (_normal.size() != _position.size())
     {
-        glm::vec3 normal(_normal[i], _normal[i + 1], _normal[i + 2]);
-        normal         = glm::normalize(normal);
-        _normal[i]     = normal.x;
-        _normal[i + 1] = normal.y;
-        _normal[i + 2] = normal.z;
+        CalculateNormal();
     }
-}
 
-void Mesh::CalculateTangent()
-{
-    if (_position.empty() || _indices.empty() || _texcoord[0].empty())
+    const uint32 vertexCount   = GetVertexCount();
+    const uint32 triangleCount = GetTriangleCount();
+
+    VertexAdjacency adjacency;
+    if (false == BuildVertexAdjacency(_indices, vertexCount, adjacency))
+    {
         return;
-    
-    size_t vertexCount = _position.size() / 3;
-    _tangent.clear();
-    _tangent.resize(vertexCount * 3, 0.0f);
-    _bitangent.clear();
-    _bitangent.resize(vertexCount * 3, 0.0f);
-    
-    // 삼각형별로 탄젠트/바이탄젠트 계산
-    for (size_t i = 0; i < _indices.size(); i += 3)
-    {
-        uint32 i0 = _indices[i];
-        uint32 i1 = _indices[i + 1];
-        uint32 i2 = _indices[i + 2];
-        
-        glm::vec3 v0(_position[i0 * 3], _position[i0 * 3 + 1], _position[i0 * 3 + 2]);
-        glm::vec3 v1(_position[i1 * 3], _position[i1 * 3 + 1], _position[i1 * 3 + 2]);
-        glm::vec3 v2(_position[i2 * 3], _position[i2 * 3 + 1], _position[i2 * 3 + 2]);
-        
-        glm::vec2 uv0(_texcoord[0][i0 * 2], _texcoord[0][i0 * 2 + 1]);
-        glm::vec2 uv1(_texcoord[0][i1 * 2], _texcoord[0][i1 * 2 + 1]);
-        glm::vec2 uv2(_texcoord[0][i2 * 2], _texcoord[0][i2 * 2 + 1]);
-        
-        glm::vec3 deltaPos1 = v1 - v0;
-        glm::vec3 deltaPos2 = v2 - v0;
-        
-        glm::vec2 deltaUV1 = uv1 - uv0;
-        glm::vec2 deltaUV2 = uv2 - uv0;
-        
-        float r = 1.0f / (deltaUV1.x * deltaUV2.y - deltaUV1.y * deltaUV2.x);
-        glm::vec3 tangent = (deltaPos1 * deltaUV2.y - deltaPos2 * deltaUV1.y) * r;
-        glm::vec3 bitangent = (deltaPos2 * deltaUV1.x - deltaPos1 * deltaUV2.x) * r;
-        
-        // 각 정점에 누적
-        for (int j = 0; j < 3; ++j)
+    }
+
+    // 삼각형별 탄젠트/바이탄젠트
+    std::vector<glm::vec3> faceTangents(triangleCount);
+    std::vector<glm::vec3> faceBitangents(triangleCount);
+    JobSystem::ParallelFor(triangleCount, [&](uint32 begin, uint32 end)
+    {
+        compute_face_tangents(_position.data(), _texcoord[0].data(), _indices.data(), begin, end, faceTangents.data(), faceBitangents.data());
+    }, s_triangleBatchSize);
+
+    _tangent.resize(static_cast<size_t>(vertexCount) * 3);
+    _bitangent.resize(static_cast<size_t>(vertexCount) * 3);
+    JobSystem::ParallelFor(vertexCount, [&](uint32 begin, uint32 end)
+    {
+        for (uint32 v = begin; v < end; v++)
         {
-            uint32 idx = _indices[i + j];
-            _tangent[idx * 3] += tangent.x;
-            _tangent[idx * 3 + 1] += tangent.y;
-            _tangent[idx * 3 + 2] += tangent.z;
-            
-            _bitangent[idx * 3] += bitangent.x;
-            _bitangent[idx * 3 + 1] += bitangent.y;
-            _bitangent[idx * 3 + 2] += bitangent.z;
+            glm::vec3 t(0.0f);
+            glm::vec3 b(0.0f);
+            for (uint32 a = adjacency.offsets[v]; a < adjacency.offsets[v + 1]; a++)
+            {
+                t += faceTangents[adjacency.triangles[a]];
+                b += faceBitangents[adjacency.triangles[a]];
+            }
+
+            const glm::vec3 n(_normal[v * 3], _normal[v * 3 + 1], _normal[v * 3 + 2]);
+
+            // Gram-Schmidt 직교화
+            t                    = t - n * glm::dot(n, t);
+            const float lengthSq = glm::dot(t, t);
+            t                    = (lengthSq > 0.0f) ? t * (1.0f / std::sqrt(lengthSq)) : glm::vec3(0.0f);
+
+            // 바이탄젠트는 법선과 탄젠트의 외적으로 재계산하되, 누적한 방향으로 뒤집어 UV 미러링을 유지한다.
+            glm::vec3 bitangent = glm::cross(n, t);
+            if (glm::dot(bitangent, b) < 0.0f)
+            {
+                bitangent = -bitangent;
+            }
+
+            _tangent[v * 3]       = t.x;
+            _tangent[v * 3 + 1]   = t.y;
+            _tangent[v * 3 + 2]   = t.z;
+            _bitangent[v * 3]     = bitangent.x;
+            _bitangent[v * 3 + 1] = bitangent.y;
+            _bitangent[v * 3 + 2] = bitangent.z;
         }
-    }
-    
-    // 정규화 및 직교화
-    for (size_t i = 0; i < vertexCount; ++i)
-    {
-        glm::vec3 n(_normal[i * 3], _normal[i * 3 + 1], _normal[i * 3 + 2]);
-        glm::vec3 t(_tangent[i * 3], _tangent[i * 3 + 1], _tangent[i * 3 + 2]);
-        
-        // Gram-Schmidt 직교화
-        t = glm::normalize(t - n * glm::dot(n, t));
-        
-        _tangent[i * 3] = t.x;
-        _tangent[i * 3 + 1] = t.y;
-        _tangent[i * 3 + 2] = t.z;
-        
-        // 바이탄젠트는 법선과 탄젠트의 외적으로 재계산
-        glm::vec3 b = glm::cross(n, t);
-        _bitangent[i * 3] = b.x;
-        _bitangent[i * 3 + 1] = b.y;
-        _bitangent[i * 3 + 2] = b.z;
-    }
+    }, s_vertexBatchSize);
 }
 
 HS_NS_END
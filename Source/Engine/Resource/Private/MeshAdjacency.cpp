@@ -0,0 +1,43 @@
+//
+//  MeshAdjacency.cpp
+//  HSMR
+//
+//  Vertex to triangle adjacency shared by Mesh, MeshOptimizer and MeshSimplifier
+//
+#include "Resource/MeshAdjacency.h"
+
+#include "Core/Log.h"
+
+HS_NS_BEGIN
+
+bool BuildVertexAdjacency(const std::vector<uint32>& indices, uint32 vertexCount, VertexAdjacency& outAdjacency)
+{
+    const size_t cornerCount = (indices.size() / 3) * 3;
+
+    outAdjacency.offsets.assign(vertexCount + 1, 0);
+    for (size_t i = 0; i < cornerCount; i++)
+    {
+        if (indices[i] >= vertexCount)
+        {
+            HS_LOG(error, "VertexAdjacency: index %u is out of range (vertex count %u)", indices[i], vertexCount);
+            return false;
+        }
+        outAdjacency.offsets[indices[i] + 1]++;
+    }
+
+    for (uint32 v = 0; v < vertexCount; v++)
+    {
+        outAdjacency.offsets[v + 1] += outAdjacency.offsets[v];
+    }
+
+    std::vector<uint32> cursor(outAdjacency.offsets.begin(), outAdjacency.offsets.end() - 1);
+    outAdjacency.triangles.resize(cornerCount);
+    for (size_t i = 0; i < cornerCount; i++)
+    {
+        outAdjacency.triangles[cursor[indices[i]]++] = static_cast<uint32>(i / 3);
+    }
+
+    return true;
+}
+
+HS_NS_END
@@ -0,0 +1,503 @@
+//
+//  MeshCache.cpp
+//  HSMR
+//
+//  Cooked binary mesh (.hsmesh) used as a persistent import cache
+//
+#include "Resource/MeshCache.h"
+
+#include "Core/Archive/VirtualFileSystem.h"
+#include "Core/HAL/FileSystem.h"
+#include "Core/Log.h"
+#include "Core/Profile/Profiler.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint64 STREAM_ALIGNMENT = 16;
+
+HS_FORCEINLINE uint64 align_up(uint64 value, uint64 alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+HS_FORCEINLINE bool is_range_valid(uint64 offset, uint64 size, uint64 fileSize)
+{
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+struct PendingStream
+{
+    EMeshCacheStream type;
+    uint32           index;
+    float            param;
+    const void*      data;
+    uint64           size;
+};
+
+struct PendingNode
+{
+    const Mesh* mesh;
+    uint32      parentIndex;
+};
+
+void flatten_mesh_tree(const Mesh* mesh, uint32 parentIndex, std::vector<PendingNode>& outNodes)
+{
+    const uint32 index = static_cast<uint32>(outNodes.size());
+    outNodes.push_back(PendingNode{mesh, parentIndex});
+
+    for (const Mesh* subMesh : mesh->GetSubMeshes())
+    {
+        if (nullptr != subMesh)
+        {
+            flatten_mesh_tree(subMesh, index, outNodes);
+        }
+    }
+}
+
+void collect_streams(const Mesh* mesh, std::vector<PendingStream>& outStreams)
+{
+    auto add = [&outStreams](EMeshCacheStream type, uint32 index, float param, const void* data, uint64 size) {
+        if (size > 0)
+        {
+            outStreams.push_back(PendingStream{type, index, param, data, size});
+        }
+    };
+
+    add(EMeshCacheStream::POSITION, 0, 0.0f, mesh->GetPosition().data(), mesh->GetPosition().size() * sizeof(float));
+    add(EMeshCacheStream::NORMAL, 0, 0.0f, mesh->GetNormal().data(), mesh->GetNormal().size() * sizeof(float));
+    for (uint32 set = 0; set < 8; ++set)
+    {
+        add(EMeshCacheStream::TEXCOORD, set, 0.0f, mesh->GetTexCoord(set).data(), mesh->GetTexCoord(set).size() * sizeof(float));
+    }
+    add(EMeshCacheStream::COLOR, 0, 0.0f, mesh->GetColor().data(), mesh->GetColor().size() * sizeof(float));
+    add(EMeshCacheStream::TANGENT, 0, 0.0f, mesh->GetTangent().data(), mesh->GetTangent().size() * sizeof(float));
+    add(EMeshCacheStream::BITANGENT, 0, 0.0f, mesh->GetBitangent().data(), mesh->GetBitangent().size() * sizeof(float));
+    add(EMeshCacheStream::INDEX, 0, 0.0f, mesh->GetIndices().data(), mesh->GetIndices().size() * sizeof(uint32));
+
+    const std::vector<MeshLOD>& lods = mesh->GetLODs();
+    for (size_t i = 0; i < lods.size(); ++i)
+    {
+        add(EMeshCacheStream::LOD_INDEX, static_cast<uint32>(i + 1), lods[i].error, lods[i].indices.data(), lods[i].indices.size() * sizeof(uint32));
+    }
+
+    const MeshletData& meshlets = mesh->GetMeshlets();
+    add(EMeshCacheStream::MESHLET, 0, 0.0f, meshlets.meshlets.data(), meshlets.meshlets.size() * sizeof(Meshlet));
+    add(EMeshCacheStream::MESHLET_VERTEX, 0, 0.0f, meshlets.vertices.data(), meshlets.vertices.size() * sizeof(uint32));
+    add(EMeshCacheStream::MESHLET_TRIANGLE, 0, 0.0f, meshlets.triangles.data(), meshlets.triangles.size());
+}
+
+uint32 append_string(std::vector<char>& strings, const std::string& value)
+{
+    const uint32 offset = static_cast<uint32>(strings.size());
+    strings.insert(strings.end(), value.begin(), value.end());
+    return offset;
+}
+
+template <typename T>
+std::vector<T> copy_stream(const uint8* data, const MeshCacheStream& stream)
+{
+    std::vector<T> result(static_cast<size_t>(stream.size / sizeof(T)));
+    ::memcpy(result.data(), data + stream.offset, result.size() * sizeof(T));
+    return result;
+}
+
+bool are_indices_valid(const std::vector<uint32>& indices, uint32 vertexCount)
+{
+    uint32 maxIndex = 0;
+    for (uint32 index : indices)
+    {
+        maxIndex = index > maxIndex ? index : maxIndex;
+    }
+    return indices.empty() || maxIndex < vertexCount;
+}
+
+// 스트림 하나를 메시에 옮긴다. 크기가 정점 수와 맞지 않으면 false
+bool apply_stream(Mesh& mesh, const MeshCacheNode& node, const MeshCacheStream& stream, const uint8* data, std::vector<MeshLOD>& lods, MeshletData& meshlets)
+{
+    const uint64 vertexCount = node.vertexCount;
+
+    switch (stream.type)
+    {
+    case EMeshCacheStream::POSITION:
+        if (stream.size != vertexCount * 3 * sizeof(float)) return false;
+        mesh.SetPosition(copy_stream<float>(data, stream), glm::make_vec3(node.boundMin), glm::make_vec3(node.boundMax));
+        return true;
+    case EMeshCacheStream::NORMAL:
+        if (stream.size != vertexCount * 3 * sizeof(float)) return false;
+        mesh.SetNormal(copy_stream<float>(data, stream));
+        return true;
+    case EMeshCacheStream::TEXCOORD:
+        if (stream.size != vertexCount * 2 * sizeof(float) || stream.index >= 8) return false;
+        mesh.SetTexCoord(copy_stream<float>(data, stream), static_cast<int>(stream.index));
+        return true;
+    case EMeshCacheStream::COLOR:
+        if (stream.size != vertexCount * 4 * sizeof(float)) return false;
+        mesh.SetColor(copy_stream<float>(data, stream));
+        return true;
+    case EMeshCacheStream::TANGENT:
+        if (stream.size != vertexCount * 3 * sizeof(float)) return false;
+        mesh.SetTangent(copy_stream<float>(data, stream));
+        return true;
+    case EMeshCacheStream::BITANGENT:
+        if (stream.size != vertexCount * 3 * sizeof(float)) return false;
+        mesh.SetBitangent(copy_stream<float>(data, stream));
+        return true;
+    case EMeshCacheStream::INDEX:
+    {
+        if (stream.size % (3 * sizeof(uint32)) != 0) return false;
+        std::vector<uint32> indices = copy_stream<uint32>(data, stream);
+        if (false == are_indices_valid(indices, node.vertexCount)) return false;
+        mesh.SetIndices(std::move(indices));
+        return true;
+    }
+    case EMeshCacheStream::LOD_INDEX:
+    {
+        if (stream.size % (3 * sizeof(uint32)) != 0 || stream.index != lods.size() + 1) return false;
+        std::vector<uint32> indices = copy_stream<uint32>(data, stream);
+        if (false == are_indices_valid(indices, node.vertexCount)) return false;
+        lods.push_back(MeshLOD{std::move(indices), stream.param});
+        return true;
+    }
+    case EMeshCacheStream::MESHLET:
+        if (stream.size % sizeof(Meshlet) != 0) return false;
+        meshlets.meshlets = copy_stream<Meshlet>(data, stream);
+        return true;
+    case EMeshCacheStream::MESHLET_VERTEX:
+        if (stream.size % sizeof(uint32) != 0) return false;
+        meshlets.vertices = copy_stream<uint32>(data, stream);
+        return are_indices_valid(meshlets.vertices, node.vertexCount);
+    case EMeshCacheStream::MESHLET_TRIANGLE:
+        meshlets.triangles = copy_stream<uint8>(data, stream);
+        return true;
+    default:
+        return false;
+    }
+}
+
+// 클러스터가 가리키는 범위가 배열 안에 있는지 본다. 셰이더가 그대로 읽으므로 여기서 걸러야 한다.
+bool are_meshlets_valid(const MeshletData& meshlets)
+{
+    for (const Meshlet& meshlet : meshlets.meshlets)
+    {
+        if (static_cast<uint64>(meshlet.vertexOffset) + meshlet.vertexCount > meshlets.vertices.size() ||
+            static_cast<uint64>(meshlet.triangleOffset) + meshlet.triangleCount * 3 > meshlets.triangles.size())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parse(const std::string& path, const uint8* data, uint64 fileSize, uint64 key, MeshCacheContent& outContent)
+{
+    if (fileSize < sizeof(MeshCacheHeader))
+    {
+        HS_LOG(warning, "MeshCache: %s is too small", path.c_str());
+        return false;
+    }
+
+    MeshCacheHeader header;
+    ::memcpy(&header, data, sizeof(header));
+    if (header.magic != MeshCacheHeader::MAGIC || header.version != MeshCacheHeader::VERSION)
+    {
+        HS_LOG(info, "MeshCache: %s has an old format (magic 0x%08X, version %u)", path.c_str(), header.magic, header.version);
+        return false;
+    }
+    if (header.key != key)
+    {
+        HS_LOG(info, "MeshCache: %s is stale", path.c_str());
+        return false;
+    }
+
+    if (header.fileSize != fileSize || header.nodeCount == 0 ||
+        false == is_range_valid(header.nodeTableOffset, static_cast<uint64>(header.nodeCount) * sizeof(MeshCacheNode), fileSize) ||
+        false == is_range_valid(header.streamTableOffset, static_cast<uint64>(header.streamCount) * sizeof(MeshCacheStream), fileSize) ||
+        false == is_range_valid(header.dependencyTableOffset, static_cast<uint64>(header.dependencyCount) * sizeof(MeshCacheDependencyEntry), fileSize) ||
+        false == is_range_valid(header.materialTableOffset, static_cast<uint64>(header.materialCount) * sizeof(MeshCacheString), fileSize) ||
+        false == is_range_valid(header.stringTableOffset, header.stringTableSize, fileSize) ||
+        (header.nodeTableOffset % alignof(MeshCacheNode)) != 0 || (header.streamTableOffset % alignof(MeshCacheStream)) != 0 ||
+        (header.dependencyTableOffset % alignof(MeshCacheDependencyEntry)) != 0 || (header.materialTableOffset % alignof(MeshCacheString)) != 0)
+    {
+        HS_LOG(warning, "MeshCache: %s has corrupted tables", path.c_str());
+        return false;
+    }
+
+    const MeshCacheNode*            nodes        = reinterpret_cast<const MeshCacheNode*>(data + header.nodeTableOffset);
+    const MeshCacheStream*          streams      = reinterpret_cast<const MeshCacheStream*>(data + header.streamTableOffset);
+    const MeshCacheDependencyEntry* dependencies = reinterpret_cast<const MeshCacheDependencyEntry*>(data + header.dependencyTableOffset);
+    const MeshCacheString*          materials    = reinterpret_cast<const MeshCacheString*>(data + header.materialTableOffset);
+    const char*                     strings      = reinterpret_cast<const char*>(data + header.stringTableOffset);
+
+    for (uint32 i = 0; i < header.streamCount; ++i)
+    {
+        if (false == is_range_valid(streams[i].offset, streams[i].size, fileSize))
+        {
+            HS_LOG(warning, "MeshCache: %s has corrupted stream %u", path.c_str(), i);
+            return false;
+        }
+    }
+
+    outContent.dependencies.resize(header.dependencyCount);
+    for (uint32 i = 0; i < header.dependencyCount; ++i)
+    {
+        const MeshCacheDependencyEntry& entry = dependencies[i];
+        if (false == is_range_valid(entry.pathOffset, entry.pathLength, header.stringTableSize))
+        {
+            HS_LOG(warning, "MeshCache: %s has corrupted dependency %u", path.c_str(), i);
+            return false;
+        }
+        outContent.dependencies[i] = MeshCacheDependency{std::string(strings + entry.pathOffset, entry.pathLength), entry.size, entry.hash};
+    }
+
+    outContent.materialNames.resize(header.materialCount);
+    for (uint32 i = 0; i < header.materialCount; ++i)
+    {
+        if (false == is_range_valid(materials[i].offset, materials[i].length, header.stringTableSize))
+        {
+            HS_LOG(warning, "MeshCache: %s has corrupted material %u", path.c_str(), i);
+            return false;
+        }
+        outContent.materialNames[i].assign(strings + materials[i].offset, materials[i].length);
+    }
+
+    std::vector<Mesh*> meshes(header.nodeCount, nullptr);
+    for (uint32 i = 0; i < header.nodeCount; ++i)
+    {
+        const MeshCacheNode& node = nodes[i];
+
+        const bool isNodeValid = (i == 0) == (node.parentIndex == MeshCacheNode::NO_PARENT) &&
+                                 (i == 0 || node.parentIndex < i) &&
+                                 static_cast<uint64>(node.firstStream) + node.streamCount <= header.streamCount &&
+                                 is_range_valid(node.nameOffset, node.nameLength, header.stringTableSize);
+
+        Scoped<Mesh> mesh = isNodeValid ? MakeScoped<Mesh>() : nullptr;
+        if (mesh)
+        {
+            if (node.nameLength > 0)
+            {
+                mesh->name = Name(strings + node.nameOffset, node.nameLength);
+            }
+            mesh->SetMaterialIndex(node.materialIndex);
+
+            std::vector<MeshLOD> lods;
+            MeshletData          meshlets;
+            for (uint32 s = 0; s < node.streamCount && mesh; ++s)
+            {
+                if (false == apply_stream(*mesh, node, streams[node.firstStream + s], data, lods, meshlets))
+                {
+                    mesh.reset();
+                }
+            }
+
+            if (mesh && false == are_meshlets_valid(meshlets))
+            {
+                mesh.reset();
+            }
+            if (mesh)
+            {
+                mesh->SetLODs(std::move(lods));
+                mesh->SetMeshlets(std::move(meshlets));
+            }
+        }
+
+        if (nullptr == mesh)
+        {
+            HS_LOG(warning, "MeshCache: %s has corrupted node %u", path.c_str(), i);
+            // 부모에 붙이지 못한 메시만 직접 지운다. 서브메시는 Mesh가 소유하지 않는다.
+            for (Mesh* created : meshes)
+            {
+                delete created;
+            }
+            return false;
+        }
+
+        meshes[i] = mesh.release();
+        if (i > 0)
+        {
+            meshes[node.parentIndex]->AddSubMesh(meshes[i]);
+        }
+    }
+
+    outContent.mesh.reset(meshes[0]);
+    return true;
+}
+} // namespace
+
+bool MeshCache::Write(const std::string& absolutePath, uint64 key, const Mesh* mesh, const std::vector<std::string>& materialNames, const std::vector<MeshCacheDependency>& dependencies)
+{
+    HS_PROFILE_SCOPE("MeshCache::Write");
+
+    if (nullptr == mesh)
+    {
+        return false;
+    }
+
+    std::vector<PendingNode> pendingNodes;
+    flatten_mesh_tree(mesh, MeshCacheNode::NO_PARENT, pendingNodes);
+
+    std::vector<char>          strings;
+    std::vector<MeshCacheNode> nodes(pendingNodes.size());
+    std::vector<PendingStream> pendingStreams;
+    for (size_t i = 0; i < pendingNodes.size(); ++i)
+    {
+        const Mesh*    source = pendingNodes[i].mesh;
+        MeshCacheNode& node   = nodes[i];
+
+        node               = MeshCacheNode{};
+        node.nameOffset    = append_string(strings, source->name.c_str());
+        node.nameLength    = static_cast<uint32>(strings.size()) - node.nameOffset;
+        node.parentIndex   = pendingNodes[i].parentIndex;
+        node.materialIndex = source->GetMaterialIndex();
+        node.firstStream   = static_cast<uint32>(pendingStreams.size());
+        node.vertexCount   = source->GetVertexCount();
+
+        const glm::vec3 boundMin = source->GetBoundMin();
+        const glm::vec3 boundMax = source->GetBoundMax();
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            node.boundMin[axis] = boundMin[axis];
+            node.boundMax[axis] = boundMax[axis];
+        }
+        node.boundMin[3] = 1.0f;
+        node.boundMax[3] = 1.0f;
+
+        collect_streams(source, pendingStreams);
+        node.streamCount = static_cast<uint32>(pendingStreams.size()) - node.firstStream;
+    }
+
+    std::vector<MeshCacheDependencyEntry> dependencyEntries(dependencies.size());
+    for (size_t i = 0; i < dependencies.size(); ++i)
+    {
+        dependencyEntries[i].pathOffset = append_string(strings, dependencies[i].path);
+        dependencyEntries[i].pathLength = static_cast<uint32>(dependencies[i].path.size());
+        dependencyEntries[i].size       = dependencies[i].size;
+        dependencyEntries[i].hash       = dependencies[i].hash;
+    }
+
+    std::vector<MeshCacheString> materialEntries(materialNames.size());
+    for (size_t i = 0; i < materialNames.size(); ++i)
+    {
+        materialEntries[i].offset = append_string(strings, materialNames[i]);
+        materialEntries[i].length = static_cast<uint32>(materialNames[i].size());
+    }
+
+    MeshCacheHeader header{};
+    header.magic                 = MeshCacheHeader::MAGIC;
+    header.version               = MeshCacheHeader::VERSION;
+    header.key                   = key;
+    header.nodeCount             = static_cast<uint32>(nodes.size());
+    header.streamCount           = static_cast<uint32>(pendingStreams.size());
+    header.dependencyCount       = static_cast<uint32>(dependencyEntries.size());
+    header.materialCount         = static_cast<uint32>(materialEntries.size());
+    header.nodeTableOffset       = sizeof(MeshCacheHeader);
+    header.streamTableOffset     = header.nodeTableOffset + nodes.size() * sizeof(MeshCacheNode);
+    header.dependencyTableOffset = header.streamTableOffset + pendingStreams.size() * sizeof(MeshCacheStream);
+    header.materialTableOffset   = header.dependencyTableOffset + dependencyEntries.size() * sizeof(MeshCacheDependencyEntry);
+    header.stringTableOffset     = header.materialTableOffset + materialEntries.size() * sizeof(MeshCacheString);
+    header.stringTableSize       = strings.size();
+
+    std::vector<MeshCacheStream> streams(pendingStreams.size());
+    uint64 offset = align_up(header.stringTableOffset + header.stringTableSize, STREAM_ALIGNMENT);
+    for (size_t i = 0; i < pendingStreams.size(); ++i)
+    {
+        streams[i]        = MeshCacheStream{};
+        streams[i].type   = pendingStreams[i].type;
+        streams[i].index  = pendingStreams[i].index;
+        streams[i].param  = pendingStreams[i].param;
+        streams[i].offset = offset;
+        streams[i].size   = pendingStreams[i].size;
+        offset            = align_up(offset + pendingStreams[i].size, STREAM_ALIGNMENT);
+    }
+    header.fileSize = offset;
+
+    // 다 쓴 뒤에 바꿔치기해서, 읽는 쪽이 반쯤 쓰인 파일을 보지 않게 한다.
+    const std::string tempPath = absolutePath + ".tmp";
+    std::ofstream file(tempPath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (false == file.is_open())
+    {
+        HS_LOG(warning, "MeshCache: fail to open %s", tempPath.c_str());
+        return false;
+    }
+
+    static const char s_padding[STREAM_ALIGNMENT] = {};
+    uint64 written = 0;
+    auto write = [&file, &written](const void* data, uint64 size) {
+        file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        written += size;
+    };
+
+    write(&header, sizeof(header));
+    write(nodes.data(), nodes.size() * sizeof(MeshCacheNode));
+    write(streams.data(), streams.size() * sizeof(MeshCacheStream));
+    write(dependencyEntries.data(), dependencyEntries.size() * sizeof(MeshCacheDependencyEntry));
+    write(materialEntries.data(), materialEntries.size() * sizeof(MeshCacheString));
+    write(strings.data(), strings.size());
+    for (size_t i = 0; i < pendingStreams.size(); ++i)
+    {
+        write(s_padding, streams[i].offset - written);
+        write(pendingStreams[i].data, pendingStreams[i].size);
+    }
+    write(s_padding, header.fileSize - written);
+
+    file.close();
+    if (false == file.good())
+    {
+        HS_LOG(warning, "MeshCache: fail to write %s", tempPath.c_str());
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Windows의 rename은 대상이 있으면 실패한다.
+    std::remove(absolutePath.c_str());
+    if (0 != std::rename(tempPath.c_str(), absolutePath.c_str()))
+    {
+        HS_LOG(warning, "MeshCache: fail to move %s", tempPath.c_str());
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    HS_LOG(info, "MeshCache: wrote %s (%u meshes, %llu bytes)", absolutePath.c_str(), header.nodeCount, static_cast<unsigned long long>(header.fileSize));
+    return true;
+}
+
+bool MeshCache::Read(const std::string& absolutePath, uint64 key, MeshCacheContent& outContent)
+{
+    HS_PROFILE_SCOPE("MeshCache::Read");
+
+    outContent = MeshCacheContent{};
+
+    bool isRead = false;
+
+    std::vector<uint8> packedData;
+    if (VirtualFileSystem::ReadPackedFile(absolutePath, packedData))
+    {
+        isRead = parse(absolutePath, packedData.data(), packedData.size(), key, outContent);
+    }
+    else if (FileSystem::Exist(absolutePath))
+    {
+        // 스트림을 앞에서부터 차례로 복사하므로 미리 읽기를 크게 잡는다.
+        MappedFile mappedFile;
+        if (false == FileSystem::MapFile(absolutePath, EFileAccessPattern::SEQUENTIAL, mappedFile) || false == mappedFile.IsValid())
+        {
+            HS_LOG(warning, "MeshCache: fail to map %s", absolutePath.c_str());
+            return false;
+        }
+
+        isRead = parse(absolutePath, mappedFile.data, mappedFile.size, key, outContent);
+        FileSystem::UnmapFile(mappedFile);
+    }
+
+    if (false == isRead)
+    {
+        outContent = MeshCacheContent{};
+    }
+    return isRead;
+}
+
+HS_NS_END
@@ -0,0 +1,568 @@
+//
+//  MeshOptimizer.cpp
+//  HSMR
+//
+//  Reorders Mesh index and vertex streams for the post-transform cache, overdraw and vertex fetch
+//
+#include "Resource/MeshOptimizer.h"
+#include "Resource/Mesh.h"
+#include "Resource/MeshAdjacency.h"
+
+#include "Core/Hash.h"
+#include "Core/Log.h"
+#include "Core/Math/Common.h"
+#include "Core/Profile/Profiler.h"
+
+#include <algorithm>
+#include <cstring>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 INVALID_INDEX     = ~0u;
+constexpr uint32 MAX_TEXCOORD_SETS = 8;
+
+enum class EVertexStream : uint8
+{
+    POSITION,
+    NORMAL,
+    TEXCOORD,
+    COLOR,
+    TANGENT,
+    BITANGENT,
+};
+
+struct VertexStream
+{
+    EVertexStream      type;
+    uint32             setIndex;
+    uint32             components;
+    std::vector<float> data;
+};
+
+// 정점 재배치는 모든 속성에 똑같이 적용해야 하므로 Mesh에서 잠시 꺼내 한 목록으로 다룬다.
+bool gather_streams(const Mesh& mesh, std::vector<VertexStream>& outStreams)
+{
+    const size_t vertexCount = mesh.GetVertexCount();
+
+    auto addStream = [&](EVertexStream type, uint32 setIndex, uint32 components, const std::vector<float>& data) {
+        if (data.empty())
+        {
+            return true;
+        }
+        if (data.size() != vertexCount * components)
+        {
+            HS_LOG(warning, "MeshOptimizer: Vertex stream %d has %zu floats, expected %zu", static_cast<int>(type), data.size(), vertexCount * components);
+            return false;
+        }
+        outStreams.push_back({type, setIndex, components, data});
+        return true;
+    };
+
+    bool isValid = addStream(EVertexStream::POSITION, 0, 3, mesh.GetPosition());
+    isValid      = isValid && addStream(EVertexStream::NORMAL, 0, 3, mesh.GetNormal());
+    for (uint32 i = 0; i < MAX_TEXCOORD_SETS; ++i)
+    {
+        isValid = isValid && addStream(EVertexStream::TEXCOORD, i, 2, mesh.GetTexCoord(static_cast<int>(i)));
+    }
+    isValid = isValid && addStream(EVertexStream::COLOR, 0, 4, mesh.GetColor());
+    isValid = isValid && addStream(EVertexStream::TANGENT, 0, 3, mesh.GetTangent());
+    isValid = isValid && addStream(EVertexStream::BITANGENT, 0, 3, mesh.GetBitangent());
+
+    return isValid;
+}
+
+void scatter_streams(Mesh& mesh, std::vector<VertexStream>& streams)
+{
+    for (VertexStream& stream : streams)
+    {
+        switch (stream.type)
+        {
+        case EVertexStream::POSITION:  mesh.SetPosition(std::move(stream.data)); break;
+        case EVertexStream::NORMAL:    mesh.SetNormal(std::move(stream.data)); break;
+        case EVertexStream::TEXCOORD:  mesh.SetTexCoord(std::move(stream.data), static_cast<int>(stream.setIndex)); break;
+        case EVertexStream::COLOR:     mesh.SetColor(std::move(stream.data)); break;
+        case EVertexStream::TANGENT:   mesh.SetTangent(std::move(stream.data)); break;
+        case EVertexStream::BITANGENT: mesh.SetBitangent(std::move(stream.data)); break;
+        }
+    }
+}
+
+bool is_same_vertex(const std::vector<VertexStream>& streams, uint32 a, uint32 b)
+{
+    for (const VertexStream& stream : streams)
+    {
+        if (0 != std::memcmp(&stream.data[a * stream.components], &stream.data[b * stream.components], sizeof(float) * stream.components))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 비트 단위로 같은 정점끼리 묶어 인덱스를 대표 정점으로 바꾼다. 남는 정점은 remap_vertex_fetch가 버린다.
+uint32 weld_vertices(const std::vector<VertexStream>& streams, uint32 vertexCount, std::vector<uint32>& indices)
+{
+    std::vector<uint32> remap(vertexCount);
+
+    size_t tableSize = 1;
+    while (tableSize < static_cast<size_t>(vertexCount) * 2)
+    {
+        tableSize <<= 1;
+    }
+    std::vector<uint32> table(tableSize, INVALID_INDEX);
+
+    uint32 weldCount = 0;
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        uint64 hash = 0;
+        for (const VertexStream& stream : streams)
+        {
+            hash = HashBytes64(&stream.data[v * stream.components], sizeof(float) * stream.components, hash);
+        }
+
+        size_t slot = static_cast<size_t>(hash) & (tableSize - 1);
+        while (table[slot] != INVALID_INDEX && false == is_same_vertex(streams, table[slot], v))
+        {
+            slot = (slot + 1) & (tableSize - 1);
+        }
+
+        if (table[slot] == INVALID_INDEX)
+        {
+            table[slot] = v;
+            remap[v]    = v;
+        }
+        else
+        {
+            remap[v] = table[slot];
+            weldCount++;
+        }
+    }
+
+    for (uint32& index : indices)
+    {
+        index = remap[index];
+    }
+
+    return weldCount;
+}
+
+// Tipsify (Sander et al. 2007). 캐시에 남아 있을 정점을 축으로 부채꼴 순서로 삼각형을 내보낸다.
+// 막다른 곳에서 다른 정점으로 건너뛴 자리는 캐시가 끊기는 곳이므로 클러스터 경계로 기록한다.
+void optimize_vertex_cache(std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize, std::vector<uint32>& outClusters)
+{
+    const uint32 triangleCount = static_cast<uint32>(indices.size() / 3);
+
+    VertexAdjacency adjacency;
+    if (false == BuildVertexAdjacency(indices, vertexCount, adjacency))
+    {
+        return;
+    }
+
+    std::vector<uint32> liveCount(vertexCount);
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        liveCount[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+
+    std::vector<uint32> cacheTime(vertexCount, 0);
+    std::vector<uint8>  isEmitted(triangleCount, 0);
+    std::vector<uint32> deadEnd;
+    std::vector<uint32> candidates;
+    std::vector<uint32> result(indices.size());
+
+    deadEnd.reserve(indices.size());
+    outClusters.clear();
+    outClusters.push_back(0);
+
+    uint32 timestamp   = cacheSize + 1;
+    uint32 scanCursor  = 0;
+    uint32 outTriangle = 0;
+
+    auto skipDeadEnd = [&]() -> uint32 {
+        while (false == deadEnd.empty())
+        {
+            const uint32 v = deadEnd.back();
+            deadEnd.pop_back();
+            if (liveCount[v] > 0)
+            {
+                return v;
+            }
+        }
+        while (scanCursor < vertexCount)
+        {
+            if (liveCount[scanCursor] > 0)
+            {
+                return scanCursor;
+            }
+            scanCursor++;
+        }
+        return INVALID_INDEX;
+    };
+
+    uint32 current = skipDeadEnd();
+    while (current != INVALID_INDEX)
+    {
+        candidates.clear();
+
+        for (uint32 a = adjacency.offsets[current]; a < adjacency.offsets[current + 1]; ++a)
+        {
+            const uint32 triangle = adjacency.triangles[a];
+            if (isEmitted[triangle])
+            {
+                continue;
+            }
+            isEmitted[triangle] = 1;
+
+            for (uint32 k = 0; k < 3; ++k)
+            {
+                const uint32 v = indices[triangle * 3 + k];
+                result[outTriangle * 3 + k] = v;
+
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                liveCount[v]--;
+
+                if (timestamp - cacheTime[v] > cacheSize)
+                {
+                    cacheTime[v] = timestamp++;
+                }
+            }
+            outTriangle++;
+        }
+
+        // 남은 삼각형을 다 내보낼 때까지 캐시에 머무를 정점 중 가장 오래된 것을 고른다.
+        uint32 next         = INVALID_INDEX;
+        int64  bestPriority = -1;
+        for (uint32 v : candidates)
+        {
+            if (liveCount[v] == 0)
+            {
+                continue;
+            }
+
+            int64 priority = 0;
+            if (timestamp - cacheTime[v] + 2 * liveCount[v] <= cacheSize)
+            {
+                priority = timestamp - cacheTime[v];
+            }
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                next         = v;
+            }
+        }
+
+        if (next == INVALID_INDEX)
+        {
+            next = skipDeadEnd();
+            if (next != INVALID_INDEX && outTriangle < triangleCount)
+            {
+                outClusters.push_back(outTriangle);
+            }
+        }
+
+        current = next;
+    }
+
+    HS_ASSERT(outTriangle == triangleCount, "MeshOptimizer: Tipsify lost triangles");
+    indices.swap(result);
+}
+
+// 캐시가 끊기지 않는 구간도 ACMR이 목표치 이하로 내려오면 잘라서 정렬 단위를 잘게 만든다.
+void split_clusters(const std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize, float threshold, std::vector<uint32>& clusters)
+{
+    const uint32 triangleCount = static_cast<uint32>(indices.size() / 3);
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    std::vector<uint32> cacheTime(vertexCount, 0);
+    uint32 timestamp = cacheSize + 1;
+
+    auto countMisses = [&](uint32 triangle) {
+        uint32 misses = 0;
+        for (uint32 k = 0; k < 3; ++k)
+        {
+            const uint32 v = indices[triangle * 3 + k];
+            if (timestamp - cacheTime[v] > cacheSize)
+            {
+                cacheTime[v] = timestamp++;
+                misses++;
+            }
+        }
+        return misses;
+    };
+
+    uint32 totalMisses = 0;
+    for (uint32 t = 0; t < triangleCount; ++t)
+    {
+        totalMisses += countMisses(t);
+    }
+    const float clusterThreshold = threshold * static_cast<float>(totalMisses) / static_cast<float>(triangleCount);
+
+    std::vector<uint32> result;
+    result.reserve(clusters.size() * 2);
+
+    for (size_t c = 0; c < clusters.size(); ++c)
+    {
+        const uint32 begin = clusters[c];
+        const uint32 end   = (c + 1 < clusters.size()) ? clusters[c + 1] : triangleCount;
+
+        // 캐시를 비운 상태에서 시작한다.
+        timestamp += cacheSize + 1;
+        result.push_back(begin);
+
+        uint32 clusterBegin  = begin;
+        uint32 clusterMisses = 0;
+        for (uint32 t = begin; t < end; ++t)
+        {
+            clusterMisses += countMisses(t);
+
+            const uint32 clusterTriangles = t + 1 - clusterBegin;
+            if (t + 1 < end && static_cast<float>(clusterMisses) <= clusterThreshold * static_cast<float>(clusterTriangles))
+            {
+                result.push_back(t + 1);
+                clusterBegin  = t + 1;
+                clusterMisses = 0;
+                timestamp += cacheSize + 1;
+            }
+        }
+    }
+
+    clusters.swap(result);
+}
+
+// 시점과 무관한 오버드로 지표 (Sander et al. 2007). 메시 중심에서 바깥을 향한 클러스터일수록
+// 다른 면을 가릴 가능성이 높으므로 먼저 그린다.
+void optimize_overdraw(std::vector<uint32>& indices, const std::vector<float>& positions, const std::vector<uint32>& clusters)
+{
+    const uint32 triangleCount = static_cast<uint32>(indices.size() / 3);
+    if (clusters.size() < 2)
+    {
+        return;
+    }
+
+    glm::dvec3 meshCenter(0.0);
+    for (uint32 index : indices)
+    {
+        meshCenter += glm::dvec3(positions[index * 3 + 0], positions[index * 3 + 1], positions[index * 3 + 2]);
+    }
+    meshCenter /= static_cast<double>(indices.size());
+
+    struct ClusterSortKey
+    {
+        float  metric;
+        uint32 cluster;
+    };
+    std::vector<ClusterSortKey> keys(clusters.size());
+
+    for (size_t c = 0; c < clusters.size(); ++c)
+    {
+        const uint32 begin = clusters[c];
+        const uint32 end   = (c + 1 < clusters.size()) ? clusters[c + 1] : triangleCount;
+
+        glm::dvec3 centroid(0.0);
+        glm::dvec3 normal(0.0);
+        double     areaSum = 0.0;
+        for (uint32 t = begin; t < end; ++t)
+        {
+            const uint32* tri = &indices[t * 3];
+            const glm::dvec3 p0(positions[tri[0] * 3 + 0], positions[tri[0] * 3 + 1], positions[tri[0] * 3 + 2]);
+            const glm::dvec3 p1(positions[tri[1] * 3 + 0], positions[tri[1] * 3 + 1], positions[tri[1] * 3 + 2]);
+            const glm::dvec3 p2(positions[tri[2] * 3 + 0], positions[tri[2] * 3 + 1], positions[tri[2] * 3 + 2]);
+
+            const glm::dvec3 faceNormal = glm::cross(p1 - p0, p2 - p0); // 길이 = 넓이 * 2
+            const double     area       = glm::length(faceNormal);
+
+            centroid += (p0 + p1 + p2) * (area / 3.0);
+            normal += faceNormal;
+            areaSum += area;
+        }
+
+        float metric = 0.0f;
+        const double normalLength = glm::length(normal);
+        if (areaSum > 0.0 && normalLength > 0.0)
+        {
+            centroid /= areaSum;
+            metric = static_cast<float>(glm::dot(centroid - meshCenter, normal / normalLength));
+        }
+
+        keys[c] = {metric, static_cast<uint32>(c)};
+    }
+
+    std::stable_sort(keys.begin(), keys.end(), [](const ClusterSortKey& a, const ClusterSortKey& b) { return a.metric > b.metric; });
+
+    std::vector<uint32> result;
+    result.reserve(indices.size());
+    for (const ClusterSortKey& key : keys)
+    {
+        const uint32 begin = clusters[key.cluster];
+        const uint32 end   = (key.cluster + 1 < clusters.size()) ? clusters[key.cluster + 1] : triangleCount;
+        result.insert(result.end(), indices.begin() + begin * 3, indices.begin() + end * 3);
+    }
+
+    indices.swap(result);
+}
+
+// 인덱스에서 처음 쓰이는 순서로 정점을 옮긴다. 쓰이지 않는 정점은 사라진다.
+uint32 remap_vertex_fetch(std::vector<VertexStream>& streams, uint32 vertexCount, std::vector<uint32>& indices)
+{
+    std::vector<uint32> remap(vertexCount, INVALID_INDEX);
+    uint32 nextVertex = 0;
+    for (uint32& index : indices)
+    {
+        if (remap[index] == INVALID_INDEX)
+        {
+            remap[index] = nextVertex++;
+        }
+        index = remap[index];
+    }
+
+    for (VertexStream& stream : streams)
+    {
+        const uint32 components = stream.components;
+        std::vector<float> remapped(static_cast<size_t>(nextVertex) * components);
+        for (uint32 v = 0; v < vertexCount; ++v)
+        {
+            if (remap[v] != INVALID_INDEX)
+            {
+                std::memcpy(&remapped[remap[v] * components], &stream.data[v * components], sizeof(float) * components);
+            }
+        }
+        stream.data.swap(remapped);
+    }
+
+    return nextVertex;
+}
+} // namespace
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize)
+{
+    indices.resize((indices.size() / 3) * 3);
+    if (indices.empty())
+    {
+        return;
+    }
+
+    std::vector<uint32> clusters;
+    optimize_vertex_cache(indices, vertexCount, cacheSize, clusters);
+}
+
+VertexCacheStats MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32>& indices, uint32 vertexCount, uint32 cacheSize)
+{
+    VertexCacheStats stats{};
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || vertexCount == 0)
+    {
+        return stats;
+    }
+
+    std::vector<uint32> cacheTime(vertexCount, 0);
+    std::vector<uint8>  isReferenced(vertexCount, 0);
+    uint32 timestamp       = cacheSize + 1;
+    uint32 referencedCount = 0;
+
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+    {
+        const uint32 v = indices[i];
+        if (v >= vertexCount)
+        {
+            continue;
+        }
+
+        if (timestamp - cacheTime[v] > cacheSize)
+        {
+            cacheTime[v] = timestamp++;
+            stats.missCount++;
+        }
+
+        if (0 == isReferenced[v])
+        {
+            isReferenced[v] = 1;
+            referencedCount++;
+        }
+    }
+
+    stats.acmr = static_cast<float>(stats.missCount) / static_cast<float>(triangleCount);
+    stats.atvr = static_cast<float>(stats.missCount) / static_cast<float>(referencedCount);
+    return stats;
+}
+
+MeshOptimizeResult MeshOptimizer::Optimize(Mesh* mesh, const MeshOptimizeInfo& info)
+{
+    HS_PROFILE_SCOPE("MeshOptimizer::Optimize");
+
+    MeshOptimizeResult result{};
+    if (nullptr == mesh || false == mesh->HasIndices())
+    {
+        return result;
+    }
+
+    const uint32 vertexCount = mesh->GetVertexCount();
+    std::vector<uint32> indices = mesh->GetIndices();
+    indices.resize((indices.size() / 3) * 3);
+
+    result.vertexCountBefore = vertexCount;
+    result.vertexCountAfter  = vertexCount;
+    result.fitsUInt16Index   = vertexCount <= 65536;
+
+    for (uint32 index : indices)
+    {
+        if (index >= vertexCount)
+        {
+            HS_LOG(warning, "MeshOptimizer: Index %u is out of range (%u vertices)", index, vertexCount);
+            return result;
+        }
+    }
+
+    result.before = AnalyzeVertexCache(indices, vertexCount, info.cacheSize);
+
+    std::vector<VertexStream> streams;
+    const bool canRemapVertices = (info.weldVertices || info.optimizeVertexFetch) && gather_streams(*mesh, streams);
+
+    if (canRemapVertices && info.weldVertices)
+    {
+        weld_vertices(streams, vertexCount, indices);
+    }
+
+    if (info.optimizeVertexCache)
+    {
+        std::vector<uint32> clusters;
+        optimize_vertex_cache(indices, vertexCount, info.cacheSize, clusters);
+
+        if (info.optimizeOverdraw)
+        {
+            split_clusters(indices, vertexCount, info.cacheSize, info.overdrawThreshold, clusters);
+            optimize_overdraw(indices, mesh->GetPosition(), clusters);
+        }
+    }
+
+    if (canRemapVertices)
+    {
+        result.vertexCountAfter = remap_vertex_fetch(streams, vertexCount, indices);
+        scatter_streams(*mesh, streams);
+    }
+
+    result.after           = AnalyzeVertexCache(indices, result.vertexCountAfter, info.cacheSize);
+    result.fitsUInt16Index = result.vertexCountAfter <= 65536;
+    result.isOptimized     = true;
+
+    mesh->SetIndices(std::move(indices));
+
+    // 삼각형 순서가 바뀌었으므로 이전 클러스터는 더 이상 맞지 않는다.
+    if (mesh->HasMeshlets())
+    {
+        mesh->SetMeshlets(MeshletData{});
+    }
+    if (canRemapVertices && mesh->HasLODs())
+    {
+        mesh->SetLODs({});
+    }
+
+    return result;
+}
+
+HS_NS_END
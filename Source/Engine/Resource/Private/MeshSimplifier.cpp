@@ -0,0 +1,543 @@
+//
+//  MeshSimplifier.cpp
+//  HSMR
+//
+//  Quadric-error edge collapse simplification and LOD chain generation
+//
+#include "Resource/MeshSimplifier.h"
+#include "Resource/MeshOptimizer.h"
+#include "Resource/Mesh.h"
+#include "Resource/MeshAdjacency.h"
+
+#include "Core/Hash.h"
+#include "Core/Log.h"
+#include "Core/Profile/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 INVALID_VERTEX     = ~0u;
+constexpr uint32 MAX_PASS_COUNT     = 64;
+// 한 번 접을 때 면 법선이 이보다 크게 돌아가면(약 75도) 뒤집힘으로 본다.
+constexpr float  FLIP_COS_THRESHOLD = 0.25f;
+
+// Garland-Heckbert 평면 쿼드릭. 대칭 4x4 행렬의 윗삼각 10개와 누적 면적을 담는다.
+struct Quadric
+{
+    double a00, a11, a22;
+    double a10, a20, a21;
+    double b0, b1, b2;
+    double c;
+    double weight;
+};
+
+HS_FORCEINLINE glm::dvec3 get_position(const std::vector<float>& positions, uint32 index)
+{
+    return glm::dvec3(positions[index * 3 + 0], positions[index * 3 + 1], positions[index * 3 + 2]);
+}
+
+HS_FORCEINLINE void add_quadric(Quadric& q, const Quadric& r)
+{
+    q.a00 += r.a00; q.a11 += r.a11; q.a22 += r.a22;
+    q.a10 += r.a10; q.a20 += r.a20; q.a21 += r.a21;
+    q.b0 += r.b0; q.b1 += r.b1; q.b2 += r.b2;
+    q.c += r.c;
+    q.weight += r.weight;
+}
+
+// 평면 (n, d)에 대한 거리 제곱에 weight를 곱한 쿼드릭
+Quadric make_plane_quadric(const glm::dvec3& n, double d, double weight)
+{
+    Quadric q;
+    q.a00 = n.x * n.x * weight; q.a11 = n.y * n.y * weight; q.a22 = n.z * n.z * weight;
+    q.a10 = n.y * n.x * weight; q.a20 = n.z * n.x * weight; q.a21 = n.z * n.y * weight;
+    q.b0 = n.x * d * weight; q.b1 = n.y * d * weight; q.b2 = n.z * d * weight;
+    q.c = d * d * weight;
+    q.weight = weight;
+    return q;
+}
+
+HS_FORCEINLINE double evaluate_quadric(const Quadric& q, const glm::dvec3& p)
+{
+    const double rx = q.b0 + q.a00 * p.x + q.a10 * p.y + q.a20 * p.z;
+    const double ry = q.b1 + q.a10 * p.x + q.a11 * p.y + q.a21 * p.z;
+    const double rz = q.b2 + q.a20 * p.x + q.a21 * p.y + q.a22 * p.z;
+    const double r  = q.c + 2.0 * (q.b0 * p.x + q.b1 * p.y + q.b2 * p.z) + (rx - q.b0) * p.x + (ry - q.b1) * p.y + (rz - q.b2) * p.z;
+
+    // 면적으로 나눠 평균 거리 제곱으로 만든다. 부동소수 오차로 음수가 될 수 있다.
+    // 접는 순서를 정하는 비용으로만 쓴다. 최대 거리보다 작으므로 보고하는 오차로는 쓰지 않는다.
+    return q.weight > 0.0 ? std::max(r, 0.0) / q.weight : 0.0;
+}
+
+// 같은 위치를 공유하는 정점을 하나의 대표 정점으로 묶는다. 이음새 판정과 경계 판정에 쓴다.
+void build_position_remap(const std::vector<float>& positions, uint32 vertexCount, std::vector<uint32>& outRemap)
+{
+    uint32 tableSize = 1;
+    while (tableSize < vertexCount * 2)
+    {
+        tableSize <<= 1;
+    }
+
+    std::vector<uint32> table(tableSize, INVALID_VERTEX);
+    outRemap.resize(vertexCount);
+
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        const float* p    = &positions[v * 3];
+        uint32       slot = static_cast<uint32>(HashBytes64(p, sizeof(float) * 3)) & (tableSize - 1);
+
+        while (true)
+        {
+            const uint32 other = table[slot];
+            if (other == INVALID_VERTEX)
+            {
+                table[slot] = v;
+                outRemap[v] = v;
+                break;
+            }
+            if (0 == std::memcmp(p, &positions[other * 3], sizeof(float) * 3))
+            {
+                outRemap[v] = other;
+                break;
+            }
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+}
+
+// 위치 기준으로 이어 붙였을 때 삼각형 하나에만 속하는 변(열린 경계)의 끝점을 잠근다.
+void lock_border_vertices(const std::vector<uint32>& indices, const std::vector<uint32>& positionRemap, uint32 vertexCount, std::vector<uint8>& locked)
+{
+    std::vector<uint32> positionIndices(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        positionIndices[i] = positionRemap[indices[i]];
+    }
+
+    VertexAdjacency adjacency;
+    if (false == BuildVertexAdjacency(positionIndices, vertexCount, adjacency))
+    {
+        return;
+    }
+    const std::vector<uint32>& offsets   = adjacency.offsets;
+    const std::vector<uint32>& triangles = adjacency.triangles;
+
+    std::vector<uint32> neighbors;
+    std::vector<uint32> counts;
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        if (offsets[v] == offsets[v + 1])
+        {
+            continue;
+        }
+
+        neighbors.clear();
+        counts.clear();
+        for (uint32 k = offsets[v]; k < offsets[v + 1]; ++k)
+        {
+            const uint32* tri = &positionIndices[triangles[k] * 3];
+            for (int e = 0; e < 3; ++e)
+            {
+                const uint32 other = tri[e];
+                if (other == v)
+                {
+                    continue;
+                }
+
+                auto it = std::find(neighbors.begin(), neighbors.end(), other);
+                if (it == neighbors.end())
+                {
+                    neighbors.push_back(other);
+                    counts.push_back(1);
+                }
+                else
+                {
+                    counts[it - neighbors.begin()]++;
+                }
+            }
+        }
+
+        for (size_t n = 0; n < neighbors.size(); ++n)
+        {
+            if (counts[n] == 1)
+            {
+                locked[v]            = 1;
+                locked[neighbors[n]] = 1;
+            }
+        }
+    }
+
+    // 대표 정점의 판정을 같은 위치의 정점 모두에 퍼뜨린다.
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        if (locked[positionRemap[v]])
+        {
+            locked[v] = 1;
+        }
+    }
+}
+
+struct Collapse
+{
+    uint32 from;
+    uint32 to;
+    float  cost;
+};
+
+// from을 to 자리로 옮겼을 때 from 주변 삼각형이 뒤집히거나 크게 꺾이면 true
+// from을 to 자리로 옮길 때 from 주변 삼각형 평면에서 to까지의 최대 거리. 새 삼각형이 옛 삼각형에서 벗어나는 거리의 근사다.
+double max_plane_distance(const std::vector<float>& positions, const std::vector<uint32>& indices, const std::vector<uint32>& offsets, const std::vector<uint32>& triangles, uint32 from, uint32 to)
+{
+    const glm::dvec3 target   = get_position(positions, to);
+    double           distance = 0.0;
+
+    for (uint32 k = offsets[from]; k < offsets[from + 1]; ++k)
+    {
+        const uint32* tri = &indices[triangles[k] * 3];
+        if (tri[0] == to || tri[1] == to || tri[2] == to)
+        {
+            continue; // to를 지나는 평면이다.
+        }
+
+        const glm::dvec3 p0     = get_position(positions, tri[0]);
+        const glm::dvec3 normal = glm::cross(get_position(positions, tri[1]) - p0, get_position(positions, tri[2]) - p0);
+        const double     length = glm::length(normal);
+        if (length > 0.0)
+        {
+            distance = std::max(distance, std::fabs(glm::dot(normal, target - p0)) / length);
+        }
+    }
+
+    return distance;
+}
+
+bool has_triangle_flip(const std::vector<float>& positions, const std::vector<uint32>& indices, const std::vector<uint32>& offsets, const std::vector<uint32>& triangles, uint32 from, uint32 to)
+{
+    const glm::dvec3 target = get_position(positions, to);
+
+    for (uint32 k = offsets[from]; k < offsets[from + 1]; ++k)
+    {
+        const uint32* tri = &indices[triangles[k] * 3];
+        if (tri[0] == to || tri[1] == to || tri[2] == to)
+        {
+            continue; // 접히면서 사라지는 삼각형
+        }
+
+        const int    corner = tri[0] == from ? 0 : (tri[1] == from ? 1 : 2);
+        const uint32 b      = tri[(corner + 1) % 3];
+        const uint32 c      = tri[(corner + 2) % 3];
+
+        const glm::dvec3 pa = get_position(positions, from);
+        const glm::dvec3 pb = get_position(positions, b);
+        const glm::dvec3 pc = get_position(positions, c);
+
+        const glm::dvec3 before = glm::cross(pb - pa, pc - pa);
+        const glm::dvec3 after  = glm::cross(pb - target, pc - target);
+
+        const double beforeLength = glm::length(before);
+        const double afterLength  = glm::length(after);
+        if (afterLength <= 0.0 || glm::dot(before, after) < FLIP_COS_THRESHOLD * beforeLength * afterLength)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<uint32> simplify_indices(const std::vector<float>& positions, uint32 vertexCount, const std::vector<uint32>& positionRemap, const std::vector<uint8>& seamLocked,
+                                     std::vector<uint32> indices, size_t targetIndexCount, float maxError, float& outError)
+{
+    outError = 0.0f;
+
+    std::vector<uint8> locked = seamLocked;
+    lock_border_vertices(indices, positionRemap, vertexCount, locked);
+
+    // 정점마다 인접 면의 평면 쿼드릭을 면적 가중치로 모은다.
+    std::vector<Quadric> quadrics(vertexCount, Quadric{});
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        const glm::dvec3 p0 = get_position(positions, indices[i + 0]);
+        const glm::dvec3 p1 = get_position(positions, indices[i + 1]);
+        const glm::dvec3 p2 = get_position(positions, indices[i + 2]);
+
+        glm::dvec3   normal = glm::cross(p1 - p0, p2 - p0);
+        const double length = glm::length(normal);
+        if (length <= 0.0)
+        {
+            continue;
+        }
+        normal /= length;
+
+        const Quadric q = make_plane_quadric(normal, -glm::dot(normal, p0), length * 0.5);
+        add_quadric(quadrics[indices[i + 0]], q);
+        add_quadric(quadrics[indices[i + 1]], q);
+        add_quadric(quadrics[indices[i + 2]], q);
+    }
+
+    const double maxErrorSq  = static_cast<double>(maxError) * static_cast<double>(maxError);
+    double       resultError = 0.0;
+
+    // 정점 주변 삼각형이 원본 표면에서 벗어난 거리의 상한. 접을 때마다 주변 오차에 새로 벗어난 거리를 더해 넓힌다.
+    std::vector<double> vertexError(vertexCount, 0.0);
+
+    VertexAdjacency       adjacency;
+    std::vector<Collapse> collapses;
+    std::vector<uint32>   remap(vertexCount);
+    std::vector<uint8>    passLocked(vertexCount);
+
+    auto collapse_cost = [&](uint32 from, uint32 to) {
+        Quadric q = quadrics[from];
+        add_quadric(q, quadrics[to]);
+        return evaluate_quadric(q, get_position(positions, to));
+    };
+
+    for (uint32 pass = 0; pass < MAX_PASS_COUNT && indices.size() > targetIndexCount; ++pass)
+    {
+        if (false == BuildVertexAdjacency(indices, vertexCount, adjacency))
+        {
+            break;
+        }
+        const std::vector<uint32>& offsets   = adjacency.offsets;
+        const std::vector<uint32>& triangles = adjacency.triangles;
+
+        collapses.clear();
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            for (int e = 0; e < 3; ++e)
+            {
+                const uint32 a = indices[i + e];
+                const uint32 b = indices[i + (e + 1) % 3];
+
+                // 변마다 양쪽 삼각형에서 한 번씩 나오므로 방향 하나씩만 넣는다.
+                if (0 == locked[a])
+                {
+                    collapses.push_back({a, b, static_cast<float>(collapse_cost(a, b))});
+                }
+            }
+        }
+
+        if (collapses.empty())
+        {
+            break;
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.cost < rhs.cost; });
+
+        // 내부 정점 하나를 접으면 삼각형이 둘 사라진다.
+        const size_t goal    = (indices.size() - targetIndexCount) / 3;
+        size_t       removed = 0;
+
+        std::iota(remap.begin(), remap.end(), 0u);
+        std::fill(passLocked.begin(), passLocked.end(), 0);
+
+        for (const Collapse& collapse : collapses)
+        {
+            // 비용은 평균 거리 제곱이라 최대 거리의 제곱보다 작다. 이미 한계를 넘었으면 뒤쪽도 모두 넘는다.
+            if (collapse.cost > maxErrorSq || removed >= goal)
+            {
+                break;
+            }
+            if (passLocked[collapse.from] || passLocked[collapse.to])
+            {
+                continue;
+            }
+            if (has_triangle_flip(positions, indices, offsets, triangles, collapse.from, collapse.to))
+            {
+                continue;
+            }
+
+            double fanError = 0.0;
+            for (uint32 k = offsets[collapse.from]; k < offsets[collapse.from + 1]; ++k)
+            {
+                const uint32* tri = &indices[triangles[k] * 3];
+                fanError          = std::max({fanError, vertexError[tri[0]], vertexError[tri[1]], vertexError[tri[2]]});
+            }
+
+            const double collapseError = fanError + max_plane_distance(positions, indices, offsets, triangles, collapse.from, collapse.to);
+            if (collapseError > static_cast<double>(maxError))
+            {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            add_quadric(quadrics[collapse.to], quadrics[collapse.from]);
+            resultError = std::max(resultError, collapseError);
+
+            // 같은 패스에서 주변 삼각형이 두 번 바뀌지 않도록 이웃을 모두 잠근다. 바뀐 삼각형의 정점은 새 오차를 물려받는다.
+            for (uint32 k = offsets[collapse.from]; k < offsets[collapse.from + 1]; ++k)
+            {
+                const uint32* tri = &indices[triangles[k] * 3];
+                for (int corner = 0; corner < 3; ++corner)
+                {
+                    passLocked[tri[corner]]  = 1;
+                    vertexError[tri[corner]] = std::max(vertexError[tri[corner]], collapseError);
+                }
+            }
+            passLocked[collapse.to] = 1;
+
+            removed += 2;
+        }
+
+        if (removed == 0)
+        {
+            break;
+        }
+
+        size_t write = 0;
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            const uint32 a = remap[indices[i + 0]];
+            const uint32 b = remap[indices[i + 1]];
+            const uint32 c = remap[indices[i + 2]];
+            if (a == b || b == c || c == a)
+            {
+                continue;
+            }
+
+            indices[write + 0] = a;
+            indices[write + 1] = b;
+            indices[write + 2] = c;
+            write += 3;
+        }
+        indices.resize(write);
+    }
+
+    outError = static_cast<float>(resultError);
+    return indices;
+}
+
+// 같은 위치에 속성이 다른 정점이 둘 이상 있으면 이음새다. 이음새 정점은 움직이지 않는다.
+void lock_seam_vertices(const std::vector<uint32>& positionRemap, uint32 vertexCount, std::vector<uint8>& outLocked)
+{
+    std::vector<uint32> wedgeCount(vertexCount, 0);
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        wedgeCount[positionRemap[v]]++;
+    }
+
+    outLocked.assign(vertexCount, 0);
+    for (uint32 v = 0; v < vertexCount; ++v)
+    {
+        outLocked[v] = wedgeCount[positionRemap[v]] > 1 ? 1 : 0;
+    }
+}
+
+bool validate_indices(const std::vector<uint32>& indices, uint32 vertexCount)
+{
+    for (uint32 index : indices)
+    {
+        if (index >= vertexCount)
+        {
+            HS_LOG(warning, "MeshSimplifier: Index %u is out of range (%u vertices)", index, vertexCount);
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+std::vector<uint32> MeshSimplifier::Simplify(const Mesh* mesh, const std::vector<uint32>& indices, size_t targetIndexCount, float maxError, float* outError)
+{
+    HS_PROFILE_SCOPE("MeshSimplifier::Simplify");
+
+    float error = 0.0f;
+    std::vector<uint32> result(indices.begin(), indices.begin() + (indices.size() / 3) * 3);
+
+    if (nullptr != mesh && result.size() > targetIndexCount && validate_indices(result, mesh->GetVertexCount()))
+    {
+        const std::vector<float>& positions   = mesh->GetPosition();
+        const uint32              vertexCount = mesh->GetVertexCount();
+
+        std::vector<uint32> positionRemap;
+        std::vector<uint8>  seamLocked;
+        build_position_remap(positions, vertexCount, positionRemap);
+        lock_seam_vertices(positionRemap, vertexCount, seamLocked);
+
+        result = simplify_indices(positions, vertexCount, positionRemap, seamLocked, std::move(result), targetIndexCount, maxError, error);
+    }
+
+    if (nullptr != outError)
+    {
+        *outError = error;
+    }
+    return result;
+}
+
+void MeshSimplifier::BuildLODChain(Mesh* mesh, const MeshLODInfo& info)
+{
+    HS_PROFILE_SCOPE("MeshSimplifier::BuildLODChain");
+
+    if (nullptr == mesh)
+    {
+        return;
+    }
+
+    for (Mesh* subMesh : mesh->GetSubMeshes())
+    {
+        BuildLODChain(subMesh, info);
+    }
+
+    std::vector<MeshLOD> lods;
+    lods.reserve(info.maxLevelCount);
+
+    const uint32 vertexCount = mesh->GetVertexCount();
+    if (false == mesh->HasIndices() || false == validate_indices(mesh->GetIndices(), vertexCount))
+    {
+        mesh->SetLODs(std::move(lods));
+        return;
+    }
+
+    HS_ASSERT(info.reductionPerLevel > 0.0f && info.reductionPerLevel < 1.0f, "LOD reduction ratio must be in (0, 1)");
+
+    const std::vector<float>& positions = mesh->GetPosition();
+
+    std::vector<uint32> positionRemap;
+    std::vector<uint8>  seamLocked;
+    build_position_remap(positions, vertexCount, positionRemap);
+    lock_seam_vertices(positionRemap, vertexCount, seamLocked);
+
+    const float radius   = glm::length(mesh->GetBoundMax() - mesh->GetBoundMin()) * 0.5f;
+    const float maxError = info.maxError * radius;
+
+    const std::vector<uint32>* source      = &mesh->GetIndices();
+    size_t                     sourceCount = (source->size() / 3) * 3;
+    float                      chainError  = 0.0f;
+
+    for (uint32 level = 0; level < info.maxLevelCount; ++level)
+    {
+        const size_t targetCount = static_cast<size_t>(static_cast<float>(sourceCount / 3) * info.reductionPerLevel) * 3;
+        if (targetCount / 3 < info.minTriangleCount)
+        {
+            break;
+        }
+
+        float levelError = 0.0f;
+        std::vector<uint32> indices(source->begin(), source->begin() + sourceCount);
+        indices = simplify_indices(positions, vertexCount, positionRemap, seamLocked, std::move(indices), targetCount, maxError - chainError, levelError);
+
+        // 이음새와 경계가 많아 거의 줄지 않으면 더 거친 단계도 의미가 없다.
+        if (indices.size() / 3 < info.minTriangleCount || static_cast<float>(indices.size()) > static_cast<float>(sourceCount) * 0.9f)
+        {
+            break;
+        }
+
+        MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+
+        chainError += levelError;
+        lods.push_back(MeshLOD{std::move(indices), chainError});
+
+        source      = &lods.back().indices;
+        sourceCount = source->size();
+    }
+
+    mesh->SetLODs(std::move(lods));
+}
+
+HS_NS_END
@@ -0,0 +1,224 @@
+//
+//  Meshlet.cpp
+//  HSMR
+//
+//  Small triangle clusters with culling bounds, built from a Mesh index stream
+//
+#include "Resource/Meshlet.h"
+#include "Resource/Mesh.h"
+
+#include "Core/Log.h"
+#include "Core/Profile/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 INVALID_LOCAL_INDEX = ~0u;
+
+HS_FORCEINLINE glm::vec3 get_position(const std::vector<float>& positions, uint32 index)
+{
+    return glm::vec3(positions[index * 3 + 0], positions[index * 3 + 1], positions[index * 3 + 2]);
+}
+
+// Ritter 방식. 축별 양 끝점 중 가장 먼 쌍으로 시작해 밖에 있는 점을 만날 때마다 구를 키운다.
+glm::vec4 compute_bounding_sphere(const std::vector<float>& positions, const uint32* vertices, uint32 vertexCount)
+{
+    uint32 minIndex[3] = {vertices[0], vertices[0], vertices[0]};
+    uint32 maxIndex[3] = {vertices[0], vertices[0], vertices[0]};
+    for (uint32 i = 1; i < vertexCount; ++i)
+    {
+        const glm::vec3 p = get_position(positions, vertices[i]);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (p[axis] < get_position(positions, minIndex[axis])[axis]) minIndex[axis] = vertices[i];
+            if (p[axis] > get_position(positions, maxIndex[axis])[axis]) maxIndex[axis] = vertices[i];
+        }
+    }
+
+    int   bestAxis     = 0;
+    float bestDistance = -1.0f;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float distance = glm::length(get_position(positions, maxIndex[axis]) - get_position(positions, minIndex[axis]));
+        if (distance > bestDistance)
+        {
+            bestDistance = distance;
+            bestAxis     = axis;
+        }
+    }
+
+    glm::vec3 center = (get_position(positions, minIndex[bestAxis]) + get_position(positions, maxIndex[bestAxis])) * 0.5f;
+    float     radius = bestDistance * 0.5f;
+
+    for (uint32 i = 0; i < vertexCount; ++i)
+    {
+        const glm::vec3 p        = get_position(positions, vertices[i]);
+        const float     distance = glm::length(p - center);
+        if (distance > radius)
+        {
+            const float newRadius = (radius + distance) * 0.5f;
+            center += (p - center) * ((newRadius - radius) / distance);
+            radius = newRadius;
+        }
+    }
+
+    return glm::vec4(center, radius);
+}
+
+// 면 법선 평균을 축으로 삼고, 축과 가장 벌어진 면을 기준으로 cutoff를 정한다.
+// 반구 이상 벌어진 클러스터는 어느 방향에서나 보이는 면이 있으므로 뒷면 컬링을 끈다.
+glm::vec4 compute_normal_cone(const std::vector<float>& positions, const uint32* vertices, const uint8* triangles, uint32 triangleCount)
+{
+    const glm::vec4 disabled(0.0f, 0.0f, 0.0f, 1.0f);
+
+    std::vector<glm::vec3> normals;
+    normals.reserve(triangleCount);
+
+    glm::vec3 axis(0.0f);
+    for (uint32 t = 0; t < triangleCount; ++t)
+    {
+        const glm::vec3 p0 = get_position(positions, vertices[triangles[t * 3 + 0]]);
+        const glm::vec3 p1 = get_position(positions, vertices[triangles[t * 3 + 1]]);
+        const glm::vec3 p2 = get_position(positions, vertices[triangles[t * 3 + 2]]);
+
+        const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        const float     length = glm::length(normal);
+        if (length <= 0.0f)
+        {
+            continue;
+        }
+
+        normals.push_back(normal / length);
+        axis += normals.back();
+    }
+
+    const float axisLength = glm::length(axis);
+    if (normals.empty() || axisLength <= 0.0f)
+    {
+        return disabled;
+    }
+    axis /= axisLength;
+
+    float minDot = 1.0f;
+    for (const glm::vec3& normal : normals)
+    {
+        minDot = std::min(minDot, glm::dot(normal, axis));
+    }
+
+    // 경계에 가까운 콘은 판정 오차로 잘못 지울 수 있으므로 여유를 둔다.
+    if (minDot <= 0.1f)
+    {
+        return disabled;
+    }
+
+    // IsMeshletBackFacing은 축과 시선 사이 각의 cos를 sin(콘 반각)과 비교한다.
+    return glm::vec4(axis, std::sqrt(1.0f - minDot * minDot));
+}
+} // namespace
+
+MeshletData MeshletBuilder::Build(const Mesh* mesh, const MeshletBuildInfo& info)
+{
+    HS_PROFILE_SCOPE("MeshletBuilder::Build");
+
+    MeshletData data;
+    if (nullptr == mesh || false == mesh->HasIndices())
+    {
+        return data;
+    }
+
+    HS_ASSERT(info.maxVertices >= 3 && info.maxVertices <= 256, "Meshlet vertex limit must be in [3, 256]");
+    HS_ASSERT(info.maxTriangles >= 1, "Meshlet triangle limit must be positive");
+
+    const std::vector<float>&  positions   = mesh->GetPosition();
+    const std::vector<uint32>& indices     = mesh->GetIndices();
+    const uint32               vertexCount = mesh->GetVertexCount();
+    const size_t               cornerCount = (indices.size() / 3) * 3;
+
+    for (size_t i = 0; i < cornerCount; ++i)
+    {
+        if (indices[i] >= vertexCount)
+        {
+            HS_LOG(warning, "MeshletBuilder: Index %u is out of range (%u vertices)", indices[i], vertexCount);
+            return data;
+        }
+    }
+
+    // 최악의 경우(삼각형마다 새 정점 3개)를 기준으로 잡는다.
+    const size_t meshletEstimate = cornerCount / 3 / info.maxTriangles + 1;
+    data.meshlets.reserve(meshletEstimate);
+    data.vertices.reserve(cornerCount);
+    data.triangles.reserve(cornerCount + meshletEstimate * 3);
+
+    std::vector<uint32> localIndex(vertexCount, INVALID_LOCAL_INDEX);
+
+    Meshlet current{};
+
+    auto flush = [&]() {
+        if (current.triangleCount == 0)
+        {
+            return;
+        }
+
+        const uint32* meshletVertices  = &data.vertices[current.vertexOffset];
+        const uint8*  meshletTriangles = &data.triangles[current.triangleOffset];
+        current.boundingSphere = compute_bounding_sphere(positions, meshletVertices, current.vertexCount);
+        current.cone           = compute_normal_cone(positions, meshletVertices, meshletTriangles, current.triangleCount);
+
+        for (uint32 i = 0; i < current.vertexCount; ++i)
+        {
+            localIndex[meshletVertices[i]] = INVALID_LOCAL_INDEX;
+        }
+
+        // 다음 클러스터의 삼각형이 4바이트 경계에서 시작하도록 채운다.
+        while (data.triangles.size() % 4 != 0)
+        {
+            data.triangles.push_back(0);
+        }
+
+        data.meshlets.push_back(current);
+
+        current                = Meshlet{};
+        current.vertexOffset   = static_cast<uint32>(data.vertices.size());
+        current.triangleOffset = static_cast<uint32>(data.triangles.size());
+    };
+
+    for (size_t i = 0; i < cornerCount; i += 3)
+    {
+        const uint32 a = indices[i + 0];
+        const uint32 b = indices[i + 1];
+        const uint32 c = indices[i + 2];
+
+        const uint32 newVertexCount = (localIndex[a] == INVALID_LOCAL_INDEX ? 1 : 0) +
+                                      (localIndex[b] == INVALID_LOCAL_INDEX && b != a ? 1 : 0) +
+                                      (localIndex[c] == INVALID_LOCAL_INDEX && c != a && c != b ? 1 : 0);
+
+        if (current.vertexCount + newVertexCount > info.maxVertices || current.triangleCount + 1 > info.maxTriangles)
+        {
+            flush();
+        }
+
+        for (uint32 v : {a, b, c})
+        {
+            if (localIndex[v] == INVALID_LOCAL_INDEX)
+            {
+                localIndex[v] = current.vertexCount++;
+                data.vertices.push_back(v);
+            }
+            data.triangles.push_back(static_cast<uint8>(localIndex[v]));
+        }
+        current.triangleCount++;
+    }
+
+    flush();
+
+    // 셰이더(MeshletCulling.hlsli)는 4바이트 경계에서 8바이트씩 읽으므로 끝에 한 워드를 더 둔다.
+    data.triangles.insert(data.triangles.end(), 4, 0);
+
+    return data;
+}
+
+HS_NS_END
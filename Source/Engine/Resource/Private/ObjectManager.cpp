@@ -2,27 +2,264 @@
 
 #include "Resource/ResourceDefinition.h"
 
+#include "Core/Archive/VirtualFileSystem.h"
 #include "Core/HAL/FileSystem.h"
 
+#include "Core/Hash.h"
+#include "Core/Job/JobSystem.h"
 #include "Core/Log.h"
 #include "Core/Math/Common.h"
+#include "Core/Profile/Profiler.h"
 
 #include "Resource/Image.h"
 #include "Resource/Mesh.h"
+#include "Resource/MeshCache.h"
+#include "Resource/MeshOptimizer.h"
+#include "Resource/MeshSimplifier.h"
 #include "Resource/Material.h"
 #include "Resource/Shader.h"
 
 #include <assimp/Importer.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 
+#include <algorithm>
+#include <cstring>
 #include <unordered_map>
 
 HS_NS_BEGIN
 
+namespace
+{
+// 에셋 디렉토리 옆에 이 팩이 있으면 Initialize에서 마운트한다. (Tools/Packer로 만든다)
+const char* s_assetPackName = "Assets.hspak";
+
+// 메모리에 올라와 있는 파일을 Assimp에 그대로 넘긴다.
+class MemoryIOStream : public Assimp::IOStream
+{
+public:
+	MemoryIOStream(const uint8* data, size_t size)
+		: _data(data)
+		, _size(size)
+	{
+	}
+
+	size_t Read(void* buffer, size_t size, size_t count) override
+	{
+		if (size == 0 || count == 0)
+		{
+			return 0;
+		}
+
+		const size_t remain = _size - _cursor;
+		count = std::min(count, remain / size);
+		if (count > 0)
+		{
+			::memcpy(buffer, _data + _cursor, size * count);
+			_cursor += size * count;
+		}
+
+		return count;
+	}
+
+	size_t Write(const void* buffer, size_t size, size_t count) override
+	{
+		return 0;
+	}
+
+	aiReturn Seek(size_t offset, aiOrigin origin) override
+	{
+		size_t newCursor = 0;
+		switch (origin)
+		{
+		case aiOrigin_SET: newCursor = offset; break;
+		case aiOrigin_CUR: newCursor = _cursor + offset; break;
+		case aiOrigin_END: newCursor = _size - offset; break;
+		default: return aiReturn_FAILURE;
+		}
+
+		if (newCursor > _size)
+		{
+			return aiReturn_FAILURE;
+		}
+
+		_cursor = newCursor;
+		return aiReturn_SUCCESS;
+	}
+
+	size_t Tell() const override { return _cursor; }
+	size_t FileSize() const override { return _size; }
+	void Flush() override {}
+
+private:
+	const uint8* _data;
+	size_t _size;
+	size_t _cursor = 0;
+};
+
+// Assimp가 파일을 fread로 힙에 복사하지 않고 매핑된 페이지 캐시에서 바로 읽도록 한다.
+// 외부 파일(.mtl, .bin 등)도 같은 IOSystem으로 열린다.
+class MappedIOStream final : public MemoryIOStream
+{
+public:
+	explicit MappedIOStream(const MappedFile& mappedFile)
+		: MemoryIOStream(mappedFile.data, mappedFile.size)
+		, _mappedFile(mappedFile)
+	{
+	}
+
+	~MappedIOStream() override
+	{
+		FileSystem::UnmapFile(_mappedFile);
+	}
+
+private:
+	MappedFile _mappedFile;
+};
+
+// 팩에서 풀어 둔 파일
+class PackedIOStream final : public MemoryIOStream
+{
+public:
+	explicit PackedIOStream(std::vector<uint8>&& data)
+		: MemoryIOStream(data.data(), data.size())
+		, _data(std::move(data))
+	{
+	}
+
+private:
+	std::vector<uint8> _data;
+};
+
+// 임포터가 연 파일을 해시와 함께 기록해 둔다. 메시 캐시가 원본 외의 파일(.mtl, .bin 등)이 바뀌었는지 확인하는 데 쓴다.
+class MappedIOSystem final : public Assimp::IOSystem
+{
+public:
+	const std::vector<MeshCacheDependency>& GetOpenedFiles() const { return _openedFiles; }
+
+	bool Exists(const char* filePath) const override
+	{
+		return VirtualFileSystem::Exist(filePath);
+	}
+
+	char getOsSeparator() const override
+	{
+		return HS_DIR_SEPERATOR;
+	}
+
+	Assimp::IOStream* Open(const char* filePath, const char* mode) override
+	{
+		// 임포터는 읽기만 한다.
+		if (nullptr != ::strchr(mode, 'w') || nullptr != ::strchr(mode, 'a'))
+		{
+			return nullptr;
+		}
+
+		std::vector<uint8> packedData;
+		if (VirtualFileSystem::ReadPackedFile(filePath, packedData))
+		{
+			recordOpenedFile(filePath, packedData.data(), packedData.size());
+			return new PackedIOStream(std::move(packedData));
+		}
+
+		MappedFile mappedFile;
+		if (false == FileSystem::MapFile(filePath, EFileAccessPattern::SEQUENTIAL, mappedFile))
+		{
+			return nullptr;
+		}
+
+		recordOpenedFile(filePath, mappedFile.data, mappedFile.size);
+		return new MappedIOStream(mappedFile);
+	}
+
+	void Close(Assimp::IOStream* stream) override
+	{
+		delete stream;
+	}
+
+private:
+	void recordOpenedFile(const char* filePath, const uint8* data, size_t size)
+	{
+		const std::string path = VirtualFileSystem::NormalizePath(filePath);
+		for (const MeshCacheDependency& openedFile : _openedFiles)
+		{
+			if (openedFile.path == path)
+			{
+				return;
+			}
+		}
+
+		_openedFiles.push_back(MeshCacheDependency{path, size, HashBytes64(data, size)});
+	}
+
+	std::vector<MeshCacheDependency> _openedFiles;
+};
+
+// 팩에 있으면 풀어서, 없으면 매핑해서 내용을 해시한다.
+bool hash_file(const std::string& path, uint64& outSize, uint64& outHash)
+{
+	std::vector<uint8> packedData;
+	if (VirtualFileSystem::ReadPackedFile(path, packedData))
+	{
+		outSize = packedData.size();
+		outHash = HashBytes64(packedData.data(), packedData.size());
+		return true;
+	}
+
+	MappedFile mappedFile;
+	if (false == FileSystem::Exist(path) || false == FileSystem::MapFile(path, EFileAccessPattern::SEQUENTIAL, mappedFile))
+	{
+		return false;
+	}
+
+	outSize = mappedFile.size;
+	outHash = HashBytes64(mappedFile.data, mappedFile.size);
+	FileSystem::UnmapFile(mappedFile);
+	return true;
+}
+
+// 원본 내용과 결과를 바꾸는 옵션을 모두 넣는다. 옵션 기본값이 바뀌면 기존 캐시는 자동으로 버려진다.
+uint64 make_mesh_cache_key(uint64 sourceHash, uint32 importFlags)
+{
+	const MeshOptimizeInfo optimizeInfo{};
+	const MeshLODInfo      lodInfo{};
+	const MeshletBuildInfo meshletInfo{};
+
+	auto float_bits = [](float value) {
+		uint32 bits;
+		::memcpy(&bits, &value, sizeof(bits));
+		return static_cast<uint64>(bits);
+	};
+
+	uint64 key = HashCombine64(sourceHash, MeshCacheHeader::VERSION, importFlags);
+	key = HashCombine64(key, (optimizeInfo.weldVertices ? 1u : 0u) | (optimizeInfo.optimizeVertexCache ? 2u : 0u) | (optimizeInfo.optimizeOverdraw ? 4u : 0u) | (optimizeInfo.optimizeVertexFetch ? 8u : 0u),
+						HashCombine64(optimizeInfo.cacheSize, float_bits(optimizeInfo.overdrawThreshold)));
+	key = HashCombine64(key, HashCombine64(lodInfo.maxLevelCount, lodInfo.minTriangleCount), HashCombine64(float_bits(lodInfo.reductionPerLevel), float_bits(lodInfo.maxError)));
+	key = HashCombine64(key, meshletInfo.maxVertices, meshletInfo.maxTriangles);
+	return key;
+}
+
+bool are_dependencies_unchanged(const std::vector<MeshCacheDependency>& dependencies)
+{
+	for (const MeshCacheDependency& dependency : dependencies)
+	{
+		uint64 size = 0;
+		uint64 hash = 0;
+		if (false == hash_file(dependency.path, size, hash) || size != dependency.size || hash != dependency.hash)
+		{
+			HS_LOG(info, "MeshCache: dependency %s has changed", dependency.path.c_str());
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace
+
 bool ObjectManager::s_isInitialize = false;
 std::string ObjectManager::s_resourcePath = "";
 
@@ -51,6 +288,15 @@ bool ObjectManager::Initialize()
 
 	HS_LOG(info, "ObjectManager initialized with path: %s", s_resourcePath.c_str());
 
+	if (sysContext)
+	{
+		const std::string packPath = sysContext->executableDirectory + s_assetPackName;
+		if (FileSystem::Exist(packPath))
+		{
+			VirtualFileSystem::Mount(packPath, s_resourcePath);
+		}
+	}
+
 	// 1x1 White Image 2D
 	{
 		uint8 whitePixel[4] = { 255, 255, 255, 255 }; // RGBA
@@ -141,6 +387,12 @@ void ObjectManager::Finalize()
 		s_fallbackMeshSphere = nullptr;
 	}
 
+	SystemContext* sysContext = SystemContext::Get();
+	if (sysContext)
+	{
+		VirtualFileSystem::Unmount(sysContext->executableDirectory + s_assetPackName);
+	}
+
 	s_isInitialize = false;
 }
 
@@ -150,19 +402,12 @@ static Scoped<Mesh> ProcessMesh(aiMesh* mesh, const aiScene* scene, std::vector<
 static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const std::string& modelDirectory);
 
 // Helper function to convert aiVector3D to float vector
-static std::vector<float> ConvertToFloatVector(const aiVector3D* data, uint32 count, uint32 components = 3)
+static std::vector<float> ConvertToFloatVector(const aiVector3D* data, uint32 count)
 {
-	std::vector<float> result;
-	result.reserve(count * components);
-
-	for (uint32 i = 0; i < count; ++i)
-	{
-		result.push_back(data[i].x);
-		result.push_back(data[i].y);
-		result.push_back(data[i].z);
-	}
-
-	return result;
+	// aiVector3D는 float 3개가 연속된 구조라 한 번에 복사한다.
+	static_assert(sizeof(aiVector3D) == sizeof(float) * 3, "aiVector3D must be tightly packed floats");
+	const float* begin = reinterpret_cast<const float*>(data);
+	return std::vector<float>(begin, begin + static_cast<size_t>(count) * 3);
 }
 
 // Helper function to convert texture coordinates
@@ -229,6 +474,14 @@ static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const
 	std::vector<Scoped<Material>> materials;
 	materials.reserve(scene->mNumMaterials);
 
+	struct TextureSlot
+	{
+		uint32 materialIndex;
+		EMaterialTextureType type;
+	};
+	std::vector<TextureSlot> textureSlots;
+	std::vector<std::string> texturePaths;
+
 	for (uint32 i = 0; i < scene->mNumMaterials; ++i)
 	{
 		aiMaterial* aiMat = scene->mMaterials[i];
@@ -238,7 +491,7 @@ static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const
 		aiString name;
 		if (aiMat->Get(AI_MATKEY_NAME, name) == AI_SUCCESS)
 		{
-			material->name = name.C_Str();
+			material->name = Name(name.C_Str(), name.length);
 		}
 
 		// Get diffuse color
@@ -290,7 +543,7 @@ static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const
 			material->SetTwoSided(twoSided != 0);
 		}
 
-		// Load textures
+		// Collect textures. 모든 머티리얼의 텍스처를 모아 한 번에 읽는다.
 		for (aiTextureType type = aiTextureType_DIFFUSE; type <= aiTextureType_AMBIENT_OCCLUSION; type = (aiTextureType)(type + 1))
 		{
 			uint32 textureCount = aiMat->GetTextureCount(type);
@@ -307,20 +560,10 @@ static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const
 						texturePath = modelDirectory + "/" + texturePath;
 					}
 
-					HS_LOG(info, "Loading texture: %s for material %s", texturePath.c_str(), material->name);
+					HS_LOG(info, "Loading texture: %s for material %s", texturePath.c_str(), material->name.c_str());
 
-					// Load the texture
-					Scoped<Image> texture = ObjectManager::LoadImageFromFile(texturePath, true);
-					if (texture)
-					{
-						EMaterialTextureType hsTextureType = ConvertTextureType(type);
-						material->SetTexture(hsTextureType, texture.release());
-						HS_LOG(info, "Successfully loaded texture for material %s", material->name);
-					}
-					else
-					{
-						HS_LOG(warning, "Failed to load texture: %s", texturePath.c_str());
-					}
+					textureSlots.push_back(TextureSlot{i, ConvertTextureType(type)});
+					texturePaths.push_back(std::move(texturePath));
 				}
 			}
 		}
@@ -328,6 +571,22 @@ static std::vector<Scoped<Material>> ProcessMaterial(const aiScene* scene, const
 		materials.push_back(std::move(material));
 	}
 
+	// Load the textures
+	std::vector<Scoped<Image>> textures = ObjectManager::LoadImagesFromFiles(texturePaths, true);
+	for (size_t i = 0; i < textures.size(); i++)
+	{
+		Material* material = materials[textureSlots[i].materialIndex].get();
+		if (textures[i])
+		{
+			material->SetTexture(textureSlots[i].type, textures[i].release());
+			HS_LOG(info, "Successfully loaded texture for material %s", material->name.c_str());
+		}
+		else
+		{
+			HS_LOG(warning, "Failed to load texture: %s", texturePaths[i].c_str());
+		}
+	}
+
 	return materials;
 }
 
@@ -339,14 +598,13 @@ static Scoped<Mesh> ProcessMesh(aiMesh* mesh, const aiScene* scene, std::vector<
 	// Set mesh name
 	if (mesh->mName.length > 0)
 	{
-		hsMesh->name = mesh->mName.C_Str();
+		hsMesh->name = Name(mesh->mName.C_Str(), mesh->mName.length);
 	}
 
 	// Process vertices
 	if (mesh->HasPositions())
 	{
-		ConvertToFloatVector(mesh->mVertices, mesh->mNumVertices);
-		hsMesh->SetPosition(std::move(ConvertToFloatVector(mesh->mVertices, mesh->mNumVertices)));
+		hsMesh->SetPosition(ConvertToFloatVector(mesh->mVertices, mesh->mNumVertices));
 	}
 
 	// Process normals
@@ -393,11 +651,35 @@ static Scoped<Mesh> ProcessMesh(aiMesh* mesh, const aiScene* scene, std::vector<
 
 	hsMesh->SetIndices(std::move(indices));
 
+	// 정점 병합과 캐시/오버드로/페치 순서는 Assimp 대신 엔진에서 처리한다.
+	const MeshOptimizeResult optimizeResult = MeshOptimizer::Optimize(hsMesh.get());
+	if (optimizeResult.isOptimized)
+	{
+		HS_LOG(info, "Mesh %s optimized: vertices %u -> %u, ACMR %.3f -> %.3f, ATVR %.3f -> %.3f%s",
+			mesh->mName.C_Str(),
+			optimizeResult.vertexCountBefore, optimizeResult.vertexCountAfter,
+			optimizeResult.before.acmr, optimizeResult.after.acmr,
+			optimizeResult.before.atvr, optimizeResult.after.atvr,
+			optimizeResult.fitsUInt16Index ? ", 16bit indices" : "");
+	}
+
+	// 캐시 순서로 정리된 인덱스를 그대로 훑어 클러스터를 만든다.
+	hsMesh->SetMeshlets(MeshletBuilder::Build(hsMesh.get()));
+
+	// LOD는 정점 버퍼를 공유하므로 정점 순서가 확정된 뒤에 만든다. aiMesh마다 불리므로 서브메시도 각각 체인을 가진다.
+	MeshSimplifier::BuildLODChain(hsMesh.get());
+	if (hsMesh->HasLODs())
+	{
+		HS_LOG(info, "Mesh %s LODs: %u triangles -> %zu levels, coarsest %zu triangles (error %.4f)",
+			mesh->mName.C_Str(), hsMesh->GetTriangleCount(), hsMesh->GetLODs().size(),
+			hsMesh->GetLODs().back().indices.size() / 3, hsMesh->GetLODs().back().error);
+	}
+
 	// Associate material with mesh
 	if (mesh->mMaterialIndex >= 0 && mesh->mMaterialIndex < materials.size())
 	{
 		hsMesh->SetMaterialIndex(mesh->mMaterialIndex);
-		HS_LOG(info, "Mesh %s uses material: %s (index: %d)", mesh->mName.C_Str(), materials[mesh->mMaterialIndex]->name, mesh->mMaterialIndex);
+		HS_LOG(info, "Mesh %s uses material: %s (index: %d)", mesh->mName.C_Str(), materials[mesh->mMaterialIndex]->name.c_str(), mesh->mMaterialIndex);
 	}
 
 	return hsMesh;
@@ -444,6 +726,8 @@ static Scoped<Mesh> ProcessNode(aiNode* node, const aiScene* scene, std::vector<
 
 Scoped<Image> ObjectManager::LoadImageFromFile(const std::string& path, bool isAbsolutePath)
 {
+	HS_PROFILE_SCOPE("ObjectManager::LoadImageFromFile");
+
 	int width = 0;
 	int height = 0;
 	int channel = 0;
@@ -459,7 +743,25 @@ Scoped<Image> ObjectManager::LoadImageFromFile(const std::string& path, bool isA
 	}
 
 	uint8* rawData = nullptr;
-	rawData = stbi_load(filePath.c_str(), &width, &height, &channel, 0);
+
+	std::vector<uint8> packedData;
+	if (VirtualFileSystem::ReadPackedFile(filePath, packedData))
+	{
+		rawData = stbi_load_from_memory(packedData.data(), static_cast<int>(packedData.size()), &width, &height, &channel, 0);
+	}
+	else
+	{
+		MappedFile mappedFile;
+		if (false == FileSystem::MapFile(filePath, EFileAccessPattern::SEQUENTIAL, mappedFile) || false == mappedFile.IsValid())
+		{
+			HS_LOG(error, "Fail to open Image: %s", filePath.c_str());
+			return nullptr;
+		}
+
+		rawData = stbi_load_from_memory(mappedFile.data, static_cast<int>(mappedFile.size), &width, &height, &channel, 0);
+
+		FileSystem::UnmapFile(mappedFile);
+	}
 
 	if (rawData == nullptr)
 	{
@@ -472,29 +774,109 @@ Scoped<Image> ObjectManager::LoadImageFromFile(const std::string& path, bool isA
 	return pImage;
 }
 
-Scoped<Mesh> ObjectManager::LoadMeshFromFile(const std::string& path, bool isAbsolutePath)
+std::vector<Scoped<Image>> ObjectManager::LoadImagesFromFiles(const std::vector<std::string>& paths, bool isAbsolutePath)
 {
-	const char* filePath = nullptr;
-	if (isAbsolutePath)
+	HS_PROFILE_SCOPE("ObjectManager::LoadImagesFromFiles");
+
+	const size_t count = paths.size();
+	std::vector<Scoped<Image>> images(count);
+	if (count == 0)
 	{
-		filePath = path.c_str();
+		return images;
 	}
-	else
+
+	std::vector<FileReadRequest> requests(count);
+	for (size_t i = 0; i < count; i++)
 	{
-		filePath = (s_resourcePath + path).c_str();
+		requests[i].path = isAbsolutePath ? paths[i] : FileSystem::GetAbsolutePath(paths[i]);
 	}
 
-	Assimp::Importer importer;
+	// 팩에 있는 파일은 바로 풀고, 나머지만 디스크 읽기 배치로 보낸다.
+	std::vector<FileReadRequest> looseRequests;
+	std::vector<size_t> looseIndices;
+	for (size_t i = 0; i < count; i++)
+	{
+		FileReadRequest& request = requests[i];
+		if (VirtualFileSystem::ReadPackedFile(request.path, request.buffer))
+		{
+			request.bytesRead = request.buffer.size();
+			request.status = EFileReadStatus::COMPLETED;
+			continue;
+		}
+
+		looseRequests.emplace_back();
+		looseRequests.back().path = request.path;
+		looseIndices.push_back(i);
+	}
+
+	if (false == looseRequests.empty())
+	{
+		HS_PROFILE_SCOPE("FileSystem::WaitReads");
+		FileSystem::WaitReads(FileSystem::SubmitReads(looseRequests.data(), looseRequests.size()));
+
+		for (size_t i = 0; i < looseRequests.size(); i++)
+		{
+			FileReadRequest& request = requests[looseIndices[i]];
+			request.buffer = std::move(looseRequests[i].buffer);
+			request.bytesRead = looseRequests[i].bytesRead;
+			request.status = looseRequests[i].status;
+		}
+	}
+
+	struct DecodedImage
+	{
+		uint8* rawData = nullptr;
+		int width = 0;
+		int height = 0;
+		int channel = 0;
+	};
+	std::vector<DecodedImage> decoded(count);
+
+	JobSystem::ParallelFor(static_cast<uint32>(count), [&](uint32 begin, uint32 end)
+	{
+		HS_PROFILE_SCOPE("DecodeImage");
+		for (uint32 i = begin; i < end; i++)
+		{
+			const FileReadRequest& request = requests[i];
+			if (request.status != EFileReadStatus::COMPLETED || request.bytesRead == 0)
+			{
+				continue;
+			}
+
+			DecodedImage& image = decoded[i];
+			image.rawData = stbi_load_from_memory(request.buffer.data(), static_cast<int>(request.bytesRead), &image.width, &image.height, &image.channel, 0);
+		}
+	});
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (decoded[i].rawData == nullptr)
+		{
+			HS_LOG(error, "Fail to load Image: %s", requests[i].path.c_str());
+			continue;
+		}
+
+		images[i] = MakeScoped<Image>(decoded[i].rawData, decoded[i].width, decoded[i].height, decoded[i].channel);
+	}
+
+	return images;
+}
+
+Scoped<Mesh> ObjectManager::LoadMeshFromFile(const std::string& path, bool isAbsolutePath)
+{
+	HS_PROFILE_SCOPE("ObjectManager::LoadMeshFromFile");
+
+	// 상대 경로는 임시 문자열이 아닌 지역 변수에 보관해야 아래에서 포인터가 유효하다.
+	const std::string resolvedPath = isAbsolutePath ? path : s_resourcePath + path;
+	const char* filePath = resolvedPath.c_str();
 
 	// Configure import flags
 	uint32 importFlags = aiProcess_Triangulate |              // Convert all faces to triangles
 		aiProcess_CalcTangentSpace |         // Calculate tangents and bitangents
 		aiProcess_GenNormals |               // Generate normals if not present
 		aiProcess_GenSmoothNormals |         // Generate smooth normals
-		aiProcess_JoinIdenticalVertices |    // Join identical vertices
 		aiProcess_OptimizeMeshes |           // Optimize mesh data
 		aiProcess_ValidateDataStructure |    // Validate the data structure
-		aiProcess_ImproveCacheLocality |     // Improve vertex cache locality
 		aiProcess_RemoveRedundantMaterials | // Remove redundant materials
 		aiProcess_FixInfacingNormals |       // Fix normals pointing inward
 		aiProcess_SortByPType |              // Sort by primitive type
@@ -503,10 +885,36 @@ Scoped<Mesh> ObjectManager::LoadMeshFromFile(const std::string& path, bool isAbs
 		aiProcess_TransformUVCoords;         // Transform UV coordinates
 	//aiProcess_FlipUVs;                 // Flip UV coordinates for OpenGL
 
+// Note: aiProcess_JoinIdenticalVertices and aiProcess_ImproveCacheLocality are replaced by MeshOptimizer in ProcessMesh
 // Note: Removed aiProcess_ConvertToLeftHanded as it might cause issues with some models
 // Add it back if needed for specific coordinate system requirements
 
-	const aiScene* scene = importer.ReadFile(filePath, importFlags);
+	// 쿠킹된 캐시가 원본, 옵션, 의존 파일과 모두 맞으면 Assimp를 거치지 않는다.
+	const std::string cachePath = MeshCache::GetCachePath(resolvedPath);
+	uint64 sourceSize = 0;
+	uint64 sourceHash = 0;
+	const bool isSourceHashed = hash_file(resolvedPath, sourceSize, sourceHash);
+	const uint64 cacheKey = make_mesh_cache_key(sourceHash, importFlags);
+
+	if (isSourceHashed)
+	{
+		MeshCacheContent cached;
+		if (MeshCache::Read(cachePath, cacheKey, cached) && are_dependencies_unchanged(cached.dependencies))
+		{
+			HS_LOG(info, "Loaded mesh from cache: %s (%zu materials)", cachePath.c_str(), cached.materialNames.size());
+			return std::move(cached.mesh);
+		}
+	}
+
+	Assimp::Importer importer;
+	MappedIOSystem* ioSystem = new MappedIOSystem();
+	importer.SetIOHandler(ioSystem); // importer가 소유한다.
+
+	const aiScene* scene = nullptr;
+	{
+		HS_PROFILE_SCOPE("Assimp::ReadFile");
+		scene = importer.ReadFile(filePath, importFlags);
+	}
 
 	if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode)
 	{
@@ -528,10 +936,18 @@ Scoped<Mesh> ObjectManager::LoadMeshFromFile(const std::string& path, bool isAbs
 	}
 
 	// First process all materials
-	std::vector<Scoped<Material>> materials = ProcessMaterial(scene, modelDirectory);
+	std::vector<Scoped<Material>> materials;
+	{
+		HS_PROFILE_SCOPE("ProcessMaterial");
+		materials = ProcessMaterial(scene, modelDirectory);
+	}
 
 	// Process the scene starting from root node
-	Scoped<Mesh> rootMesh = ProcessNode(scene->mRootNode, scene, materials);
+	Scoped<Mesh> rootMesh;
+	{
+		HS_PROFILE_SCOPE("ProcessNode");
+		rootMesh = ProcessNode(scene->mRootNode, scene, materials);
+	}
 
 	if (!rootMesh || rootMesh->GetPosition().empty())
 	{
@@ -541,6 +957,32 @@ Scoped<Mesh> ObjectManager::LoadMeshFromFile(const std::string& path, bool isAbs
 
 	HS_LOG(info, "Successfully loaded mesh: %s", filePath);
 
+	if (isSourceHashed)
+	{
+		HS_PROFILE_SCOPE("WriteMeshCache");
+
+		std::vector<std::string> materialNames;
+		materialNames.reserve(materials.size());
+		for (const Scoped<Material>& material : materials)
+		{
+			materialNames.emplace_back(material->name.c_str());
+		}
+
+		// 원본은 키에 이미 들어가 있으므로 의존 목록에서 뺀다.
+		const std::string normalizedSourcePath = VirtualFileSystem::NormalizePath(resolvedPath);
+		std::vector<MeshCacheDependency> dependencies;
+		for (const MeshCacheDependency& openedFile : ioSystem->GetOpenedFiles())
+		{
+			if (openedFile.path != normalizedSourcePath)
+			{
+				dependencies.push_back(openedFile);
+			}
+		}
+
+		// 쓰기 실패는 다음 로드가 느려질 뿐이므로 결과는 그대로 돌려준다.
+		MeshCache::Write(cachePath, cacheKey, rootMesh.get(), materialNames, dependencies);
+	}
+
 	return rootMesh;
 }
 
@@ -569,33 +1011,29 @@ Scoped<Shader> ObjectManager::LoadShaderFromFile(const std::string& path, EShade
 		shaderPath = s_resourcePath + path;
 	}
 
-	if(FileSystem::Exist(shaderPath) == false)
+	if(VirtualFileSystem::Exist(shaderPath) == false)
 	{
 		HS_LOG(error, "Shader file does not exist: %s", shaderPath.c_str());
 		return nullptr;
 	}
-	FileHandle fHandle;
-	FileSystem::Open(shaderPath, EFileAccess::READ_ONLY, fHandle);
 
-	size_t sourceLen = FileSystem::GetSize(fHandle);
-	if (sourceLen == 0)
+	std::vector<uint8> fileData;
+	if (VirtualFileSystem::ReadFile(shaderPath, fileData) == false)
 	{
-		HS_LOG(error, "Shader file is empty: %s", shaderPath.c_str());
-		FileSystem::Close(fHandle);
+		HS_LOG(error, "Failed to read entire shader file: %s", shaderPath.c_str());
 		return nullptr;
 	}
 
-	std::string sourceCode;
-	sourceCode.resize(sourceLen + 1);
-	size_t bytesRead = FileSystem::Read(fHandle, sourceCode.data(), sourceLen);
-	if(bytesRead != sourceLen)
+	size_t sourceLen = fileData.size();
+	if (sourceLen == 0)
 	{
-		HS_LOG(error, "Failed to read entire shader file: %s", shaderPath.c_str());
-		FileSystem::Close(fHandle);
+		HS_LOG(error, "Shader file is empty: %s", shaderPath.c_str());
 		return nullptr;
 	}
 
-	FileSystem::Close(fHandle);
+	std::string sourceCode;
+	sourceCode.resize(sourceLen + 1);
+	::memcpy(sourceCode.data(), fileData.data(), sourceLen);
 	sourceCode[sourceLen] = '\0'; // Null-terminate
 
 	Scoped<Shader> shader = MakeScoped<Shader>(sourceCode, stage, entryName);
@@ -2,8 +2,10 @@
 #define __HS_MESH_PROXY_H__
 
 #include "Precompile.h"
-#include "Resource/ObjectProxy.h"
+#include "Resource/Proxy/ObjectProxy.h"
+#include "Resource/Meshlet.h"
 #include "RHI/RHIDefinition.h"
+#include "Core/Math/Common.h"
 #include <vector>
 
 HS_NS_BEGIN
@@ -12,8 +14,45 @@ class Mesh;
 class RHIBuffer;
 class RHIVertexInputLayout;
 
+enum class EVertexPositionEncoding : uint8
+{
+    FLOAT,   // float3
+    HALF,    // half4, 바운드 중심 기준 상대 좌표
+    SNORM16, // short4 정규화, 바운드를 [-1, 1]로 맞춘 좌표
+};
 
-class HS_RESOURCE_API MeshProxy : public ObjectProxy
+// 정점 속성의 셰이더 location. 메시에 없는 속성은 입력 상태에서 빠지지만 나머지 속성의 location은 바뀌지 않는다.
+// Shader/VertexDecode.hlsli의 [[vk::location]]과 같은 값이어야 한다.
+enum class EVertexAttributeLocation : uint32
+{
+    POSITION  = 0,
+    NORMAL    = 1,
+    TANGENT   = 2,
+    BITANGENT = 3, // 압축하지 않을 때만. 압축하면 부호가 TANGENT의 z에 들어간다.
+    COLOR     = 4,
+    TEXCOORD0 = 5, // UV 세트 i는 TEXCOORD0 + i
+};
+
+// 정점 속성별 저장 형식. 기본값은 압축 형식이고, 디코드는 Shader/VertexDecode.hlsli가 맡는다.
+struct VertexCompressionInfo
+{
+    EVertexPositionEncoding position = EVertexPositionEncoding::SNORM16;
+    bool octahedralNormal            = true; // 법선은 short2, 접선은 short4(팔면체 좌표 + 종접선 부호)
+    bool halfTexCoord                = true;
+    bool unorm8Color                 = true;
+
+    static VertexCompressionInfo Uncompressed() { return VertexCompressionInfo{EVertexPositionEncoding::FLOAT, false, false, false}; }
+};
+
+// 인덱스 버퍼 안에서 LOD 한 단계가 차지하는 구간. 모든 단계가 같은 정점 버퍼를 쓴다.
+struct MeshLODRange
+{
+    uint32 firstIndex;
+    uint32 indexCount;
+    float  error; // 오브젝트 공간 최대 오차. LOD0은 0
+};
+
+class HS_API MeshProxy : public ObjectProxy
 {
 public:
     explicit MeshProxy(uint64 gameObjectId);
@@ -22,40 +61,89 @@ public:
     void UpdateFromGameObject(const Object* gameObject) override;
     void ReleaseRenderResources() override;
 
+    // 다음 UpdateFromGameObject에서 버퍼와 레이아웃을 다시 만든다.
+    void SetVertexCompression(const VertexCompressionInfo& info) { _compression = info; MarkDirty(); }
+    const VertexCompressionInfo& GetVertexCompression() const { return _compression; }
+
     RHIBuffer* GetVertexBuffer() const { return _vertexBuffer; }
     RHIBuffer* GetIndexBuffer() const { return _indexBuffer; }
     RHIVertexInputLayout* GetVertexInputLayout() const { return _vertexInputLayout; }
 
+    // 파이프라인의 vertexInputDesc에 그대로 넣는다. location은 EVertexAttributeLocation을 따르고,
+    // 버퍼 안 순서는 위치, 법선, UV 세트, 색, 접선(, 종접선)이다.
+    const VertexInputStateDescriptor& GetVertexInputState() const { return _vertexInputState; }
+
+    // 양자화된 위치를 오브젝트 공간으로 되돌리는 값. positionOS = decoded * scale + offset
+    const glm::vec3& GetPositionScale() const { return _positionScale; }
+    const glm::vec3& GetPositionOffset() const { return _positionOffset; }
+    glm::mat4 GetPositionDecodeMatrix() const { return glm::scale(glm::translate(glm::mat4(1.0f), _positionOffset), _positionScale); }
+
+    // 클러스터 컬링용. CPU에서 판정할 때는 GetMeshlets를, 컴퓨트 셰이더에는 아래 버퍼 셋을 쓴다.
+    // 버퍼 레이아웃은 Shader/MeshletCulling.hlsli와 같다.
+    const MeshletData& GetMeshlets() const { return _meshlets; }
+    RHIBuffer* GetMeshletBuffer() const { return _meshletBuffer; }
+    RHIBuffer* GetMeshletVertexBuffer() const { return _meshletVertexBuffer; }
+    RHIBuffer* GetMeshletTriangleBuffer() const { return _meshletTriangleBuffer; }
+    bool HasMeshlets() const { return false == _meshlets.IsEmpty(); }
+
+    // LOD0이 맨 앞이고 뒤로 갈수록 거칠다. 인덱스 버퍼에 이 순서대로 이어 붙어 있다.
+    const std::vector<MeshLODRange>& GetLODs() const { return _lods; }
+    uint32 GetLODCount() const { return static_cast<uint32>(_lods.size()); }
+    const glm::vec4& GetBoundingSphere() const { return _boundingSphere; }
+
+    // 바운딩 구가 화면에서 차지하는 반지름(픽셀). projectionScaleY는 투영 행렬의 [1][1]이다.
+    // 카메라가 구 안에 있으면 무한대를 돌려 LOD0이 골라지게 한다.
+    float ComputeProjectedRadius(const glm::mat4& modelView, float projectionScaleY, float viewportHeight) const;
+
+    // 오차를 화면에 투영해 maxPixelError 픽셀 이하인 단계 중 가장 거친 것을 고른다.
+    uint32 SelectLOD(float projectedRadius, float maxPixelError = 1.0f) const;
+
     uint32 GetVertexCount() const { return _vertexCount; }
     uint32 GetIndexCount() const { return _indexCount; }
     uint32 GetTriangleCount() const { return _indexCount / 3; }
     uint32 GetVertexStride() const { return _vertexStride; }
+    EIndexFormat GetIndexFormat() const { return _indexFormat; }
 
-    const std::vector<VertexAttribute>& GetVertexAttributes() const { return _vertexAttributes; }
-    
     bool HasValidBuffers() const { return _vertexBuffer != nullptr; }
     bool HasIndexBuffer() const { return _indexBuffer != nullptr; }
 
     int32 GetMaterialIndex() const { return _materialIndex; }
 
+    // UpdateFromGameObject에서 정한 레이아웃대로 정점을 인터리브해 outData에 쓴다.
+    // outData는 GetVertexCount() * GetVertexStride() 바이트 이상이어야 한다.
+    void PackVertexData(const Mesh* mesh, void* outData) const;
+
 private:
     void CreateRHIResources(const Mesh* mesh);
     void UpdateVertexData(const Mesh* mesh);
-    void CreateVertexInputLayout();
-    uint32 CalculateVertexStride(const Mesh* mesh);
-    std::vector<float> PackVertexData(const Mesh* mesh);
+    void BuildVertexInputState(const Mesh* mesh);
+    RHIBuffer* CreateVertexBuffer(const Mesh* mesh);
+    RHIBuffer* CreateIndexBuffer(const Mesh* mesh);
+    void CreateMeshletBuffers();
 
     RHIBuffer* _vertexBuffer;
     RHIBuffer* _indexBuffer;
     RHIVertexInputLayout* _vertexInputLayout;
-    
-    std::vector<VertexAttribute> _vertexAttributes;
-    
+
+    std::vector<MeshLODRange> _lods;
+    glm::vec4 _boundingSphere;
+
+    MeshletData _meshlets;
+    RHIBuffer* _meshletBuffer;
+    RHIBuffer* _meshletVertexBuffer;
+    RHIBuffer* _meshletTriangleBuffer;
+
+    VertexCompressionInfo _compression;
+    VertexInputStateDescriptor _vertexInputState;
+    glm::vec3 _positionScale;
+    glm::vec3 _positionOffset;
+
     uint32 _vertexCount;
-    uint32 _indexCount;
+    uint32 _indexCount; // LOD0
     uint32 _vertexStride;
+    EIndexFormat _indexFormat;
     int32 _materialIndex;
-    
+
     uint64 _lastUpdateHash;
 };
 
@@ -8,7 +8,7 @@ HS_NS_BEGIN
 
 class Object;
 
-class HS_RESOURCE_API ObjectProxy
+class HS_API ObjectProxy
 {
 public:
     enum class EType
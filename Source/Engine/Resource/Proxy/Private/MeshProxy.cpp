@@ -1,19 +1,122 @@
-#include "Resource/MeshProxy.h"
+#include "Resource/Proxy/MeshProxy.h"
 #include "Resource/Mesh.h"
 #include "Core/Log.h"
 #include "RHI/RHIContext.h"
+#include "RHI/ResourceHandle.h"
+#include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 
 HS_NS_BEGIN
 
+namespace
+{
+constexpr uint32 MAX_TEXCOORD_SETS = 8;
+
+// location을 바꾸면 Shader/VertexDecode.hlsli의 VSCompressedInput도 함께 바꾼다.
+static_assert(static_cast<uint32>(EVertexAttributeLocation::POSITION) == 0 && static_cast<uint32>(EVertexAttributeLocation::NORMAL) == 1 &&
+              static_cast<uint32>(EVertexAttributeLocation::TANGENT) == 2 && static_cast<uint32>(EVertexAttributeLocation::TEXCOORD0) == 5,
+              "VertexDecode.hlsli hardcodes these vertex attribute locations");
+static_assert(static_cast<uint32>(EVertexAttributeLocation::TEXCOORD0) + MAX_TEXCOORD_SETS <= MAX_VERTEX_ATTRIBUTES,
+              "Vertex attribute locations exceed MAX_VERTEX_ATTRIBUTES");
+
+uint32 get_format_size(EVertexFormat format)
+{
+    switch (format)
+    {
+    case EVertexFormat::FLOAT:        return 4;
+    case EVertexFormat::FLOAT2:       return 8;
+    case EVertexFormat::FLOAT3:       return 12;
+    case EVertexFormat::FLOAT4:       return 16;
+    case EVertexFormat::HALF2:        return 4;
+    case EVertexFormat::HALF4:        return 8;
+    case EVertexFormat::SHORT2_NORM:  return 4;
+    case EVertexFormat::SHORT4_NORM:  return 8;
+    case EVertexFormat::UCHAR4_NORM:  return 4;
+    default:
+        HS_LOG(crash, "MeshProxy: Unsupported vertex format %d", static_cast<int>(format));
+        return 0;
+    }
+}
+
+HS_FORCEINLINE int16 to_snorm16(float value)
+{
+    value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return static_cast<int16>(value * 32767.0f + (value >= 0.0f ? 0.5f : -0.5f));
+}
+
+// 가장 가까운 짝수로 반올림하는 float -> half 변환. 정점 수만큼 불리므로 분기를 줄인 비트 연산으로 한다.
+HS_FORCEINLINE uint16 to_half(float value)
+{
+    uint32 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32 sign = (bits >> 16) & 0x8000u;
+    bits &= 0x7FFFFFFFu;
+
+    // 범위를 넘으면 Inf, NaN은 quiet NaN
+    if (bits >= 0x47800000u)
+    {
+        return static_cast<uint16>(sign | (bits > 0x7F800000u ? 0x7E00u : 0x7C00u));
+    }
+
+    // 비정규 수와 0은 float 덧셈의 반올림을 빌린다.
+    if (bits < 0x38800000u)
+    {
+        float denormal;
+        std::memcpy(&denormal, &bits, sizeof(denormal));
+        denormal += 0.5f;
+        std::memcpy(&bits, &denormal, sizeof(bits));
+        return static_cast<uint16>(sign | (bits - 0x3F000000u));
+    }
+
+    const uint32 mantissaOdd = (bits >> 13) & 1u;
+    bits += 0xC8000FFFu + mantissaOdd; // 지수 편향을 127에서 15로 옮기고 반올림
+    return static_cast<uint16>(sign | (bits >> 13));
+}
+
+// 팔면체 인코딩. 단위 벡터를 [-1, 1]^2로 접는다. 길이가 0이면 +Z로 풀리는 원점을 돌려준다.
+HS_FORCEINLINE glm::vec2 encode_octahedral(float x, float y, float z)
+{
+    const float sum = std::fabs(x) + std::fabs(y) + std::fabs(z);
+    if (sum <= 0.0f)
+    {
+        return glm::vec2(0.0f);
+    }
+
+    glm::vec2 oct(x / sum, y / sum);
+    if (z < 0.0f)
+    {
+        const float ox = oct.x;
+        oct.x          = (1.0f - std::fabs(oct.y)) * (ox >= 0.0f ? 1.0f : -1.0f);
+        oct.y          = (1.0f - std::fabs(ox)) * (oct.y >= 0.0f ? 1.0f : -1.0f);
+    }
+    return oct;
+}
+
+template <size_t N, typename T>
+HS_FORCEINLINE void write_elements(uint8* dst, const T (&values)[N])
+{
+    std::memcpy(dst, values, sizeof(values));
+}
+} // namespace
+
 MeshProxy::MeshProxy(uint64 gameObjectId)
     : ObjectProxy(EType::MESH, gameObjectId)
     , _vertexBuffer(nullptr)
     , _indexBuffer(nullptr)
     , _vertexInputLayout(nullptr)
+    , _boundingSphere(0.0f)
+    , _meshletBuffer(nullptr)
+    , _meshletVertexBuffer(nullptr)
+    , _meshletTriangleBuffer(nullptr)
+    , _positionScale(1.0f)
+    , _positionOffset(0.0f)
     , _vertexCount(0)
     , _indexCount(0)
     , _vertexStride(0)
+    , _indexFormat(EIndexFormat::UINT32)
     , _materialIndex(-1)
     , _lastUpdateHash(0)
 {
@@ -46,18 +149,35 @@ void MeshProxy::UpdateFromGameObject(const Object* gameObject)
 
 void MeshProxy::ReleaseRenderResources()
 {
+    RHIContext* rhiContext = RHIContext::Get();
+
     if (_vertexBuffer)
     {
-        // TODO: Release RHI vertex buffer when RHI is implemented
+        if (rhiContext)
+        {
+            rhiContext->DestroyBuffer(_vertexBuffer);
+        }
         _vertexBuffer = nullptr;
     }
 
     if (_indexBuffer)
     {
-        // TODO: Release RHI index buffer when RHI is implemented
+        if (rhiContext)
+        {
+            rhiContext->DestroyBuffer(_indexBuffer);
+        }
         _indexBuffer = nullptr;
     }
 
+    for (RHIBuffer** buffer : {&_meshletBuffer, &_meshletVertexBuffer, &_meshletTriangleBuffer})
+    {
+        if (*buffer && rhiContext)
+        {
+            rhiContext->DestroyBuffer(*buffer);
+        }
+        *buffer = nullptr;
+    }
+
     if (_vertexInputLayout)
     {
         // TODO: Release RHI vertex input layout when RHI is implemented
@@ -78,173 +198,258 @@ void MeshProxy::CreateRHIResources(const Mesh* mesh)
     _vertexCount = mesh->GetVertexCount();
     _indexCount = static_cast<uint32>(mesh->GetIndices().size());
     _materialIndex = mesh->GetMaterialIndex();
-    _vertexStride = CalculateVertexStride(mesh);
 
-    // Build vertex attributes list
-    _vertexAttributes.clear();
-    uint32 offset = 0;
+    BuildVertexInputState(mesh);
 
-    // Position (always present)
-    _vertexAttributes.push_back({
-        ERHIVertexElementType::Float3,
-        offset,
-        sizeof(float) * 3,
-        std::string("POSITION"),
-        0
-    });
-    offset += sizeof(float) * 3;
+    _meshlets = mesh->GetMeshlets();
 
-    // Normal
-    if (mesh->HasNormals())
-    {
-        _vertexAttributes.push_back({
-            ERHIVertexElementType::Float3,
-            offset,
-            sizeof(float) * 3,
-            std::string("NORMAL"),
-            0
-        });
-        offset += sizeof(float) * 3;
-    }
+    const glm::vec3 boundMin = mesh->GetBoundMin();
+    const glm::vec3 boundMax = mesh->GetBoundMax();
+    _boundingSphere = glm::vec4((boundMin + boundMax) * 0.5f, glm::length(boundMax - boundMin) * 0.5f);
 
-    // Texture coordinates
-    for (int i = 0; i < 8; ++i)
+    _lods.clear();
+    if (mesh->HasIndices())
     {
-        if (mesh->HasTexCoords(i))
+        uint32 firstIndex = _indexCount;
+        _lods.push_back(MeshLODRange{0, _indexCount, 0.0f});
+        for (const MeshLOD& lod : mesh->GetLODs())
         {
-            _vertexAttributes.push_back({
-                ERHIVertexElementType::Float2,
-                offset,
-                sizeof(float) * 2,
-                std::string("TEXCOORD"),
-                static_cast<uint32>(i)
-            });
-            offset += sizeof(float) * 2;
+            _lods.push_back(MeshLODRange{firstIndex, static_cast<uint32>(lod.indices.size()), lod.error});
+            firstIndex += static_cast<uint32>(lod.indices.size());
         }
     }
 
-    // Color
-    if (mesh->HasColors())
+    RHIContext* rhiContext = RHIContext::Get();
+    if (nullptr == rhiContext)
     {
-        _vertexAttributes.push_back({
-            ERHIVertexElementType::Float4,
-            offset,
-            sizeof(float) * 4,
-            "COLOR",
-            0
-        });
-        offset += sizeof(float) * 4;
+        // 렌더러 없이 쓰는 경우(툴, 벤치)는 레이아웃까지만 만든다.
+        return;
     }
 
-    // Tangent
-    if (mesh->HasTangents())
-    {
-        _vertexAttributes.push_back({
-            ERHIVertexElementType::Float3,
-            offset,
-            sizeof(float) * 3,
-            std::string("TANGENT"),
-            0
-        });
-        offset += sizeof(float) * 3;
-
-        // Bitangent
-        _vertexAttributes.push_back({
-            ERHIVertexElementType::Float3,
-            offset,
-            sizeof(float) * 3,
-            std::string("BITANGENT"),
-            0
-        });
-        offset += sizeof(float) * 3;
-    }
-
-    // Pack vertex data
-    std::vector<float> packedVertexData = PackVertexData(mesh);
-
-    // TODO: Create RHI vertex buffer when RHI system is available
-    // RHIBufferDesc vertexBufferDesc;
-    // vertexBufferDesc.usage = ERHIBufferUsage::VertexBuffer;
-    // vertexBufferDesc.size = packedVertexData.size() * sizeof(float);
-    // vertexBufferDesc.initialData = packedVertexData.data();
-    // 
-    // _vertexBuffer = RHIContext::CreateBuffer(vertexBufferDesc);
-
-    // Create index buffer if indices exist
+    _vertexBuffer = CreateVertexBuffer(mesh);
+
     if (mesh->HasIndices())
     {
-        // TODO: Create RHI index buffer when RHI system is available
-        // RHIBufferDesc indexBufferDesc;
-        // indexBufferDesc.usage = ERHIBufferUsage::IndexBuffer;
-        // indexBufferDesc.size = mesh->GetIndices().size() * sizeof(uint32);
-        // indexBufferDesc.initialData = mesh->GetIndices().data();
-        // 
-        // _indexBuffer = RHIContext::CreateBuffer(indexBufferDesc);
+        _indexBuffer = CreateIndexBuffer(mesh);
     }
 
-    CreateVertexInputLayout();
+    if (false == _meshlets.IsEmpty())
+    {
+        CreateMeshletBuffers();
+    }
 
-    HS_LOG(info, "MeshProxy: Created RHI resources for mesh with %u vertices, %u indices", 
-           _vertexCount, _indexCount);
+    HS_LOG(info, "MeshProxy: Created RHI resources for mesh with %u vertices (%u bytes each), %u indices, %u LODs", 
+           _vertexCount, _vertexStride, _indexCount, GetLODCount());
 }
 
-void MeshProxy::UpdateVertexData(const Mesh* mesh)
+float MeshProxy::ComputeProjectedRadius(const glm::mat4& modelView, float projectionScaleY, float viewportHeight) const
 {
-    if (!_vertexBuffer || !mesh)
+    const glm::vec3 centerVS = glm::vec3(modelView * glm::vec4(glm::vec3(_boundingSphere), 1.0f));
+
+    // 비균등 스케일이면 가장 큰 축을 쓴다.
+    const float scale  = std::sqrt(std::max({glm::dot(glm::vec3(modelView[0]), glm::vec3(modelView[0])),
+                                             glm::dot(glm::vec3(modelView[1]), glm::vec3(modelView[1])),
+                                             glm::dot(glm::vec3(modelView[2]), glm::vec3(modelView[2]))}));
+    const float radius = _boundingSphere.w * scale;
+
+    // 뷰 공간은 -Z를 바라본다.
+    const float depth = -centerVS.z;
+    if (depth <= radius)
     {
-        return;
+        return std::numeric_limits<float>::infinity();
     }
 
-    std::vector<float> packedVertexData = PackVertexData(mesh);
+    return radius * projectionScaleY * 0.5f * viewportHeight / depth;
+}
 
-    // TODO: Update vertex buffer data when RHI system is available
-    // RHIContext::UpdateBufferData(_vertexBuffer, packedVertexData.data(), packedVertexData.size() * sizeof(float));
+uint32 MeshProxy::SelectLOD(float projectedRadius, float maxPixelError) const
+{
+    if (_lods.size() <= 1 || _boundingSphere.w <= 0.0f)
+    {
+        return 0;
+    }
+
+    // 오차와 반지름이 같은 공간에 있으므로 비율만으로 화면 오차를 구한다.
+    const float pixelsPerUnit = projectedRadius / _boundingSphere.w;
+
+    uint32 selected = 0;
+    for (uint32 level = 1; level < static_cast<uint32>(_lods.size()); ++level)
+    {
+        if (_lods[level].error * pixelsPerUnit > maxPixelError)
+        {
+            break;
+        }
+        selected = level;
+    }
+    return selected;
 }
 
-void MeshProxy::CreateVertexInputLayout()
+RHIBuffer* MeshProxy::CreateVertexBuffer(const Mesh* mesh)
 {
-    if (_vertexAttributes.empty())
+    RHIContext* rhiContext = RHIContext::Get();
+    const size_t byteSize  = static_cast<size_t>(_vertexCount) * _vertexStride;
+
+    // 정적 메시는 매 프레임 GPU가 읽으므로 장치 메모리에 둔다. HOST_VISIBLE 메모리에서 바로 읽으면 대역폭이 크게 떨어진다.
+    // STATIC 버퍼는 백엔드가 스테이징 버퍼에 복사한 뒤 장치 메모리로 옮긴다.
+    std::vector<uint8> packedVertexData(byteSize);
+    PackVertexData(mesh, packedVertexData.data());
+
+    return rhiContext->CreateBuffer("MeshProxy VertexBuffer", packedVertexData.data(), byteSize, EBufferUsage::VERTEX, EBufferMemoryOption::STATIC);
+}
+
+RHIBuffer* MeshProxy::CreateIndexBuffer(const Mesh* mesh)
+{
+    RHIContext* rhiContext = RHIContext::Get();
+
+    // LOD 인덱스를 LOD0 뒤에 이어 붙인다. 구간은 _lods에 있다.
+    std::vector<uint32> indices;
+    indices.reserve(_lods.empty() ? mesh->GetIndices().size() : _lods.back().firstIndex + _lods.back().indexCount);
+    indices.insert(indices.end(), mesh->GetIndices().begin(), mesh->GetIndices().end());
+    for (const MeshLOD& lod : mesh->GetLODs())
+    {
+        indices.insert(indices.end(), lod.indices.begin(), lod.indices.end());
+    }
+
+    BufferInfo info{};
+    info.usage        = EBufferUsage::INDEX;
+    info.memoryOption = EBufferMemoryOption::STATIC;
+
+    // 정점이 65536개 이하면 16bit로 올려 인덱스 대역폭을 절반으로 줄인다.
+    if (_vertexCount <= 65536)
     {
+        std::vector<uint16> indices16(indices.begin(), indices.end());
+        info.indexFormat = EIndexFormat::UINT16;
+        _indexFormat     = EIndexFormat::UINT16;
+        return rhiContext->CreateBuffer("MeshProxy IndexBuffer", indices16.data(), indices16.size() * sizeof(uint16), info);
+    }
+
+    info.indexFormat = EIndexFormat::UINT32;
+    _indexFormat     = EIndexFormat::UINT32;
+    return rhiContext->CreateBuffer("MeshProxy IndexBuffer", indices.data(), indices.size() * sizeof(uint32), info);
+}
+
+void MeshProxy::CreateMeshletBuffers()
+{
+    RHIContext* rhiContext = RHIContext::Get();
+
+    _meshletBuffer         = rhiContext->CreateBuffer("MeshProxy MeshletBuffer", _meshlets.meshlets.data(), _meshlets.meshlets.size() * sizeof(Meshlet), EBufferUsage::STORAGE_BUFFER, EBufferMemoryOption::STATIC);
+    _meshletVertexBuffer   = rhiContext->CreateBuffer("MeshProxy MeshletVertexBuffer", _meshlets.vertices.data(), _meshlets.vertices.size() * sizeof(uint32), EBufferUsage::STORAGE_BUFFER, EBufferMemoryOption::STATIC);
+    _meshletTriangleBuffer = rhiContext->CreateBuffer("MeshProxy MeshletTriangleBuffer", _meshlets.triangles.data(), _meshlets.triangles.size(), EBufferUsage::STORAGE_BUFFER, EBufferMemoryOption::STATIC);
+}
+
+void MeshProxy::UpdateVertexData(const Mesh* mesh)
+{
+    if (!_vertexBuffer || !mesh)
+    {
+        return;
+    }
+
+    if (_vertexBuffer->byte)
+    {
+        PackVertexData(mesh, _vertexBuffer->byte);
         return;
     }
 
-    // TODO: Create vertex input layout when RHI system is available
-    // RHIVertexInputLayoutDesc layoutDesc;
-    // layoutDesc.elements = _vertexAttributes.data();
-    // layoutDesc.elementCount = static_cast<uint32>(_vertexAttributes.size());
-    // layoutDesc.stride = _vertexStride;
-    // 
-    // _vertexInputLayout = RHIContext::CreateVertexInputLayout(layoutDesc);
+    // 정적 버퍼는 다시 만든다.
+    RHIContext::Get()->DestroyBuffer(_vertexBuffer);
+    _vertexBuffer = CreateVertexBuffer(mesh);
 }
 
-uint32 MeshProxy::CalculateVertexStride(const Mesh* mesh)
+void MeshProxy::BuildVertexInputState(const Mesh* mesh)
 {
-    uint32 stride = sizeof(float) * 3; // Position
+    _vertexInputState.layouts.clear();
+    _vertexInputState.attributes.clear();
 
+    // 버퍼 안 순서는 PackVertexData와 같아야 하고, location은 속성마다 고정이다.
+    uint32 offset = 0;
+    auto addAttribute = [&](EVertexAttributeLocation location, EVertexFormat format, uint32 locationOffset = 0) {
+        _vertexInputState.attributes.push_back({static_cast<uint32>(location) + locationOffset, 0, format, offset});
+        offset += get_format_size(format);
+    };
+
+    // Position
+    const glm::vec3 boundMin = mesh->GetBoundMin();
+    const glm::vec3 boundMax = mesh->GetBoundMax();
+    switch (_compression.position)
+    {
+    case EVertexPositionEncoding::FLOAT:
+        _positionScale  = glm::vec3(1.0f);
+        _positionOffset = glm::vec3(0.0f);
+        addAttribute(EVertexAttributeLocation::POSITION, EVertexFormat::FLOAT3);
+        break;
+    case EVertexPositionEncoding::HALF:
+        // 중심 기준 상대 좌표로 두면 원점에서 먼 메시도 half 정밀도를 잃지 않는다.
+        _positionScale  = glm::vec3(1.0f);
+        _positionOffset = (boundMin + boundMax) * 0.5f;
+        addAttribute(EVertexAttributeLocation::POSITION, EVertexFormat::HALF4);
+        break;
+    case EVertexPositionEncoding::SNORM16:
+        _positionOffset = (boundMin + boundMax) * 0.5f;
+        _positionScale  = (boundMax - boundMin) * 0.5f;
+        // 납작한 축은 0으로 나누지 않도록 1로 둔다. 그 축의 값은 모두 0이 된다.
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (_positionScale[axis] <= 0.0f)
+            {
+                _positionScale[axis] = 1.0f;
+            }
+        }
+        addAttribute(EVertexAttributeLocation::POSITION, EVertexFormat::SHORT4_NORM);
+        break;
+    }
+
+    // Normal
     if (mesh->HasNormals())
-        stride += sizeof(float) * 3;
+    {
+        addAttribute(EVertexAttributeLocation::NORMAL, _compression.octahedralNormal ? EVertexFormat::SHORT2_NORM : EVertexFormat::FLOAT3);
+    }
 
-    for (int i = 0; i < 8; ++i)
+    // Texture coordinates
+    for (uint32 i = 0; i < MAX_TEXCOORD_SETS; ++i)
     {
-        if (mesh->HasTexCoords(i))
-            stride += sizeof(float) * 2;
+        if (mesh->HasTexCoords(static_cast<int>(i)))
+        {
+            addAttribute(EVertexAttributeLocation::TEXCOORD0, _compression.halfTexCoord ? EVertexFormat::HALF2 : EVertexFormat::FLOAT2, i);
+        }
     }
 
+    // Color
     if (mesh->HasColors())
-        stride += sizeof(float) * 4;
+    {
+        addAttribute(EVertexAttributeLocation::COLOR, _compression.unorm8Color ? EVertexFormat::UCHAR4_NORM : EVertexFormat::FLOAT4);
+    }
 
+    // Tangent, Bitangent. 압축할 때는 종접선을 부호 하나로 줄여 접선의 z에 넣는다.
     if (mesh->HasTangents())
-        stride += sizeof(float) * 6; // Tangent + Bitangent
+    {
+        if (_compression.octahedralNormal)
+        {
+            addAttribute(EVertexAttributeLocation::TANGENT, EVertexFormat::SHORT4_NORM);
+        }
+        else
+        {
+            addAttribute(EVertexAttributeLocation::TANGENT, EVertexFormat::FLOAT3);
+            addAttribute(EVertexAttributeLocation::BITANGENT, EVertexFormat::FLOAT3);
+        }
+    }
 
-    return stride;
+    _vertexStride = offset;
+
+    VertexInputLayoutDescriptor layout{};
+    layout.binding       = 0;
+    layout.stride        = _vertexStride;
+    layout.stepRate      = 1;
+    layout.useInstancing = false;
+    _vertexInputState.layouts.push_back(layout);
 }
 
-std::vector<float> MeshProxy::PackVertexData(const Mesh* mesh)
+void MeshProxy::PackVertexData(const Mesh* mesh, void* outData) const
 {
-    const uint32 vertexCount = mesh->GetVertexCount();
-    const uint32 elementsPerVertex = _vertexStride / sizeof(float);
-    
-    std::vector<float> packedData(vertexCount * elementsPerVertex);
+    HS_ASSERT(mesh->GetVertexCount() == _vertexCount, "MeshProxy: Vertex count does not match the built layout");
+
+    const uint32 vertexCount = _vertexCount;
+    const uint32 stride      = _vertexStride;
+    uint8* base              = static_cast<uint8*>(outData);
 
     const auto& positions = mesh->GetPosition();
     const auto& normals = mesh->GetNormal();
@@ -252,86 +457,165 @@ std::vector<float> MeshProxy::PackVertexData(const Mesh* mesh)
     const auto& tangents = mesh->GetTangent();
     const auto& bitangents = mesh->GetBitangent();
 
-    for (uint32 v = 0; v < vertexCount; ++v)
-    {
-        uint32 index = 0;
-
-        // Position
-        packedData[v * elementsPerVertex + index++] = positions[v * 3 + 0];
-        packedData[v * elementsPerVertex + index++] = positions[v * 3 + 1];
-        packedData[v * elementsPerVertex + index++] = positions[v * 3 + 2];
+    // 속성 하나씩 전체 정점을 돈다. 안쪽 루프에 형식 분기가 남지 않는다.
+    size_t attributeIndex = 0;
+    auto nextOffset = [&]() { return _vertexInputState.attributes[attributeIndex++].offset; };
 
-        // Normal
-        if (mesh->HasNormals())
+    // Position
+    {
+        const uint32 offset = nextOffset();
+        switch (_compression.position)
         {
-            packedData[v * elementsPerVertex + index++] = normals[v * 3 + 0];
-            packedData[v * elementsPerVertex + index++] = normals[v * 3 + 1];
-            packedData[v * elementsPerVertex + index++] = normals[v * 3 + 2];
+        case EVertexPositionEncoding::FLOAT:
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                std::memcpy(base + v * stride + offset, &positions[v * 3], sizeof(float) * 3);
+            }
+            break;
+        case EVertexPositionEncoding::HALF:
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                const uint16 packed[4] = {
+                    to_half(positions[v * 3 + 0] - _positionOffset.x),
+                    to_half(positions[v * 3 + 1] - _positionOffset.y),
+                    to_half(positions[v * 3 + 2] - _positionOffset.z),
+                    to_half(1.0f)};
+                write_elements(base + v * stride + offset, packed);
+            }
+            break;
+        case EVertexPositionEncoding::SNORM16:
+        {
+            const glm::vec3 invScale = 1.0f / _positionScale;
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                // w는 1로 두어 셰이더에서 float4 그대로 쓸 수 있게 한다.
+                const int16 packed[4] = {
+                    to_snorm16((positions[v * 3 + 0] - _positionOffset.x) * invScale.x),
+                    to_snorm16((positions[v * 3 + 1] - _positionOffset.y) * invScale.y),
+                    to_snorm16((positions[v * 3 + 2] - _positionOffset.z) * invScale.z),
+                    32767};
+                write_elements(base + v * stride + offset, packed);
+            }
+            break;
+        }
         }
+    }
 
-        // Texture coordinates
-        for (int i = 0; i < 8; ++i)
+    // Normal
+    if (mesh->HasNormals())
+    {
+        const uint32 offset = nextOffset();
+        if (_compression.octahedralNormal)
         {
-            if (mesh->HasTexCoords(i))
+            for (uint32 v = 0; v < vertexCount; ++v)
             {
-                const auto& texCoords = mesh->GetTexCoord(i);
-                packedData[v * elementsPerVertex + index++] = texCoords[v * 2 + 0];
-                packedData[v * elementsPerVertex + index++] = texCoords[v * 2 + 1];
+                const glm::vec2 oct    = encode_octahedral(normals[v * 3 + 0], normals[v * 3 + 1], normals[v * 3 + 2]);
+                const int16 packed[2] = {to_snorm16(oct.x), to_snorm16(oct.y)};
+                write_elements(base + v * stride + offset, packed);
             }
         }
+        else
+        {
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                std::memcpy(base + v * stride + offset, &normals[v * 3], sizeof(float) * 3);
+            }
+        }
+    }
+
+    // Texture coordinates
+    for (uint32 i = 0; i < MAX_TEXCOORD_SETS; ++i)
+    {
+        if (!mesh->HasTexCoords(static_cast<int>(i)))
+        {
+            continue;
+        }
 
-        // Color
-        if (mesh->HasColors())
+        const uint32 offset   = nextOffset();
+        const auto& texCoords = mesh->GetTexCoord(static_cast<int>(i));
+        if (_compression.halfTexCoord)
         {
-            if (colors.size() >= (v + 1) * 4)
+            for (uint32 v = 0; v < vertexCount; ++v)
             {
-                packedData[v * elementsPerVertex + index++] = colors[v * 4 + 0];
-                packedData[v * elementsPerVertex + index++] = colors[v * 4 + 1];
-                packedData[v * elementsPerVertex + index++] = colors[v * 4 + 2];
-                packedData[v * elementsPerVertex + index++] = colors[v * 4 + 3];
+                const uint16 packed[2] = {to_half(texCoords[v * 2 + 0]), to_half(texCoords[v * 2 + 1])};
+                write_elements(base + v * stride + offset, packed);
             }
-            else
+        }
+        else
+        {
+            for (uint32 v = 0; v < vertexCount; ++v)
             {
-                // Default white color
-                packedData[v * elementsPerVertex + index++] = 1.0f;
-                packedData[v * elementsPerVertex + index++] = 1.0f;
-                packedData[v * elementsPerVertex + index++] = 1.0f;
-                packedData[v * elementsPerVertex + index++] = 1.0f;
+                std::memcpy(base + v * stride + offset, &texCoords[v * 2], sizeof(float) * 2);
             }
         }
+    }
 
-        // Tangent and Bitangent
-        if (mesh->HasTangents())
+    // Color
+    if (mesh->HasColors())
+    {
+        const uint32 offset = nextOffset();
+        for (uint32 v = 0; v < vertexCount; ++v)
         {
-            if (tangents.size() >= (v + 1) * 3)
+            // Default white color
+            glm::vec4 color(1.0f);
+            if (colors.size() >= (v + 1) * 4)
+            {
+                color = glm::vec4(colors[v * 4 + 0], colors[v * 4 + 1], colors[v * 4 + 2], colors[v * 4 + 3]);
+            }
+
+            if (_compression.unorm8Color)
             {
-                packedData[v * elementsPerVertex + index++] = tangents[v * 3 + 0];
-                packedData[v * elementsPerVertex + index++] = tangents[v * 3 + 1];
-                packedData[v * elementsPerVertex + index++] = tangents[v * 3 + 2];
+                const uint32 packed = glm::packUnorm4x8(color);
+                std::memcpy(base + v * stride + offset, &packed, sizeof(packed));
             }
             else
             {
-                packedData[v * elementsPerVertex + index++] = 1.0f;
-                packedData[v * elementsPerVertex + index++] = 0.0f;
-                packedData[v * elementsPerVertex + index++] = 0.0f;
+                std::memcpy(base + v * stride + offset, &color[0], sizeof(float) * 4);
             }
+        }
+    }
+
+    // Tangent and Bitangent
+    if (mesh->HasTangents())
+    {
+        const bool hasTangent   = tangents.size() >= static_cast<size_t>(vertexCount) * 3;
+        const bool hasBitangent = bitangents.size() >= static_cast<size_t>(vertexCount) * 3;
 
-            if (bitangents.size() >= (v + 1) * 3)
+        if (_compression.octahedralNormal)
+        {
+            const uint32 offset = nextOffset();
+            const bool hasNormal = normals.size() >= static_cast<size_t>(vertexCount) * 3;
+            for (uint32 v = 0; v < vertexCount; ++v)
             {
-                packedData[v * elementsPerVertex + index++] = bitangents[v * 3 + 0];
-                packedData[v * elementsPerVertex + index++] = bitangents[v * 3 + 1];
-                packedData[v * elementsPerVertex + index++] = bitangents[v * 3 + 2];
+                const glm::vec3 t = hasTangent ? glm::vec3(tangents[v * 3 + 0], tangents[v * 3 + 1], tangents[v * 3 + 2]) : glm::vec3(1.0f, 0.0f, 0.0f);
+
+                // 종접선은 cross(N, T)에 부호만 곱해 복원한다.
+                float handedness = 1.0f;
+                if (hasNormal && hasBitangent)
+                {
+                    const glm::vec3 n(normals[v * 3 + 0], normals[v * 3 + 1], normals[v * 3 + 2]);
+                    const glm::vec3 b(bitangents[v * 3 + 0], bitangents[v * 3 + 1], bitangents[v * 3 + 2]);
+                    handedness = glm::dot(glm::cross(n, t), b) < 0.0f ? -1.0f : 1.0f;
+                }
+
+                const glm::vec2 oct    = encode_octahedral(t.x, t.y, t.z);
+                const int16 packed[4] = {to_snorm16(oct.x), to_snorm16(oct.y), to_snorm16(handedness), 0};
+                write_elements(base + v * stride + offset, packed);
             }
-            else
+        }
+        else
+        {
+            const uint32 tangentOffset   = nextOffset();
+            const uint32 bitangentOffset = nextOffset();
+            const float defaultTangent[3]   = {1.0f, 0.0f, 0.0f};
+            const float defaultBitangent[3] = {0.0f, 1.0f, 0.0f};
+            for (uint32 v = 0; v < vertexCount; ++v)
             {
-                packedData[v * elementsPerVertex + index++] = 0.0f;
-                packedData[v * elementsPerVertex + index++] = 1.0f;
-                packedData[v * elementsPerVertex + index++] = 0.0f;
+                std::memcpy(base + v * stride + tangentOffset, hasTangent ? &tangents[v * 3] : defaultTangent, sizeof(float) * 3);
+                std::memcpy(base + v * stride + bitangentOffset, hasBitangent ? &bitangents[v * 3] : defaultBitangent, sizeof(float) * 3);
             }
         }
     }
-
-    return packedData;
 }
 
 HS_NS_END
\ No newline at end of file
@@ -1,4 +1,4 @@
-#include "Resource/ObjectProxy.h"
+#include "Resource/Proxy/ObjectProxy.h"
 
 HS_NS_BEGIN
 
@@ -0,0 +1,18 @@
+//
+//  LinuxFileSystem.h
+//  Platform
+//
+//  POSIX file system backend
+//
+#ifndef __HS_LINUX_FILE_SYSTEM_H__
+#define __HS_LINUX_FILE_SYSTEM_H__
+
+#include "Precompile.h"
+
+#include "Core/HAL/FileSystem.h"
+
+HS_NS_BEGIN
+
+HS_NS_END
+
+#endif /*__HS_LINUX_FILE_SYSTEM_H__*/
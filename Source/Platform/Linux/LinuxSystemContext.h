@@ -0,0 +1,17 @@
+//
+//  LinuxSystemContext.h
+//  Platform
+//
+//  Linux system context
+//
+#ifndef __HS_LINUX_SYSTEM_CONTEXT_H__
+#define __HS_LINUX_SYSTEM_CONTEXT_H__
+
+#include "Precompile.h"
+#include "Core/SystemContext.h"
+
+HS_NS_BEGIN
+
+HS_NS_END
+
+#endif /*__HS_LINUX_SYSTEM_CONTEXT_H__*/
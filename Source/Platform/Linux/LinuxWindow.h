@@ -0,0 +1,40 @@
+//
+//  LinuxWindow.h
+//  Platform
+//
+//  Linux native window (X11 optional, headless fallback)
+//
+#ifndef __HS_PLATFORM_WINDOW_LINUX_H__
+#define __HS_PLATFORM_WINDOW_LINUX_H__
+
+#include "Precompile.h"
+#include "Core/Native/NativeWindow.h"
+
+HS_NS_BEGIN
+
+// NativeWindow::handle이 가리키는 구조체.
+// headless 창은 display가 nullptr이고 window가 0이다. RHI는 isHeadless로 surface 생성 여부를 결정한다.
+struct HS_API LinuxWindowHandle
+{
+    void*  display;  // X11 Display*
+    uint64 window;   // X11 Window(XID)
+    bool   isHeadless;
+
+    uint32 frameCount;
+    uint32 closeAfterFrames; // 0이면 자동으로 닫지 않는다.
+};
+
+void HS_API SetNativePreEventHandler(void* fnHandler);
+
+bool HS_API CreateNativeWindowInternal(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow);
+void HS_API DestroyNativeWindowInternal(NativeWindow& nativeWindow);
+void HS_API ShowNativeWindowInternal(const NativeWindow& nativeWindow);
+void HS_API PollNativeEventInternal(NativeWindow& nativeWindow);
+void HS_API SetNativeWindowSizeInternal(uint16 width, uint16 height);
+void HS_API GetNativeWindowSizeInternal(uint16& outWidth, uint16& outHeight);
+
+bool HS_API IsNativeWindowHeadless(const NativeWindow& nativeWindow);
+
+HS_NS_END
+
+#endif /*__HS_PLATFORM_WINDOW_LINUX_H__*/
@@ -0,0 +1,489 @@
+//
+//  LinuxFileSystem.cpp
+//  Platform
+//
+//  POSIX file system backend
+//
+#include "Platform/Linux/LinuxFileSystem.h"
+
+#include "Core/SystemContext.h"
+#include "Core/Log.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+HS_NS_BEGIN
+
+// FileHandle이 nullptr이면 유효하지 않은 핸들이므로 fd 0을 구분하기 위해 1을 더해 보관한다.
+static HS_FORCEINLINE FileHandle to_file_handle(int fd)
+{
+    return reinterpret_cast<FileHandle>(static_cast<intptr_t>(fd) + 1);
+}
+
+static HS_FORCEINLINE int to_fd(FileHandle fileHandle)
+{
+    return static_cast<int>(reinterpret_cast<intptr_t>(fileHandle) - 1);
+}
+
+static int get_open_flag(EFileAccess access)
+{
+    switch (access)
+    {
+    case EFileAccess::READ_ONLY:
+        return O_RDONLY;
+    case EFileAccess::WRITE_ONLY:
+        return O_WRONLY | O_CREAT;
+    case EFileAccess::READ_WRITE:
+        return O_RDWR | O_CREAT;
+    default:
+        return O_RDONLY;
+    }
+}
+
+bool FileSystem::Exist(const std::string& absolutePath)
+{
+    struct stat st;
+    return ::stat(absolutePath.c_str(), &st) == 0;
+}
+
+// 파일 복사 함수
+bool FileSystem::Copy(const std::string& src, const std::string& dst)
+{
+    int srcFd = ::open(src.c_str(), O_RDONLY | O_CLOEXEC);
+    if (srcFd < 0)
+    {
+        return false;
+    }
+
+    int dstFd = ::open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (dstFd < 0)
+    {
+        ::close(srcFd);
+        return false;
+    }
+
+    char buffer[64 * 1024];
+    bool success = true;
+    while (true)
+    {
+        ssize_t readSize = ::read(srcFd, buffer, sizeof(buffer));
+        if (readSize < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (readSize <= 0)
+        {
+            success = (readSize == 0);
+            break;
+        }
+
+        char* cursor = buffer;
+        while (readSize > 0)
+        {
+            ssize_t written = ::write(dstFd, cursor, static_cast<size_t>(readSize));
+            if (written < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (written <= 0)
+            {
+                success = false;
+                break;
+            }
+            cursor += written;
+            readSize -= written;
+        }
+
+        if (false == success)
+        {
+            break;
+        }
+    }
+
+    ::close(srcFd);
+    ::close(dstFd);
+
+    return success;
+}
+
+// 파일 열기 함수
+bool FileSystem::Open(const std::string& absolutePath, EFileAccess access, FileHandle& outFileHandle)
+{
+    int fd = ::open(absolutePath.c_str(), get_open_flag(access) | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    outFileHandle = to_file_handle(fd);
+    return true;
+}
+
+// 파일 닫기 함수
+bool FileSystem::Close(FileHandle fileHandle)
+{
+    if (!fileHandle)
+    {
+        return false;
+    }
+
+    return ::close(to_fd(fileHandle)) == 0;
+}
+
+// 파일 읽기 함수. 시그널로 끊기거나 나눠 읽히더라도 byteSize 또는 EOF까지 읽는다.
+size_t FileSystem::Read(FileHandle fileHandle, void* buffer, size_t byteSize)
+{
+    if (!fileHandle || !buffer || byteSize == 0)
+    {
+        return 0;
+    }
+
+    const int fd  = to_fd(fileHandle);
+    uint8* cursor = static_cast<uint8*>(buffer);
+    size_t total  = 0;
+    while (total < byteSize)
+    {
+        ssize_t readSize = ::read(fd, cursor + total, byteSize - total);
+        if (readSize < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (readSize <= 0)
+        {
+            break;
+        }
+        total += static_cast<size_t>(readSize);
+    }
+
+    return total;
+}
+
+// 파일 쓰기 함수
+size_t FileSystem::Write(FileHandle fileHandle, void* buffer, size_t byteSize)
+{
+    if (!fileHandle || !buffer || byteSize == 0)
+    {
+        return 0;
+    }
+
+    const int fd        = to_fd(fileHandle);
+    const uint8* cursor = static_cast<const uint8*>(buffer);
+    size_t total        = 0;
+    while (total < byteSize)
+    {
+        ssize_t written = ::write(fd, cursor + total, byteSize - total);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            break;
+        }
+        total += static_cast<size_t>(written);
+    }
+
+    return total;
+}
+
+// 파일 위치 설정 함수
+bool FileSystem::SetPos(FileHandle fileHandle, const int64 pos)
+{
+    if (!fileHandle)
+    {
+        return false;
+    }
+
+    return ::lseek(to_fd(fileHandle), static_cast<off_t>(pos), SEEK_SET) >= 0;
+}
+
+// 파일 버퍼 비우기 함수
+bool FileSystem::Flush(FileHandle fileHandle)
+{
+    if (!fileHandle)
+    {
+        return false;
+    }
+
+    return ::fsync(to_fd(fileHandle)) == 0;
+}
+
+// 파일 끝 확인 함수
+bool FileSystem::IsEOF(FileHandle fileHandle)
+{
+    if (!fileHandle)
+    {
+        return true; // 유효하지 않은 핸들은 EOF로 간주
+    }
+
+    const int fd = to_fd(fileHandle);
+
+    off_t currentPos = ::lseek(fd, 0, SEEK_CUR);
+    struct stat st;
+    if (currentPos < 0 || ::fstat(fd, &st) != 0)
+    {
+        return true;
+    }
+
+    return currentPos >= st.st_size;
+}
+
+// 파일 크기 확인 함수
+size_t FileSystem::GetSize(FileHandle fileHandle)
+{
+    if (!fileHandle)
+    {
+        return 0;
+    }
+
+    struct stat st;
+    if (::fstat(to_fd(fileHandle), &st) != 0)
+    {
+        return 0;
+    }
+
+    return static_cast<size_t>(st.st_size);
+}
+
+bool FileSystem::MapFile(const std::string& absolutePath, EFileAccessPattern pattern, MappedFile& outMappedFile)
+{
+    outMappedFile = MappedFile{};
+
+    int fd = ::open(absolutePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        HS_LOG(error, "Fail to open file for mapping: %s (%s)", absolutePath.c_str(), ::strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0)
+    {
+        ::close(fd);
+        return true;
+    }
+
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // 매핑이 파일을 참조하고 있으므로 fd는 바로 닫아도 된다.
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        HS_LOG(error, "Fail to map file: %s (%s)", absolutePath.c_str(), ::strerror(errno));
+        return false;
+    }
+
+    switch (pattern)
+    {
+    case EFileAccessPattern::SEQUENTIAL:
+        ::madvise(data, size, MADV_SEQUENTIAL);
+        ::madvise(data, size, MADV_WILLNEED);
+        break;
+    case EFileAccessPattern::RANDOM:
+        ::madvise(data, size, MADV_RANDOM);
+        break;
+    default:
+        break;
+    }
+
+    outMappedFile.data = static_cast<const uint8*>(data);
+    outMappedFile.size = size;
+
+    return true;
+}
+
+void FileSystem::UnmapFile(MappedFile& mappedFile)
+{
+    if (nullptr != mappedFile.data)
+    {
+        ::munmap(const_cast<uint8*>(mappedFile.data), mappedFile.size);
+    }
+
+    mappedFile = MappedFile{};
+}
+
+// 디렉토리 경로 얻기 함수
+std::string FileSystem::GetDirectory(const std::string& absolutePath)
+{
+    size_t lastSeparator = absolutePath.find_last_of('/');
+    if (lastSeparator == std::string::npos)
+    {
+        return "";
+    }
+
+    return absolutePath.substr(0, lastSeparator + 1);
+}
+
+// 파일 확장자 얻기 함수
+std::string FileSystem::GetExtension(const std::string& fileName)
+{
+    size_t lastDot = fileName.find_last_of('.');
+    if (lastDot == std::string::npos)
+    {
+        return "";
+    }
+
+    size_t lastSeparator = fileName.find_last_of('/');
+    if (lastSeparator != std::string::npos && lastDot < lastSeparator)
+    {
+        return "";
+    }
+
+    return fileName.substr(lastDot + 1);
+}
+
+// 절대 경로 확인 함수
+bool FileSystem::IsAbsolutePath(const std::string& path)
+{
+    return !path.empty() && path[0] == '/';
+}
+
+// 실행 파일 기준 상대 경로 얻기 함수
+std::string FileSystem::GetRelativePath(const std::string& absolutePath)
+{
+    SystemContext* context = SystemContext::Get();
+    if (nullptr == context || context->executableDirectory.empty())
+    {
+        return absolutePath;
+    }
+
+    const std::string& baseDir = context->executableDirectory;
+    if (absolutePath.compare(0, baseDir.length(), baseDir) == 0)
+    {
+        std::string relative = absolutePath.substr(baseDir.length());
+        if (!relative.empty() && relative[0] == HS_DIR_SEPERATOR)
+        {
+            relative = relative.substr(1);
+        }
+        return relative;
+    }
+
+    return absolutePath;
+}
+
+// 실행 파일 기준 절대 경로 얻기 함수
+std::string FileSystem::GetAbsolutePath(const std::string& relativePath)
+{
+    if (FileSystem::IsAbsolutePath(relativePath))
+    {
+        return relativePath;
+    }
+
+    SystemContext* context = SystemContext::Get();
+    if (nullptr == context || context->executableDirectory.empty())
+    {
+        return relativePath;
+    }
+
+    std::string baseDir = context->executableDirectory;
+    if (baseDir.back() != HS_DIR_SEPERATOR)
+    {
+        baseDir.push_back(HS_DIR_SEPERATOR);
+    }
+    return baseDir + relativePath;
+}
+
+// Linux의 wchar_t는 4바이트이므로 코드 포인트를 그대로 담는다.
+std::wstring FileSystem::Utf8ToUtf16(const std::string& utf8)
+{
+    std::wstring result;
+    result.reserve(utf8.size());
+
+    for (size_t i = 0; i < utf8.size();)
+    {
+        const uint8 lead = static_cast<uint8>(utf8[i]);
+        uint32 codePoint = 0;
+        size_t length    = 1;
+
+        if (lead < 0x80)
+        {
+            codePoint = lead;
+        }
+        else if ((lead >> 5) == 0x6)
+        {
+            codePoint = lead & 0x1F;
+            length    = 2;
+        }
+        else if ((lead >> 4) == 0xE)
+        {
+            codePoint = lead & 0x0F;
+            length    = 3;
+        }
+        else if ((lead >> 3) == 0x1E)
+        {
+            codePoint = lead & 0x07;
+            length    = 4;
+        }
+        else
+        {
+            // 잘못된 선행 바이트는 건너뛴다.
+            i++;
+            continue;
+        }
+
+        if (i + length > utf8.size())
+        {
+            break;
+        }
+
+        for (size_t j = 1; j < length; j++)
+        {
+            codePoint = (codePoint << 6) | (static_cast<uint8>(utf8[i + j]) & 0x3F);
+        }
+
+        result.push_back(static_cast<wchar_t>(codePoint));
+        i += length;
+    }
+
+    return result;
+}
+
+std::string FileSystem::Utf16ToUtf8(const std::wstring& utf16)
+{
+    std::string result;
+    result.reserve(utf16.size());
+
+    for (const wchar_t ch : utf16)
+    {
+        const uint32 codePoint = static_cast<uint32>(ch);
+        if (codePoint < 0x80)
+        {
+            result.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800)
+        {
+            result.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x10000)
+        {
+            result.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            result.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            result.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    return result;
+}
+
+HS_NS_END
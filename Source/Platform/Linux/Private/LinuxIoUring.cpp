@@ -0,0 +1,422 @@
+//
+//  LinuxIoUring.cpp
+//  Platform
+//
+//  io_uring backend for FileSystem::SubmitReads
+//
+#include "Platform/Linux/LinuxFileSystem.h"
+
+#include "Core/HAL/FileReadBackend.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 s_ringEntries  = 256;
+constexpr size_t s_maxReadChunk = 1u << 30; // sqe->len은 32bit
+
+int io_uring_setup(uint32 entries, io_uring_params* params)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int io_uring_enter(int ringFd, uint32 toSubmit, uint32 minComplete, uint32 flags)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+int io_uring_register(int ringFd, uint32 opcode, void* arg, uint32 argCount)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_register, ringFd, opcode, arg, argCount));
+}
+
+// IORING_REGISTER_PROBE(5.6)로 커널이 실제로 지원하는 연산인지 묻는다. 프로브가 없는 커널은 IORING_OP_READ도 없다.
+bool is_opcode_supported(int ringFd, uint8 opcode)
+{
+    constexpr uint32 probeOpCount = 256;
+    std::vector<uint8> storage(sizeof(io_uring_probe) + probeOpCount * sizeof(io_uring_probe_op), 0);
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+    if (io_uring_register(ringFd, IORING_REGISTER_PROBE, probe, probeOpCount) < 0)
+    {
+        return false;
+    }
+
+    return opcode <= probe->last_op && 0 != (probe->ops[opcode].flags & IO_URING_OP_SUPPORTED);
+}
+
+// liburing 없이 시스템 콜로 직접 구현한다. 제출(SQ)과 회수(CQ)는 각각 다른 잠금으로 보호하고,
+// CQ 넘침을 막기 위해 동시에 진행 중인 읽기는 CQ 크기로 제한한다. 넘치는 요청은 _pending에서 기다린다.
+class IoUringFileReadBackend final : public FileReadBackend
+{
+public:
+    ~IoUringFileReadBackend() override
+    {
+        if (nullptr != _sqes)
+        {
+            ::munmap(_sqes, _sqesSize);
+        }
+        if (nullptr != _cqRing && _cqRing != _sqRing)
+        {
+            ::munmap(_cqRing, _cqRingSize);
+        }
+        if (nullptr != _sqRing)
+        {
+            ::munmap(_sqRing, _sqRingSize);
+        }
+        if (_ringFd >= 0)
+        {
+            ::close(_ringFd);
+        }
+    }
+
+    bool Setup(uint32 entries)
+    {
+        io_uring_params params{};
+        _ringFd = io_uring_setup(entries, &params);
+        if (_ringFd < 0)
+        {
+            HS_LOG(info, "io_uring is not available (%s)", ::strerror(errno));
+            return false;
+        }
+
+        if (0 == (params.features & IORING_FEAT_SINGLE_MMAP) || false == is_opcode_supported(_ringFd, IORING_OP_READ))
+        {
+            HS_LOG(info, "io_uring kernel does not support IORING_OP_READ");
+            return false;
+        }
+
+        _sqEntries  = params.sq_entries;
+        _cqEntries  = params.cq_entries;
+        _sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32);
+        _cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+
+        _sqRing = ::mmap(nullptr, _sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ringFd, IORING_OFF_SQ_RING);
+        if (_sqRing == MAP_FAILED)
+        {
+            _sqRing = nullptr;
+            return false;
+        }
+        _cqRing = _sqRing;
+
+        _sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ringFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            return false;
+        }
+        _sqes = static_cast<io_uring_sqe*>(sqes);
+
+        uint8* sq = static_cast<uint8*>(_sqRing);
+        _sqHead   = reinterpret_cast<uint32*>(sq + params.sq_off.head);
+        _sqTail   = reinterpret_cast<uint32*>(sq + params.sq_off.tail);
+        _sqMask   = *reinterpret_cast<uint32*>(sq + params.sq_off.ring_mask);
+        _sqArray  = reinterpret_cast<uint32*>(sq + params.sq_off.array);
+
+        uint8* cq = static_cast<uint8*>(_cqRing);
+        _cqHead   = reinterpret_cast<uint32*>(cq + params.cq_off.head);
+        _cqTail   = reinterpret_cast<uint32*>(cq + params.cq_off.tail);
+        _cqMask   = *reinterpret_cast<uint32*>(cq + params.cq_off.ring_mask);
+        _cqes     = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+        return true;
+    }
+
+    const char* GetName() const override { return "io_uring"; }
+
+    void Submit(FileReadBatch* batch) override
+    {
+        std::deque<ReadOp*> ops;
+
+        // 파일 열기는 동기로 처리하고 읽기만 링에 넣는다.
+        for (size_t i = 0; i < batch->requestCount; i++)
+        {
+            FileReadRequest& request = batch->requests[i];
+
+            const int fd = ::open(request.path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0)
+            {
+                batch->Complete(request, EFileReadStatus::FAILED, 0);
+                continue;
+            }
+
+            uint8* destination = static_cast<uint8*>(request.destination);
+            size_t size        = request.size;
+            if (nullptr == destination)
+            {
+                struct stat st;
+                const size_t fileSize = (::fstat(fd, &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+                size                  = (fileSize > request.offset) ? fileSize - static_cast<size_t>(request.offset) : 0;
+                request.buffer.resize(size);
+                destination = request.buffer.data();
+            }
+
+            if (size == 0)
+            {
+                ::close(fd);
+                batch->Complete(request, EFileReadStatus::COMPLETED, 0);
+                continue;
+            }
+
+            ops.push_back(new ReadOp{batch, &request, fd, destination, size, 0});
+        }
+
+        std::lock_guard<std::mutex> lock(_sqMutex);
+        _pending.insert(_pending.end(), ops.begin(), ops.end());
+        flushPending();
+    }
+
+    void Poll(FileReadBatch* batch, bool wait) override
+    {
+        do
+        {
+            if (_cqMutex.try_lock())
+            {
+                reap();
+
+                if (wait && false == batch->IsDone() && isCompletionQueueEmpty())
+                {
+                    // 제출이 실패해 남은 요청과, 링에 올렸지만 커널이 아직 가져가지 않은 항목을 먼저 밀어 넣는다.
+                    uint32 unsubmitted = 0;
+                    {
+                        std::lock_guard<std::mutex> lock(_sqMutex);
+                        flushPending();
+                        unsubmitted = *_sqTail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+                    }
+
+                    if (_inflight.load(std::memory_order_acquire) > 0)
+                    {
+                        // 제출하지 못한 항목만 남았으면 to_submit 없이 기다리는 동안 완료가 절대 오지 않는다.
+                        // 커널은 링에 실제로 남은 개수까지만 가져가므로 다른 스레드가 그 사이 제출해도 안전하다.
+                        const int result = io_uring_enter(_ringFd, unsubmitted, 1, IORING_ENTER_GETEVENTS);
+                        if (result < 0 && errno != EINTR)
+                        {
+                            if (errno == EAGAIN || errno == EBUSY)
+                            {
+                                batch->WaitFor(std::chrono::milliseconds(1));
+                            }
+                            else
+                            {
+                                HS_LOG(error, "io_uring_enter failed (%s)", ::strerror(errno));
+                            }
+                        }
+                    }
+                    reap();
+                }
+
+                _cqMutex.unlock();
+            }
+            else if (wait)
+            {
+                // 다른 스레드가 회수 중이다. 이 배치의 완료도 그 스레드가 처리한다.
+                batch->WaitFor(std::chrono::milliseconds(1));
+            }
+        } while (wait && false == batch->IsDone());
+    }
+
+private:
+    struct ReadOp
+    {
+        FileReadBatch*   batch;
+        FileReadRequest* request;
+        int              fd;
+        uint8*           destination;
+        size_t           size;
+        size_t           done;
+    };
+
+    HS_FORCEINLINE bool isCompletionQueueEmpty() const
+    {
+        return *_cqHead == __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+    }
+
+    // _sqMutex를 잡은 상태에서 호출한다.
+    void flushPending()
+    {
+        uint32       tail = *_sqTail;
+        const uint32 head = __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+
+        while (false == _pending.empty() && tail - head < _sqEntries && _inflight.load(std::memory_order_relaxed) < _cqEntries)
+        {
+            ReadOp* op = _pending.front();
+            _pending.pop_front();
+
+            const uint32  index = tail & _sqMask;
+            io_uring_sqe* sqe   = &_sqes[index];
+            ::memset(sqe, 0, sizeof(io_uring_sqe));
+            sqe->opcode    = IORING_OP_READ;
+            sqe->fd        = op->fd;
+            sqe->addr      = reinterpret_cast<uint64>(op->destination + op->done);
+            sqe->len       = static_cast<uint32>(std::min(op->size - op->done, s_maxReadChunk));
+            sqe->off       = op->request->offset + op->done;
+            sqe->user_data = reinterpret_cast<uint64>(op);
+
+            _sqArray[index] = index;
+            tail++;
+            _inflight.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        __atomic_store_n(_sqTail, tail, __ATOMIC_RELEASE);
+
+        // 커널이 아직 가져가지 않은 항목까지 포함해 제출한다.
+        uint32 toSubmit = tail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+        while (toSubmit > 0)
+        {
+            const int submitted = io_uring_enter(_ringFd, toSubmit, 0, 0);
+            if (submitted < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                // EAGAIN/EBUSY는 다음 회수나 Poll(wait)에서 다시 시도한다.
+                if (errno != EAGAIN && errno != EBUSY)
+                {
+                    HS_LOG(error, "io_uring submit failed (%s)", ::strerror(errno));
+                    failUnsubmitted();
+                }
+                break;
+            }
+            toSubmit -= std::min(toSubmit, static_cast<uint32>(submitted));
+        }
+    }
+
+    // _sqMutex를 잡은 상태에서 호출한다. 링이 제출을 거부하면 커널이 가져가지 않은 항목을 되돌리고
+    // 기다리던 요청까지 모두 실패로 끝내 _inflight가 남지 않게 한다. SQPOLL을 쓰지 않으므로 커널은 io_uring_enter 안에서만 SQ를 읽는다.
+    void failUnsubmitted()
+    {
+        const uint32 head = __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+        const uint32 tail = *_sqTail;
+        for (uint32 i = head; i != tail; i++)
+        {
+            const io_uring_sqe& sqe = _sqes[_sqArray[i & _sqMask]];
+            _inflight.fetch_sub(1, std::memory_order_relaxed);
+            finish(reinterpret_cast<ReadOp*>(sqe.user_data), EFileReadStatus::FAILED);
+        }
+        __atomic_store_n(_sqTail, head, __ATOMIC_RELEASE);
+
+        for (ReadOp* op : _pending)
+        {
+            finish(op, EFileReadStatus::FAILED);
+        }
+        _pending.clear();
+    }
+
+    // _cqMutex를 잡은 상태에서 호출한다.
+    void reap()
+    {
+        uint32       head = *_cqHead;
+        const uint32 tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+        if (head == tail)
+        {
+            return;
+        }
+
+        std::deque<ReadOp*> resubmit;
+        for (; head != tail; head++)
+        {
+            const io_uring_cqe& cqe = _cqes[head & _cqMask];
+            ReadOp*             op  = reinterpret_cast<ReadOp*>(cqe.user_data);
+            const int32         res = cqe.res;
+            _inflight.fetch_sub(1, std::memory_order_relaxed);
+
+            if (res < 0)
+            {
+                if (res == -EAGAIN || res == -EINTR)
+                {
+                    resubmit.push_back(op);
+                }
+                else
+                {
+                    finish(op, EFileReadStatus::FAILED);
+                }
+            }
+            else if (res == 0)
+            {
+                // 파일 끝. 요청보다 짧은 파일이다.
+                finish(op, (op->done > 0) ? EFileReadStatus::COMPLETED : EFileReadStatus::FAILED);
+            }
+            else
+            {
+                op->done += static_cast<size_t>(res);
+                if (op->done < op->size)
+                {
+                    resubmit.push_back(op);
+                }
+                else
+                {
+                    finish(op, EFileReadStatus::COMPLETED);
+                }
+            }
+        }
+        __atomic_store_n(_cqHead, head, __ATOMIC_RELEASE);
+
+        std::lock_guard<std::mutex> lock(_sqMutex);
+        _pending.insert(_pending.begin(), resubmit.begin(), resubmit.end());
+        flushPending();
+    }
+
+    static void finish(ReadOp* op, EFileReadStatus status)
+    {
+        ::close(op->fd);
+        op->batch->Complete(*op->request, status, op->done);
+        delete op;
+    }
+
+    int    _ringFd     = -1;
+    void*  _sqRing     = nullptr;
+    void*  _cqRing     = nullptr;
+    size_t _sqRingSize = 0;
+    size_t _cqRingSize = 0;
+    size_t _sqesSize   = 0;
+    uint32 _sqEntries  = 0;
+    uint32 _cqEntries  = 0;
+
+    uint32*       _sqHead  = nullptr;
+    uint32*       _sqTail  = nullptr;
+    uint32        _sqMask  = 0;
+    uint32*       _sqArray = nullptr;
+    io_uring_sqe* _sqes    = nullptr;
+
+    uint32*       _cqHead = nullptr;
+    uint32*       _cqTail = nullptr;
+    uint32        _cqMask = 0;
+    io_uring_cqe* _cqes   = nullptr;
+
+    std::mutex          _sqMutex;
+    std::mutex          _cqMutex;
+    std::deque<ReadOp*> _pending;
+    std::atomic<uint32> _inflight{0};
+};
+} // namespace
+
+FileReadBackend* FileSystem::createPlatformReadBackend()
+{
+    IoUringFileReadBackend* backend = new IoUringFileReadBackend();
+    if (false == backend->Setup(s_ringEntries))
+    {
+        delete backend;
+        return nullptr;
+    }
+
+    return backend;
+}
+
+HS_NS_END
@@ -0,0 +1,41 @@
+//
+//  LinuxSystemContext.cpp
+//  Platform
+//
+//  Linux system context
+//
+#include "Platform/Linux/LinuxSystemContext.h"
+
+#include "Core/SystemContext.h"
+#include "Core/HAL/FileSystem.h"
+#include "Core/Log.h"
+
+#include <climits>
+#include <unistd.h>
+
+HS_NS_BEGIN
+
+bool SystemContext::initializePlatform()
+{
+    char path[PATH_MAX] = {0};
+    ssize_t length      = readlink("/proc/self/exe", path, sizeof(path) - 1);
+
+    if (length <= 0)
+    {
+        HS_LOG(error, "Fail to resolve executable path from /proc/self/exe");
+        return false;
+    }
+
+    executablePath      = std::string(path, static_cast<size_t>(length));
+    executableDirectory = FileSystem::GetDirectory(executablePath);
+    assetDirectory      = executableDirectory + "Assets" + HS_DIR_SEPERATOR;
+
+    return true;
+}
+
+void SystemContext::finalizePlatform()
+{
+    //...
+}
+
+HS_NS_END
@@ -0,0 +1,482 @@
+//
+//  LinuxWindow.cpp
+//  Platform
+//
+//  Linux native window (X11 optional, headless fallback)
+//
+#include "Platform/Linux/LinuxWindow.h"
+
+#include "Core/HAL/Input.h"
+#include "Core/Log.h"
+
+#include <cstdlib>
+
+#if defined(HS_LINUX_X11)
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/XKBlib.h>
+#include <X11/keysym.h>
+#endif
+
+HS_NS_BEGIN
+
+static NativeWindow* s_boundHsWindow        = nullptr;
+static LinuxWindowHandle s_handle           = {};
+static bool (*s_preEventHandler)(void*)     = nullptr;
+
+namespace
+{
+// HS_HEADLESS=1 이면 디스플레이가 있어도 headless 창을 만든다.
+// HS_HEADLESS_FRAMES=N 이면 N 프레임 후 WINDOW_CLOSE를 보내 벤치마크가 스스로 종료되게 한다.
+bool is_headless_requested()
+{
+    const char* value = std::getenv("HS_HEADLESS");
+    return value != nullptr && value[0] != '\0' && value[0] != '0';
+}
+
+uint32 get_headless_frame_limit()
+{
+    const char* value = std::getenv("HS_HEADLESS_FRAMES");
+    if (value == nullptr)
+    {
+        return 0;
+    }
+
+    return static_cast<uint32>(std::strtoul(value, nullptr, 10));
+}
+
+void fill_native_window(const char* name, uint16 width, uint16 height, EWindowFlags flag, float scale, NativeWindow& outNativeWindow)
+{
+    // 생성 중에 이미 이벤트가 들어왔을 수 있으므로 구조체 전체를 초기화하지 않는다(eventQueue 보존).
+    outNativeWindow.width         = width;
+    outNativeWindow.height        = height;
+    outNativeWindow.surfaceWidth  = width;
+    outNativeWindow.surfaceHeight = height;
+    outNativeWindow.flags         = flag;
+    outNativeWindow.title         = name;
+    outNativeWindow.scale         = scale;
+    outNativeWindow.handle        = &s_handle;
+    outNativeWindow.isMaximized   = false;
+    outNativeWindow.isMinimized   = false;
+    outNativeWindow.resizable     = (flag & EWindowFlags::WINDOW_RESIZABLE) != EWindowFlags::NONE;
+    outNativeWindow.useHDR        = (flag & EWindowFlags::WINDOW_HIGH_PIXEL_DENSITY) != EWindowFlags::NONE;
+}
+
+void reset_frame_input()
+{
+    Input::s_move.isMoved      = 0;
+    Input::s_scroll.isScrolled = 0;
+}
+
+bool create_headless_window(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow)
+{
+    s_handle.display          = nullptr;
+    s_handle.window           = 0;
+    s_handle.isHeadless       = true;
+    s_handle.frameCount       = 0;
+    s_handle.closeAfterFrames = get_headless_frame_limit();
+
+    fill_native_window(name, width, height, flag, 1.0f, outNativeWindow);
+
+    PushNativeEvent(&outNativeWindow, NativeEvent::Type::WINDOW_OPEN);
+
+    HS_LOG(info, "Headless window created. (%ux%u, closeAfterFrames: %u)", width, height, s_handle.closeAfterFrames);
+
+    return true;
+}
+
+void poll_headless_window(NativeWindow& nativeWindow)
+{
+    // PeekNativeEvent가 이벤트마다 폴링하므로 큐가 빈 상태의 폴링만 한 프레임으로 센다.
+    if (false == nativeWindow.eventQueue.IsEmpty())
+    {
+        return;
+    }
+
+    ++s_handle.frameCount;
+
+    if (s_handle.closeAfterFrames != 0 && s_handle.frameCount == s_handle.closeAfterFrames)
+    {
+        PushNativeEvent(&nativeWindow, NativeEvent::Type::WINDOW_CLOSE);
+    }
+}
+
+#if defined(HS_LINUX_X11)
+Atom s_wmDeleteWindow = None;
+
+Input::Button to_input_button(KeySym keySym)
+{
+    if (keySym >= XK_a && keySym <= XK_z)
+    {
+        return static_cast<Input::Button>(static_cast<uint8>(Input::Button::A) + (keySym - XK_a));
+    }
+    if (keySym >= XK_A && keySym <= XK_Z)
+    {
+        return static_cast<Input::Button>(static_cast<uint8>(Input::Button::A) + (keySym - XK_A));
+    }
+    if (keySym >= XK_0 && keySym <= XK_9)
+    {
+        return static_cast<Input::Button>(static_cast<uint8>(Input::Button::NUM_0) + (keySym - XK_0));
+    }
+    if (keySym >= XK_KP_0 && keySym <= XK_KP_9)
+    {
+        return static_cast<Input::Button>(static_cast<uint8>(Input::Button::NUMPAD_0) + (keySym - XK_KP_0));
+    }
+    if (keySym >= XK_F1 && keySym <= XK_F12)
+    {
+        return static_cast<Input::Button>(static_cast<uint8>(Input::Button::F1) + (keySym - XK_F1));
+    }
+
+    switch (keySym)
+    {
+    case XK_BackSpace:    return Input::Button::BACK;
+    case XK_Tab:          return Input::Button::TAB;
+    case XK_Shift_L:
+    case XK_Shift_R:      return Input::Button::SHIFT;
+    case XK_Control_L:
+    case XK_Control_R:    return Input::Button::CONTROL;
+    case XK_Alt_L:
+    case XK_Alt_R:        return Input::Button::ALT;
+    case XK_space:        return Input::Button::SPACE;
+    case XK_End:          return Input::Button::END;
+    case XK_Home:         return Input::Button::HOME;
+    case XK_Left:         return Input::Button::LEFT;
+    case XK_Up:           return Input::Button::UP;
+    case XK_Right:        return Input::Button::RIGHT;
+    case XK_Down:         return Input::Button::DOWN;
+    case XK_Insert:       return Input::Button::INSERT;
+    case XK_Delete:       return Input::Button::DELETE;
+    case XK_Super_L:      return Input::Button::LWIN_OR_COMMAND;
+    case XK_Super_R:      return Input::Button::RWIN;
+    case XK_Menu:         return Input::Button::APPS;
+    case XK_KP_Multiply:  return Input::Button::MULTIPLY;
+    case XK_KP_Add:       return Input::Button::ADD;
+    case XK_KP_Separator: return Input::Button::SEPARATOR;
+    case XK_KP_Subtract:  return Input::Button::SUBTRACT;
+    case XK_KP_Decimal:   return Input::Button::DECIMAL;
+    case XK_KP_Divide:    return Input::Button::DIVIDE;
+    default:
+        return Input::Button::UNKNOWN;
+    }
+}
+
+bool create_x11_window(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow)
+{
+    Display* display = XOpenDisplay(nullptr);
+    if (display == nullptr)
+    {
+        return false;
+    }
+
+    const int screen = DefaultScreen(display);
+    ::Window root    = RootWindow(display, screen);
+
+    XSetWindowAttributes attributes{};
+    attributes.background_pixel = BlackPixel(display, screen);
+    attributes.event_mask       = ExposureMask | StructureNotifyMask | KeyPressMask | KeyReleaseMask |
+                                  ButtonPressMask | ButtonReleaseMask | PointerMotionMask;
+
+    ::Window window = XCreateWindow(display, root, 0, 0, width, height, 0,
+                                    CopyFromParent, InputOutput, CopyFromParent,
+                                    CWBackPixel | CWEventMask, &attributes);
+    if (window == 0)
+    {
+        XCloseDisplay(display);
+        return false;
+    }
+
+    XStoreName(display, window, name);
+
+    s_wmDeleteWindow = XInternAtom(display, "WM_DELETE_WINDOW", False);
+    XSetWMProtocols(display, window, &s_wmDeleteWindow, 1);
+
+    if ((flag & EWindowFlags::WINDOW_RESIZABLE) == EWindowFlags::NONE)
+    {
+        XSizeHints* hints = XAllocSizeHints();
+        hints->flags      = PMinSize | PMaxSize;
+        hints->min_width  = hints->max_width  = width;
+        hints->min_height = hints->max_height = height;
+        XSetWMNormalHints(display, window, hints);
+        XFree(hints);
+    }
+
+    // 키를 누르고 있을 때 Release/Press 쌍 대신 Press만 반복되도록 한다.
+    XkbSetDetectableAutoRepeat(display, True, nullptr);
+
+    const int widthMM = DisplayWidthMM(display, screen);
+    const float scale = widthMM > 0 ? (DisplayWidth(display, screen) * 25.4f / widthMM) / 96.0f : 1.0f;
+
+    s_handle.display          = display;
+    s_handle.window           = static_cast<uint64>(window);
+    s_handle.isHeadless       = false;
+    s_handle.frameCount       = 0;
+    s_handle.closeAfterFrames = 0;
+
+    fill_native_window(name, width, height, flag, scale, outNativeWindow);
+
+    PushNativeEvent(&outNativeWindow, NativeEvent::Type::WINDOW_OPEN);
+
+    return true;
+}
+
+void set_button_state(Input::Button button, bool isPressed)
+{
+    if (button == Input::Button::UNKNOWN)
+    {
+        return;
+    }
+
+    auto& info = Input::s_button[static_cast<uint8>(button)];
+    if (isPressed)
+    {
+        info.repeatCount = info.isPressed ? info.repeatCount + 1 : 1;
+        info.isPressed   = 1;
+    }
+    else
+    {
+        info.isPressed   = 0;
+        info.repeatCount = 0;
+    }
+}
+
+void handle_x11_event(XEvent& event, NativeWindow& nativeWindow)
+{
+    switch (event.type)
+    {
+    case ClientMessage:
+    {
+        if (static_cast<Atom>(event.xclient.data.l[0]) == s_wmDeleteWindow)
+        {
+            PushNativeEvent(&nativeWindow, NativeEvent::Type::WINDOW_CLOSE);
+        }
+        break;
+    }
+    case ConfigureNotify:
+    {
+        const uint16 width  = static_cast<uint16>(event.xconfigure.width);
+        const uint16 height = static_cast<uint16>(event.xconfigure.height);
+        if (width != nativeWindow.surfaceWidth || height != nativeWindow.surfaceHeight)
+        {
+            nativeWindow.width         = width;
+            nativeWindow.height        = height;
+            nativeWindow.surfaceWidth  = width;
+            nativeWindow.surfaceHeight = height;
+
+            PushNativeEvent(&nativeWindow, NativeEvent::Type::WINDOW_RESIZE);
+        }
+        break;
+    }
+    case UnmapNotify:
+    {
+        nativeWindow.isMinimized = true;
+        PushNativeEvent(&nativeWindow, NativeEvent::Type::WINDOW_MINIMIZE);
+        break;
+    }
+    case MapNotify:
+    {
+        if (nativeWindow.isMinimized)
+        {
+            nativeWindow.isMinimized = false;
+            PushNativeEvent(&nativeWindow, NativeEvent::Type::WINDOW_RESTORE);
+        }
+        break;
+    }
+    case KeyPress:
+    case KeyRelease:
+    {
+        const KeySym keySym = XLookupKeysym(&event.xkey, 0);
+        set_button_state(to_input_button(keySym), event.type == KeyPress);
+        break;
+    }
+    case ButtonPress:
+    case ButtonRelease:
+    {
+        const bool isPressed = (event.type == ButtonPress);
+        switch (event.xbutton.button)
+        {
+        case Button1: set_button_state(Input::Button::MOUSE_LEFT, isPressed); break;
+        case Button2: set_button_state(Input::Button::MOUSE_MIDDLE, isPressed); break;
+        case Button3: set_button_state(Input::Button::MOUSE_RIGHT, isPressed); break;
+        case Button4:
+        case Button5:
+        {
+            // WHEEL_DELTA(120)와 같은 단위로 맞춘다.
+            if (isPressed)
+            {
+                Input::s_scroll.vOffset    = event.xbutton.button == Button4 ? 120 : -120;
+                Input::s_scroll.isScrolled = 1;
+            }
+            break;
+        }
+        case 6:
+        case 7:
+        {
+            if (isPressed)
+            {
+                Input::s_scroll.hOffset    = event.xbutton.button == 7 ? 120 : -120;
+                Input::s_scroll.isScrolled = 1;
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        break;
+    }
+    case MotionNotify:
+    {
+        Input::s_move.xPoint  = static_cast<uint16>(event.xmotion.x);
+        Input::s_move.yPoint  = static_cast<uint16>(event.xmotion.y);
+        Input::s_move.isMoved = 1;
+        break;
+    }
+    default:
+        break;
+    }
+}
+#endif
+} // namespace
+
+bool CreateNativeWindowInternal(const char* name, uint16 width, uint16 height, EWindowFlags flag, NativeWindow& outNativeWindow)
+{
+    s_boundHsWindow = &outNativeWindow;
+
+#if defined(HS_LINUX_X11)
+    if (false == is_headless_requested())
+    {
+        if (create_x11_window(name, width, height, flag, outNativeWindow))
+        {
+            return true;
+        }
+
+        HS_LOG(warning, "Fail to open X11 display. Fallback to headless window.");
+    }
+#else
+    if (false == is_headless_requested())
+    {
+        HS_LOG(info, "Built without a windowing system. Fallback to headless window.");
+    }
+#endif
+
+    return create_headless_window(name, width, height, flag, outNativeWindow);
+}
+
+void DestroyNativeWindowInternal(NativeWindow& nativeWindow)
+{
+#if defined(HS_LINUX_X11)
+    if (false == s_handle.isHeadless && s_handle.display)
+    {
+        Display* display = static_cast<Display*>(s_handle.display);
+        XDestroyWindow(display, static_cast<::Window>(s_handle.window));
+        XCloseDisplay(display);
+    }
+#endif
+
+    s_handle = {};
+
+    if (s_boundHsWindow == &nativeWindow)
+    {
+        s_boundHsWindow = nullptr;
+    }
+}
+
+void ShowNativeWindowInternal(const NativeWindow& nativeWindow)
+{
+#if defined(HS_LINUX_X11)
+    if (false == s_handle.isHeadless)
+    {
+        Display* display = static_cast<Display*>(s_handle.display);
+        XMapWindow(display, static_cast<::Window>(s_handle.window));
+        XFlush(display);
+    }
+#endif
+}
+
+void PollNativeEventInternal(NativeWindow& nativeWindow)
+{
+    // Reset per-frame input states
+    reset_frame_input();
+
+    s_boundHsWindow = &nativeWindow;
+
+    if (s_handle.isHeadless)
+    {
+        poll_headless_window(nativeWindow);
+        return;
+    }
+
+#if defined(HS_LINUX_X11)
+    Display* display = static_cast<Display*>(s_handle.display);
+    while (XPending(display) > 0)
+    {
+        XEvent event;
+        XNextEvent(display, &event);
+
+        if (s_preEventHandler && s_preEventHandler(&event))
+        {
+            continue;
+        }
+
+        handle_x11_event(event, nativeWindow);
+    }
+#endif
+}
+
+void SetNativeWindowSizeInternal(uint16 width, uint16 height)
+{
+    if (s_boundHsWindow == nullptr)
+    {
+        return;
+    }
+
+    if (s_handle.isHeadless)
+    {
+        if (width == s_boundHsWindow->surfaceWidth && height == s_boundHsWindow->surfaceHeight)
+        {
+            return;
+        }
+
+        s_boundHsWindow->width         = width;
+        s_boundHsWindow->height        = height;
+        s_boundHsWindow->surfaceWidth  = width;
+        s_boundHsWindow->surfaceHeight = height;
+
+        PushNativeEvent(s_boundHsWindow, NativeEvent::Type::WINDOW_RESIZE);
+        return;
+    }
+
+#if defined(HS_LINUX_X11)
+    // 실제 크기는 ConfigureNotify에서 갱신된다.
+    Display* display = static_cast<Display*>(s_handle.display);
+    XResizeWindow(display, static_cast<::Window>(s_handle.window), width, height);
+    XFlush(display);
+#endif
+}
+
+void GetNativeWindowSizeInternal(uint16& outWidth, uint16& outHeight)
+{
+    if (s_boundHsWindow == nullptr)
+    {
+        outWidth  = 0;
+        outHeight = 0;
+        return;
+    }
+
+    outWidth  = s_boundHsWindow->surfaceWidth;
+    outHeight = s_boundHsWindow->surfaceHeight;
+}
+
+bool IsNativeWindowHeadless(const NativeWindow& nativeWindow)
+{
+    const LinuxWindowHandle* handle = static_cast<const LinuxWindowHandle*>(nativeWindow.handle);
+
+    return handle == nullptr || handle->isHeadless;
+}
+
+void SetNativePreEventHandler(void* fnHandler)
+{
+    // X11 빌드에서 fnHandler는 bool(*)(XEvent*) 이다. headless 창에는 OS 이벤트가 없으므로 호출되지 않는다.
+    s_preEventHandler = reinterpret_cast<bool (*)(void*)>(fnHandler);
+}
+
+HS_NS_END
@@ -6,7 +6,10 @@
 #include <cstddef>
 #include <string>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include <Foundation/Foundation.h>
 #include <Cocoa/Cocoa.h>
@@ -267,6 +270,73 @@ size_t FileSystem::GetSize(FileHandle fileHandle)
     }
 }
 
+bool FileSystem::MapFile(const std::string& absolutePath, EFileAccessPattern pattern, MappedFile& outMappedFile)
+{
+    outMappedFile = MappedFile{};
+
+    int fd = ::open(absolutePath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0)
+    {
+        ::close(fd);
+        return true;
+    }
+
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+
+    switch (pattern)
+    {
+        case EFileAccessPattern::SEQUENTIAL:
+            ::madvise(data, size, MADV_SEQUENTIAL);
+            ::madvise(data, size, MADV_WILLNEED);
+            break;
+        case EFileAccessPattern::RANDOM:
+            ::madvise(data, size, MADV_RANDOM);
+            break;
+        default:
+            break;
+    }
+
+    outMappedFile.data = static_cast<const uint8*>(data);
+    outMappedFile.size = size;
+
+    return true;
+}
+
+void FileSystem::UnmapFile(MappedFile& mappedFile)
+{
+    if (nullptr != mappedFile.data)
+    {
+        ::munmap(const_cast<uint8*>(mappedFile.data), mappedFile.size);
+    }
+
+    mappedFile = MappedFile{};
+}
+
+// 전용 백엔드 없이 Core의 IO 스레드 풀(포터블 백엔드)을 사용한다.
+FileReadBackend* FileSystem::createPlatformReadBackend()
+{
+    return nullptr;
+}
+
 // 디렉토리 경로 얻기 함수
 std::string FileSystem::GetDirectory(const std::string& absolutePath)
 {
@@ -314,6 +314,85 @@ size_t FileSystem::GetSize(FileHandle fileHandle)
     return static_cast<size_t>(fileSize.QuadPart);
 }
 
+// 파일 매핑 함수
+bool FileSystem::MapFile(const std::string& absolutePath, EFileAccessPattern pattern, MappedFile& outMappedFile)
+{
+    outMappedFile = MappedFile{};
+
+    std::wstring pathW = FileSystem::Utf8ToUtf16(absolutePath);
+    if (pathW.empty())
+    {
+        return false;
+    }
+
+    // Windows는 madvise 대신 파일을 열 때 캐시 관리자에 접근 패턴을 알려준다.
+    DWORD flagsAndAttributes = FILE_ATTRIBUTE_NORMAL;
+    if (pattern == EFileAccessPattern::SEQUENTIAL)
+    {
+        flagsAndAttributes |= FILE_FLAG_SEQUENTIAL_SCAN;
+    }
+    else if (pattern == EFileAccessPattern::RANDOM)
+    {
+        flagsAndAttributes |= FILE_FLAG_RANDOM_ACCESS;
+    }
+
+    HANDLE file = CreateFileW(pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flagsAndAttributes, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    if (fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return true;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+    {
+        return false;
+    }
+
+    // 뷰가 매핑 객체를 참조하므로 핸들은 바로 닫아도 된다.
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    outMappedFile.data = static_cast<const uint8*>(data);
+    outMappedFile.size = static_cast<size_t>(fileSize.QuadPart);
+
+    return true;
+}
+
+// 파일 매핑 해제 함수
+void FileSystem::UnmapFile(MappedFile& mappedFile)
+{
+    if (nullptr != mappedFile.data)
+    {
+        UnmapViewOfFile(mappedFile.data);
+    }
+
+    mappedFile = MappedFile{};
+}
+
+// 전용 백엔드 없이 Core의 IO 스레드 풀(포터블 백엔드)을 사용한다.
+FileReadBackend* FileSystem::createPlatformReadBackend()
+{
+    return nullptr;
+}
+
 // 디렉토리 경로 얻기 함수
 std::string FileSystem::GetDirectory(const std::string& absolutePath)
 {
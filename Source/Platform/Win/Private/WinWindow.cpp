@@ -256,7 +256,7 @@ bool CreateNativeWindowInternal(const char* name, uint16 width, uint16 height, E
     {
         assert(false);
     }
-    outNativeWindow               = {};
+    // WM_CREATE에서 이미 이벤트가 들어왔을 수 있으므로 구조체 전체를 초기화하지 않는다(eventQueue 보존).
     outNativeWindow.width         = width;
     outNativeWindow.height        = height;
     outNativeWindow.surfaceWidth  = surfaceRect.right - surfaceRect.left;
@@ -0,0 +1,72 @@
+//
+//  NeonSimd.h
+//  Platform
+//
+//  NEON register wrappers used by Core/HAL/Simd.h
+//
+#ifndef __HS_NEON_SIMD_H__
+#define __HS_NEON_SIMD_H__
+
+#include "Precompile.h"
+
+#include <arm_neon.h>
+
+HS_NS_BEGIN
+
+namespace simd
+{
+using Float4 = float32x4_t;
+
+HS_FORCEINLINE Float4 Load4(const float* p) { return vld1q_f32(p); }
+HS_FORCEINLINE void   Store4(float* p, Float4 v) { vst1q_f32(p, v); }
+HS_FORCEINLINE Float4 Set4(float x, float y, float z, float w)
+{
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+}
+HS_FORCEINLINE Float4 Splat4(float value) { return vdupq_n_f32(value); }
+
+HS_FORCEINLINE Float4 SplatX(Float4 v) { return vdupq_laneq_f32(v, 0); }
+HS_FORCEINLINE Float4 SplatY(Float4 v) { return vdupq_laneq_f32(v, 1); }
+HS_FORCEINLINE Float4 SplatZ(Float4 v) { return vdupq_laneq_f32(v, 2); }
+HS_FORCEINLINE Float4 SplatW(Float4 v) { return vdupq_laneq_f32(v, 3); }
+HS_FORCEINLINE float  GetX(Float4 v) { return vgetq_lane_f32(v, 0); }
+
+HS_FORCEINLINE Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+HS_FORCEINLINE Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+HS_FORCEINLINE Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+HS_FORCEINLINE Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+HS_FORCEINLINE Float4 Sqrt(Float4 v) { return vsqrtq_f32(v); }
+HS_FORCEINLINE Float4 Min(Float4 a, Float4 b) { return vminq_f32(a, b); }
+HS_FORCEINLINE Float4 Max(Float4 a, Float4 b) { return vmaxq_f32(a, b); }
+HS_FORCEINLINE Float4 Abs(Float4 v) { return vabsq_f32(v); }
+HS_FORCEINLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return vfmaq_f32(c, a, b); }
+
+HS_FORCEINLINE Float4 CmpLt(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+HS_FORCEINLINE Float4 CmpGt(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+HS_FORCEINLINE Float4 And(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+HS_FORCEINLINE Float4 Or(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+HS_FORCEINLINE Float4 Select(Float4 mask, Float4 a, Float4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+
+// SSE movemask와 같이 lane i의 부호 비트를 i번째 비트로 모은다.
+HS_FORCEINLINE uint32 MoveMask(Float4 mask)
+{
+    static const int32 shifts[4] = {0, 1, 2, 3};
+    const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask), 31), vld1q_s32(shifts));
+    return vaddvq_u32(bits);
+}
+
+HS_FORCEINLINE float HorizontalMin(Float4 v) { return vminvq_f32(v); }
+HS_FORCEINLINE float HorizontalMax(Float4 v) { return vmaxvq_f32(v); }
+
+using FloatN                = Float4;
+constexpr uint32 SIMD_WIDTH = 4;
+
+HS_FORCEINLINE FloatN LoadN(const float* p) { return Load4(p); }
+HS_FORCEINLINE void   StoreN(float* p, FloatN v) { Store4(p, v); }
+HS_FORCEINLINE FloatN SplatN(float value) { return Splat4(value); }
+} // namespace simd
+
+HS_NS_END
+
+#endif /* __HS_NEON_SIMD_H__ */
@@ -0,0 +1,26 @@
+//
+//  NeonSimd.cpp
+//  Platform
+//
+//  CPU feature check for the arm64 SIMD build
+//
+#include "Core/HAL/Simd.h"
+
+HS_NS_BEGIN
+
+const char* Simd::GetInstructionSetName()
+{
+#if HS_SIMD_NEON
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+// AArch64는 NEON(Advanced SIMD)이 필수이다.
+bool Simd::IsSupported()
+{
+    return true;
+}
+
+HS_NS_END
@@ -0,0 +1,101 @@
+//
+//  SSESimd.cpp
+//  Platform
+//
+//  CPU feature check for the x64 SIMD build
+//
+#include "Core/HAL/Simd.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+HS_NS_BEGIN
+
+namespace
+{
+void cpuid(uint32 leaf, uint32 subLeaf, uint32 out[4])
+{
+#if defined(_MSC_VER)
+    int registers[4];
+    __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subLeaf));
+    for (int i = 0; i < 4; i++)
+    {
+        out[i] = static_cast<uint32>(registers[i]);
+    }
+#else
+    __cpuid_count(leaf, subLeaf, out[0], out[1], out[2], out[3]);
+#endif
+}
+
+// AVX 레지스터 상태를 OS가 저장해 주는지 (XCR0의 XMM, YMM 비트)
+bool is_avx_state_enabled()
+{
+#if defined(_MSC_VER)
+    return (_xgetbv(0) & 0x6) == 0x6;
+#else
+    uint32 eax = 0;
+    uint32 edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (eax & 0x6) == 0x6;
+#endif
+}
+} // namespace
+
+const char* Simd::GetInstructionSetName()
+{
+#if HS_SIMD_SCALAR
+    return "Scalar";
+#elif HS_SIMD_AVX2
+    return "AVX2";
+#elif defined(__SSE4_1__) || defined(__AVX__)
+    return "SSE4.1";
+#else
+    return "SSE2";
+#endif
+}
+
+bool Simd::IsSupported()
+{
+    uint32 leaf1[4];
+    cpuid(1, 0, leaf1);
+
+    const bool hasSSE41 = (leaf1[2] & (1u << 19)) != 0;
+    const bool hasFMA   = (leaf1[2] & (1u << 12)) != 0;
+    const bool hasAVX   = (leaf1[2] & (1u << 28)) != 0 && (leaf1[2] & (1u << 27)) != 0 && is_avx_state_enabled();
+
+    uint32 leaf0[4];
+    cpuid(0, 0, leaf0);
+
+    uint32 leaf7[4] = {};
+    if (leaf0[0] >= 7)
+    {
+        cpuid(7, 0, leaf7);
+    }
+    const bool hasAVX2 = (leaf7[1] & (1u << 5)) != 0;
+
+#if HS_SIMD_SCALAR
+    (void)hasSSE41;
+    (void)hasFMA;
+    (void)hasAVX;
+    (void)hasAVX2;
+    return true;
+#elif HS_SIMD_AVX2
+    return hasSSE41 && hasAVX && hasAVX2 && hasFMA;
+#elif defined(__SSE4_1__) || defined(__AVX__)
+    (void)hasFMA;
+    (void)hasAVX;
+    (void)hasAVX2;
+    return hasSSE41;
+#else
+    (void)hasSSE41;
+    (void)hasFMA;
+    (void)hasAVX;
+    (void)hasAVX2;
+    return true;
+#endif
+}
+
+HS_NS_END
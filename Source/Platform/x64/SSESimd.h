@@ -0,0 +1,135 @@
+//
+//  SSESimd.h
+//  Platform
+//
+//  SSE/AVX2 register wrappers used by Core/HAL/Simd.h
+//
+#ifndef __HS_SSE_SIMD_H__
+#define __HS_SSE_SIMD_H__
+
+#include "Precompile.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#if defined(__SSE4_1__) || defined(__AVX__)
+#include <smmintrin.h>
+#endif
+#endif
+
+HS_NS_BEGIN
+
+namespace simd
+{
+using Float4 = __m128;
+
+HS_FORCEINLINE Float4 Load4(const float* p) { return _mm_loadu_ps(p); }
+HS_FORCEINLINE void   Store4(float* p, Float4 v) { _mm_storeu_ps(p, v); }
+HS_FORCEINLINE Float4 Set4(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+HS_FORCEINLINE Float4 Splat4(float value) { return _mm_set1_ps(value); }
+
+HS_FORCEINLINE Float4 SplatX(Float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)); }
+HS_FORCEINLINE Float4 SplatY(Float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)); }
+HS_FORCEINLINE Float4 SplatZ(Float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)); }
+HS_FORCEINLINE Float4 SplatW(Float4 v) { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+HS_FORCEINLINE float  GetX(Float4 v) { return _mm_cvtss_f32(v); }
+
+HS_FORCEINLINE Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+HS_FORCEINLINE Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+HS_FORCEINLINE Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+HS_FORCEINLINE Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+HS_FORCEINLINE Float4 Sqrt(Float4 v) { return _mm_sqrt_ps(v); }
+HS_FORCEINLINE Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+HS_FORCEINLINE Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+HS_FORCEINLINE Float4 Abs(Float4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+
+// a * b + c. FMA가 있으면 한 번만 반올림하므로 스칼라 결과와 마지막 비트가 다를 수 있다.
+HS_FORCEINLINE Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+{
+#if defined(__FMA__)
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+HS_FORCEINLINE Float4 CmpLt(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+HS_FORCEINLINE Float4 CmpGt(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+HS_FORCEINLINE Float4 And(Float4 a, Float4 b) { return _mm_and_ps(a, b); }
+HS_FORCEINLINE Float4 Or(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+HS_FORCEINLINE uint32 MoveMask(Float4 mask) { return static_cast<uint32>(_mm_movemask_ps(mask)); }
+
+// mask 비트가 켜진 lane은 a, 아니면 b
+HS_FORCEINLINE Float4 Select(Float4 mask, Float4 a, Float4 b)
+{
+#if defined(__SSE4_1__) || defined(__AVX__)
+    return _mm_blendv_ps(b, a, mask);
+#else
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#endif
+}
+
+HS_FORCEINLINE float HorizontalMin(Float4 v)
+{
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(v);
+}
+
+HS_FORCEINLINE float HorizontalMax(Float4 v)
+{
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    return _mm_cvtss_f32(v);
+}
+
+#if defined(__AVX2__)
+// SoA 커널은 한 번에 8개씩 처리한다.
+using FloatN                 = __m256;
+constexpr uint32 SIMD_WIDTH  = 8;
+
+HS_FORCEINLINE FloatN LoadN(const float* p) { return _mm256_loadu_ps(p); }
+HS_FORCEINLINE void   StoreN(float* p, FloatN v) { _mm256_storeu_ps(p, v); }
+HS_FORCEINLINE FloatN SplatN(float value) { return _mm256_set1_ps(value); }
+
+HS_FORCEINLINE FloatN Add(FloatN a, FloatN b) { return _mm256_add_ps(a, b); }
+HS_FORCEINLINE FloatN Sub(FloatN a, FloatN b) { return _mm256_sub_ps(a, b); }
+HS_FORCEINLINE FloatN Mul(FloatN a, FloatN b) { return _mm256_mul_ps(a, b); }
+HS_FORCEINLINE FloatN Div(FloatN a, FloatN b) { return _mm256_div_ps(a, b); }
+HS_FORCEINLINE FloatN Sqrt(FloatN v) { return _mm256_sqrt_ps(v); }
+HS_FORCEINLINE FloatN Min(FloatN a, FloatN b) { return _mm256_min_ps(a, b); }
+HS_FORCEINLINE FloatN Max(FloatN a, FloatN b) { return _mm256_max_ps(a, b); }
+HS_FORCEINLINE FloatN Abs(FloatN v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+
+HS_FORCEINLINE FloatN MulAdd(FloatN a, FloatN b, FloatN c)
+{
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+HS_FORCEINLINE FloatN CmpLt(FloatN a, FloatN b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+HS_FORCEINLINE FloatN CmpGt(FloatN a, FloatN b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+HS_FORCEINLINE FloatN And(FloatN a, FloatN b) { return _mm256_and_ps(a, b); }
+HS_FORCEINLINE FloatN Or(FloatN a, FloatN b) { return _mm256_or_ps(a, b); }
+HS_FORCEINLINE uint32 MoveMask(FloatN mask) { return static_cast<uint32>(_mm256_movemask_ps(mask)); }
+HS_FORCEINLINE FloatN Select(FloatN mask, FloatN a, FloatN b) { return _mm256_blendv_ps(b, a, mask); }
+
+HS_FORCEINLINE float HorizontalMin(FloatN v) { return HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1))); }
+HS_FORCEINLINE float HorizontalMax(FloatN v) { return HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1))); }
+#else
+using FloatN                 = Float4;
+constexpr uint32 SIMD_WIDTH  = 4;
+
+HS_FORCEINLINE FloatN LoadN(const float* p) { return Load4(p); }
+HS_FORCEINLINE void   StoreN(float* p, FloatN v) { Store4(p, v); }
+HS_FORCEINLINE FloatN SplatN(float value) { return Splat4(value); }
+#endif
+} // namespace simd
+
+HS_NS_END
+
+#endif /* __HS_SSE_SIMD_H__ */
@@ -40,10 +40,10 @@ typedef int64_t int64;
 typedef uint64_t uint64;
 
 #ifndef HS_DEBUG_BREAK
-#if defined(__APPLE__)
-#define HS_DEBUG_BREAK() __builtin_trap()
-#else
+#if defined(_MSC_VER)
 #define HS_DEBUG_BREAK() __debugbreak()
+#else
+#define HS_DEBUG_BREAK() __builtin_trap()
 #endif
 #endif
 
@@ -66,7 +66,7 @@ typedef uint64_t uint64;
 #endif
 #endif
 
-#if defined(__APPLE__)
+#if defined(__APPLE__) || defined(__LINUX__)
 
 #if defined(HS_API_EXPORT)
 #define HS_API __attribute__((__visibility__("default")))
@@ -99,10 +99,10 @@ typedef uint64_t uint64;
 #endif
 #endif
 
-#if defined(__APPLE__)
-#define HS_DIR_SEPERATOR '/'
-#else
+#if defined(_WIN32)
 #define HS_DIR_SEPERATOR '\\'
+#else
+#define HS_DIR_SEPERATOR '/'
 #endif
 
 #define HS_CHAR_INIT_LENGTH       512
@@ -114,6 +114,8 @@ typedef uint64_t uint64;
 
 #define HS_BIT(x) ((uint64)1 << (x))
 
+#define HS_CACHE_LINE_SIZE 64
+
 #define HS_INT8_MAX   (0x0f)
 #define HS_UINT8_MAX  (0xff)
 #define HS_INT16_MAX  (0x0fff)
@@ -123,7 +125,7 @@ typedef uint64_t uint64;
 #define HS_INT64_MAX  (0x0fffffffffffffff)
 #define HS_UINT64_MAX (0xffffffffffffffff)
 
-#if defined(__APPLE__)
+#if defined(__APPLE__) || defined(__GNUC__)
 #define HS_FORCEINLINE   inline __attribute__((always_inline))
 #define HS_FORCENOINLINE __attribute__((noinline))
 #elif defined(_MSC_VER)
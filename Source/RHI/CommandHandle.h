@@ -18,6 +18,7 @@ class RHIFramebuffer;
 class RHIGraphicsPipeline;
 class RHIComputePipeline;
 class RHIResourceSet;
+class RHIQueryPool;
 
 class HS_API RHICommandQueue : public RHIHandle
 {
@@ -72,6 +73,12 @@ public:
     virtual void PushDebugMark(const char* label, float color[4]) = 0;
     virtual void PopDebugMark() = 0;
 
+    // Queries. Reset/Begin/End는 렌더 패스 밖에서 호출해야 하며, Begin과 End는 같은 커맨드 버퍼에 기록해야 한다.
+    virtual void ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount) = 0;
+    virtual void WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex) = 0;
+    virtual void BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex) = 0;
+    virtual void EndQuery(RHIQueryPool* queryPool, uint32 queryIndex) = 0;
+
 protected:
     RHICommandBuffer(const char* name);
     bool _isBegan = false;
@@ -73,6 +73,11 @@ public:
     void PushDebugMark(const char* label, float color[4]) override;
     void PopDebugMark() override;
 
+    void ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount) override;
+    void WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex) override;
+    void BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+    void EndQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+
     id<MTLCommandBuffer>        handle;
     id<MTLRenderCommandEncoder> curRenderEncoder;
     id<MTLComputeCommandEncoder> curComputeEncoder;
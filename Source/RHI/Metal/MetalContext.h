@@ -73,6 +73,14 @@ public:
     RHICommandBuffer* CreateCommandBuffer(const char* name) override;
     void           DestroyCommandBuffer(RHICommandBuffer* cmdBuffer) override;
 
+    RHIQueryPool* CreateQueryPool(const char* name, const QueryPoolInfo& info) override;
+    void          DestroyQueryPool(RHIQueryPool* queryPool) override;
+
+    bool GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize) override;
+
+    double GetTimestampPeriod() const override;
+    bool   IsPipelineStatisticsSupported() const override;
+
     void Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount) override;
 
     void Present(Swapchain* swapchain) override;
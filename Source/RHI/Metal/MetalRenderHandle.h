@@ -48,6 +48,13 @@ struct MetalComputePipeline : public RHIComputePipeline
     id<MTLComputePipelineState> pipelineState;
 };
 
+// Metal 백엔드는 쿼리를 지원하지 않으므로 핸들만 있다. (MetalContext::GetTimestampPeriod가 0)
+struct MetalQueryPool : public RHIQueryPool
+{
+    MetalQueryPool(const char* name, const QueryPoolInfo& info);
+    ~MetalQueryPool() override;
+};
+
 HS_NS_END
 
 
@@ -234,11 +234,13 @@ void MetalCommandBuffer::DrawIndexed(const uint32 firstIndex, const uint32 index
 {
     MTLPrimitiveType primType = MetalUtility::ToPrimitiveTopology(curBindPipeline->info.inputAssemblyDesc.primitiveTopology);
 
+    const bool isUInt16 = curBindIndexBuffer->info.indexFormat == EIndexFormat::UINT16;
+
     [curRenderEncoder drawIndexedPrimitives:primType
                                  indexCount:indexCount
-                                  indexType:MTLIndexTypeUInt32
+                                  indexType:isUInt16 ? MTLIndexTypeUInt16 : MTLIndexTypeUInt32
                                 indexBuffer:curBindIndexBuffer->handle
-                          indexBufferOffset:firstIndex
+                          indexBufferOffset:firstIndex * (isUInt16 ? sizeof(uint16) : sizeof(uint32))
                               instanceCount:instanceCount
                                  baseVertex:vertexOffset
                                baseInstance:0];
@@ -402,6 +404,23 @@ void MetalCommandBuffer::PopDebugMark()
     [curRenderEncoder popDebugGroup];
 }
 
+// Metal 백엔드는 쿼리를 지원하지 않는다. (GetTimestampPeriod가 0) 기록 호출은 아무것도 하지 않는다.
+void MetalCommandBuffer::ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount)
+{
+}
+
+void MetalCommandBuffer::WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+}
+
+void MetalCommandBuffer::BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+}
+
+void MetalCommandBuffer::EndQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+}
+
 void MetalCommandBuffer::bindBuffers(EShaderStage stage, uint8 binding, RHIBuffer* const* buffers, const uint32* offsets, uint8 arrayCount)
 {
     MetalBuffer* const* MetalBuffers = reinterpret_cast<MetalBuffer* const*>(buffers);
@@ -146,9 +146,11 @@ RHIGraphicsPipeline* MetalContext::CreateGraphicsPipeline(const char* name, cons
     {
         const auto& curAttribute = info.vertexInputDesc.attributes[i];
 
-        vertexDesc.attributes[i].offset      = curAttribute.offset;
-        vertexDesc.attributes[i].bufferIndex = curAttribute.binding;
-        vertexDesc.attributes[i].format      = MetalUtility::ToVertexFormat(curAttribute.format);
+        // Vulkan과 같이 location이 셰이더의 attribute 번호다. 빠진 속성이 있어도 번호가 밀리지 않는다.
+        const NSUInteger index = curAttribute.location;
+        vertexDesc.attributes[index].offset      = curAttribute.offset;
+        vertexDesc.attributes[index].bufferIndex = curAttribute.binding;
+        vertexDesc.attributes[index].format      = MetalUtility::ToVertexFormat(curAttribute.format);
     }
 
     for (size_t i = 0; i < info.vertexInputDesc.layouts.size(); i++)
@@ -367,7 +369,9 @@ RHIBuffer* MetalContext::CreateBuffer(const char* name, const void* data, size_t
 {
     MetalBuffer* MetalBuffer = new struct MetalBuffer(name, info);
 
-    id<MTLBuffer> mtlBuffer = [s_device newBufferWithBytes:data length:dataSize options:MetalUtility::ToBufferOption(info.memoryOption)];
+    const MTLResourceOptions options = MetalUtility::ToBufferOption(info.memoryOption);
+    id<MTLBuffer> mtlBuffer = (nullptr != data) ? [s_device newBufferWithBytes:data length:dataSize options:options]
+                                                : [s_device newBufferWithLength:dataSize options:options];
 
     if (nil == mtlBuffer)
     {
@@ -376,6 +380,13 @@ RHIBuffer* MetalContext::CreateBuffer(const char* name, const void* data, size_t
 
     MetalBuffer->handle = mtlBuffer;
 
+    // Shared 메모리만 바로 쓸 수 있다. Managed는 didModifyRange가 필요해서 byte를 열지 않는다.
+    if (info.memoryOption == EBufferMemoryOption::DYNAMIC)
+    {
+        MetalBuffer->byte     = [mtlBuffer contents];
+        MetalBuffer->byteSize = dataSize;
+    }
+
     return static_cast<RHIBuffer*>(MetalBuffer);
 }
 
@@ -525,6 +536,36 @@ void MetalContext::DestroyCommandBuffer(RHICommandBuffer* cmdBuffer)
     delete cmdMetalBuffer;
 }
 
+RHIQueryPool* MetalContext::CreateQueryPool(const char* name, const QueryPoolInfo& info)
+{
+    MetalQueryPool* queryPool = new MetalQueryPool(name, info);
+
+    return static_cast<RHIQueryPool*>(queryPool);
+}
+
+void MetalContext::DestroyQueryPool(RHIQueryPool* queryPool)
+{
+    MetalQueryPool* queryPoolMetal = static_cast<MetalQueryPool*>(queryPool);
+
+    delete queryPoolMetal;
+}
+
+bool MetalContext::GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize)
+{
+    return false;
+}
+
+double MetalContext::GetTimestampPeriod() const
+{
+    // 타임스탬프 쿼리 미지원. GPUProfiler는 이 값을 보고 스스로 꺼진다.
+    return 0.0;
+}
+
+bool MetalContext::IsPipelineStatisticsSupported() const
+{
+    return false;
+}
+
 void MetalContext::Submit(Swapchain* swapchain, RHICommandBuffer** cmdBuffers, size_t bufferCount)
 {
     //...
@@ -40,4 +40,13 @@ MetalComputePipeline::~MetalComputePipeline()
 {
 }
 
+MetalQueryPool::MetalQueryPool(const char* name, const QueryPoolInfo& info)
+    : RHIQueryPool(name, info)
+{
+}
+
+MetalQueryPool::~MetalQueryPool()
+{
+}
+
 HS_NS_END
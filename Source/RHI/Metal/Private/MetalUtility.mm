@@ -71,6 +71,12 @@ MTLVertexFormat MetalUtility::ToVertexFormat(EVertexFormat format)
         case EVertexFormat::HALF2:  return MTLVertexFormatHalf2;
         case EVertexFormat::HALF3:  return MTLVertexFormatHalf3;
         case EVertexFormat::HALF4:  return MTLVertexFormatHalf4;
+        case EVertexFormat::SHORT2_NORM:  return MTLVertexFormatShort2Normalized;
+        case EVertexFormat::SHORT4_NORM:  return MTLVertexFormatShort4Normalized;
+        case EVertexFormat::USHORT2_NORM: return MTLVertexFormatUShort2Normalized;
+        case EVertexFormat::USHORT4_NORM: return MTLVertexFormatUShort4Normalized;
+        case EVertexFormat::CHAR4_NORM:   return MTLVertexFormatChar4Normalized;
+        case EVertexFormat::UCHAR4_NORM:  return MTLVertexFormatUChar4Normalized;
      
         default:                    break;
     }
@@ -92,6 +98,12 @@ EVertexFormat MetalUtility::FromVertexFormat(MTLVertexFormat format)
         case MTLVertexFormatHalf2:  return EVertexFormat::HALF2;
         case MTLVertexFormatHalf3:  return EVertexFormat::HALF3;
         case MTLVertexFormatHalf4:  return EVertexFormat::HALF4;
+        case MTLVertexFormatShort2Normalized:  return EVertexFormat::SHORT2_NORM;
+        case MTLVertexFormatShort4Normalized:  return EVertexFormat::SHORT4_NORM;
+        case MTLVertexFormatUShort2Normalized: return EVertexFormat::USHORT2_NORM;
+        case MTLVertexFormatUShort4Normalized: return EVertexFormat::USHORT4_NORM;
+        case MTLVertexFormatChar4Normalized:   return EVertexFormat::CHAR4_NORM;
+        case MTLVertexFormatUChar4Normalized:  return EVertexFormat::UCHAR4_NORM;
 
         default:                    break;
     }
@@ -1,10 +1,11 @@
 ﻿#include "RHI/RHIContext.h"
 
-#ifdef __WINDOWS__
-#include "RHI/Vulkan/VulkanContext.h"
-#else
+#ifdef __APPLE__
 #include "RHI/Metal/MetalContext.h"
+#else
+#include "RHI/Vulkan/VulkanContext.h"
 #endif
+#include "RHI/Virtual/VirtualContext.h"
 
 HS_NS_BEGIN
 
@@ -19,7 +20,7 @@ RHIContext* RHIContext::Create(ERHIPlatform platform)
 
 	switch (platform)
 	{
-#if defined(__WINDOWS__)
+#if defined(__WINDOWS__) || defined(__LINUX__)
 	case ERHIPlatform::VULKAN:
 	{
 		g_rhiContext = new VulkanContext();
@@ -32,6 +33,11 @@ RHIContext* RHIContext::Create(ERHIPlatform platform)
 	}
 	break;
 #endif
+	case ERHIPlatform::VIRTUAL:
+	{
+		g_rhiContext = new VirtualContext();
+	}
+	break;
 	default:
 		HS_LOG(crash, "Unsupported RHI");
 	}
@@ -51,4 +57,16 @@ RHIContext* RHIContext::Get()
 	return g_rhiContext;
 }
 
+void RHIContext::Destroy()
+{
+	if (nullptr == g_rhiContext)
+	{
+		return;
+	}
+
+	g_rhiContext->Finalize();
+	delete g_rhiContext;
+	g_rhiContext = nullptr;
+}
+
 HS_NS_END
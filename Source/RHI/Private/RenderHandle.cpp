@@ -34,4 +34,12 @@ RHIComputePipeline::RHIComputePipeline(const char* name, const ComputePipelineIn
 RHIComputePipeline::~RHIComputePipeline()
 {}
 
+RHIQueryPool::RHIQueryPool(const char* name, const QueryPoolInfo& info)
+    : RHIHandle(EType::QUERY_POOL, name)
+    , info(info)
+{}
+
+RHIQueryPool::~RHIQueryPool()
+{}
+
 HS_NS_END
@@ -36,6 +36,8 @@ RHIShader::~RHIShader()
 RHIBuffer::RHIBuffer(const char* name, const BufferInfo& info)
     : RHIHandle(EType::BUFFER, name)
     , info(info)
+    , byte(nullptr)
+    , byteSize(0)
 {}
 
 RHIBuffer::~RHIBuffer()
@@ -77,6 +77,21 @@ public:
 	virtual RHICommandBuffer* CreateCommandBuffer(const char* name) = 0;
 	virtual void DestroyCommandBuffer(RHICommandBuffer* cmdBuffer) = 0;
 
+	virtual RHIQueryPool* CreateQueryPool(const char* name, const QueryPoolInfo& info) = 0;
+	virtual void DestroyQueryPool(RHIQueryPool* queryPool) = 0;
+
+	// 기다리지 않는다. 요청한 쿼리 중 하나라도 아직 결과가 없으면 false를 돌려준다.
+	// TIMESTAMP는 쿼리당 uint64 하나, PIPELINE_STATISTICS는 쿼리당 PipelineStatistics 하나를 채운다.
+	virtual bool GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize) = 0;
+
+	// 타임스탬프 한 틱의 길이(ns). 타임스탬프를 지원하지 않으면 0.
+	virtual double GetTimestampPeriod() const = 0;
+	virtual bool IsPipelineStatisticsSupported() const = 0;
+
+	// RHIHandle::GetPoolHandle()로 받아 둔 핸들이 아직 살아있는지. 슬롯이 재사용됐으면 generation이 달라 false.
+	// 풀을 쓰지 않는 백엔드는 핸들을 발급하지 않으므로 항상 false.
+	virtual bool IsAlive(RHIHandle::EType /*type*/, uint32 /*poolHandle*/) const { return false; }
+
 	virtual void Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount) = 0;
 
 	virtual void Present(Swapchain* swapchain) = 0;
@@ -87,6 +102,8 @@ public:
 
 	static RHIContext* Create(ERHIPlatform platform);
 	static RHIContext* Get();
+	// Finalize 후 파괴한다. 이후 Create로 다시 만들 수 있다.
+	static void Destroy();
 };
 
 extern HS_API RHIContext* g_rhiContext;
@@ -11,15 +11,25 @@
 
 #include "Core/Log.h"
 #include "Core/Hash.h"
+#include "Core/Name.h"
+#include "Core/Container/SmallVector.h"
 
 #include <vector>
 #include <string>
+#include <atomic>
 
 namespace hs { struct NativeWindow; }
 namespace hs { class Swapchain; }
 
 HS_NS_BEGIN
 
+// 디스크립터 배열의 인라인 용량. 일반적인 경우 파이프라인/렌더패스 조회 시 힙 할당이 발생하지 않도록 잡는다.
+constexpr size_t MAX_COLOR_ATTACHMENTS     = 8;
+constexpr size_t MAX_VERTEX_INPUT_LAYOUTS  = 8;
+constexpr size_t MAX_VERTEX_ATTRIBUTES     = 16;
+constexpr size_t MAX_SHADER_STAGES         = 4;
+constexpr size_t MAX_BINDING_ARRAY_INLINE  = 4;
+
 class HS_API RHIHandle
 {
 public:
@@ -40,6 +50,7 @@ public:
 		COMMAND_QUEUE,
 		COMMAND_POOL,
 		COMMAND_BUFFER,
+		QUERY_POOL,
 	};
 
 	RHIHandle() = delete;
@@ -48,84 +59,47 @@ public:
 		, name(name)
 	{}
 
-	// RAII: Virtual destructor calls Release() automatically
-	virtual ~RHIHandle() 
-	{
-		//// Only cleanup if we're the last reference
-		//if (_refs == 1)
-		//{
-		//	delete this;
-		//}
-	}
-
-	// Copy constructor - increase reference count
-	RHIHandle(const RHIHandle& other) = delete;  // Disable copy to prevent issues
-	
-	// Move constructor - transfer ownership
-	RHIHandle(RHIHandle&& other) noexcept
-		: _type(other._type)
-		, name(other.name)
-		, _refs(other._refs)
-		, _hash(other._hash)
-	{
-		other._refs = 0;  // Moved-from object should not trigger destruction
-	}
+	// 실제 파괴는 소유한 RHIContext의 Destroy*가 담당한다. (슬롯 풀에 배치되므로 delete this 금지)
+	virtual ~RHIHandle() = default;
 
-	// Move assignment
-	RHIHandle& operator=(RHIHandle&& other) noexcept
-	{
-		if (this != &other)
-		{
-			// Release current resource
-			if (_refs == 1)
-			{
-				delete this;
-			}
-			
-			// Transfer from other
-			_type = other._type;
-			name = other.name;
-			_refs = other._refs;
-			_hash = other._hash;
-			other._refs = 0;
-		}
-		return *this;
-	}
+	RHIHandle(const RHIHandle& other)            = delete;
+	RHIHandle& operator=(const RHIHandle& other) = delete;
+	RHIHandle(RHIHandle&& other)                 = delete;
+	RHIHandle& operator=(RHIHandle&& other)      = delete;
 
 	HS_FORCEINLINE RHIHandle::EType GetType() const { return _type; }
 	HS_FORCEINLINE uint32           GetHash() const { return _hash; }
-	HS_FORCEINLINE void GetName(const char* name) { this->name = name; }
-	
-	// For external reference counting when needed
+	HS_FORCEINLINE const Name& GetName() const { return name; }
+	HS_FORCEINLINE void        SetName(const Name& newName) { name = newName; }
+
+	// 0이면 풀에 속하지 않은 핸들. 상위 16비트는 generation, 하위 16비트는 슬롯 인덱스.
+	HS_FORCEINLINE uint32 GetPoolHandle() const { return _poolHandle; }
+	HS_FORCEINLINE void   SetPoolHandle(uint32 poolHandle) { _poolHandle = poolHandle; }
+
+	// 여러 스레드에서 공유될 수 있으므로 참조 카운트는 atomic으로 관리한다.
+	// Release가 0을 반환하면 호출자가 RHIContext의 Destroy*로 반환해야 한다.
 	HS_FORCEINLINE int Retain()
 	{
-		return ++_refs;
+		return _refs.fetch_add(1, std::memory_order_relaxed) + 1;
 	}
 
 	HS_FORCEINLINE int Release()
 	{
-		HS_ASSERT(_refs > 0, "Over Released!");
-		
-		if (--_refs == 0)
-		{
-			delete this;
-			return 0;
-		}
-		return _refs;
+		const int refs = _refs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		HS_ASSERT(refs >= 0, "Over Released!");
+		return refs;
 	}
 
-	HS_FORCEINLINE int GetRefCount() const { return _refs; }
-	HS_FORCEINLINE bool IsValid() const { return _refs > 0; }
+	HS_FORCEINLINE int GetRefCount() const { return _refs.load(std::memory_order_relaxed); }
+	HS_FORCEINLINE bool IsValid() const { return GetRefCount() > 0; }
 
-	const char* name;
+	Name name;
 
 protected:
-	// Pure virtual method for platform-specific resource cleanup
-	//virtual void OnDestroy() = 0;
-
 	EType _type;
-	int    _refs = 1;      // Start with 1 reference
-	uint32 _hash = 0;
+	std::atomic<int> _refs{1}; // Start with 1 reference
+	uint32 _hash       = 0;
+	uint32 _poolHandle = 0;
 };
 
 enum class ERHIPlatform
@@ -154,6 +128,14 @@ enum class EVertexFormat
 	HALF3,
 	HALF4,
 
+	// 정규화 정수. 셰이더에는 [-1, 1] 또는 [0, 1] 범위의 float로 들어간다.
+	SHORT2_NORM,
+	SHORT4_NORM,
+	USHORT2_NORM,
+	USHORT4_NORM,
+	CHAR4_NORM,
+	UCHAR4_NORM,
+
 	MAT2x2,
 	MAT2x3,
 	MAT2x4,
@@ -344,10 +326,17 @@ enum class EBufferMemoryOption
 	DYNAMIC
 };
 
+enum class EIndexFormat : uint8
+{
+	UINT32,
+	UINT16,
+};
+
 struct BufferInfo
 {
 	EBufferUsage        usage;
 	EBufferMemoryOption memoryOption;
+	EIndexFormat        indexFormat = EIndexFormat::UINT32; // INDEX 버퍼에서만 쓴다.
 };
 
 struct RHITexture;
@@ -360,7 +349,7 @@ struct RenderTexture
 	uint32       width;
 	uint32       height;
 
-	std::vector<RHITexture*> colorBuffers;
+	SmallVector<RHITexture*, MAX_COLOR_ATTACHMENTS> colorBuffers;
 	RHITexture* depthStencilBuffer;
 };
 
@@ -371,6 +360,12 @@ struct SwapchainInfo
 	bool useMSAA;
     bool enableVSync;
 
+	// 표면 없이 일반 컬러 텍스처에 그린다(headless, GPU 없는 CI). Present는 화면에 내보내지 않고 프레임을 읽어오기만 한다.
+	bool isOffscreen;
+	// isOffscreen일 때 readbackInterval 프레임마다 Present된 프레임을 이 디렉터리에 PNG로 저장한다. nullptr이면 읽어오지 않는다.
+	const char* readbackDirectory;
+	uint32 readbackInterval;
+
 	const NativeWindow* nativeWindow;
 };
 
@@ -437,7 +432,7 @@ struct Attachment
 
 struct RenderPassInfo
 {
-	std::vector<Attachment> colorAttachments;
+	SmallVector<Attachment, MAX_COLOR_ATTACHMENTS> colorAttachments;
 	//std::vector<Attachment> resolveColorAttachments; // TODO: Resolve Color Attachments
 	Attachment              depthStencilAttachment;
 	uint8					colorAttachmentCount;
@@ -451,7 +446,7 @@ class RHIRenderPass;
 struct FramebufferInfo
 {
 	RHIRenderPass* renderPass;
-	std::vector<RHITexture*> colorBuffers;
+	SmallVector<RHITexture*, MAX_COLOR_ATTACHMENTS> colorBuffers;
 	RHITexture* depthStencilBuffer;
 	RHITexture* resolveBuffer;
 
@@ -618,11 +613,11 @@ struct ResourceBinding
 {
 	struct Resource
 	{
-		std::vector<RHIBuffer*>  buffers;
-		std::vector<RHITexture*> textures;
-		std::vector<RHISampler*> samplers;
+		SmallVector<RHIBuffer*, MAX_BINDING_ARRAY_INLINE>  buffers;
+		SmallVector<RHITexture*, MAX_BINDING_ARRAY_INLINE> textures;
+		SmallVector<RHISampler*, MAX_BINDING_ARRAY_INLINE> samplers;
 
-		std::vector<uint32> offsets;
+		SmallVector<uint32, MAX_BINDING_ARRAY_INLINE> offsets;
 	};
 
 	EResourceType type;
@@ -631,8 +626,7 @@ struct ResourceBinding
 	uint8         arrayCount;
 	Resource      resource;
 
-	std::string name;
-	uint32      nameHash;
+	Name name; // name.GetHash()는 HS_STRING_HASH("...")와 같은 값이다.
 };
 
 class RHIShader;
@@ -640,7 +634,7 @@ class RHIShader;
 
 struct ShaderProgramDescriptor
 {
-	std::vector<RHIShader*> stages;
+	SmallVector<RHIShader*, MAX_SHADER_STAGES> stages;
 };
 
 struct VertexInputLayoutDescriptor
@@ -661,8 +655,8 @@ struct VertexInputAttributeDescriptor
 
 struct VertexInputStateDescriptor
 {
-	std::vector<VertexInputLayoutDescriptor>    layouts;
-	std::vector<VertexInputAttributeDescriptor> attributes;
+	SmallVector<VertexInputLayoutDescriptor, MAX_VERTEX_INPUT_LAYOUTS> layouts;
+	SmallVector<VertexInputAttributeDescriptor, MAX_VERTEX_ATTRIBUTES> attributes;
 };
 
 enum class EPrimitiveTopology
@@ -756,11 +750,11 @@ struct ColorBlendAttachmentDescriptor
 
 struct ColorBlendStateDescriptor
 {
-	bool                                        logicOpEnable;
-	ELogicOp                                    blendLogic;
-	uint32                                      attachmentCount;
-	std::vector<ColorBlendAttachmentDescriptor> attachments;
-	float                                       blendConstants[4];
+	bool                                                               logicOpEnable;
+	ELogicOp                                                           blendLogic;
+	uint32                                                             attachmentCount;
+	SmallVector<ColorBlendAttachmentDescriptor, MAX_COLOR_ATTACHMENTS> attachments;
+	float                                                              blendConstants[4];
 };
 
 enum class EPolygonMode
@@ -882,32 +876,224 @@ struct ComputePipelineInfo
 	RHIResourceLayout* resourceLayout;
 };
 
+enum class EQueryType : uint8
+{
+	TIMESTAMP,
+	PIPELINE_STATISTICS,
+};
+
+struct QueryPoolInfo
+{
+	EQueryType type = EQueryType::TIMESTAMP;
+	uint32 queryCount = 0;
+};
+
+// PIPELINE_STATISTICS 쿼리 하나의 결과. 백엔드는 이 순서대로 값을 채운다.
+struct PipelineStatistics
+{
+	uint64 inputAssemblyVertices = 0;
+	uint64 inputAssemblyPrimitives = 0;
+	uint64 vertexShaderInvocations = 0;
+	uint64 clippingPrimitives = 0;
+	uint64 fragmentShaderInvocations = 0;
+};
+
+// RHIHandleCache는 아래 구조체 전체를 키로 저장하고 64bit 해시 일치 후 operator==로 다시 확인한다.
+// 해시와 비교 연산은 항상 같은 필드 집합을 다뤄야 한다.
+
+HS_FORCEINLINE bool operator==(const ClearValue& lhs, const ClearValue& rhs)
+{
+	return lhs.color[0] == rhs.color[0] && lhs.color[1] == rhs.color[1] && lhs.color[2] == rhs.color[2] && lhs.color[3] == rhs.color[3];
+}
+
+HS_FORCEINLINE bool operator==(const Attachment& lhs, const Attachment& rhs)
+{
+	return lhs.format == rhs.format && lhs.loadAction == rhs.loadAction && lhs.storeAction == rhs.storeAction &&
+		   lhs.clearValue == rhs.clearValue && lhs.sampleCount == rhs.sampleCount && lhs.isDepthStencil == rhs.isDepthStencil;
+}
+
+HS_FORCEINLINE bool operator==(const RenderPassInfo& lhs, const RenderPassInfo& rhs)
+{
+	if (lhs.colorAttachmentCount != rhs.colorAttachmentCount ||
+		lhs.useDepthStencilAttachment != rhs.useDepthStencilAttachment ||
+		lhs.isSwapchainRenderPass != rhs.isSwapchainRenderPass)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < lhs.colorAttachmentCount; i++)
+	{
+		if (!(lhs.colorAttachments[i] == rhs.colorAttachments[i]))
+		{
+			return false;
+		}
+	}
+	return !lhs.useDepthStencilAttachment || lhs.depthStencilAttachment == rhs.depthStencilAttachment;
+}
+
+HS_FORCEINLINE bool operator==(const FramebufferInfo& lhs, const FramebufferInfo& rhs)
+{
+	return lhs.renderPass == rhs.renderPass && lhs.colorBuffers == rhs.colorBuffers &&
+		   lhs.depthStencilBuffer == rhs.depthStencilBuffer && lhs.resolveBuffer == rhs.resolveBuffer &&
+		   lhs.width == rhs.width && lhs.height == rhs.height && lhs.isSwapchainFramebuffer == rhs.isSwapchainFramebuffer;
+}
+
+HS_FORCEINLINE bool operator==(const VertexInputLayoutDescriptor& lhs, const VertexInputLayoutDescriptor& rhs)
+{
+	return lhs.binding == rhs.binding && lhs.stride == rhs.stride && lhs.stepRate == rhs.stepRate && lhs.useInstancing == rhs.useInstancing;
+}
+
+HS_FORCEINLINE bool operator==(const VertexInputAttributeDescriptor& lhs, const VertexInputAttributeDescriptor& rhs)
+{
+	return lhs.location == rhs.location && lhs.binding == rhs.binding && lhs.format == rhs.format && lhs.offset == rhs.offset;
+}
+
+HS_FORCEINLINE bool operator==(const ColorBlendAttachmentDescriptor& lhs, const ColorBlendAttachmentDescriptor& rhs)
+{
+	return lhs.blendEnable == rhs.blendEnable &&
+		   lhs.srcColorFactor == rhs.srcColorFactor && lhs.dstColorFactor == rhs.dstColorFactor && lhs.colorBlendOp == rhs.colorBlendOp &&
+		   lhs.srcAlphaFactor == rhs.srcAlphaFactor && lhs.dstAlphaFactor == rhs.dstAlphaFactor && lhs.alphaBlendOp == rhs.alphaBlendOp &&
+		   lhs.writeMask == rhs.writeMask;
+}
+
+HS_FORCEINLINE bool operator==(const StencilTestDescriptor& lhs, const StencilTestDescriptor& rhs)
+{
+	return lhs.failOp == rhs.failOp && lhs.passOp == rhs.passOp && lhs.depthFailOp == rhs.depthFailOp && lhs.compareOp == rhs.compareOp &&
+		   lhs.compareMask == rhs.compareMask && lhs.writeMask == rhs.writeMask && lhs.reference == rhs.reference;
+}
+
+HS_FORCEINLINE bool operator==(const GraphicsPipelineInfo& lhs, const GraphicsPipelineInfo& rhs)
+{
+	const auto& lrs = lhs.rasterizerDesc;
+	const auto& rrs = rhs.rasterizerDesc;
+	const auto& lds = lhs.depthStencilDesc;
+	const auto& rds = rhs.depthStencilDesc;
+	const auto& lcb = lhs.colorBlendDesc;
+	const auto& rcb = rhs.colorBlendDesc;
+
+	return lhs.renderPass == rhs.renderPass && lhs.resourceLayout == rhs.resourceLayout &&
+		   lhs.shaderDesc.stages == rhs.shaderDesc.stages &&
+		   lhs.inputAssemblyDesc.primitiveTopology == rhs.inputAssemblyDesc.primitiveTopology &&
+		   lhs.inputAssemblyDesc.isRestartEnable == rhs.inputAssemblyDesc.isRestartEnable &&
+		   lhs.tesellationDesc.patchControlPoints == rhs.tesellationDesc.patchControlPoints &&
+		   lhs.vertexInputDesc.layouts == rhs.vertexInputDesc.layouts &&
+		   lhs.vertexInputDesc.attributes == rhs.vertexInputDesc.attributes &&
+		   lrs.depthClampEnable == rrs.depthClampEnable && lrs.rasterizerDiscardEnable == rrs.rasterizerDiscardEnable &&
+		   lrs.polygonMode == rrs.polygonMode && lrs.cullMode == rrs.cullMode && lrs.frontFace == rrs.frontFace &&
+		   lrs.depthBiasEnable == rrs.depthBiasEnable && lrs.depthBias == rrs.depthBias && lrs.depthBiasClamp == rrs.depthBiasClamp &&
+		   lrs.depthBiasSlope == rrs.depthBiasSlope && lrs.depthBiasConstant == rrs.depthBiasConstant && lrs.lineWidth == rrs.lineWidth &&
+		   lds.depthTestEnable == rds.depthTestEnable && lds.depthWriteEnable == rds.depthWriteEnable &&
+		   lds.depthCompareOp == rds.depthCompareOp && lds.depthBoundTestEnable == rds.depthBoundTestEnable &&
+		   lds.stencilTestEnable == rds.stencilTestEnable && lds.stencilFront == rds.stencilFront && lds.stencilBack == rds.stencilBack &&
+		   lds.minDepthBound == rds.minDepthBound && lds.maxDepthBound == rds.maxDepthBound &&
+		   lcb.logicOpEnable == rcb.logicOpEnable && lcb.blendLogic == rcb.blendLogic && lcb.attachmentCount == rcb.attachmentCount &&
+		   lcb.attachments == rcb.attachments &&
+		   lcb.blendConstants[0] == rcb.blendConstants[0] && lcb.blendConstants[1] == rcb.blendConstants[1] &&
+		   lcb.blendConstants[2] == rcb.blendConstants[2] && lcb.blendConstants[3] == rcb.blendConstants[3];
+}
+
+template <>
+struct Hasher<Attachment>
+{
+	static uint64 Get(const Attachment& key)
+	{
+		uint64 hash = HashCombine64(Hasher<EPixelFormat>::Get(key.format), Hasher<ELoadAction>::Get(key.loadAction), Hasher<EStoreAction>::Get(key.storeAction));
+		hash = HashCombine64(hash, key.sampleCount, key.isDepthStencil);
+		hash = HashCombine64(hash, (static_cast<uint64>(Hasher<float>::Get(key.clearValue.color[0])) << 32) | Hasher<float>::Get(key.clearValue.color[1]),
+							 (static_cast<uint64>(Hasher<float>::Get(key.clearValue.color[2])) << 32) | Hasher<float>::Get(key.clearValue.color[3]));
+
+		return hash;
+	}
+};
+
 template <>
-struct hs::Hasher<Attachment>
+struct Hasher<RenderPassInfo>
 {
-	static uint32 Get(const Attachment& key)
+	static uint64 Get(const RenderPassInfo& key)
 	{
-		uint32 hash = HashCombine(Hasher<EPixelFormat>::Get(key.format), Hasher<ELoadAction>::Get(key.loadAction), Hasher<EStoreAction>::Get(key.storeAction));
-		hash = HashCombine(hash, key.isDepthStencil);
+		uint64 hash = HashCombine64(key.colorAttachmentCount, key.useDepthStencilAttachment, key.isSwapchainRenderPass);
+		for (size_t i = 0; i < key.colorAttachmentCount; i++)
+		{
+			hash = HashCombine64(hash, Hasher<Attachment>::Get(key.colorAttachments[i]));
+		}
+		if (key.useDepthStencilAttachment)
+		{
+			hash = HashCombine64(hash, Hasher<Attachment>::Get(key.depthStencilAttachment));
+		}
+		return hash;
+	}
+};
 
+template <>
+struct Hasher<FramebufferInfo>
+{
+	static uint64 Get(const FramebufferInfo& key)
+	{
+		uint64 hash = HashCombine64(reinterpret_cast<uintptr_t>(key.renderPass), key.width, key.height);
+		hash = HashCombine64(hash, HashBytes64(key.colorBuffers.data(), key.colorBuffers.size() * sizeof(RHITexture*)));
+		hash = HashCombine64(hash, reinterpret_cast<uintptr_t>(key.depthStencilBuffer), reinterpret_cast<uintptr_t>(key.resolveBuffer));
+		hash = HashCombine64(hash, key.isSwapchainFramebuffer);
 		return hash;
 	}
 };
 
 template <>
-struct hs::Hasher<RenderPassInfo>
+struct Hasher<GraphicsPipelineInfo>
 {
-	static uint32 Get(const RenderPassInfo& key)
+	static uint64 Get(const GraphicsPipelineInfo& key)
 	{
-		uint32 hash = HashCombine(Hasher<uint64>::Get(key.colorAttachmentCount), key.useDepthStencilAttachment, key.isSwapchainRenderPass);
-		for (size_t i = 0; i < key.colorAttachmentCount / 2; i += 2)
+		uint64 hash = HashCombine64(reinterpret_cast<uintptr_t>(key.renderPass), reinterpret_cast<uintptr_t>(key.resourceLayout));
+		hash = HashCombine64(hash, HashBytes64(key.shaderDesc.stages.data(), key.shaderDesc.stages.size() * sizeof(RHIShader*)));
+		hash = HashCombine64(hash, Hasher<EPrimitiveTopology>::Get(key.inputAssemblyDesc.primitiveTopology), key.inputAssemblyDesc.isRestartEnable);
+		hash = HashCombine64(hash, key.tesellationDesc.patchControlPoints);
+
+		for (const auto& layout : key.vertexInputDesc.layouts)
+		{
+			hash = HashCombine64(hash, (static_cast<uint64>(layout.binding) << 32) | layout.stride, (layout.stepRate << 1) | layout.useInstancing);
+		}
+		for (const auto& attribute : key.vertexInputDesc.attributes)
+		{
+			hash = HashCombine64(hash, (static_cast<uint64>(attribute.location) << 32) | attribute.binding, (static_cast<uint64>(Hasher<EVertexFormat>::Get(attribute.format)) << 32) | attribute.offset);
+		}
+
+		const auto& rs = key.rasterizerDesc;
+		hash = HashCombine64(hash, (static_cast<uint64>(rs.depthClampEnable) << 2) | (static_cast<uint64>(rs.rasterizerDiscardEnable) << 1) | rs.depthBiasEnable,
+							 (static_cast<uint64>(Hasher<EPolygonMode>::Get(rs.polygonMode)) << 32) | (Hasher<ECullMode>::Get(rs.cullMode) << 8) | Hasher<EFrontFace>::Get(rs.frontFace));
+		hash = HashCombine64(hash, (static_cast<uint64>(Hasher<float>::Get(rs.depthBias)) << 32) | Hasher<float>::Get(rs.depthBiasClamp),
+							 (static_cast<uint64>(Hasher<float>::Get(rs.depthBiasSlope)) << 32) | Hasher<float>::Get(rs.depthBiasConstant));
+		hash = HashCombine64(hash, Hasher<float>::Get(rs.lineWidth));
+
+		const auto& ds = key.depthStencilDesc;
+		hash = HashCombine64(hash, (static_cast<uint64>(ds.depthTestEnable) << 3) | (static_cast<uint64>(ds.depthWriteEnable) << 2) | (static_cast<uint64>(ds.depthBoundTestEnable) << 1) | ds.stencilTestEnable,
+							 Hasher<ECompareOp>::Get(ds.depthCompareOp));
+		if (ds.stencilTestEnable)
+		{
+			for (const StencilTestDescriptor* stencil : { &ds.stencilFront, &ds.stencilBack })
+			{
+				hash = HashCombine64(hash, (static_cast<uint64>(Hasher<EStencilOp>::Get(stencil->failOp)) << 24) | (Hasher<EStencilOp>::Get(stencil->passOp) << 16) |
+										   (Hasher<EStencilOp>::Get(stencil->depthFailOp) << 8) | Hasher<ECompareOp>::Get(stencil->compareOp),
+									 (static_cast<uint64>(stencil->compareMask) << 32) | stencil->writeMask);
+				hash = HashCombine64(hash, stencil->reference);
+			}
+		}
+		hash = HashCombine64(hash, (static_cast<uint64>(Hasher<float>::Get(ds.minDepthBound)) << 32) | Hasher<float>::Get(ds.maxDepthBound));
+
+		const auto& cb = key.colorBlendDesc;
+		hash = HashCombine64(hash, (static_cast<uint64>(cb.logicOpEnable) << 32) | Hasher<ELogicOp>::Get(cb.blendLogic), cb.attachmentCount);
+		for (const auto& attachment : cb.attachments)
 		{
-			hash = HashCombine(hash, Hasher<Attachment>::Get(key.colorAttachments[i]), Hasher<Attachment>::Get(key.colorAttachments[i + 1]));
+			hash = HashCombine64(hash,
+								 (static_cast<uint64>(attachment.blendEnable) << 48) |
+									 (static_cast<uint64>(Hasher<EBlendFactor>::Get(attachment.srcColorFactor)) << 40) |
+									 (static_cast<uint64>(Hasher<EBlendFactor>::Get(attachment.dstColorFactor)) << 32) |
+									 (Hasher<EBlendOp>::Get(attachment.colorBlendOp) << 24) |
+									 (Hasher<EBlendFactor>::Get(attachment.srcAlphaFactor) << 16) |
+									 (Hasher<EBlendFactor>::Get(attachment.dstAlphaFactor) << 8) |
+									 Hasher<EBlendOp>::Get(attachment.alphaBlendOp),
+								 attachment.writeMask);
 		}
+		hash = HashCombine64(hash, (static_cast<uint64>(Hasher<float>::Get(cb.blendConstants[0])) << 32) | Hasher<float>::Get(cb.blendConstants[1]),
+							 (static_cast<uint64>(Hasher<float>::Get(cb.blendConstants[2])) << 32) | Hasher<float>::Get(cb.blendConstants[3]));
 
-		uint32 b = (key.colorAttachmentCount % 2 != 0) ? Hasher<Attachment>::Get(key.colorAttachments.back()) : 0;
-		uint32 c = (key.useDepthStencilAttachment) ? Hasher<Attachment>::Get(key.depthStencilAttachment) : 0;
-		hash = HashCombine(hash, b, c);
 		return hash;
 	}
 };
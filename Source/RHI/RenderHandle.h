@@ -57,12 +57,23 @@ protected:
     RHIComputePipeline(const char* name, const ComputePipelineInfo& info);
 };
 
+class HS_API RHIQueryPool : public RHIHandle
+{
+public:
+    ~RHIQueryPool() override;
+
+    const QueryPoolInfo info;
+protected:
+    RHIQueryPool(const char* name, const QueryPoolInfo& info);
+};
+
 template<>
 struct Hasher<RHIRenderPass>
 {
     static uint32 Get(const RHIRenderPass& key)
     {
-        return 0;
+        const uint64 hash = Hasher<RenderPassInfo>::Get(key.info);
+        return static_cast<uint32>(hash ^ (hash >> 32));
     }
 };
 
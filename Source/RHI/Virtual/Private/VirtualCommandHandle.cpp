@@ -0,0 +1,448 @@
+#include "RHI/Virtual/VirtualCommandHandle.h"
+
+#include <cstring>
+
+HS_NS_BEGIN
+
+void VirtualCommandStats::Accumulate(const VirtualCommandStats& other)
+{
+    commandCount += other.commandCount;
+    streamBytes += other.streamBytes;
+
+    renderPasses += other.renderPasses;
+    computePasses += other.computePasses;
+    drawCalls += other.drawCalls;
+    dispatches += other.dispatches;
+    vertices += other.vertices;
+    instances += other.instances;
+
+    pipelineBinds += other.pipelineBinds;
+    redundantPipelineBinds += other.redundantPipelineBinds;
+    resourceSetBinds += other.resourceSetBinds;
+    redundantResourceSetBinds += other.redundantResourceSetBinds;
+    vertexBufferBinds += other.vertexBufferBinds;
+    redundantVertexBufferBinds += other.redundantVertexBufferBinds;
+    indexBufferBinds += other.indexBufferBinds;
+    redundantIndexBufferBinds += other.redundantIndexBufferBinds;
+    viewportChanges += other.viewportChanges;
+    redundantViewportChanges += other.redundantViewportChanges;
+    scissorChanges += other.scissorChanges;
+    redundantScissorChanges += other.redundantScissorChanges;
+
+    barriers += other.barriers;
+    copies += other.copies;
+    bufferUpdates += other.bufferUpdates;
+    uploadBytes += other.uploadBytes;
+    debugMarks += other.debugMarks;
+    queries += other.queries;
+}
+
+CommandBufferVirtual::CommandBufferVirtual(const char* name)
+    : RHICommandBuffer(name)
+{
+    stream.reserve(4096);
+}
+
+CommandBufferVirtual::~CommandBufferVirtual()
+{}
+
+void* CommandBufferVirtual::push(EVirtualCommand type, size_t payloadSize)
+{
+    const size_t alignedSize = (payloadSize + 3) & ~static_cast<size_t>(3);
+    HS_ASSERT(alignedSize <= UINT32_MAX, "Command payload is too large");
+
+    const size_t offset = stream.size();
+    stream.resize(offset + sizeof(VirtualCommandHeader) + alignedSize);
+
+    VirtualCommandHeader header{type, 0, static_cast<uint32>(alignedSize)};
+    ::memcpy(stream.data() + offset, &header, sizeof(header));
+
+    stats.commandCount++;
+    stats.streamBytes = static_cast<uint32>(stream.size());
+
+    return stream.data() + offset + sizeof(VirtualCommandHeader);
+}
+
+void CommandBufferVirtual::clearBoundState()
+{
+    _curPipeline           = nullptr;
+    _curComputePipeline    = nullptr;
+    _curResourceSet        = nullptr;
+    _curComputeResourceSet = nullptr;
+    _curIndexBuffer        = nullptr;
+    _curVertexBufferCount  = 0;
+    _hasViewport           = false;
+    _hasScissor            = false;
+}
+
+void CommandBufferVirtual::Begin()
+{
+    HS_ASSERT(false == _isBegan, "CommandBuffer has already began.");
+    stream.clear();
+    stats = VirtualCommandStats{};
+    clearBoundState();
+    _debugDepth = 0;
+    _isBegan    = true;
+}
+
+void CommandBufferVirtual::End()
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(_isGraphicsBegan == false, "RenderPass has not ended");
+    HS_ASSERT(_debugDepth == 0, "Debug marks are not balanced");
+    _isBegan = false;
+}
+
+void CommandBufferVirtual::Reset()
+{
+    stream.clear();
+    stats = VirtualCommandStats{};
+    clearBoundState();
+    _debugDepth      = 0;
+    _isBegan         = false;
+    _isGraphicsBegan = false;
+    _isComputeBegan  = false;
+    _isBlitBegan     = false;
+}
+
+void CommandBufferVirtual::BeginRenderPass(RHIRenderPass* renderPass, RHIFramebuffer* framebuffer, const Area& renderArea)
+{
+    HS_ASSERT(renderPass && framebuffer, "both renderPass and framebuffer should't be nullptr");
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(_isGraphicsBegan == false, "Graphics Pass is already began");
+    HS_ASSERT(_isComputeBegan == false, "Compute Pass is aready began");
+    HS_ASSERT(framebuffer->info.renderPass == renderPass, "RenderPass and Framebuffer are not matched.");
+
+    auto* cmd        = static_cast<VirtualCmdBeginRenderPass*>(push(EVirtualCommand::BEGIN_RENDER_PASS, sizeof(VirtualCmdBeginRenderPass)));
+    cmd->renderPass  = renderPass->GetPoolHandle();
+    cmd->framebuffer = framebuffer->GetPoolHandle();
+    cmd->renderArea  = renderArea;
+
+    // 백엔드와 마찬가지로 렌더 패스가 바뀌면 바인딩된 상태는 모두 무효가 된다.
+    clearBoundState();
+    stats.renderPasses++;
+    _isGraphicsBegan = true;
+}
+
+void CommandBufferVirtual::BindPipeline(RHIGraphicsPipeline* pipeline)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(pipeline, "Pipeline is nullptr");
+
+    stats.pipelineBinds++;
+    if (_curPipeline == pipeline)
+    {
+        stats.redundantPipelineBinds++;
+    }
+    _curPipeline = pipeline;
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::BIND_PIPELINE, sizeof(VirtualCmdBind)))->handle = pipeline->GetPoolHandle();
+}
+
+void CommandBufferVirtual::BindResourceSet(RHIResourceSet* rSet)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(rSet, "ResourceSet is nullptr");
+
+    stats.resourceSetBinds++;
+    if (_curResourceSet == rSet)
+    {
+        stats.redundantResourceSetBinds++;
+    }
+    _curResourceSet = rSet;
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::BIND_RESOURCE_SET, sizeof(VirtualCmdBind)))->handle = rSet->GetPoolHandle();
+}
+
+void CommandBufferVirtual::SetViewport(const Viewport& viewport)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+
+    stats.viewportChanges++;
+    if (_hasViewport && 0 == ::memcmp(&_curViewport, &viewport, sizeof(Viewport)))
+    {
+        stats.redundantViewportChanges++;
+    }
+    _curViewport = viewport;
+    _hasViewport = true;
+
+    static_cast<VirtualCmdSetViewport*>(push(EVirtualCommand::SET_VIEWPORT, sizeof(VirtualCmdSetViewport)))->viewport = viewport;
+}
+
+void CommandBufferVirtual::SetScissor(const uint32 x, const uint32 y, const uint32 width, const uint32 height)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+
+    stats.scissorChanges++;
+    if (_hasScissor && _curScissor[0] == x && _curScissor[1] == y && _curScissor[2] == width && _curScissor[3] == height)
+    {
+        stats.redundantScissorChanges++;
+    }
+    _curScissor[0] = x;
+    _curScissor[1] = y;
+    _curScissor[2] = width;
+    _curScissor[3] = height;
+    _hasScissor    = true;
+
+    auto* cmd   = static_cast<VirtualCmdSetScissor*>(push(EVirtualCommand::SET_SCISSOR, sizeof(VirtualCmdSetScissor)));
+    cmd->x      = x;
+    cmd->y      = y;
+    cmd->width  = width;
+    cmd->height = height;
+}
+
+void CommandBufferVirtual::BindIndexBuffer(RHIBuffer* indexBuffer)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(indexBuffer, "IndexBuffer is nullptr");
+
+    stats.indexBufferBinds++;
+    if (_curIndexBuffer == indexBuffer)
+    {
+        stats.redundantIndexBufferBinds++;
+    }
+    _curIndexBuffer = indexBuffer;
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::BIND_INDEX_BUFFER, sizeof(VirtualCmdBind)))->handle = indexBuffer->GetPoolHandle();
+}
+
+void CommandBufferVirtual::BindVertexBuffers(const RHIBuffer* const* vertexBuffers, const uint32* offsets, const uint8 bufferCount)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(bufferCount <= MAX_VERTEX_INPUT_LAYOUTS, "Too many vertex buffers");
+
+    bool isRedundant = (bufferCount == _curVertexBufferCount);
+    for (uint8 i = 0; i < bufferCount && isRedundant; i++)
+    {
+        const uint32 offset = (offsets != nullptr) ? offsets[i] : 0;
+        isRedundant         = (_curVertexBuffers[i] == vertexBuffers[i]) && (_curVertexOffsets[i] == offset);
+    }
+
+    stats.vertexBufferBinds++;
+    if (isRedundant)
+    {
+        stats.redundantVertexBufferBinds++;
+    }
+
+    const size_t payloadSize = sizeof(VirtualCmdBindVertexBuffers) + sizeof(uint32) * 2 * bufferCount;
+    auto* cmd                = static_cast<VirtualCmdBindVertexBuffers*>(push(EVirtualCommand::BIND_VERTEX_BUFFERS, payloadSize));
+    cmd->bufferCount         = bufferCount;
+
+    uint32* handles    = reinterpret_cast<uint32*>(cmd + 1);
+    uint32* cmdOffsets = handles + bufferCount;
+    for (uint8 i = 0; i < bufferCount; i++)
+    {
+        const uint32 offset = (offsets != nullptr) ? offsets[i] : 0;
+        handles[i]          = vertexBuffers[i]->GetPoolHandle();
+        cmdOffsets[i]       = offset;
+
+        _curVertexBuffers[i] = vertexBuffers[i];
+        _curVertexOffsets[i] = offset;
+    }
+    _curVertexBufferCount = bufferCount;
+}
+
+void CommandBufferVirtual::DrawArrays(const uint32 firstVertex, const uint32 vertexCount, const uint32 instanceCount)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(_curPipeline, "Pipeline is not bound");
+
+    auto* cmd          = static_cast<VirtualCmdDraw*>(push(EVirtualCommand::DRAW, sizeof(VirtualCmdDraw)));
+    cmd->firstVertex   = firstVertex;
+    cmd->vertexCount   = vertexCount;
+    cmd->instanceCount = instanceCount;
+
+    stats.drawCalls++;
+    stats.instances += instanceCount;
+    stats.vertices += static_cast<uint64>(vertexCount) * instanceCount;
+}
+
+void CommandBufferVirtual::DrawIndexed(const uint32 firstIndex, const uint32 indexCount, const uint32 instanceCount, const uint32 vertexOffset)
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    HS_ASSERT(_curPipeline, "Pipeline is not bound");
+    HS_ASSERT(_curIndexBuffer, "IndexBuffer is not bound");
+
+    auto* cmd          = static_cast<VirtualCmdDrawIndexed*>(push(EVirtualCommand::DRAW_INDEXED, sizeof(VirtualCmdDrawIndexed)));
+    cmd->firstIndex    = firstIndex;
+    cmd->indexCount    = indexCount;
+    cmd->instanceCount = instanceCount;
+    cmd->vertexOffset  = vertexOffset;
+
+    stats.drawCalls++;
+    stats.instances += instanceCount;
+    stats.vertices += static_cast<uint64>(indexCount) * instanceCount;
+}
+
+void CommandBufferVirtual::EndRenderPass()
+{
+    HS_ASSERT(_isGraphicsBegan && _isBegan, "RenderPass has not begun");
+    push(EVirtualCommand::END_RENDER_PASS, 0);
+    _isGraphicsBegan = false;
+}
+
+void CommandBufferVirtual::BindComputePipeline(RHIComputePipeline* pipeline)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(_isGraphicsBegan == false, "Compute pipeline cannot be bound inside a render pass");
+    HS_ASSERT(pipeline, "Pipeline is nullptr");
+
+    if (false == _isComputeBegan)
+    {
+        stats.computePasses++;
+        _isComputeBegan = true;
+    }
+
+    stats.pipelineBinds++;
+    if (_curComputePipeline == pipeline)
+    {
+        stats.redundantPipelineBinds++;
+    }
+    _curComputePipeline = pipeline;
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::BIND_COMPUTE_PIPELINE, sizeof(VirtualCmdBind)))->handle = pipeline->GetPoolHandle();
+}
+
+void CommandBufferVirtual::BindComputeResourceSet(RHIResourceSet* rSet)
+{
+    HS_ASSERT(_isComputeBegan && _isBegan, "Compute pass has not begun");
+    HS_ASSERT(rSet, "ResourceSet is nullptr");
+
+    stats.resourceSetBinds++;
+    if (_curComputeResourceSet == rSet)
+    {
+        stats.redundantResourceSetBinds++;
+    }
+    _curComputeResourceSet = rSet;
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::BIND_COMPUTE_RESOURCE_SET, sizeof(VirtualCmdBind)))->handle = rSet->GetPoolHandle();
+}
+
+void CommandBufferVirtual::Dispatch(uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ)
+{
+    HS_ASSERT(_isComputeBegan && _isBegan, "Compute pass has not begun");
+    HS_ASSERT(_curComputePipeline, "Compute pipeline is not bound");
+
+    auto* cmd        = static_cast<VirtualCmdDispatch*>(push(EVirtualCommand::DISPATCH, sizeof(VirtualCmdDispatch)));
+    cmd->groupCountX = groupCountX;
+    cmd->groupCountY = groupCountY;
+    cmd->groupCountZ = groupCountZ;
+
+    stats.dispatches++;
+}
+
+void CommandBufferVirtual::EndComputePass()
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    push(EVirtualCommand::END_COMPUTE_PASS, 0);
+
+    _curComputePipeline    = nullptr;
+    _curComputeResourceSet = nullptr;
+    _isComputeBegan        = false;
+}
+
+void CommandBufferVirtual::TextureBarrier(RHITexture* texture)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(texture, "Texture is nullptr");
+
+    static_cast<VirtualCmdBind*>(push(EVirtualCommand::TEXTURE_BARRIER, sizeof(VirtualCmdBind)))->handle = texture->GetPoolHandle();
+    stats.barriers++;
+}
+
+void CommandBufferVirtual::CopyTexture(RHITexture* srcTexture, RHITexture* dstTexture)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(_isGraphicsBegan == false, "CopyTexture cannot be recorded inside a render pass");
+    HS_ASSERT(srcTexture && dstTexture, "Texture is nullptr");
+
+    auto* cmd       = static_cast<VirtualCmdCopyTexture*>(push(EVirtualCommand::COPY_TEXTURE, sizeof(VirtualCmdCopyTexture)));
+    cmd->srcTexture = srcTexture->GetPoolHandle();
+    cmd->dstTexture = dstTexture->GetPoolHandle();
+    stats.copies++;
+}
+
+void CommandBufferVirtual::UpdateBuffer(RHIBuffer* buffer, const size_t dstOffset, const void* srcData, const size_t dataSize)
+{
+    HS_ASSERT(_isBegan, "CommandBuffer has not began");
+    HS_ASSERT(buffer && srcData, "Buffer or data is nullptr");
+    // vkCmdUpdateBuffer와 같은 제한을 두어 백엔드 간 동작 차이를 줄인다.
+    HS_ASSERT(dataSize <= 65536, "UpdateBuffer supports up to 64KB");
+
+    auto* cmd      = static_cast<VirtualCmdUpdateBuffer*>(push(EVirtualCommand::UPDATE_BUFFER, sizeof(VirtualCmdUpdateBuffer) + dataSize));
+    cmd->buffer    = buffer->GetPoolHandle();
+    cmd->dstOffset = static_cast<uint32>(dstOffset);
+    cmd->dataSize  = static_cast<uint32>(dataSize);
+    ::memcpy(cmd + 1, srcData, dataSize);
+
+    stats.bufferUpdates++;
+    stats.uploadBytes += dataSize;
+}
+
+void CommandBufferVirtual::PushDebugMark(const char* label, float color[4])
+{
+    const uint32 length = (label != nullptr) ? static_cast<uint32>(::strlen(label)) : 0;
+
+    auto* cmd   = static_cast<VirtualCmdDebugMark*>(push(EVirtualCommand::PUSH_DEBUG_MARK, sizeof(VirtualCmdDebugMark) + length));
+    cmd->length = length;
+    if (length > 0)
+    {
+        ::memcpy(cmd + 1, label, length);
+    }
+
+    stats.debugMarks++;
+    _debugDepth++;
+}
+
+void CommandBufferVirtual::PopDebugMark()
+{
+    HS_ASSERT(_debugDepth > 0, "PopDebugMark without PushDebugMark");
+    push(EVirtualCommand::POP_DEBUG_MARK, 0);
+    _debugDepth--;
+}
+
+void CommandBufferVirtual::ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount)
+{
+    HS_ASSERT(_isGraphicsBegan == false, "Query pool must be reset outside of a render pass");
+    HS_ASSERT(firstQuery + queryCount <= queryPool->info.queryCount, "Query range is out of bounds");
+
+    auto* cmd       = static_cast<VirtualCmdQuery*>(push(EVirtualCommand::RESET_QUERY_POOL, sizeof(VirtualCmdQuery)));
+    cmd->queryPool  = queryPool->GetPoolHandle();
+    cmd->firstQuery = firstQuery;
+    cmd->queryCount = queryCount;
+}
+
+void CommandBufferVirtual::WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+    HS_ASSERT(queryPool->info.type == EQueryType::TIMESTAMP, "Query pool is not a timestamp pool");
+    HS_ASSERT(queryIndex < queryPool->info.queryCount, "Query index is out of bounds");
+
+    auto* cmd       = static_cast<VirtualCmdQuery*>(push(EVirtualCommand::WRITE_TIMESTAMP, sizeof(VirtualCmdQuery)));
+    cmd->queryPool  = queryPool->GetPoolHandle();
+    cmd->firstQuery = queryIndex;
+    cmd->queryCount = 1;
+    stats.queries++;
+}
+
+void CommandBufferVirtual::BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+    HS_ASSERT(queryIndex < queryPool->info.queryCount, "Query index is out of bounds");
+
+    auto* cmd       = static_cast<VirtualCmdQuery*>(push(EVirtualCommand::BEGIN_QUERY, sizeof(VirtualCmdQuery)));
+    cmd->queryPool  = queryPool->GetPoolHandle();
+    cmd->firstQuery = queryIndex;
+    cmd->queryCount = 1;
+}
+
+void CommandBufferVirtual::EndQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+    HS_ASSERT(queryIndex < queryPool->info.queryCount, "Query index is out of bounds");
+
+    auto* cmd       = static_cast<VirtualCmdQuery*>(push(EVirtualCommand::END_QUERY, sizeof(VirtualCmdQuery)));
+    cmd->queryPool  = queryPool->GetPoolHandle();
+    cmd->firstQuery = queryIndex;
+    cmd->queryCount = 1;
+    stats.queries++;
+}
+
+HS_NS_END
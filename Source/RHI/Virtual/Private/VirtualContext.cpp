@@ -0,0 +1,499 @@
+#include "RHI/Virtual/VirtualContext.h"
+
+#include "RHI/Virtual/VirtualSwapchain.h"
+
+#include <chrono>
+#include <cstring>
+
+HS_NS_BEGIN
+
+void VirtualFrameStats::Accumulate(const VirtualFrameStats& other)
+{
+    commands.Accumulate(other.commands);
+    submits += other.submits;
+    commandBuffers += other.commandBuffers;
+    createCalls += other.createCalls;
+    destroyCalls += other.destroyCalls;
+    staleHandles += other.staleHandles;
+}
+
+VirtualContext::~VirtualContext()
+{
+    Finalize();
+}
+
+bool VirtualContext::Initialize()
+{
+    ResetStats();
+    _isInitialized = true;
+
+    HS_LOG(info, "Virtual RHI is initialized. No GPU work will be performed.");
+    return true;
+}
+
+void VirtualContext::Finalize()
+{
+    if (!_isInitialized)
+    {
+        return;
+    }
+
+    _isInitialized = false;
+}
+
+void VirtualContext::ResetStats()
+{
+    _frameStats     = VirtualFrameStats{};
+    _lastFrameStats = VirtualFrameStats{};
+    _totalStats     = VirtualFrameStats{};
+    _presentCount   = 0;
+    _createCalls.store(0, std::memory_order_relaxed);
+    _destroyCalls.store(0, std::memory_order_relaxed);
+}
+
+void VirtualContext::Suspend(Swapchain* swapchain)
+{
+    HS_ASSERT(swapchain != nullptr, "Swapchain is null in VirtualContext::Suspend");
+    static_cast<SwapchainVirtual*>(swapchain)->_isSuspended = true;
+}
+
+void VirtualContext::Restore(Swapchain* swapchain)
+{
+    HS_ASSERT(swapchain != nullptr, "Swapchain is null in VirtualContext::Restore");
+
+    SwapchainVirtual* swapchainVT = static_cast<SwapchainVirtual*>(swapchain);
+    if (!swapchainVT->_isSuspended)
+    {
+        return;
+    }
+
+    // Resize 혹은 Maximize된 상황
+    const RHIFramebuffer* framebuffer = swapchainVT->_framebuffers[0];
+    if (framebuffer->info.width != swapchainVT->_info.nativeWindow->surfaceWidth ||
+        framebuffer->info.height != swapchainVT->_info.nativeWindow->surfaceHeight)
+    {
+        swapchainVT->destroySwapchain(this);
+        swapchainVT->initSwapchain(this);
+    }
+
+    swapchainVT->_isSuspended = false;
+}
+
+uint32 VirtualContext::AcquireNextImage(Swapchain* swapchain)
+{
+    HS_ASSERT(swapchain != nullptr, "Swapchain is null in VirtualContext::AcquireNextImage");
+
+    SwapchainVirtual* swapchainVT = static_cast<SwapchainVirtual*>(swapchain);
+    swapchainVT->_frameIndex      = static_cast<uint8>(swapchainVT->_frameIndex + 1) % SwapchainVirtual::MAX_FRAME_COUNT;
+    swapchainVT->GetCommandBufferForCurrentFrame()->Reset();
+
+    return swapchainVT->_frameIndex;
+}
+
+Swapchain* VirtualContext::CreateSwapchain(SwapchainInfo info)
+{
+    SwapchainVirtual* swapchainVT = new SwapchainVirtual(info);
+    swapchainVT->initSwapchain(this);
+
+    return static_cast<Swapchain*>(swapchainVT);
+}
+
+void VirtualContext::DestroySwapchain(Swapchain* swapchain)
+{
+    SwapchainVirtual* swapchainVT = static_cast<SwapchainVirtual*>(swapchain);
+    swapchainVT->destroySwapchain(this);
+
+    delete swapchainVT;
+}
+
+RHIRenderPass* VirtualContext::CreateRenderPass(const char* name, const RenderPassInfo& info)
+{
+    return createPooled(_renderPassPool, name, info);
+}
+
+void VirtualContext::DestroyRenderPass(RHIRenderPass* renderPass)
+{
+    destroyPooled(_renderPassPool, renderPass);
+}
+
+RHIFramebuffer* VirtualContext::CreateFramebuffer(const char* name, const FramebufferInfo& info)
+{
+    HS_ASSERT(info.renderPass != nullptr, "Framebuffer needs a render pass");
+    return createPooled(_framebufferPool, name, info);
+}
+
+void VirtualContext::DestroyFramebuffer(RHIFramebuffer* framebuffer)
+{
+    destroyPooled(_framebufferPool, framebuffer);
+}
+
+RHIGraphicsPipeline* VirtualContext::CreateGraphicsPipeline(const char* name, const GraphicsPipelineInfo& info)
+{
+    return createPooled(_graphicsPipelinePool, name, info);
+}
+
+void VirtualContext::DestroyGraphicsPipeline(RHIGraphicsPipeline* pipeline)
+{
+    destroyPooled(_graphicsPipelinePool, pipeline);
+}
+
+RHIComputePipeline* VirtualContext::CreateComputePipeline(const char* name, const ComputePipelineInfo& info)
+{
+    return createPooled(_computePipelinePool, name, info);
+}
+
+void VirtualContext::DestroyComputePipeline(RHIComputePipeline* pipeline)
+{
+    destroyPooled(_computePipelinePool, pipeline);
+}
+
+RHIShader* VirtualContext::CreateShader(const char* name, const ShaderInfo& info, const char* path)
+{
+    // 파일을 읽지 않는다. 셰이더 에셋이 없는 환경에서도 렌더 경로 전체를 실행할 수 있게 하기 위함.
+    (void)path;
+    return createPooled(_shaderPool, name, info);
+}
+
+RHIShader* VirtualContext::CreateShader(const char* name, const ShaderInfo& info, const char* byteCode, size_t byteCodeSize)
+{
+    (void)byteCode;
+    ShaderVirtual* shaderVT = createPooled(_shaderPool, name, info);
+    if (nullptr == shaderVT)
+    {
+        return nullptr;
+    }
+    shaderVT->byteCodeSize  = byteCodeSize;
+
+    return shaderVT;
+}
+
+void VirtualContext::DestroyShader(RHIShader* shader)
+{
+    destroyPooled(_shaderPool, shader);
+}
+
+RHIBuffer* VirtualContext::CreateBuffer(const char* name, const void* data, size_t dataSize, EBufferUsage usage, EBufferMemoryOption memoryOption)
+{
+    BufferInfo info{};
+    info.usage        = usage;
+    info.memoryOption = memoryOption;
+
+    return CreateBuffer(name, data, dataSize, info);
+}
+
+RHIBuffer* VirtualContext::CreateBuffer(const char* name, const void* data, size_t dataSize, const BufferInfo& info)
+{
+    BufferVirtual* bufferVT = createPooled(_bufferPool, name, info);
+    if (nullptr == bufferVT)
+    {
+        return nullptr;
+    }
+    bufferVT->storage.resize(dataSize);
+    if (data != nullptr && dataSize > 0)
+    {
+        ::memcpy(bufferVT->storage.data(), data, dataSize);
+    }
+    bufferVT->byte     = bufferVT->storage.data();
+    bufferVT->byteSize = dataSize;
+
+    return bufferVT;
+}
+
+void VirtualContext::DestroyBuffer(RHIBuffer* buffer)
+{
+    destroyPooled(_bufferPool, buffer);
+}
+
+RHITexture* VirtualContext::CreateTexture(const char* name, void* image, const TextureInfo& info)
+{
+    (void)image;
+    return createPooled(_texturePool, name, info);
+}
+
+RHITexture* VirtualContext::CreateTexture(const char* name, void* image, uint32 width, uint32 height, EPixelFormat format, ETextureType type, ETextureUsage usage)
+{
+    TextureInfo info{};
+    info.format        = format;
+    info.type          = type;
+    info.usage         = usage;
+    info.extent.width  = width;
+    info.extent.height = height;
+    info.extent.depth  = 1;
+
+    return CreateTexture(name, image, info);
+}
+
+void VirtualContext::DestroyTexture(RHITexture* texture)
+{
+    destroyPooled(_texturePool, texture);
+}
+
+RHISampler* VirtualContext::CreateSampler(const char* name, const SamplerInfo& info)
+{
+    return createPooled(_samplerPool, name, info);
+}
+
+void VirtualContext::DestroySampler(RHISampler* sampler)
+{
+    destroyPooled(_samplerPool, sampler);
+}
+
+RHIResourceLayout* VirtualContext::CreateResourceLayout(const char* name, ResourceBinding* bindings, uint32 bindingCount)
+{
+    return createPooled(_resourceLayoutPool, name, bindings, static_cast<size_t>(bindingCount));
+}
+
+void VirtualContext::DestroyResourceLayout(RHIResourceLayout* resourceLayout)
+{
+    destroyPooled(_resourceLayoutPool, resourceLayout);
+}
+
+RHIResourceSet* VirtualContext::CreateResourceSet(const char* name, RHIResourceLayout* resourceLayouts)
+{
+    ResourceSetVirtual* resourceSetVT = createPooled(_resourceSetPool, name);
+    if (nullptr == resourceSetVT)
+    {
+        return nullptr;
+    }
+    resourceSetVT->layouts.push_back(resourceLayouts);
+
+    return resourceSetVT;
+}
+
+void VirtualContext::DestroyResourceSet(RHIResourceSet* resourceSet)
+{
+    destroyPooled(_resourceSetPool, resourceSet);
+}
+
+RHIResourceSetPool* VirtualContext::CreateResourceSetPool(const char* name, uint32 bufferSize, uint32 textureSize)
+{
+    (void)bufferSize;
+    (void)textureSize;
+    return createPooled(_resourceSetPoolPool, name);
+}
+
+void VirtualContext::DestroyResourceSetPool(RHIResourceSetPool* resourceSetPool)
+{
+    destroyPooled(_resourceSetPoolPool, resourceSetPool);
+}
+
+RHICommandPool* VirtualContext::CreateCommandPool(const char* name, uint32 queueFamilyIndex)
+{
+    (void)queueFamilyIndex;
+    return createPooled(_commandPoolPool, name);
+}
+
+void VirtualContext::DestroyCommandPool(RHICommandPool* cmdPool)
+{
+    destroyPooled(_commandPoolPool, cmdPool);
+}
+
+RHICommandBuffer* VirtualContext::CreateCommandBuffer(const char* name)
+{
+    return createPooled(_commandBufferPool, name);
+}
+
+void VirtualContext::DestroyCommandBuffer(RHICommandBuffer* commandBuffer)
+{
+    destroyPooled(_commandBufferPool, commandBuffer);
+}
+
+RHIQueryPool* VirtualContext::CreateQueryPool(const char* name, const QueryPoolInfo& info)
+{
+    return createPooled(_queryPoolPool, name, info);
+}
+
+void VirtualContext::DestroyQueryPool(RHIQueryPool* queryPool)
+{
+    destroyPooled(_queryPoolPool, queryPool);
+}
+
+bool VirtualContext::IsAlive(RHIHandle::EType type, uint32 poolHandle) const
+{
+    switch (type)
+    {
+        case RHIHandle::EType::BUFFER:            return _bufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::TEXTURE:           return _texturePool.IsAlive(poolHandle);
+        case RHIHandle::EType::SAMPLER:           return _samplerPool.IsAlive(poolHandle);
+        case RHIHandle::EType::SHADER:            return _shaderPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_LAYOUT:   return _resourceLayoutPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_SET:      return _resourceSetPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_SET_POOL: return _resourceSetPoolPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RENDER_PASS:       return _renderPassPool.IsAlive(poolHandle);
+        case RHIHandle::EType::FRAMEBUFFER:       return _framebufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::GRAPHICS_PIPELINE: return _graphicsPipelinePool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMPUTE_PIPELINE:  return _computePipelinePool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMMAND_POOL:      return _commandPoolPool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMMAND_BUFFER:    return _commandBufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::QUERY_POOL:        return _queryPoolPool.IsAlive(poolHandle);
+        default:                                  return false;
+    }
+}
+
+bool VirtualContext::GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize)
+{
+    QueryPoolVirtual* queryPoolVT = static_cast<QueryPoolVirtual*>(queryPool);
+    const size_t stride           = (queryPool->info.type == EQueryType::TIMESTAMP) ? sizeof(uint64) : sizeof(PipelineStatistics);
+    HS_ASSERT(dataSize >= stride * queryCount, "Query result buffer is too small");
+    HS_ASSERT(firstQuery + queryCount <= queryPool->info.queryCount, "Query range is out of bounds");
+
+    for (uint32 i = firstQuery; i < firstQuery + queryCount; i++)
+    {
+        if (0 == queryPoolVT->isAvailable[i])
+        {
+            return false;
+        }
+    }
+
+    // 파이프라인 통계는 지원하지 않으므로 0으로 채운다.
+    ::memset(outData, 0, stride * queryCount);
+    if (queryPool->info.type == EQueryType::TIMESTAMP)
+    {
+        ::memcpy(outData, queryPoolVT->results.data() + firstQuery, sizeof(uint64) * queryCount);
+    }
+
+    return true;
+}
+
+void VirtualContext::Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount)
+{
+    HS_ASSERT(swapchain != nullptr, "Swapchain is null in VirtualContext::Submit");
+    HS_ASSERT(bufferCount > 0, "Buffer count must be greater than 0 in VirtualContext::Submit");
+
+    _frameStats.submits++;
+    for (size_t i = 0; i < bufferCount; i++)
+    {
+        const CommandBufferVirtual* commandBufferVT = static_cast<const CommandBufferVirtual*>(buffers[i]);
+        execute(commandBufferVT);
+
+        _frameStats.commands.Accumulate(commandBufferVT->GetStats());
+        _frameStats.commandBuffers++;
+    }
+}
+
+void VirtualContext::Present(Swapchain* swapchain)
+{
+    HS_ASSERT(swapchain != nullptr, "Swapchain is null in VirtualContext::Present");
+
+    _frameStats.createCalls  = _createCalls.exchange(0, std::memory_order_relaxed);
+    _frameStats.destroyCalls = _destroyCalls.exchange(0, std::memory_order_relaxed);
+
+    _totalStats.Accumulate(_frameStats);
+    _lastFrameStats = _frameStats;
+    _frameStats     = VirtualFrameStats{};
+    _presentCount++;
+}
+
+void VirtualContext::execute(const CommandBufferVirtual* commandBuffer)
+{
+    // GPU 대신 스트림을 한 번 훑는다. 버퍼 업데이트와 쿼리만 실제로 반영하고, 나머지는 핸들 유효성만 확인한다.
+    const uint8* cursor = commandBuffer->GetStream();
+    const uint8* end    = cursor + commandBuffer->GetStreamSize();
+
+    uint32 staleHandles = 0;
+    auto checkAlive     = [&staleHandles](bool isAlive) {
+        if (!isAlive)
+        {
+            staleHandles++;
+        }
+    };
+
+    while (cursor < end)
+    {
+        VirtualCommandHeader header;
+        ::memcpy(&header, cursor, sizeof(header));
+        const uint8* payload = cursor + sizeof(VirtualCommandHeader);
+        cursor               = payload + header.size;
+
+        switch (header.type)
+        {
+        case EVirtualCommand::BEGIN_RENDER_PASS:
+        {
+            const auto* cmd = reinterpret_cast<const VirtualCmdBeginRenderPass*>(payload);
+            checkAlive(_renderPassPool.IsAlive(cmd->renderPass));
+            checkAlive(_framebufferPool.IsAlive(cmd->framebuffer));
+        }
+        break;
+        case EVirtualCommand::BIND_PIPELINE:
+            checkAlive(_graphicsPipelinePool.IsAlive(reinterpret_cast<const VirtualCmdBind*>(payload)->handle));
+            break;
+        case EVirtualCommand::BIND_COMPUTE_PIPELINE:
+            checkAlive(_computePipelinePool.IsAlive(reinterpret_cast<const VirtualCmdBind*>(payload)->handle));
+            break;
+        case EVirtualCommand::BIND_RESOURCE_SET:
+        case EVirtualCommand::BIND_COMPUTE_RESOURCE_SET:
+            checkAlive(_resourceSetPool.IsAlive(reinterpret_cast<const VirtualCmdBind*>(payload)->handle));
+            break;
+        case EVirtualCommand::BIND_INDEX_BUFFER:
+            checkAlive(_bufferPool.IsAlive(reinterpret_cast<const VirtualCmdBind*>(payload)->handle));
+            break;
+        case EVirtualCommand::BIND_VERTEX_BUFFERS:
+        {
+            const auto* cmd      = reinterpret_cast<const VirtualCmdBindVertexBuffers*>(payload);
+            const uint32* handles = reinterpret_cast<const uint32*>(cmd + 1);
+            for (uint32 i = 0; i < cmd->bufferCount; i++)
+            {
+                checkAlive(_bufferPool.IsAlive(handles[i]));
+            }
+        }
+        break;
+        case EVirtualCommand::TEXTURE_BARRIER:
+            checkAlive(_texturePool.IsAlive(reinterpret_cast<const VirtualCmdBind*>(payload)->handle));
+            break;
+        case EVirtualCommand::COPY_TEXTURE:
+        {
+            const auto* cmd = reinterpret_cast<const VirtualCmdCopyTexture*>(payload);
+            checkAlive(_texturePool.IsAlive(cmd->srcTexture));
+            checkAlive(_texturePool.IsAlive(cmd->dstTexture));
+        }
+        break;
+        case EVirtualCommand::UPDATE_BUFFER:
+        {
+            const auto* cmd         = reinterpret_cast<const VirtualCmdUpdateBuffer*>(payload);
+            BufferVirtual* bufferVT = _bufferPool.Get(cmd->buffer);
+            if (bufferVT == nullptr)
+            {
+                staleHandles++;
+                break;
+            }
+            HS_ASSERT(static_cast<size_t>(cmd->dstOffset) + cmd->dataSize <= bufferVT->storage.size(), "UpdateBuffer is out of bounds");
+            ::memcpy(bufferVT->storage.data() + cmd->dstOffset, cmd + 1, cmd->dataSize);
+        }
+        break;
+        case EVirtualCommand::RESET_QUERY_POOL:
+        case EVirtualCommand::WRITE_TIMESTAMP:
+        case EVirtualCommand::END_QUERY:
+        {
+            const auto* cmd              = reinterpret_cast<const VirtualCmdQuery*>(payload);
+            QueryPoolVirtual* queryPoolVT = _queryPoolPool.Get(cmd->queryPool);
+            if (queryPoolVT == nullptr)
+            {
+                staleHandles++;
+                break;
+            }
+
+            // 타임스탬프는 재생 시점의 CPU 시간(ns)이다. 구간 측정값은 엔진이 아닌 Submit 처리 비용이 된다.
+            const uint64 timestamp  = (header.type == EVirtualCommand::WRITE_TIMESTAMP)
+                                          ? static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())
+                                          : 0;
+            const uint8 isAvailable = (header.type == EVirtualCommand::RESET_QUERY_POOL) ? 0 : 1;
+            for (uint32 i = cmd->firstQuery; i < cmd->firstQuery + cmd->queryCount; i++)
+            {
+                queryPoolVT->results[i]     = timestamp;
+                queryPoolVT->isAvailable[i] = isAvailable;
+            }
+        }
+        break;
+        default:
+            break;
+        }
+    }
+
+    if (staleHandles > 0)
+    {
+        HS_LOG(warning, "%u commands in \"%s\" reference destroyed objects.", staleHandles, commandBuffer->GetName().c_str());
+    }
+    _frameStats.staleHandles += staleHandles;
+}
+
+HS_NS_END
@@ -0,0 +1,78 @@
+#include "RHI/Virtual/VirtualSwapchain.h"
+
+#include "RHI/Virtual/VirtualContext.h"
+
+HS_NS_BEGIN
+
+SwapchainVirtual::SwapchainVirtual(const SwapchainInfo& info)
+    : Swapchain(info)
+{}
+
+SwapchainVirtual::~SwapchainVirtual()
+{}
+
+void SwapchainVirtual::initSwapchain(VirtualContext* context)
+{
+    const uint32 width  = _info.nativeWindow->surfaceWidth;
+    const uint32 height = _info.nativeWindow->surfaceHeight;
+
+    Attachment colorAttachment{};
+    colorAttachment.format         = EPixelFormat::B8G8A8R8_UNORM;
+    colorAttachment.clearValue     = ClearValue(0.3, 0.3, 0.3, 1.0);
+    colorAttachment.loadAction     = ELoadAction::CLEAR;
+    colorAttachment.storeAction    = EStoreAction::STORE;
+    colorAttachment.isDepthStencil = false;
+
+    RenderPassInfo rpInfo{};
+    rpInfo.isSwapchainRenderPass     = true;
+    rpInfo.colorAttachments          = {colorAttachment};
+    rpInfo.colorAttachmentCount      = 1;
+    rpInfo.useDepthStencilAttachment = false;
+    _renderPass                      = context->CreateRenderPass("Swapchain RenderPass", rpInfo);
+
+    for (uint8 i = 0; i < MAX_FRAME_COUNT; i++)
+    {
+        _commandBuffers[i] = context->CreateCommandBuffer("CommandBuffer in Swapchain");
+        _textures[i]       = context->CreateTexture("Swapchain Framebuffer Texture", nullptr, width, height, EPixelFormat::B8G8A8R8_UNORM, ETextureType::TEX_2D, ETextureUsage::COLOR_ATTACHMENT);
+
+        FramebufferInfo fbInfo{};
+        fbInfo.depthStencilBuffer     = nullptr;
+        fbInfo.resolveBuffer          = nullptr;
+        fbInfo.isSwapchainFramebuffer = true;
+        fbInfo.width                  = width;
+        fbInfo.height                 = height;
+        fbInfo.renderPass             = _renderPass;
+        fbInfo.colorBuffers.push_back(_textures[i]);
+        _framebuffers[i] = context->CreateFramebuffer("Swapchain Framebuffer", fbInfo);
+    }
+}
+
+void SwapchainVirtual::destroySwapchain(VirtualContext* context)
+{
+    for (uint8 i = 0; i < MAX_FRAME_COUNT; i++)
+    {
+        if (_framebuffers[i])
+        {
+            context->DestroyFramebuffer(_framebuffers[i]);
+            _framebuffers[i] = nullptr;
+        }
+        if (_textures[i])
+        {
+            context->DestroyTexture(_textures[i]);
+            _textures[i] = nullptr;
+        }
+        if (_commandBuffers[i])
+        {
+            context->DestroyCommandBuffer(_commandBuffers[i]);
+            _commandBuffers[i] = nullptr;
+        }
+    }
+
+    if (_renderPass)
+    {
+        context->DestroyRenderPass(_renderPass);
+        _renderPass = nullptr;
+    }
+}
+
+HS_NS_END
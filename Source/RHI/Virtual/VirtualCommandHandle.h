@@ -0,0 +1,202 @@
+//
+//  VirtualCommandHandle.h
+//  RHI
+//
+//  CPU-only command buffer. Records into a compact command stream and counts state changes.
+//
+#ifndef __HS_COMMAND_HANDLE_VIRTUAL_H__
+#define __HS_COMMAND_HANDLE_VIRTUAL_H__
+
+#include "Precompile.h"
+
+#include "RHI/CommandHandle.h"
+#include "RHI/ResourceHandle.h"
+#include "RHI/RenderHandle.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+enum class EVirtualCommand : uint16
+{
+    BEGIN_RENDER_PASS,
+    END_RENDER_PASS,
+    BIND_PIPELINE,
+    BIND_RESOURCE_SET,
+    SET_VIEWPORT,
+    SET_SCISSOR,
+    BIND_INDEX_BUFFER,
+    BIND_VERTEX_BUFFERS,
+    DRAW,
+    DRAW_INDEXED,
+
+    BIND_COMPUTE_PIPELINE,
+    BIND_COMPUTE_RESOURCE_SET,
+    DISPATCH,
+    END_COMPUTE_PASS,
+
+    TEXTURE_BARRIER,
+    COPY_TEXTURE,
+    UPDATE_BUFFER,
+
+    PUSH_DEBUG_MARK,
+    POP_DEBUG_MARK,
+
+    RESET_QUERY_POOL,
+    WRITE_TIMESTAMP,
+    BEGIN_QUERY,
+    END_QUERY,
+
+    COUNT,
+};
+
+// 스트림의 모든 커맨드는 이 헤더로 시작하고, 뒤에 size 바이트의 페이로드가 따라온다.
+// 객체는 포인터 대신 HandlePool 핸들(uint32)로 기록하므로 Submit 시점에 이미 파괴된 객체를 잡아낼 수 있다.
+// UpdateBuffer 페이로드(12 + 최대 65536바이트)가 들어가도록 size는 32비트다.
+struct VirtualCommandHeader
+{
+    EVirtualCommand type;
+    uint16          reserved;
+    uint32          size; // 페이로드 크기. 항상 4의 배수.
+};
+
+static_assert(sizeof(VirtualCommandHeader) == 8, "VirtualCommandHeader layout");
+
+// 커맨드별 페이로드. 가변 길이 데이터(정점 버퍼 목록, 업로드 데이터, 라벨)는 구조체 바로 뒤에 이어진다.
+struct VirtualCmdBeginRenderPass { uint32 renderPass; uint32 framebuffer; Area renderArea; };
+struct VirtualCmdBind            { uint32 handle; };
+struct VirtualCmdSetViewport     { Viewport viewport; };
+struct VirtualCmdSetScissor      { uint32 x; uint32 y; uint32 width; uint32 height; };
+struct VirtualCmdBindVertexBuffers { uint32 bufferCount; /* uint32 handles[bufferCount], uint32 offsets[bufferCount] */ };
+struct VirtualCmdDraw            { uint32 firstVertex; uint32 vertexCount; uint32 instanceCount; };
+struct VirtualCmdDrawIndexed     { uint32 firstIndex; uint32 indexCount; uint32 instanceCount; uint32 vertexOffset; };
+struct VirtualCmdDispatch        { uint32 groupCountX; uint32 groupCountY; uint32 groupCountZ; };
+struct VirtualCmdCopyTexture     { uint32 srcTexture; uint32 dstTexture; };
+struct VirtualCmdUpdateBuffer    { uint32 buffer; uint32 dstOffset; uint32 dataSize; /* uint8 data[dataSize] */ };
+struct VirtualCmdDebugMark       { uint32 length; /* char label[length] */ };
+struct VirtualCmdQuery           { uint32 queryPool; uint32 firstQuery; uint32 queryCount; };
+
+// 기록 시점에 집계한다. redundant는 직전과 같은 상태를 다시 설정한 횟수로, 엔진 쪽에서 걸러낼 수 있었던 호출이다.
+struct HS_API VirtualCommandStats
+{
+    uint32 commandCount = 0;
+    uint32 streamBytes  = 0;
+
+    uint32 renderPasses  = 0;
+    uint32 computePasses = 0;
+    uint32 drawCalls     = 0;
+    uint32 dispatches    = 0;
+    uint64 vertices      = 0; // 인스턴스를 곱한 정점(인덱스) 수
+    uint64 instances     = 0;
+
+    uint32 pipelineBinds             = 0;
+    uint32 redundantPipelineBinds    = 0;
+    uint32 resourceSetBinds          = 0;
+    uint32 redundantResourceSetBinds = 0;
+    uint32 vertexBufferBinds         = 0;
+    uint32 redundantVertexBufferBinds = 0;
+    uint32 indexBufferBinds          = 0;
+    uint32 redundantIndexBufferBinds = 0;
+    uint32 viewportChanges           = 0;
+    uint32 redundantViewportChanges  = 0;
+    uint32 scissorChanges            = 0;
+    uint32 redundantScissorChanges   = 0;
+
+    uint32 barriers      = 0;
+    uint32 copies        = 0;
+    uint32 bufferUpdates = 0;
+    uint64 uploadBytes   = 0;
+    uint32 debugMarks    = 0;
+    uint32 queries       = 0;
+
+    void Accumulate(const VirtualCommandStats& other);
+
+    HS_FORCEINLINE uint32 GetStateChanges() const
+    {
+        return pipelineBinds + resourceSetBinds + vertexBufferBinds + indexBufferBinds + viewportChanges + scissorChanges;
+    }
+
+    HS_FORCEINLINE uint32 GetRedundantStateChanges() const
+    {
+        return redundantPipelineBinds + redundantResourceSetBinds + redundantVertexBufferBinds + redundantIndexBufferBinds + redundantViewportChanges + redundantScissorChanges;
+    }
+};
+
+struct HS_API CommandPoolVirtual : public RHICommandPool
+{
+    CommandPoolVirtual(const char* name) : RHICommandPool(name) {}
+    ~CommandPoolVirtual() override = default;
+};
+
+struct HS_API CommandBufferVirtual : public RHICommandBuffer
+{
+    CommandBufferVirtual(const char* name);
+    ~CommandBufferVirtual() override;
+
+    void Begin() override;
+    void End() override;
+    void Reset() override;
+
+    void BeginRenderPass(RHIRenderPass* renderPass, RHIFramebuffer* framebuffer, const Area& renderArea) override;
+
+    void BindPipeline(RHIGraphicsPipeline* pipeline) override;
+    void BindResourceSet(RHIResourceSet* rSet) override;
+    void SetViewport(const Viewport& viewport) override;
+    void SetScissor(const uint32 x, const uint32 y, const uint32 width, const uint32 height) override;
+    void BindIndexBuffer(RHIBuffer* indexBuffer) override;
+    void BindVertexBuffers(const RHIBuffer* const* vertexBuffers, const uint32* offsets, const uint8 bufferCount) override;
+    void DrawArrays(const uint32 firstVertex, const uint32 vertexCount, const uint32 instanceCount) override;
+    void DrawIndexed(const uint32 firstIndex, const uint32 indexCount, const uint32 instanceCount, const uint32 vertexOffset) override;
+
+    void EndRenderPass() override;
+
+    // Compute commands
+    void BindComputePipeline(RHIComputePipeline* pipeline) override;
+    void BindComputeResourceSet(RHIResourceSet* rSet) override;
+    void Dispatch(uint32 groupCountX, uint32 groupCountY, uint32 groupCountZ) override;
+    void EndComputePass() override;
+
+    // Memory barriers
+    void TextureBarrier(RHITexture* texture) override;
+
+    void CopyTexture(RHITexture* srcTexture, RHITexture* dstTexture) override;
+    void UpdateBuffer(RHIBuffer* buffer, const size_t dstOffset, const void* srcData, const size_t dataSize) override;
+
+    void PushDebugMark(const char* label, float color[4]) override;
+    void PopDebugMark() override;
+
+    void ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount) override;
+    void WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex) override;
+    void BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+    void EndQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+
+    HS_FORCEINLINE const uint8*               GetStream() const { return stream.data(); }
+    HS_FORCEINLINE size_t                     GetStreamSize() const { return stream.size(); }
+    HS_FORCEINLINE const VirtualCommandStats& GetStats() const { return stats; }
+
+    // 스트림 용량은 Reset 후에도 유지되므로 정상 상태에서는 프레임마다 할당하지 않는다.
+    std::vector<uint8>  stream;
+    VirtualCommandStats stats;
+
+private:
+    void* push(EVirtualCommand type, size_t payloadSize);
+    void  clearBoundState();
+
+    const RHIGraphicsPipeline* _curPipeline        = nullptr;
+    const RHIComputePipeline*  _curComputePipeline = nullptr;
+    const RHIResourceSet*      _curResourceSet     = nullptr;
+    const RHIResourceSet*      _curComputeResourceSet = nullptr;
+    const RHIBuffer*           _curIndexBuffer     = nullptr;
+    const RHIBuffer*           _curVertexBuffers[MAX_VERTEX_INPUT_LAYOUTS] = {};
+    uint32                     _curVertexOffsets[MAX_VERTEX_INPUT_LAYOUTS] = {};
+    uint8                      _curVertexBufferCount = 0;
+    Viewport                   _curViewport{};
+    uint32                     _curScissor[4] = {};
+    bool                       _hasViewport   = false;
+    bool                       _hasScissor    = false;
+    uint32                     _debugDepth    = 0;
+};
+
+HS_NS_END
+
+#endif /* __HS_COMMAND_HANDLE_VIRTUAL_H__ */
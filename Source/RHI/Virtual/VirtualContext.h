@@ -0,0 +1,184 @@
+//
+//  VirtualContext.h
+//  RHI
+//
+//  RHI backend without a GPU. Every object is a CPU-side record and command buffers are replayed
+//  on Submit only to apply buffer updates and queries, so the measured cost is the engine's own.
+//
+#ifndef __HS_RHI_CONTEXT_VIRTUAL_H__
+#define __HS_RHI_CONTEXT_VIRTUAL_H__
+
+#include "Precompile.h"
+
+#include "RHI/RHIContext.h"
+#include "RHI/Virtual/VirtualCommandHandle.h"
+#include "RHI/Virtual/VirtualRenderHandle.h"
+#include "RHI/Virtual/VirtualResourceHandle.h"
+
+#include "Core/Memory/HandlePool.h"
+
+#include <atomic>
+
+HS_NS_BEGIN
+
+struct HS_API VirtualFrameStats
+{
+    VirtualCommandStats commands;
+
+    uint32 submits        = 0;
+    uint32 commandBuffers = 0;
+    uint32 createCalls    = 0;
+    uint32 destroyCalls   = 0;
+    uint32 staleHandles   = 0; // Submit 시점에 이미 파괴된 객체를 참조한 커맨드 수
+
+    void Accumulate(const VirtualFrameStats& other);
+};
+
+class HS_API VirtualContext final : public RHIContext
+{
+public:
+    VirtualContext() = default;
+    ~VirtualContext() final;
+
+    bool Initialize() final;
+    void Finalize() final;
+
+    void Suspend(Swapchain* swapchain) final;
+    void Restore(Swapchain* swapchain) final;
+
+    uint32 AcquireNextImage(Swapchain* swapchain) final;
+
+    Swapchain* CreateSwapchain(SwapchainInfo info) final;
+    void DestroySwapchain(Swapchain* swapchain) final;
+
+    RHIRenderPass* CreateRenderPass(const char* name, const RenderPassInfo& info) final;
+    void DestroyRenderPass(RHIRenderPass* renderPass) final;
+
+    RHIFramebuffer* CreateFramebuffer(const char* name, const FramebufferInfo& info) final;
+    void DestroyFramebuffer(RHIFramebuffer* framebuffer) final;
+
+    RHIGraphicsPipeline* CreateGraphicsPipeline(const char* name, const GraphicsPipelineInfo& info) final;
+    void DestroyGraphicsPipeline(RHIGraphicsPipeline* pipeline) final;
+
+    RHIComputePipeline* CreateComputePipeline(const char* name, const ComputePipelineInfo& info) final;
+    void DestroyComputePipeline(RHIComputePipeline* pipeline) final;
+
+    RHIShader* CreateShader(const char* name, const ShaderInfo& info, const char* path) final;
+    RHIShader* CreateShader(const char* name, const ShaderInfo& info, const char* byteCode, size_t byteCodeSize) final;
+    void DestroyShader(RHIShader* shader) final;
+
+    RHIBuffer* CreateBuffer(const char* name, const void* data, size_t dataSize, EBufferUsage usage, EBufferMemoryOption memoryOption) final;
+    RHIBuffer* CreateBuffer(const char* name, const void* data, size_t dataSize, const BufferInfo& info) final;
+    void DestroyBuffer(RHIBuffer* buffer) final;
+
+    RHITexture* CreateTexture(const char* name, void* image, const TextureInfo& info) final;
+    RHITexture* CreateTexture(const char* name, void* image, uint32 width, uint32 height, EPixelFormat format, ETextureType type, ETextureUsage usage) final;
+    void DestroyTexture(RHITexture* texture) final;
+
+    RHISampler* CreateSampler(const char* name, const SamplerInfo& info) final;
+    void DestroySampler(RHISampler* sampler) final;
+
+    RHIResourceLayout* CreateResourceLayout(const char* name, ResourceBinding* bindings, uint32 bindingCount) final;
+    void DestroyResourceLayout(RHIResourceLayout* resourceLayout) final;
+
+    RHIResourceSet* CreateResourceSet(const char* name, RHIResourceLayout* resourceLayouts) final;
+    void DestroyResourceSet(RHIResourceSet* resourceSet) final;
+
+    RHIResourceSetPool* CreateResourceSetPool(const char* name, uint32 bufferSize, uint32 textureSize) final;
+    void DestroyResourceSetPool(RHIResourceSetPool* resourceSetPool) final;
+
+    RHICommandPool* CreateCommandPool(const char* name, uint32 queueFamilyIndex = 0) final;
+    void DestroyCommandPool(RHICommandPool* cmdPool) final;
+
+    RHICommandBuffer* CreateCommandBuffer(const char* name) final;
+    void DestroyCommandBuffer(RHICommandBuffer* commandBuffer) final;
+
+    RHIQueryPool* CreateQueryPool(const char* name, const QueryPoolInfo& info) final;
+    void DestroyQueryPool(RHIQueryPool* queryPool) final;
+
+    bool GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize) final;
+
+    double GetTimestampPeriod() const final { return 1.0; }
+    bool IsPipelineStatisticsSupported() const final { return false; }
+    bool IsAlive(RHIHandle::EType type, uint32 poolHandle) const final;
+
+    void Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount) final;
+
+    void Present(Swapchain* swapchain) final;
+
+    void WaitForIdle() const final {}
+
+    HS_FORCEINLINE ERHIPlatform GetCurrentPlatform() const override { return ERHIPlatform::VIRTUAL; }
+
+    // 마지막으로 Present된 프레임의 통계와 Initialize 이후 누적 통계.
+    HS_FORCEINLINE const VirtualFrameStats& GetLastFrameStats() const { return _lastFrameStats; }
+    HS_FORCEINLINE const VirtualFrameStats& GetTotalStats() const { return _totalStats; }
+    HS_FORCEINLINE uint64                   GetPresentedFrameCount() const { return _presentCount; }
+    void ResetStats();
+
+    HS_FORCEINLINE uint32 GetLiveBufferCount() const { return _bufferPool.GetLiveCount(); }
+    HS_FORCEINLINE uint32 GetLiveTextureCount() const { return _texturePool.GetLiveCount(); }
+    HS_FORCEINLINE uint32 GetLiveGraphicsPipelineCount() const { return _graphicsPipelinePool.GetLiveCount(); }
+    HS_FORCEINLINE uint32 GetLiveFramebufferCount() const { return _framebufferPool.GetLiveCount(); }
+    HS_FORCEINLINE uint32 GetLiveResourceSetCount() const { return _resourceSetPool.GetLiveCount(); }
+
+private:
+    void execute(const CommandBufferVirtual* commandBuffer);
+
+    template <typename T, typename... Args>
+    HS_FORCEINLINE T* createPooled(HandlePool<T>& pool, Args&&... args)
+    {
+        uint32 poolHandle = HandlePool<T>::INVALID_HANDLE;
+        T* object         = pool.Create(poolHandle, std::forward<Args>(args)...);
+        if (nullptr == object)
+        {
+            HS_LOG(error, "VirtualContext: Failed to allocate RHI object. The pool is full.");
+            return nullptr;
+        }
+        object->SetPoolHandle(poolHandle);
+        _createCalls.fetch_add(1, std::memory_order_relaxed);
+        return object;
+    }
+
+    template <typename T>
+    HS_FORCEINLINE void destroyPooled(HandlePool<T>& pool, RHIHandle* object)
+    {
+        if (object == nullptr)
+        {
+            return;
+        }
+        // 이미 반환된 객체일 수 있으므로 객체에서 핸들을 읽지 않고 주소로 슬롯을 찾는다.
+        pool.Destroy(pool.FindHandle(static_cast<T*>(object)));
+        _destroyCalls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    HandlePool<RenderPassVirtual> _renderPassPool;
+    HandlePool<FramebufferVirtual> _framebufferPool;
+    HandlePool<GraphicsPipelineVirtual> _graphicsPipelinePool;
+    HandlePool<ComputePipelineVirtual> _computePipelinePool;
+    HandlePool<ShaderVirtual> _shaderPool;
+    HandlePool<BufferVirtual> _bufferPool;
+    HandlePool<TextureVirtual> _texturePool;
+    HandlePool<SamplerVirtual> _samplerPool;
+    HandlePool<ResourceLayoutVirtual> _resourceLayoutPool;
+    HandlePool<ResourceSetVirtual> _resourceSetPool;
+    HandlePool<ResourceSetPoolVirtual> _resourceSetPoolPool;
+    HandlePool<CommandPoolVirtual> _commandPoolPool;
+    HandlePool<CommandBufferVirtual> _commandBufferPool;
+    HandlePool<QueryPoolVirtual> _queryPoolPool;
+
+    // Create/Destroy는 여러 스레드에서 불릴 수 있으므로 따로 세고 Present에서 프레임 통계로 옮긴다.
+    std::atomic<uint32> _createCalls{0};
+    std::atomic<uint32> _destroyCalls{0};
+
+    VirtualFrameStats _frameStats;
+    VirtualFrameStats _lastFrameStats;
+    VirtualFrameStats _totalStats;
+    uint64            _presentCount = 0;
+
+    bool _isInitialized = false;
+};
+
+HS_NS_END
+
+#endif /* __HS_RHI_CONTEXT_VIRTUAL_H__ */
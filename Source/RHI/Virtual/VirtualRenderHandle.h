@@ -0,0 +1,58 @@
+//
+//  VirtualRenderHandle.h
+//  RHI
+//
+//  CPU-only render passes, framebuffers, pipelines and query pools.
+//
+#ifndef __HS_RENDER_HANDLE_VIRTUAL_H__
+#define __HS_RENDER_HANDLE_VIRTUAL_H__
+
+#include "Precompile.h"
+
+#include "RHI/RenderHandle.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+struct HS_API RenderPassVirtual : public RHIRenderPass
+{
+    RenderPassVirtual(const char* name, const RenderPassInfo& info) : RHIRenderPass(name, info) {}
+    ~RenderPassVirtual() override = default;
+};
+
+struct HS_API FramebufferVirtual : public RHIFramebuffer
+{
+    FramebufferVirtual(const char* name, const FramebufferInfo& info) : RHIFramebuffer(name, info) {}
+    ~FramebufferVirtual() override = default;
+};
+
+struct HS_API GraphicsPipelineVirtual : public RHIGraphicsPipeline
+{
+    GraphicsPipelineVirtual(const char* name, const GraphicsPipelineInfo& info) : RHIGraphicsPipeline(name, info) {}
+    ~GraphicsPipelineVirtual() override = default;
+};
+
+struct HS_API ComputePipelineVirtual : public RHIComputePipeline
+{
+    ComputePipelineVirtual(const char* name, const ComputePipelineInfo& info) : RHIComputePipeline(name, info) {}
+    ~ComputePipelineVirtual() override = default;
+};
+
+// 결과는 Submit에서 스트림을 재생할 때 채워진다. TIMESTAMP는 CPU 시계(ns) 값이다.
+struct HS_API QueryPoolVirtual : public RHIQueryPool
+{
+    QueryPoolVirtual(const char* name, const QueryPoolInfo& info)
+        : RHIQueryPool(name, info)
+        , results(info.queryCount, 0)
+        , isAvailable(info.queryCount, 0)
+    {}
+    ~QueryPoolVirtual() override = default;
+
+    std::vector<uint64> results;
+    std::vector<uint8>  isAvailable;
+};
+
+HS_NS_END
+
+#endif /* __HS_RENDER_HANDLE_VIRTUAL_H__ */
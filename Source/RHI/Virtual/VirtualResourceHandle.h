@@ -0,0 +1,67 @@
+//
+//  VirtualResourceHandle.h
+//  RHI
+//
+//  CPU-only resources. Buffers keep their contents in system memory, textures keep only their description.
+//
+#ifndef __HS_RESOURCE_HANDLE_VIRTUAL_H__
+#define __HS_RESOURCE_HANDLE_VIRTUAL_H__
+
+#include "Precompile.h"
+
+#include "RHI/ResourceHandle.h"
+
+#include <vector>
+
+HS_NS_BEGIN
+
+struct HS_API TextureVirtual : public RHITexture
+{
+    TextureVirtual(const char* name, const TextureInfo& info) noexcept : RHITexture(name, info) {}
+    ~TextureVirtual() final = default;
+};
+
+struct HS_API SamplerVirtual : public RHISampler
+{
+    SamplerVirtual(const char* name, const SamplerInfo& info) noexcept : RHISampler(name, info) {}
+    ~SamplerVirtual() final = default;
+};
+
+struct HS_API BufferVirtual : public RHIBuffer
+{
+    BufferVirtual(const char* name, const BufferInfo& info) noexcept : RHIBuffer(name, info) {}
+    ~BufferVirtual() final = default;
+
+    // UpdateBuffer는 Submit 시점에 여기에 반영된다.
+    std::vector<uint8> storage;
+};
+
+struct HS_API ShaderVirtual : public RHIShader
+{
+    ShaderVirtual(const char* name, const ShaderInfo& info) noexcept : RHIShader(name, info) {}
+    ~ShaderVirtual() final = default;
+
+    size_t byteCodeSize = 0;
+};
+
+struct HS_API ResourceLayoutVirtual : public RHIResourceLayout
+{
+    ResourceLayoutVirtual(const char* name, ResourceBinding* bindings, size_t bindingCount) noexcept : RHIResourceLayout(name, bindings, bindingCount) {}
+    ~ResourceLayoutVirtual() final = default;
+};
+
+struct HS_API ResourceSetVirtual : public RHIResourceSet
+{
+    ResourceSetVirtual(const char* name) noexcept : RHIResourceSet(name) {}
+    ~ResourceSetVirtual() final = default;
+};
+
+struct HS_API ResourceSetPoolVirtual : public RHIResourceSetPool
+{
+    ResourceSetPoolVirtual(const char* name) noexcept : RHIResourceSetPool(name) {}
+    ~ResourceSetPoolVirtual() final = default;
+};
+
+HS_NS_END
+
+#endif /* __HS_RESOURCE_HANDLE_VIRTUAL_H__ */
@@ -0,0 +1,52 @@
+//
+//  VirtualSwapchain.h
+//  RHI
+//
+//  Swapchain of CPU-only textures. Acquire and Present only advance the frame index.
+//
+#ifndef __HS_SWAPCHAIN_VIRTUAL_H__
+#define __HS_SWAPCHAIN_VIRTUAL_H__
+
+#include "Precompile.h"
+
+#include "RHI/Swapchain.h"
+#include "RHI/Virtual/VirtualCommandHandle.h"
+
+HS_NS_BEGIN
+
+class VirtualContext;
+
+class HS_API SwapchainVirtual final : public Swapchain
+{
+public:
+    friend class VirtualContext;
+    SwapchainVirtual(const SwapchainInfo& info);
+    ~SwapchainVirtual() override;
+
+    HS_FORCEINLINE uint8 GetMaxFrameCount() const override { return MAX_FRAME_COUNT; }
+    HS_FORCEINLINE uint8 GetCurrentFrameIndex() const override { return _frameIndex; }
+    HS_FORCEINLINE uint8 GetCurrentImageIndex() const override { return _frameIndex; }
+    HS_FORCEINLINE RHICommandBuffer* GetCommandBufferForCurrentFrame() const override { return _commandBuffers[_frameIndex]; }
+    HS_FORCEINLINE RHICommandBuffer* GetCommandBufferByIndex(uint8 index) const override
+    {
+        HS_ASSERT(index < MAX_FRAME_COUNT, "out of index");
+        return _commandBuffers[index];
+    }
+    HS_FORCEINLINE RHIFramebuffer* GetFramebufferForCurrentFrame() const override { return _framebuffers[_frameIndex]; }
+
+private:
+    static constexpr uint8 MAX_FRAME_COUNT = 2;
+
+    void initSwapchain(VirtualContext* context);
+    void destroySwapchain(VirtualContext* context);
+
+    uint8              _frameIndex = static_cast<uint8>(-1);
+    RHICommandBuffer*  _commandBuffers[MAX_FRAME_COUNT] = {};
+    RHITexture*        _textures[MAX_FRAME_COUNT]       = {};
+    RHIFramebuffer*    _framebuffers[MAX_FRAME_COUNT]   = {};
+    bool               _isSuspended = false;
+};
+
+HS_NS_END
+
+#endif /* __HS_SWAPCHAIN_VIRTUAL_H__ */
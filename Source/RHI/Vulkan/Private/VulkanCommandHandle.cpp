@@ -4,6 +4,8 @@
 #include "RHI/Vulkan/VulkanRenderHandle.h"
 #include "RHI/Vulkan/VulkanResourceHandle.h"
 
+#include "Core/Memory/MemoryPool.h"
+
 HS_NS_BEGIN
 
 CommandQueueVulkan::CommandQueueVulkan(const char* name)
@@ -68,8 +70,6 @@ void CommandBufferVulkan::Reset()
 
 void CommandBufferVulkan::BeginRenderPass(RHIRenderPass* renderPass, RHIFramebuffer* framebuffer, const Area& renderArea)
 {
-	static std::vector<VkClearValue> clearValues;
-
 	HS_ASSERT(renderPass && framebuffer, "both renderPass and framebuffer should't be nullptr");
 	HS_ASSERT(_isBegan, "CommandBuffer has not began");
 	HS_ASSERT(_isGraphicsBegan == false, "Graphics Pass is already began");
@@ -84,10 +84,10 @@ void CommandBufferVulkan::BeginRenderPass(RHIRenderPass* renderPass, RHIFramebuf
 	HS_ASSERT(framebufferInfo.renderPass == renderPass, "RenderPass and Framebuffer are not matched.");
 
 	uint8 attachmentCount = static_cast<uint8>(renderPassInfo.colorAttachmentCount) + static_cast<uint8>(renderPassInfo.useDepthStencilAttachment);
-	if (clearValues.size() < attachmentCount)
-	{
-		clearValues.resize(attachmentCount);
-	}
+
+	StackAllocator& scratch = StackAllocator::GetThreadLocal();
+	ScopedStackMarker scratchMarker(scratch);
+	VkClearValue* clearValues = scratch.AllocateArray<VkClearValue>(attachmentCount);
 
 	size_t attachmentIndex = 0;
 	for (; attachmentIndex < renderPassInfo.colorAttachmentCount; attachmentIndex++)
@@ -111,7 +111,7 @@ void CommandBufferVulkan::BeginRenderPass(RHIRenderPass* renderPass, RHIFramebuf
 	VkRenderPassBeginInfo beginInfo{};
 	beginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
 	beginInfo.clearValueCount = attachmentCount;
-	beginInfo.pClearValues = clearValues.data();
+	beginInfo.pClearValues = clearValues;
 	beginInfo.renderArea = area;
 	beginInfo.renderPass = renderPassVK->handle;
 	beginInfo.framebuffer = framebufferVK->handle;
@@ -177,14 +177,17 @@ void CommandBufferVulkan::BindIndexBuffer(RHIBuffer* indexBuffer)
 	HS_ASSERT(indexBuffer, "Index Buffer is nullptr");
 
 	BufferVulkan* indexBufferVK = static_cast<BufferVulkan*>(indexBuffer);
+	const VkIndexType indexType = indexBufferVK->info.indexFormat == EIndexFormat::UINT16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
 
-
+	vkCmdBindIndexBuffer(handle, indexBufferVK->handle, 0, indexType);
 }
 
 void CommandBufferVulkan::BindVertexBuffers(const RHIBuffer* const* vertexBuffers, const uint32* offsets, const uint8 bufferCount)
 {
-	std::vector<VkBuffer> vertexBufferHandles(bufferCount);
-	std::vector<VkDeviceSize> vertexOffsets(bufferCount);
+	StackAllocator& scratch = StackAllocator::GetThreadLocal();
+	ScopedStackMarker scratchMarker(scratch);
+	VkBuffer* vertexBufferHandles = scratch.AllocateArray<VkBuffer>(bufferCount);
+	VkDeviceSize* vertexOffsets = scratch.AllocateArray<VkDeviceSize>(bufferCount);
 	for (uint8 i = 0; i < bufferCount; i++)
 	{
 		HS_ASSERT(vertexBuffers[i], "Vertex Buffer is nullptr at index %d", i);
@@ -193,7 +196,7 @@ void CommandBufferVulkan::BindVertexBuffers(const RHIBuffer* const* vertexBuffer
 		vertexOffsets[i] = static_cast<VkDeviceSize>(offsets[i]);
 	}
 
-	vkCmdBindVertexBuffers(handle, 0, bufferCount, vertexBufferHandles.data(), vertexOffsets.data());
+	vkCmdBindVertexBuffers(handle, 0, bufferCount, vertexBufferHandles, vertexOffsets);
 }
 
 void CommandBufferVulkan::DrawArrays(const uint32 firstVertex, const uint32 vertexCount, const uint32 instanceCount)
@@ -203,7 +206,7 @@ void CommandBufferVulkan::DrawArrays(const uint32 firstVertex, const uint32 vert
 
 void CommandBufferVulkan::DrawIndexed(const uint32 firstIndex, const uint32 indexCount, const uint32 instanceCount, const uint32 vertexOffset)
 {
-	// TODO:
+	vkCmdDrawIndexed(handle, indexCount, instanceCount, firstIndex, static_cast<int32>(vertexOffset), 0);
 }
 
 void CommandBufferVulkan::EndRenderPass()
@@ -235,12 +238,64 @@ void CommandBufferVulkan::UpdateBuffer(RHIBuffer* buffer, const size_t dstOffset
 
 void CommandBufferVulkan::PushDebugMark(const char* label, float color[4])
 {
-	
+	if (nullptr == cmdBeginDebugLabel)
+	{
+		return;
+	}
+
+	VkDebugUtilsLabelEXT labelInfo{};
+	labelInfo.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
+	labelInfo.pLabelName = label;
+	if (nullptr != color)
+	{
+		::memcpy(labelInfo.color, color, sizeof(float[4]));
+	}
+
+	cmdBeginDebugLabel(handle, &labelInfo);
 }
 
 void CommandBufferVulkan::PopDebugMark()
 {
+	if (nullptr == cmdEndDebugLabel)
+	{
+		return;
+	}
+
+	cmdEndDebugLabel(handle);
+}
+
+void CommandBufferVulkan::ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount)
+{
+	HS_ASSERT(_isBegan, "CommandBuffer has not began");
+	HS_ASSERT(false == _isGraphicsBegan, "Query pool must be reset outside of a render pass");
+	HS_ASSERT(queryPool, "Query pool is nullptr");
+
+	vkCmdResetQueryPool(handle, static_cast<QueryPoolVulkan*>(queryPool)->handle, firstQuery, queryCount);
+}
+
+void CommandBufferVulkan::WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+	HS_ASSERT(_isBegan, "CommandBuffer has not began");
+	HS_ASSERT(queryPool && queryPool->info.type == EQueryType::TIMESTAMP, "Query pool is not a timestamp pool");
+
+	// 앞선 명령이 모두 끝난 시점을 기록하므로 연속된 두 타임스탬프의 차이가 그 사이 명령의 GPU 시간이 된다.
+	vkCmdWriteTimestamp(handle, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, static_cast<QueryPoolVulkan*>(queryPool)->handle, queryIndex);
+}
+
+void CommandBufferVulkan::BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+	HS_ASSERT(_isBegan, "CommandBuffer has not began");
+	HS_ASSERT(queryPool && queryPool->info.type != EQueryType::TIMESTAMP, "Timestamp queries use WriteTimestamp");
+
+	vkCmdBeginQuery(handle, static_cast<QueryPoolVulkan*>(queryPool)->handle, queryIndex, 0);
+}
+
+void CommandBufferVulkan::EndQuery(RHIQueryPool* queryPool, uint32 queryIndex)
+{
+	HS_ASSERT(_isBegan, "CommandBuffer has not began");
+	HS_ASSERT(queryPool && queryPool->info.type != EQueryType::TIMESTAMP, "Timestamp queries use WriteTimestamp");
 
+	vkCmdEndQuery(handle, static_cast<QueryPoolVulkan*>(queryPool)->handle, queryIndex);
 }
 
 void CommandBufferVulkan::BindComputePipeline(RHIComputePipeline* pipeline)
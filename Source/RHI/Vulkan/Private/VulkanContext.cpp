@@ -8,10 +8,13 @@
 #include "RHI/Vulkan/VulkanSwapchain.h"
 
 #include "Core/Utility/StringUtility.h"
+#include "Core/Memory/MemoryPool.h"
 
 #include "Core/Native/NativeWindow.h"
 #include "Core/HAL/FileSystem.h"
 
+#include <algorithm>
+
 static const std::vector<const char*> s_validationLayers =
     {
 #ifdef _DEBUG
@@ -22,7 +25,7 @@ static const std::vector<const char*> s_validationLayers =
 #ifdef _DEBUG
 static constexpr bool s_enableValidationLayers = true;
 #else
-static constexpr bool enableValidationLayers = false;
+static constexpr bool s_enableValidationLayers = false;
 #endif
 
 static VKAPI_ATTR VkBool32 VKAPI_CALL hs_rhi_vk_report_debug_callback(
@@ -112,6 +115,12 @@ bool VulkanContext::Initialize()
 
     _descriptorPoolAllocator.Initialize(_instanceVk, &_device, 1000, ratios);
 
+    if (_isDebugUtilsEnabled)
+    {
+        _cmdBeginDebugLabel = (PFN_vkCmdBeginDebugUtilsLabelEXT)vkGetInstanceProcAddr(_instanceVk, "vkCmdBeginDebugUtilsLabelEXT");
+        _cmdEndDebugLabel   = (PFN_vkCmdEndDebugUtilsLabelEXT)vkGetInstanceProcAddr(_instanceVk, "vkCmdEndDebugUtilsLabelEXT");
+    }
+
     _isInitialized = true;
 
     return true;
@@ -130,6 +139,8 @@ void VulkanContext::Finalize()
         vkDestroyCommandPool(_device, _defaultCommandPool, nullptr);
         _defaultCommandPool = VK_NULL_HANDLE;
     }
+    // 디바이스는 인스턴스보다 먼저 파괴해야 한다.
+    _device.Destroy();
     if (_instanceVk != VK_NULL_HANDLE)
     {
         vkDestroyInstance(_instanceVk, nullptr);
@@ -170,6 +181,7 @@ void VulkanContext::Restore(Swapchain* swapchain)
     {
         swapchainVK->destroySwapchainVK();
         swapchainVK->initSwapchainVK(this, _instanceVk, &_device);
+        initOffscreenImages(swapchainVK);
     }
 
     swapchainVK->_isSuspended = false;
@@ -188,6 +200,16 @@ uint32 VulkanContext::AcquireNextImage(Swapchain* swapchain)
     vkWaitForFences(_device, 1, &swapchainVK->syncObjects.inFlightFences[curframeIndex], VK_TRUE, UINT64_MAX);
     vkResetFences(_device, 1, &swapchainVK->syncObjects.inFlightFences[curframeIndex]);
 
+    if (swapchainVK->IsOffscreen())
+    {
+        // 이미지와 프레임이 1대1이므로 펜스만 기다리면 해당 이미지를 다시 쓸 수 있다.
+        swapchainVK->_curImageIndex      = curframeIndex;
+        CommandBufferVulkan* cmdBufferVK = static_cast<CommandBufferVulkan*>(swapchainVK->GetCommandBufferForCurrentFrame());
+        vkResetCommandBuffer(cmdBufferVK->handle, 0);
+
+        return swapchainVK->_curImageIndex;
+    }
+
     uint32 imageIndex = 0;
     VkResult result   = vkAcquireNextImageKHR(_device, swapchainVK->handle,
                                               UINT64_MAX, // Timeout
@@ -214,9 +236,38 @@ uint32 VulkanContext::AcquireNextImage(Swapchain* swapchain)
 
 Swapchain* VulkanContext::CreateSwapchain(SwapchainInfo info)
 {
-    VkSurfaceKHR surface         = createSurface(*info.nativeWindow);
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+#if defined(__WINDOWS__)
+    if (!info.isOffscreen && _device.isSwapchainSupported)
+    {
+        surface = createSurface(*info.nativeWindow);
+    }
+#else
+    // Linux에는 창 surface 경로가 없다. 창이 있어도 offscreen으로 그리고 프레임은 readback으로만 꺼낸다.
+    info.isOffscreen = true;
+#endif
+
+    if (surface != VK_NULL_HANDLE)
+    {
+        VkBool32 isPresentSupported = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(_device.physicalDevice, _device.queueFamilyIndices.graphics, surface, &isPresentSupported);
+        if (VK_FALSE == isPresentSupported)
+        {
+            HS_LOG(warning, "Graphics queue cannot present to this surface. Fall back to offscreen swapchain.");
+            vkDestroySurfaceKHR(_instanceVk, surface, nullptr);
+            surface = VK_NULL_HANDLE;
+        }
+    }
+
+    if (surface == VK_NULL_HANDLE)
+    {
+        info.isOffscreen = true;
+        HS_LOG(info, "Create offscreen swapchain (%ux%u)", info.nativeWindow->surfaceWidth, info.nativeWindow->surfaceHeight);
+    }
+
     SwapchainVulkan* swapchainVK = new SwapchainVulkan(info, surface);
     swapchainVK->initSwapchainVK(this, _instanceVk, &_device);
+    initOffscreenImages(swapchainVK);
 
     return static_cast<Swapchain*>(swapchainVK);
 }
@@ -231,7 +282,11 @@ void VulkanContext::DestroySwapchain(Swapchain* swapchain)
 
 RHIRenderPass* VulkanContext::CreateRenderPass(const char* name, const RenderPassInfo& info)
 {
-    RenderPassVulkan* renderPassVK = new RenderPassVulkan(name, info);
+    RenderPassVulkan* renderPassVK = createPooled(_renderPassPool, name, info);
+    if (nullptr == renderPassVK)
+    {
+        return nullptr;
+    }
 
     renderPassVK->handle = createRenderPass(info);
     if (renderPassVK->handle == VK_NULL_HANDLE)
@@ -247,22 +302,30 @@ RHIRenderPass* VulkanContext::CreateRenderPass(const char* name, const RenderPas
 void VulkanContext::DestroyRenderPass(RHIRenderPass* renderPass)
 {
     RenderPassVulkan* renderPassVK = static_cast<RenderPassVulkan*>(renderPass);
+    if (false == isPooledAlive(_renderPassPool, renderPassVK))
+    {
+        return;
+    }
     if (renderPassVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyRenderPass(_device, renderPassVK->handle, nullptr);
         renderPassVK->handle = VK_NULL_HANDLE;
     }
-    delete renderPassVK; // Delete the RenderPassVulkan object
+    destroyPooled(_renderPassPool, renderPassVK);
 }
 
 RHIFramebuffer* VulkanContext::CreateFramebuffer(const char* name, const FramebufferInfo& info)
 {
     HS_ASSERT(info.renderPass->info.colorAttachmentCount == info.colorBuffers.size(), "Framebuffer Info is not matched with RenderPass Info");
 
-    FramebufferVulkan* framebufferVK = new FramebufferVulkan(name, info);
+    FramebufferVulkan* framebufferVK = createPooled(_framebufferPool, name, info);
+    if (nullptr == framebufferVK)
+    {
+        return nullptr;
+    }
 
     size_t attachmentSize = static_cast<uint32>(info.colorBuffers.size());
-    std::vector<VkImageView> attachments(attachmentSize);
+    SmallVector<VkImageView, MAX_COLOR_ATTACHMENTS + 1> attachments(attachmentSize);
     for (size_t i = 0; i < attachmentSize; i++)
     {
         TextureVulkan* textureVK = static_cast<TextureVulkan*>(info.colorBuffers[i]);
@@ -306,17 +369,25 @@ void VulkanContext::DestroyFramebuffer(RHIFramebuffer* framebuffer)
 {
     // Destroy the Vulkan framebuffer
     FramebufferVulkan* framebufferVK = static_cast<FramebufferVulkan*>(framebuffer);
+    if (false == isPooledAlive(_framebufferPool, framebufferVK))
+    {
+        return;
+    }
     if (framebufferVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyFramebuffer(_device, framebufferVK->handle, nullptr);
         framebufferVK->handle = VK_NULL_HANDLE;
     }
-    delete framebufferVK;
+    destroyPooled(_framebufferPool, framebufferVK);
 }
 
 RHIGraphicsPipeline* VulkanContext::CreateGraphicsPipeline(const char* name, const GraphicsPipelineInfo& info)
 {
-    GraphicsPipelineVulkan* pipelineVK = new GraphicsPipelineVulkan(name, info);
+    GraphicsPipelineVulkan* pipelineVK = createPooled(_graphicsPipelinePool, name, info);
+    if (nullptr == pipelineVK)
+    {
+        return nullptr;
+    }
 
     VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
     VkPipeline pipelineVk = createGraphicsPipeline(info, pipelineLayout);
@@ -332,24 +403,32 @@ void VulkanContext::DestroyGraphicsPipeline(RHIGraphicsPipeline* pipeline)
 {
     // Destroy the Vulkan graphics pipeline
     GraphicsPipelineVulkan* pipelineVK = static_cast<GraphicsPipelineVulkan*>(pipeline);
+    if (false == isPooledAlive(_graphicsPipelinePool, pipelineVK))
+    {
+        return;
+    }
     if (pipelineVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyPipeline(_device, pipelineVK->handle, nullptr);
         pipelineVK->handle = VK_NULL_HANDLE;
     }
 
-    delete pipelineVK;
+    destroyPooled(_graphicsPipelinePool, pipelineVK);
 }
 
 RHIComputePipeline* VulkanContext::CreateComputePipeline(const char* name, const ComputePipelineInfo& info)
 {
-    ComputePipelineVulkan* pipelineVK = new ComputePipelineVulkan(name, info);
-    pipelineVK->handle                = createComputePipeline(info, pipelineVK->layout);
+    ComputePipelineVulkan* pipelineVK = createPooled(_computePipelinePool, name, info);
+    if (nullptr == pipelineVK)
+    {
+        return nullptr;
+    }
+    pipelineVK->handle = createComputePipeline(info, pipelineVK->layout);
 
     if (pipelineVK->handle == VK_NULL_HANDLE)
     {
         HS_LOG(error, "Failed to create compute pipeline: %s", name);
-        delete pipelineVK;
+        destroyPooled(_computePipelinePool, pipelineVK);
         return nullptr;
     }
 
@@ -360,6 +439,10 @@ RHIComputePipeline* VulkanContext::CreateComputePipeline(const char* name, const
 void VulkanContext::DestroyComputePipeline(RHIComputePipeline* pipeline)
 {
     ComputePipelineVulkan* pipelineVK = static_cast<ComputePipelineVulkan*>(pipeline);
+    if (false == isPooledAlive(_computePipelinePool, pipelineVK))
+    {
+        return;
+    }
     if (pipelineVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyPipeline(_device, pipelineVK->handle, nullptr);
@@ -372,7 +455,7 @@ void VulkanContext::DestroyComputePipeline(RHIComputePipeline* pipeline)
         pipelineVK->layout = VK_NULL_HANDLE;
     }
 
-    delete pipelineVK;
+    destroyPooled(_computePipelinePool, pipelineVK);
 }
 
 RHIShader* VulkanContext::CreateShader(const char* name, const ShaderInfo& info, const char* path)
@@ -424,8 +507,13 @@ RHIShader* VulkanContext::CreateShader(const char* name, const ShaderInfo& info,
         return nullptr;
     }
 
-    ShaderVulkan* shaderVK = new ShaderVulkan(name, info);
-    shaderVK->handle       = shaderModule;
+    ShaderVulkan* shaderVK = createPooled(_shaderPool, name, info);
+    if (nullptr == shaderVK)
+    {
+        vkDestroyShaderModule(_device, shaderModule, nullptr);
+        return nullptr;
+    }
+    shaderVK->handle = shaderModule;
 
     shaderVK->stageInfo.sType  = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     shaderVK->stageInfo.stage  = RHIUtilityVulkan::RHIUtilityVulkan::ToShaderStageFlags(info.stage);
@@ -440,11 +528,17 @@ RHIShader* VulkanContext::CreateShader(const char* name, const ShaderInfo& info,
 void VulkanContext::DestroyShader(RHIShader* shader)
 {
     ShaderVulkan* shaderVulkan = static_cast<ShaderVulkan*>(shader);
+    if (false == isPooledAlive(_shaderPool, shaderVulkan))
+    {
+        return;
+    }
     if (shaderVulkan->handle)
     {
         vkDestroyShaderModule(_device, shaderVulkan->handle, nullptr);
         shaderVulkan->handle = VK_NULL_HANDLE;
     }
+
+    destroyPooled(_shaderPool, shaderVulkan);
 }
 
 RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_t dataSize, EBufferUsage usage, EBufferMemoryOption memoryOption)
@@ -458,7 +552,8 @@ RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_
 
 RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_t dataSize, const BufferInfo& info)
 {
-    bool needsStaging = (data != nullptr) && (info.memoryOption == EBufferMemoryOption::STATIC);
+    const bool isHostVisible = (info.memoryOption == EBufferMemoryOption::MAPPED || info.memoryOption == EBufferMemoryOption::DYNAMIC);
+    const bool needsStaging  = (data != nullptr) && (info.memoryOption == EBufferMemoryOption::STATIC);
 
     VkBuffer bufferVk;
     // Create a Vulkan buffer
@@ -471,7 +566,7 @@ RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_
         createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
     }
     // MAPPED/DYNAMIC buffers may use vkCmdUpdateBuffer, which requires TRANSFER_DST
-    if (info.memoryOption == EBufferMemoryOption::MAPPED || info.memoryOption == EBufferMemoryOption::DYNAMIC)
+    if (isHostVisible)
     {
         createInfo.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
     }
@@ -506,6 +601,14 @@ RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_
     vkAllocateMemory(_device, &allocInfo, nullptr, &bufferMemory);
     VK_CHECK_RESULT(vkBindBufferMemory(_device, bufferVk, bufferMemory, 0));
 
+    // 호스트에서 보이는 버퍼는 살아 있는 동안 매핑해 둔다. 호출자는 byte에 직접 쓸 수 있다.
+    // INVALID/NOTHING은 HOST_VISIBLE 메모리를 요구하지 않았으므로 매핑하지 않는다.
+    void* persistentMapped = nullptr;
+    if (isHostVisible)
+    {
+        VK_CHECK_RESULT(vkMapMemory(_device, bufferMemory, 0, dataSize, 0, &persistentMapped));
+    }
+
     if (data != nullptr)
     {
         if (needsStaging)
@@ -553,19 +656,28 @@ RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_
             vkDestroyBuffer(_device, stagingBuffer, nullptr);
             vkFreeMemory(_device, stagingMemory, nullptr);
         }
+        else if (nullptr != persistentMapped)
+        {
+            // Direct copy into the persistently mapped HOST_VISIBLE memory
+            memcpy(persistentMapped, data, dataSize);
+        }
         else
         {
-            // Direct map for HOST_VISIBLE memory
-            void* mapped;
-            VK_CHECK_RESULT(vkMapMemory(_device, bufferMemory, 0, dataSize, 0, &mapped));
-            memcpy(mapped, data, dataSize);
-            vkUnmapMemory(_device, bufferMemory);
+            HS_LOG(error, "Initial data for buffer %s is ignored: memory option %d is not host visible", name, static_cast<int>(info.memoryOption));
         }
     }
 
-    BufferVulkan* bufferVK = new BufferVulkan(name, info);
+    BufferVulkan* bufferVK = createPooled(_bufferPool, name, info);
+    if (nullptr == bufferVK)
+    {
+        vkDestroyBuffer(_device, bufferVk, nullptr);
+        vkFreeMemory(_device, bufferMemory, nullptr);
+        return nullptr;
+    }
     bufferVK->handle       = bufferVk;
     bufferVK->memory       = bufferMemory;
+    bufferVK->byte         = persistentMapped;
+    bufferVK->byteSize     = dataSize;
 
     setDebugObjectName(VK_OBJECT_TYPE_BUFFER, reinterpret_cast<uint64>(bufferVk), name);
 
@@ -575,18 +687,27 @@ RHIBuffer* VulkanContext::CreateBuffer(const char* name, const void* data, size_
 void VulkanContext::DestroyBuffer(RHIBuffer* buffer)
 {
     BufferVulkan* bufferVK = static_cast<BufferVulkan*>(buffer);
+    if (false == isPooledAlive(_bufferPool, bufferVK))
+    {
+        return;
+    }
     if (bufferVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyBuffer(_device, bufferVK->handle, nullptr);
         bufferVK->handle = VK_NULL_HANDLE;
     }
+    if (bufferVK->byte != nullptr)
+    {
+        vkUnmapMemory(_device, bufferVK->memory);
+        bufferVK->byte = nullptr;
+    }
     if (bufferVK->memory != VK_NULL_HANDLE)
     {
         vkFreeMemory(_device, bufferVK->memory, nullptr);
         bufferVK->memory = VK_NULL_HANDLE;
     }
 
-    delete bufferVK;
+    destroyPooled(_bufferPool, bufferVK);
 }
 
 RHITexture* VulkanContext::CreateTexture(const char* name, void* image, uint32 width, uint32 height, EPixelFormat format, ETextureType type, ETextureUsage usage)
@@ -621,7 +742,11 @@ RHITexture* VulkanContext::CreateTexture(const char* name, void* image, const Te
         {
             if (swapchainVK->_framebuffers[i] == nullptr)
             {
-                TextureVulkan* textureVK = new TextureVulkan(name, info);
+                TextureVulkan* textureVK = createPooled(_texturePool, name, info);
+                if (nullptr == textureVK)
+                {
+                    return nullptr;
+                }
                 textureVK->handle        = swapchainVK->imageVks[i];
                 textureVK->imageViewVk   = swapchainVK->imageViewVks[i];
                 textureVK->memoryVk      = VK_NULL_HANDLE;            // Swapchain textures do not have dedicated memory
@@ -849,7 +974,14 @@ RHITexture* VulkanContext::CreateTexture(const char* name, void* image, const Te
     VkImageView imageViewVk;
     VK_CHECK_RESULT(vkCreateImageView(_device, &viewCreateInfo, nullptr, &imageViewVk));
 
-    TextureVulkan* textureVK = new TextureVulkan(name, info);
+    TextureVulkan* textureVK = createPooled(_texturePool, name, info);
+    if (nullptr == textureVK)
+    {
+        vkDestroyImageView(_device, imageViewVk, nullptr);
+        vkDestroyImage(_device, imageVk, nullptr);
+        vkFreeMemory(_device, imageMemory, nullptr);
+        return nullptr;
+    }
     textureVK->handle        = imageVk;
     textureVK->imageViewVk   = imageViewVk;
     textureVK->memoryVk      = imageMemory;
@@ -865,6 +997,10 @@ void VulkanContext::DestroyTexture(RHITexture* texture)
 {
     // Destroy the Vulkan texture
     TextureVulkan* textureVK = static_cast<TextureVulkan*>(texture);
+    if (false == isPooledAlive(_texturePool, textureVK))
+    {
+        return;
+    }
 
     if (textureVK->imageViewVk != VK_NULL_HANDLE)
     {
@@ -881,7 +1017,7 @@ void VulkanContext::DestroyTexture(RHITexture* texture)
         vkFreeMemory(_device, textureVK->memoryVk, nullptr);
         textureVK->memoryVk = VK_NULL_HANDLE;
     }
-    delete textureVK;
+    destroyPooled(_texturePool, textureVK);
 }
 
 RHISampler* VulkanContext::CreateSampler(const char* name, const SamplerInfo& info)
@@ -902,8 +1038,13 @@ RHISampler* VulkanContext::CreateSampler(const char* name, const SamplerInfo& in
     VkSampler vkSampler;
     vkCreateSampler(_device, &samplerInfo, nullptr, &vkSampler);
 
-    SamplerVulkan* samplerVK = new SamplerVulkan(name, info);
-    samplerVK->handle        = vkSampler;
+    SamplerVulkan* samplerVK = createPooled(_samplerPool, name, info);
+    if (nullptr == samplerVK)
+    {
+        vkDestroySampler(_device, vkSampler, nullptr);
+        return nullptr;
+    }
+    samplerVK->handle = vkSampler;
 
     setDebugObjectName(VK_OBJECT_TYPE_SAMPLER, reinterpret_cast<uint64>(vkSampler), name);
 
@@ -913,18 +1054,26 @@ RHISampler* VulkanContext::CreateSampler(const char* name, const SamplerInfo& in
 void VulkanContext::DestroySampler(RHISampler* sampler)
 {
     SamplerVulkan* samplerVK = static_cast<SamplerVulkan*>(sampler);
+    if (false == isPooledAlive(_samplerPool, samplerVK))
+    {
+        return;
+    }
     if (samplerVK->handle)
     {
         vkDestroySampler(_device, samplerVK->handle, nullptr);
         samplerVK->handle = VK_NULL_HANDLE;
     }
 
-    delete samplerVK;
+    destroyPooled(_samplerPool, samplerVK);
 }
 
 RHIResourceLayout* VulkanContext::CreateResourceLayout(const char* name, ResourceBinding* bindings, uint32 bindingCount)
 {
-    ResourceLayoutVulkan* resourceLayoutVK                = new ResourceLayoutVulkan(name, bindings, bindingCount);
+    ResourceLayoutVulkan* resourceLayoutVK = createPooled(_resourceLayoutPool, name, bindings, bindingCount);
+    if (nullptr == resourceLayoutVK)
+    {
+        return nullptr;
+    }
     std::vector<VkDescriptorSetLayoutBinding>& bindingVks = resourceLayoutVK->bindingVks;
     bindingVks.resize(bindingCount);
 
@@ -992,11 +1141,17 @@ void VulkanContext::DestroyResourceLayout(RHIResourceLayout* resourceLayout)
     // Destroy the Vulkan resource layout
 
     ResourceLayoutVulkan* resourceLayoutVK = static_cast<ResourceLayoutVulkan*>(resourceLayout);
+    if (false == isPooledAlive(_resourceLayoutPool, resourceLayoutVK))
+    {
+        return;
+    }
     if (resourceLayoutVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyDescriptorSetLayout(_device, resourceLayoutVK->handle, nullptr);
         resourceLayoutVK->handle = VK_NULL_HANDLE;
     }
+
+    destroyPooled(_resourceLayoutPool, resourceLayoutVK);
 }
 
 RHIResourceSet* VulkanContext::CreateResourceSet(const char* name, RHIResourceLayout* resourceLayouts)
@@ -1134,9 +1289,14 @@ RHIResourceSet* VulkanContext::CreateResourceSet(const char* name, RHIResourceLa
             descriptorWrites.data(), 0, nullptr);
     }
 
-    ResourceSetVulkan* resourceSetVK = new ResourceSetVulkan(name);
-    resourceSetVK->handle            = rSetVk;
-    resourceSetVK->layoutVK          = layoutVK;
+    ResourceSetVulkan* resourceSetVK = createPooled(_resourceSetPool, name);
+    if (nullptr == resourceSetVK)
+    {
+        _descriptorPoolAllocator.FreeDescriptorSet(rSetVk);
+        return nullptr;
+    }
+    resourceSetVK->handle   = rSetVk;
+    resourceSetVK->layoutVK = layoutVK;
 
     setDebugObjectName(VK_OBJECT_TYPE_DESCRIPTOR_SET, reinterpret_cast<uint64>(rSetVk), name);
 
@@ -1147,12 +1307,16 @@ void VulkanContext::DestroyResourceSet(RHIResourceSet* resourceSet)
 {
     // Destroy the Vulkan resource set
     ResourceSetVulkan* resourceSetVK = static_cast<ResourceSetVulkan*>(resourceSet);
+    if (false == isPooledAlive(_resourceSetPool, resourceSetVK))
+    {
+        return;
+    }
     if (resourceSetVK->handle != VK_NULL_HANDLE)
     {
         _descriptorPoolAllocator.FreeDescriptorSet(resourceSetVK->handle);
         resourceSetVK->handle = VK_NULL_HANDLE;
     }
-    delete resourceSetVK;
+    destroyPooled(_resourceSetPool, resourceSetVK);
 }
 
 RHIResourceSetPool* VulkanContext::CreateResourceSetPool(const char* name, uint32 bufferSize, uint32 textureSize)
@@ -1178,8 +1342,13 @@ RHIResourceSetPool* VulkanContext::CreateResourceSetPool(const char* name, uint3
 
     VkDescriptorPool descriptorPool;
     VK_CHECK_RESULT(vkCreateDescriptorPool(_device, &poolInfo, nullptr, &descriptorPool));
-    ResourceSetPoolVulkan* resourceSetPoolVK = new ResourceSetPoolVulkan(name);
-    resourceSetPoolVK->handle                = descriptorPool;
+    ResourceSetPoolVulkan* resourceSetPoolVK = createPooled(_resourceSetPoolPool, name);
+    if (nullptr == resourceSetPoolVK)
+    {
+        vkDestroyDescriptorPool(_device, descriptorPool, nullptr);
+        return nullptr;
+    }
+    resourceSetPoolVK->handle = descriptorPool;
 
     setDebugObjectName(VK_OBJECT_TYPE_DESCRIPTOR_POOL, reinterpret_cast<uint64>(descriptorPool), name);
 
@@ -1190,12 +1359,16 @@ void VulkanContext::DestroyResourceSetPool(RHIResourceSetPool* resourceSetPool)
 {
     // Destroy the Vulkan resource set pool
     ResourceSetPoolVulkan* resourceSetPoolVK = static_cast<ResourceSetPoolVulkan*>(resourceSetPool);
+    if (false == isPooledAlive(_resourceSetPoolPool, resourceSetPoolVK))
+    {
+        return;
+    }
     if (resourceSetPoolVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyDescriptorPool(_device, resourceSetPoolVK->handle, nullptr);
         resourceSetPoolVK->handle = VK_NULL_HANDLE;
     }
-    delete resourceSetPoolVK;
+    destroyPooled(_resourceSetPoolPool, resourceSetPoolVK);
 }
 
 RHICommandPool* VulkanContext::CreateCommandPool(const char* name, uint32 queueFamilyIndex)
@@ -1210,8 +1383,13 @@ RHICommandPool* VulkanContext::CreateCommandPool(const char* name, uint32 queueF
     VkCommandPool commandPool;
     vkCreateCommandPool(_device, &poolInfo, nullptr, &commandPool);
 
-    CommandPoolVulkan* commandPoolVK = new CommandPoolVulkan(name);
-    commandPoolVK->handle            = commandPool;
+    CommandPoolVulkan* commandPoolVK = createPooled(_commandPoolPool, name);
+    if (nullptr == commandPoolVK)
+    {
+        vkDestroyCommandPool(_device, commandPool, nullptr);
+        return nullptr;
+    }
+    commandPoolVK->handle = commandPool;
 
     setDebugObjectName(VK_OBJECT_TYPE_COMMAND_POOL, reinterpret_cast<uint64>(commandPool), name);
 
@@ -1222,13 +1400,17 @@ void VulkanContext::DestroyCommandPool(RHICommandPool* commandPool)
 {
     // Destroy the Vulkan command pool
     CommandPoolVulkan* commandPoolVK = static_cast<CommandPoolVulkan*>(commandPool);
+    if (false == isPooledAlive(_commandPoolPool, commandPoolVK))
+    {
+        return;
+    }
     if (commandPoolVK->handle != VK_NULL_HANDLE)
     {
         vkDestroyCommandPool(_device, commandPoolVK->handle, nullptr);
         commandPoolVK->handle = VK_NULL_HANDLE;
     }
 
-    delete commandPoolVK;
+    destroyPooled(_commandPoolPool, commandPoolVK);
 }
 
 RHICommandBuffer* VulkanContext::CreateCommandBuffer(const char* name)
@@ -1243,8 +1425,15 @@ RHICommandBuffer* VulkanContext::CreateCommandBuffer(const char* name)
     VkCommandBuffer cmdBufferVk;
     vkAllocateCommandBuffers(_device, &allocInfo, &cmdBufferVk);
 
-    CommandBufferVulkan* commandBufferVK = new CommandBufferVulkan(name);
-    commandBufferVK->handle              = cmdBufferVk;
+    CommandBufferVulkan* commandBufferVK = createPooled(_commandBufferPool, name);
+    if (nullptr == commandBufferVK)
+    {
+        vkFreeCommandBuffers(_device, _defaultCommandPool, 1, &cmdBufferVk);
+        return nullptr;
+    }
+    commandBufferVK->handle             = cmdBufferVk;
+    commandBufferVK->cmdBeginDebugLabel = _cmdBeginDebugLabel;
+    commandBufferVK->cmdEndDebugLabel   = _cmdEndDebugLabel;
 
     setDebugObjectName(VK_OBJECT_TYPE_COMMAND_BUFFER, reinterpret_cast<uint64>(cmdBufferVk), name);
 
@@ -1255,41 +1444,152 @@ void VulkanContext::DestroyCommandBuffer(RHICommandBuffer* commandBuffer)
 {
     // Destroy the Vulkan command buffer
     CommandBufferVulkan* commandBufferVK = static_cast<CommandBufferVulkan*>(commandBuffer);
+    if (false == isPooledAlive(_commandBufferPool, commandBufferVK))
+    {
+        return;
+    }
     if (commandBufferVK->handle)
     {
         vkFreeCommandBuffers(_device, _defaultCommandPool, 1, &commandBufferVK->handle);
         commandBufferVK->handle = VK_NULL_HANDLE;
     }
-    delete commandBuffer;
+    destroyPooled(_commandBufferPool, commandBufferVK);
 }
 
-void VulkanContext::Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount)
+RHIQueryPool* VulkanContext::CreateQueryPool(const char* name, const QueryPoolInfo& info)
 {
-    static std::vector<VkCommandBuffer> commandBufferVks;
+    HS_ASSERT(info.queryCount > 0, "Query count must be greater than 0");
+
+    VkQueryPoolCreateInfo createInfo{};
+    createInfo.sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    createInfo.queryCount = info.queryCount;
 
+    switch (info.type)
+    {
+        case EQueryType::TIMESTAMP:
+            createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+            break;
+        case EQueryType::PIPELINE_STATISTICS:
+            if (false == IsPipelineStatisticsSupported())
+            {
+                HS_LOG(error, "Pipeline statistics query is not supported: %s", name);
+                return nullptr;
+            }
+            // 비트 순서대로 결과가 기록되므로 PipelineStatistics의 멤버 순서와 맞춰야 한다.
+            createInfo.queryType          = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+            createInfo.pipelineStatistics = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT |
+                                            VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT |
+                                            VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT |
+                                            VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT |
+                                            VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+            break;
+    }
+
+    VkQueryPool queryPoolVk = VK_NULL_HANDLE;
+    if (vkCreateQueryPool(_device, &createInfo, nullptr, &queryPoolVk) != VK_SUCCESS)
+    {
+        HS_LOG(error, "Failed to create query pool: %s", name);
+        return nullptr;
+    }
+
+    QueryPoolVulkan* queryPoolVK = createPooled(_queryPoolPool, name, info);
+    if (nullptr == queryPoolVK)
+    {
+        vkDestroyQueryPool(_device, queryPoolVk, nullptr);
+        return nullptr;
+    }
+    queryPoolVK->handle = queryPoolVk;
+
+    setDebugObjectName(VK_OBJECT_TYPE_QUERY_POOL, reinterpret_cast<uint64>(queryPoolVk), name);
+
+    return static_cast<RHIQueryPool*>(queryPoolVK);
+}
+
+void VulkanContext::DestroyQueryPool(RHIQueryPool* queryPool)
+{
+    QueryPoolVulkan* queryPoolVK = static_cast<QueryPoolVulkan*>(queryPool);
+    if (false == isPooledAlive(_queryPoolPool, queryPoolVK))
+    {
+        return;
+    }
+    if (queryPoolVK->handle != VK_NULL_HANDLE)
+    {
+        vkDestroyQueryPool(_device, queryPoolVK->handle, nullptr);
+        queryPoolVK->handle = VK_NULL_HANDLE;
+    }
+    destroyPooled(_queryPoolPool, queryPoolVK);
+}
+
+bool VulkanContext::GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize)
+{
+    QueryPoolVulkan* queryPoolVK = static_cast<QueryPoolVulkan*>(queryPool);
+    const VkDeviceSize stride    = (queryPool->info.type == EQueryType::TIMESTAMP) ? sizeof(uint64) : sizeof(PipelineStatistics);
+    HS_ASSERT(dataSize >= stride * queryCount, "Query result buffer is too small");
+
+    const VkResult result = vkGetQueryPoolResults(_device, queryPoolVK->handle, firstQuery, queryCount, dataSize, outData, stride, VK_QUERY_RESULT_64_BIT);
+    return result == VK_SUCCESS;
+}
+
+double VulkanContext::GetTimestampPeriod() const
+{
+    if (VK_FALSE == _device.properties.limits.timestampComputeAndGraphics)
+    {
+        return 0.0;
+    }
+
+    return static_cast<double>(_device.properties.limits.timestampPeriod);
+}
+
+bool VulkanContext::IsPipelineStatisticsSupported() const
+{
+    return VK_TRUE == _device.features.pipelineStatisticsQuery;
+}
+
+bool VulkanContext::IsAlive(RHIHandle::EType type, uint32 poolHandle) const
+{
+    switch (type)
+    {
+        case RHIHandle::EType::BUFFER:            return _bufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::TEXTURE:           return _texturePool.IsAlive(poolHandle);
+        case RHIHandle::EType::SAMPLER:           return _samplerPool.IsAlive(poolHandle);
+        case RHIHandle::EType::SHADER:            return _shaderPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_LAYOUT:   return _resourceLayoutPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_SET:      return _resourceSetPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RESOURCE_SET_POOL: return _resourceSetPoolPool.IsAlive(poolHandle);
+        case RHIHandle::EType::RENDER_PASS:       return _renderPassPool.IsAlive(poolHandle);
+        case RHIHandle::EType::FRAMEBUFFER:       return _framebufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::GRAPHICS_PIPELINE: return _graphicsPipelinePool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMPUTE_PIPELINE:  return _computePipelinePool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMMAND_POOL:      return _commandPoolPool.IsAlive(poolHandle);
+        case RHIHandle::EType::COMMAND_BUFFER:    return _commandBufferPool.IsAlive(poolHandle);
+        case RHIHandle::EType::QUERY_POOL:        return _queryPoolPool.IsAlive(poolHandle);
+        default:                                  return false;
+    }
+}
+
+void VulkanContext::Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount)
+{
     HS_ASSERT(swapchain != nullptr, "Swapchain is null in VulkanContext::Submit");
     HS_ASSERT(bufferCount > 0, "Buffer count must be greater than 0 in VulkanContext::Submit");
 
     SwapchainVulkan* swapchainVK = static_cast<SwapchainVulkan*>(swapchain);
+    const bool isOffscreen       = swapchainVK->IsOffscreen();
 
     VkSubmitInfo submitInfo{};
     submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-    submitInfo.waitSemaphoreCount   = 1;
-    submitInfo.pWaitSemaphores      = &swapchainVK->syncObjects.imageAvailableSemaphores[swapchainVK->_frameIndex];
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores    = &swapchainVK->syncObjects.renderFinishedSemaphores[swapchainVK->_curImageIndex];
+    submitInfo.waitSemaphoreCount   = isOffscreen ? 0 : 1;
+    submitInfo.pWaitSemaphores      = isOffscreen ? nullptr : &swapchainVK->syncObjects.imageAvailableSemaphores[swapchainVK->_frameIndex];
+    submitInfo.signalSemaphoreCount = isOffscreen ? 0 : 1;
+    submitInfo.pSignalSemaphores    = isOffscreen ? nullptr : &swapchainVK->syncObjects.renderFinishedSemaphores[swapchainVK->_curImageIndex];
 
-    if (commandBufferVks.size() < bufferCount)
-    {
-        commandBufferVks.resize(bufferCount);
-    }
+    VkCommandBuffer* commandBufferVks = FrameAllocator::Get().AllocateArray<VkCommandBuffer>(bufferCount);
 
     for (size_t i = 0; i < bufferCount; ++i)
     {
         CommandBufferVulkan* commandBufferVK = static_cast<CommandBufferVulkan*>(buffers[i]);
         commandBufferVks[i]                  = commandBufferVK->handle;
     }
-    submitInfo.pCommandBuffers    = commandBufferVks.data();
+    submitInfo.pCommandBuffers    = commandBufferVks;
     submitInfo.commandBufferCount = static_cast<uint32_t>(bufferCount);
 
     VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
@@ -1304,6 +1604,29 @@ void VulkanContext::Present(Swapchain* swapchain)
     HS_ASSERT(swapchain != nullptr, "Swapchain is null in VulkanContext::Present");
     SwapchainVulkan* swapchainVK = static_cast<SwapchainVulkan*>(swapchain);
 
+    if (swapchainVK->IsOffscreen())
+    {
+        const uint64 frameNumber = swapchainVK->_presentCount++;
+        ReadbackRingVulkan* readback = swapchainVK->_readback;
+        if (readback == nullptr)
+        {
+            return;
+        }
+
+        // 복사는 같은 큐에 렌더링 뒤로 제출되므로 별도의 동기화 없이 순서가 보장된다.
+        const uint32 interval = std::max(swapchainVK->_info.readbackInterval, 1u);
+        if (frameNumber % interval == 0)
+        {
+            TextureVulkan* textureVK = static_cast<TextureVulkan*>(swapchainVK->_offscreenTextures[swapchainVK->_curImageIndex]);
+            readback->Enqueue(textureVK->handle, frameNumber);
+        }
+        else
+        {
+            readback->Collect();
+        }
+        return;
+    }
+
     VkPresentInfoKHR presentInfo{};
     presentInfo.sType              = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.swapchainCount     = 1;
@@ -1336,7 +1659,7 @@ void VulkanContext::cleanup()
     {
         destroyDebugUtilsMessengerEXT(_instanceVk, _debugMessenger, nullptr);
     }
-    delete _device;
+    _device.Destroy();
 
     vkDestroyInstance(_instanceVk, nullptr);
 }
@@ -1361,17 +1684,21 @@ bool VulkanContext::createInstance()
     for (const auto& extension : availableExtensions)
     {
         HS_LOG(info, "Available Extension: %s", extension.extensionName);
+#if defined(__WINDOWS__)
         if (strcmp(extension.extensionName, VK_KHR_WIN32_SURFACE_EXTENSION_NAME) == 0)
         {
             extensionNames.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
         }
-        else if (strcmp(extension.extensionName, VK_KHR_SURFACE_EXTENSION_NAME) == 0)
+        else
+#endif
+        if (strcmp(extension.extensionName, VK_KHR_SURFACE_EXTENSION_NAME) == 0)
         {
             extensionNames.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
         }
         else if (strcmp(extension.extensionName, VK_EXT_DEBUG_UTILS_EXTENSION_NAME) == 0)
         {
             extensionNames.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+            _isDebugUtilsEnabled = true;
         }
     }
 
@@ -1439,6 +1766,7 @@ void VulkanContext::createDefaultCommandPool()
     VK_CHECK_RESULT(vkCreateCommandPool(_device, &poolInfo, nullptr, &_defaultCommandPool));
 }
 
+#if defined(__WINDOWS__)
 VkSurfaceKHR VulkanContext::createSurface(const NativeWindow& nativeWindow)
 {
     VkWin32SurfaceCreateInfoKHR surfaceCreateInfo{};
@@ -1453,6 +1781,18 @@ VkSurfaceKHR VulkanContext::createSurface(const NativeWindow& nativeWindow)
 
     return surface;
 }
+#endif
+
+void VulkanContext::initOffscreenImages(SwapchainVulkan* swapchainVK)
+{
+    // 렌더 패스가 아직 한 번도 실행되지 않은 이미지도 readback 배리어가 가정하는 레이아웃에 두기 위함.
+    for (RHITexture* texture : swapchainVK->_offscreenTextures)
+    {
+        TextureVulkan* textureVK = static_cast<TextureVulkan*>(texture);
+        traisitionImageLayout(textureVK->handle, RHIUtilityVulkan::ToPixelFormat(texture->info.format), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+        textureVK->layoutVk = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    }
+}
 
 VkRenderPass VulkanContext::createRenderPass(const RenderPassInfo& info)
 {
@@ -1461,7 +1801,7 @@ VkRenderPass VulkanContext::createRenderPass(const RenderPassInfo& info)
     VkImageLayout colorFinalLayout        = info.isSwapchainRenderPass ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     VkImageLayout depthStencilFinalLayout = info.isSwapchainRenderPass ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL;
 
-    std::vector<VkAttachmentDescription> attachments(attachmentCount);
+    SmallVector<VkAttachmentDescription, MAX_COLOR_ATTACHMENTS + 1> attachments(attachmentCount);
     int index = 0;
     for (; index < info.colorAttachmentCount; index++)
     {
@@ -1502,7 +1842,7 @@ VkRenderPass VulkanContext::createRenderPass(const RenderPassInfo& info)
     VkSubpassDescription subPass{};
     subPass.pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS;
     subPass.colorAttachmentCount = info.colorAttachmentCount;
-    std::vector<VkAttachmentReference> colorAttachments(info.colorAttachmentCount);
+    SmallVector<VkAttachmentReference, MAX_COLOR_ATTACHMENTS> colorAttachments(info.colorAttachmentCount);
     for (uint32 i = 0; i < info.colorAttachmentCount; i++)
     {
         colorAttachments[i].attachment = i;
@@ -1537,7 +1877,7 @@ VkFramebuffer VulkanContext::createFramebuffer(const FramebufferInfo& info)
 {
     RenderPassVulkan* renderPassVK = static_cast<RenderPassVulkan*>(info.renderPass);
 
-    std::vector<VkImageView> attachments;
+    SmallVector<VkImageView, MAX_COLOR_ATTACHMENTS + 1> attachments;
     attachments.reserve(info.colorBuffers.size() + (info.depthStencilBuffer ? 1 : 0));
     for (const auto& colorBuffer : info.colorBuffers)
     {
@@ -1602,7 +1942,7 @@ VkPipeline VulkanContext::createGraphicsPipeline(const GraphicsPipelineInfo& inf
 
     // ShaderStage
     uint32 stageCount = static_cast<uint32>(info.shaderDesc.stages.size());
-    std::vector<VkPipelineShaderStageCreateInfo> shaderStages(stageCount);
+    SmallVector<VkPipelineShaderStageCreateInfo, MAX_SHADER_STAGES> shaderStages(stageCount);
     for (size_t i = 0; i < stageCount; i++)
     {
         auto* shader    = info.shaderDesc.stages[i];
@@ -1626,7 +1966,7 @@ VkPipeline VulkanContext::createGraphicsPipeline(const GraphicsPipelineInfo& inf
 
     // Bindings
     uint32 bindingCount = info.vertexInputDesc.layouts.size();
-    std::vector<VkVertexInputBindingDescription> bindingDescriptions(bindingCount);
+    SmallVector<VkVertexInputBindingDescription, MAX_VERTEX_INPUT_LAYOUTS> bindingDescriptions(bindingCount);
     for (size_t i = 0; i < bindingCount; i++)
     {
         const auto& layout                         = info.vertexInputDesc.layouts[i];
@@ -1639,7 +1979,7 @@ VkPipeline VulkanContext::createGraphicsPipeline(const GraphicsPipelineInfo& inf
 
     // Attributes
     uint32 attributeCount = info.vertexInputDesc.attributes.size();
-    std::vector<VkVertexInputAttributeDescription> attributeDescriptions(attributeCount);
+    SmallVector<VkVertexInputAttributeDescription, MAX_VERTEX_ATTRIBUTES> attributeDescriptions(attributeCount);
     for (size_t i = 0; i < attributeCount; i++)
     {
         const auto& attribute  = info.vertexInputDesc.attributes[i];
@@ -1728,7 +2068,7 @@ VkPipeline VulkanContext::createGraphicsPipeline(const GraphicsPipelineInfo& inf
     colorBlendState.blendConstants[2] = info.colorBlendDesc.blendConstants[2];
     colorBlendState.blendConstants[3] = info.colorBlendDesc.blendConstants[3];
 
-    std::vector<VkPipelineColorBlendAttachmentState> attachmentVks(info.colorBlendDesc.attachmentCount);
+    SmallVector<VkPipelineColorBlendAttachmentState, MAX_COLOR_ATTACHMENTS> attachmentVks(info.colorBlendDesc.attachmentCount);
     for (size_t i = 0; i < info.colorBlendDesc.attachmentCount; i++)
     {
         const auto& attachment               = info.colorBlendDesc.attachments[i];
@@ -1936,6 +2276,15 @@ void VulkanContext::traisitionImageLayout(
         sourceStage      = VK_PIPELINE_STAGE_TRANSFER_BIT;
         destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
     }
+    else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED &&
+             newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+    {
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+
+        sourceStage      = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+        destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+    }
     else
     {
         HS_LOG(error, "Unsupported layout transition!");
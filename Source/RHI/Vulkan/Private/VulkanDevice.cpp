@@ -9,7 +9,6 @@
 HS_NS_BEGIN
 
 std::vector<const char*> s_requiredDeviceExtensions = {
-	VK_KHR_SWAPCHAIN_EXTENSION_NAME
 };
 
 VulkanDevice::~VulkanDevice()
@@ -28,7 +27,9 @@ bool VulkanDevice::Create(VkInstance instance)
 
 void VulkanDevice::Destroy()
 {
+	// 컨텍스트 정리와 소멸자에서 두 번 불릴 수 있다.
 	vkDestroyDevice(logicalDevice, nullptr);
+	logicalDevice = VK_NULL_HANDLE;
 }
 
 void VulkanDevice::getPhysicalDevice()
@@ -49,8 +50,13 @@ void VulkanDevice::getPhysicalDevice()
 		vkEnumerateDeviceExtensionProperties(physicalDevices[i], nullptr, &availableExtensionCount, availableExtensions.data());
 
 		int supportedExtensionCount = 0;
+		bool hasSwapchain = false;
 		for (const auto& extension : availableExtensions)
 		{
+			if (strcmp(extension.extensionName, VK_KHR_SWAPCHAIN_EXTENSION_NAME) == 0)
+			{
+				hasSwapchain = true;
+			}
 			for (int j = 0; j < s_requiredDeviceExtensions.size(); j++)
 			{
 				if (strcmp(extension.extensionName, s_requiredDeviceExtensions[j]) == 0)
@@ -60,11 +66,18 @@ void VulkanDevice::getPhysicalDevice()
 				}
 			}
 		}
+
+		// 스왑체인은 offscreen 렌더링(lavapipe 등)에서는 없어도 되므로 필수가 아니라 가산점으로 처리한다.
+		if (hasSwapchain)
+		{
+			score += 10000;
+		}
 		
 		if ((supportedExtensionCount == s_requiredDeviceExtensions.size()) && (maxScore == 0 || maxScore < score))
 		{
 			maxScore = score;
 			physicalDevice = physicalDevices[i];
+			isSwapchainSupported = hasSwapchain;
 		}
 	}
 
@@ -90,6 +103,7 @@ void VulkanDevice::createLogicalDevice()
 	// Set queue family indices
 	uint32 queueFamilyCount = 0;
 	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+	queueFamilyProperties.resize(queueFamilyCount);
 	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilyProperties.data());
 
 	bool isQueueFamilyFound = false;
@@ -98,19 +112,16 @@ void VulkanDevice::createLogicalDevice()
 		const auto& queueFamily = queueFamilyProperties[i];
 		if (queueFamily.queueFlags & VK_QUEUE_GRAPHICS_BIT)
 		{
-			queueFamilyIndices.graphics = i;
-			queueFamilyIndices.compute = i;
-		}
-		else if (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT)
-		{
-			queueFamilyIndices.compute = i;
-		}
-
-		if (queueFamily.queueFlags & VK_QUEUE_TRANSFER_BIT)
-		{
-			queueFamilyIndices.transfer = i;
+			queueFamilyIndices.graphics = static_cast<uint32>(i);
+			isQueueFamilyFound = true;
+			break;
 		}
 	}
+	HS_ASSERT(isQueueFamilyFound, "There is no graphics queue family.");
+
+	// 큐는 graphics 패밀리에서 하나만 생성하므로 compute/transfer도 같은 큐를 쓴다.
+	queueFamilyIndices.compute = queueFamilyIndices.graphics;
+	queueFamilyIndices.transfer = queueFamilyIndices.graphics;
 
 	VkDeviceQueueCreateInfo queueInfo{};
 	queueInfo.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
@@ -124,8 +135,13 @@ void VulkanDevice::createLogicalDevice()
 	deviceInfo.queueCreateInfoCount = 1;
 	deviceInfo.pQueueCreateInfos = &queueInfo;
 	deviceInfo.pEnabledFeatures = &features;
-	deviceInfo.enabledExtensionCount = s_requiredDeviceExtensions.size();
-	deviceInfo.ppEnabledExtensionNames = s_requiredDeviceExtensions.data();
+	deviceExtensions = s_requiredDeviceExtensions;
+	if (isSwapchainSupported)
+	{
+		deviceExtensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+	}
+	deviceInfo.enabledExtensionCount = static_cast<uint32>(deviceExtensions.size());
+	deviceInfo.ppEnabledExtensionNames = deviceExtensions.data();
 	
 	VK_CHECK_RESULT(vkCreateDevice(physicalDevice, &deviceInfo, nullptr, &logicalDevice));
 
@@ -0,0 +1,327 @@
+﻿#include "RHI/Vulkan/VulkanReadback.h"
+
+#include "Core/Log.h"
+#include "Core/Utility/StringUtility.h"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+#include <cstring>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+uint32 find_memory_type(const VkPhysicalDeviceMemoryProperties& props, uint32 typeBits, VkMemoryPropertyFlags flags)
+{
+	for (uint32 i = 0; i < props.memoryTypeCount; i++)
+	{
+		if ((typeBits & (1u << i)) && (props.memoryTypes[i].propertyFlags & flags) == flags)
+		{
+			return i;
+		}
+	}
+	return UINT32_MAX;
+}
+} // namespace
+
+ReadbackRingVulkan::~ReadbackRingVulkan()
+{
+	Finalize();
+}
+
+bool ReadbackRingVulkan::Initialize(VulkanDevice* device, uint32 slotCount, uint32 width, uint32 height, VkFormat format, const char* directory)
+{
+	HS_ASSERT(_slots == nullptr, "Readback ring is already initialized.");
+	HS_ASSERT(slotCount > 0, "Readback ring needs at least one slot.");
+
+	if (format != VK_FORMAT_B8G8R8A8_UNORM && format != VK_FORMAT_R8G8B8A8_UNORM)
+	{
+		HS_LOG(error, "Readback supports only 8bit RGBA/BGRA formats. (format: %d)", format);
+		return false;
+	}
+
+	_device    = device;
+	_width     = width;
+	_height    = height;
+	_format    = format;
+	_byteSize  = static_cast<size_t>(width) * height * 4;
+	_directory = (directory != nullptr) ? directory : ".";
+
+	VkCommandPoolCreateInfo poolInfo{};
+	poolInfo.sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	poolInfo.flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+	poolInfo.queueFamilyIndex = _device->queueFamilyIndices.graphics;
+	VK_CHECK_RESULT(vkCreateCommandPool(_device->logicalDevice, &poolInfo, nullptr, &_commandPool));
+
+	_slotCount = slotCount;
+	_slots     = new Slot[_slotCount];
+
+	for (uint32 i = 0; i < _slotCount; i++)
+	{
+		Slot& slot = _slots[i];
+
+		VkBufferCreateInfo bufferInfo{};
+		bufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferInfo.size        = _byteSize;
+		bufferInfo.usage       = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+		bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+		VK_CHECK_RESULT(vkCreateBuffer(_device->logicalDevice, &bufferInfo, nullptr, &slot.buffer));
+
+		VkMemoryRequirements memReq;
+		vkGetBufferMemoryRequirements(_device->logicalDevice, slot.buffer, &memReq);
+
+		// CPU가 읽기만 하므로 cached 메모리를 우선한다. coherent가 아니면 읽기 전에 invalidate 한다.
+		VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
+		uint32 memoryType           = find_memory_type(_device->memoryProperties, memReq.memoryTypeBits, flags);
+		if (memoryType == UINT32_MAX)
+		{
+			flags      = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+			memoryType = find_memory_type(_device->memoryProperties, memReq.memoryTypeBits, flags);
+		}
+		if (memoryType == UINT32_MAX)
+		{
+			HS_LOG(error, "There is no host visible memory for readback.");
+			Finalize();
+			return false;
+		}
+		_isCoherent = (_device->memoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+		VkMemoryAllocateInfo allocInfo{};
+		allocInfo.sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+		allocInfo.allocationSize  = memReq.size;
+		allocInfo.memoryTypeIndex = memoryType;
+		VK_CHECK_RESULT(vkAllocateMemory(_device->logicalDevice, &allocInfo, nullptr, &slot.memory));
+		VK_CHECK_RESULT(vkBindBufferMemory(_device->logicalDevice, slot.buffer, slot.memory, 0));
+
+		// 링이 살아있는 동안 계속 매핑해 둔다.
+		VK_CHECK_RESULT(vkMapMemory(_device->logicalDevice, slot.memory, 0, VK_WHOLE_SIZE, 0, &slot.mapped));
+
+		VkCommandBufferAllocateInfo cmdInfo{};
+		cmdInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		cmdInfo.commandPool        = _commandPool;
+		cmdInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		cmdInfo.commandBufferCount = 1;
+		VK_CHECK_RESULT(vkAllocateCommandBuffers(_device->logicalDevice, &cmdInfo, &slot.cmd));
+
+		VkFenceCreateInfo fenceInfo{};
+		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+		VK_CHECK_RESULT(vkCreateFence(_device->logicalDevice, &fenceInfo, nullptr, &slot.fence));
+	}
+
+	HS_LOG(info, "Readback ring: %u slots, %ux%u, writing to %s", _slotCount, _width, _height, _directory.c_str());
+	return true;
+}
+
+void ReadbackRingVulkan::Finalize()
+{
+	if (_slots == nullptr)
+	{
+		return;
+	}
+
+	for (uint32 i = 0; i < _slotCount; i++)
+	{
+		waitSlot(_slots[i]);
+	}
+
+	for (uint32 i = 0; i < _slotCount; i++)
+	{
+		Slot& slot = _slots[i];
+		if (slot.fence != VK_NULL_HANDLE)
+		{
+			vkDestroyFence(_device->logicalDevice, slot.fence, nullptr);
+		}
+		if (slot.mapped != nullptr)
+		{
+			vkUnmapMemory(_device->logicalDevice, slot.memory);
+		}
+		if (slot.buffer != VK_NULL_HANDLE)
+		{
+			vkDestroyBuffer(_device->logicalDevice, slot.buffer, nullptr);
+		}
+		if (slot.memory != VK_NULL_HANDLE)
+		{
+			vkFreeMemory(_device->logicalDevice, slot.memory, nullptr);
+		}
+	}
+
+	if (_commandPool != VK_NULL_HANDLE)
+	{
+		vkDestroyCommandPool(_device->logicalDevice, _commandPool, nullptr);
+		_commandPool = VK_NULL_HANDLE;
+	}
+
+	delete[] _slots;
+	_slots     = nullptr;
+	_slotCount = 0;
+	_nextSlot  = 0;
+}
+
+void ReadbackRingVulkan::Enqueue(VkImage image, uint64 frameNumber)
+{
+	Collect();
+
+	Slot& slot = _slots[_nextSlot];
+	if (slot.state != ESlotState::FREE)
+	{
+		// 링이 가득 찼다. 가장 오래된 슬롯만 기다린다.
+		waitSlot(slot);
+	}
+	_nextSlot = (_nextSlot + 1) % _slotCount;
+
+	VkCommandBufferBeginInfo beginInfo{};
+	beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	VK_CHECK_RESULT(vkResetCommandBuffer(slot.cmd, 0));
+	VK_CHECK_RESULT(vkBeginCommandBuffer(slot.cmd, &beginInfo));
+
+	VkImageMemoryBarrier barrier{};
+	barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+	barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+	barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+	barrier.image                           = image;
+	barrier.subresourceRange.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+	barrier.subresourceRange.baseMipLevel   = 0;
+	barrier.subresourceRange.levelCount     = 1;
+	barrier.subresourceRange.baseArrayLayer = 0;
+	barrier.subresourceRange.layerCount     = 1;
+	barrier.srcAccessMask                   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+	barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.oldLayout                       = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	vkCmdPipelineBarrier(slot.cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+	VkBufferImageCopy region{};
+	region.bufferOffset                    = 0;
+	region.bufferRowLength                 = 0;
+	region.bufferImageHeight               = 0;
+	region.imageSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+	region.imageSubresource.mipLevel       = 0;
+	region.imageSubresource.baseArrayLayer = 0;
+	region.imageSubresource.layerCount     = 1;
+	region.imageOffset                     = {0, 0, 0};
+	region.imageExtent                     = {_width, _height, 1};
+	vkCmdCopyImageToBuffer(slot.cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, slot.buffer, 1, &region);
+
+	// 다음 프레임의 렌더링이 복사가 끝난 뒤에 이 이미지에 쓰도록 원래 레이아웃으로 되돌린다.
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_READ_BIT;
+	barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	barrier.newLayout     = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	vkCmdPipelineBarrier(slot.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+	// 호스트가 매핑된 메모리를 읽을 수 있도록 전송 쓰기를 가시화한다.
+	VkBufferMemoryBarrier hostBarrier{};
+	hostBarrier.sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+	hostBarrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+	hostBarrier.dstAccessMask       = VK_ACCESS_HOST_READ_BIT;
+	hostBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	hostBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+	hostBarrier.buffer              = slot.buffer;
+	hostBarrier.offset              = 0;
+	hostBarrier.size                = VK_WHOLE_SIZE;
+	vkCmdPipelineBarrier(slot.cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 0, nullptr, 1, &hostBarrier, 0, nullptr);
+
+	VK_CHECK_RESULT(vkEndCommandBuffer(slot.cmd));
+
+	VkSubmitInfo submitInfo{};
+	submitInfo.sType              = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+	submitInfo.commandBufferCount = 1;
+	submitInfo.pCommandBuffers    = &slot.cmd;
+	VK_CHECK_RESULT(vkQueueSubmit(_device->graphicsQueue, 1, &submitInfo, slot.fence));
+
+	slot.frameNumber = frameNumber;
+	slot.state       = ESlotState::GPU_PENDING;
+}
+
+void ReadbackRingVulkan::Collect()
+{
+	for (uint32 i = 0; i < _slotCount; i++)
+	{
+		Slot& slot = _slots[i];
+		if (slot.state == ESlotState::GPU_PENDING && vkGetFenceStatus(_device->logicalDevice, slot.fence) == VK_SUCCESS)
+		{
+			dispatchEncode(slot);
+		}
+		else if (slot.state == ESlotState::ENCODING && slot.encodeCounter.IsDone())
+		{
+			slot.state = ESlotState::FREE;
+		}
+	}
+}
+
+void ReadbackRingVulkan::waitSlot(Slot& slot)
+{
+	if (slot.state == ESlotState::GPU_PENDING)
+	{
+		VK_CHECK_RESULT(vkWaitForFences(_device->logicalDevice, 1, &slot.fence, VK_TRUE, UINT64_MAX));
+		dispatchEncode(slot);
+	}
+
+	if (slot.state == ESlotState::ENCODING)
+	{
+		JobSystem::Wait(slot.encodeCounter);
+		slot.state = ESlotState::FREE;
+	}
+}
+
+void ReadbackRingVulkan::dispatchEncode(Slot& slot)
+{
+	VK_CHECK_RESULT(vkResetFences(_device->logicalDevice, 1, &slot.fence));
+
+	if (!_isCoherent)
+	{
+		VkMappedMemoryRange range{};
+		range.sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+		range.memory = slot.memory;
+		range.offset = 0;
+		range.size   = VK_WHOLE_SIZE;
+		VK_CHECK_RESULT(vkInvalidateMappedMemoryRanges(_device->logicalDevice, 1, &range));
+	}
+
+	slot.state = ESlotState::ENCODING;
+
+	if (JobSystem::IsInitialized())
+	{
+		const Slot* target = &slot;
+		JobSystem::Schedule([this, target]() { encode(*target); }, &slot.encodeCounter);
+	}
+	else
+	{
+		encode(slot);
+	}
+}
+
+void ReadbackRingVulkan::encode(const Slot& slot)
+{
+	// 매핑된 메모리는 GPU가 다음 복사에 재사용하지 않는 동안(ENCODING)만 유효하다. 별도 버퍼로 옮겨 swizzle 한다.
+	const uint8* src = static_cast<const uint8*>(slot.mapped);
+	std::vector<uint8> rgba(_byteSize);
+	if (_format == VK_FORMAT_B8G8R8A8_UNORM)
+	{
+		for (size_t i = 0; i < _byteSize; i += 4)
+		{
+			rgba[i + 0] = src[i + 2];
+			rgba[i + 1] = src[i + 1];
+			rgba[i + 2] = src[i + 0];
+			rgba[i + 3] = src[i + 3];
+		}
+	}
+	else
+	{
+		::memcpy(rgba.data(), src, _byteSize);
+	}
+
+	std::string path = StringUtil::Format("%s/frame_%06llu.png", _directory.c_str(), static_cast<unsigned long long>(slot.frameNumber));
+	if (0 == stbi_write_png(path.c_str(), static_cast<int>(_width), static_cast<int>(_height), 4, rgba.data(), static_cast<int>(_width * 4)))
+	{
+		HS_LOG(error, "Failed to write readback frame: %s", path.c_str());
+		return;
+	}
+
+	_encodedFrameCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+HS_NS_END
@@ -44,7 +44,7 @@ void SwapchainVulkan::setRenderPass()
 	renderArea.height = _info.nativeWindow->surfaceHeight;
 
 	RenderPassInfo info{};
-	info.isSwapchainRenderPass = true;
+	info.isSwapchainRenderPass = !IsOffscreen(); // offscreen은 PRESENT_SRC 대신 SHADER_READ_ONLY로 끝나야 읽어올 수 있다.
 	info.colorAttachments = { colorAttachment };
 	info.colorAttachmentCount = 1;
 	info.useDepthStencilAttachment = false;
@@ -56,13 +56,31 @@ void SwapchainVulkan::setFramebuffers()
 {
 	HS_ASSERT(_framebuffers == nullptr, "Framebuffer is already exists. you should destroy it before creating new one.");
 
-	_framebuffers = new RHIFramebuffer * [imageVks.size()] { nullptr };
+	const size_t imageCount = IsOffscreen() ? _offscreenTextures.size() : imageVks.size();
+	_framebuffers = new RHIFramebuffer * [imageCount] { nullptr };
 
 	RHIContext* rhiContext = RHIContext::Get();
 
 	// Framebuffer는 스왑체인 이미지와 1대1 대응이므로 VkImage개수와 동일하게 생성합니다.
-	for (uint8 i = 0; i < imageVks.size(); i++)
+	for (uint8 i = 0; i < imageCount; i++)
 	{
+		if (IsOffscreen())
+		{
+			RHITexture* texture = _offscreenTextures[i];
+
+			FramebufferInfo fbInfo{};
+			fbInfo.depthStencilBuffer = nullptr;
+			fbInfo.resolveBuffer = nullptr;
+			fbInfo.isSwapchainFramebuffer = false;
+			fbInfo.width = texture->info.extent.width;
+			fbInfo.height = texture->info.extent.height;
+			fbInfo.renderPass = _renderPass;
+			fbInfo.colorBuffers.push_back(texture);
+
+			_framebuffers[i] = rhiContext->CreateFramebuffer("Offscreen Swapchain Framebuffer", fbInfo);
+			continue;
+		}
+
 		TextureInfo tInfo{};
 		tInfo.arrayLength = 0;
 		tInfo.extent.width = _info.nativeWindow->surfaceWidth;
@@ -157,6 +175,11 @@ void SwapchainVulkan::getSwapchainImages()
 bool SwapchainVulkan::initSwapchainVK(VulkanContext* rhiContext, VkInstance instance, VulkanDevice* deviceVulkan)
 {
 	_deviceVulkan = deviceVulkan;
+	if (IsOffscreen())
+	{
+		return initOffscreenVK(rhiContext);
+	}
+
 	vkGetPhysicalDeviceSurfaceCapabilitiesKHR(_deviceVulkan->physicalDevice, surface, &surfaceCapabilities);
 	VkSwapchainCreateInfoKHR createInfo{};
 
@@ -240,6 +263,66 @@ bool SwapchainVulkan::initSwapchainVK(VulkanContext* rhiContext, VkInstance inst
 	getSwapchainImages(); 
 	_maxFrameCount = desiredNumOfSwapchainImages;
 
+	createFrameResources(rhiContext);
+
+	setRenderPass();
+	setFramebuffers();
+
+	_isInitialized = true;
+	return true;
+}
+
+bool SwapchainVulkan::initOffscreenVK(VulkanContext* rhiContext)
+{
+	// 표시할 곳이 없으므로 포맷은 고정이다. readback에서 BGRA를 RGBA로 바꿔 저장한다.
+	surfaceFormat.format = VK_FORMAT_B8G8R8A8_UNORM;
+	surfaceFormat.colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+	_maxFrameCount = 2;
+
+	_offscreenTextures.resize(_maxFrameCount, nullptr);
+	for (uint8 i = 0; i < _maxFrameCount; i++)
+	{
+		TextureInfo tInfo{};
+		tInfo.arrayLength = 0;
+		tInfo.extent.width = _info.nativeWindow->surfaceWidth;
+		tInfo.extent.height = _info.nativeWindow->surfaceHeight;
+		tInfo.extent.depth = 1;
+		tInfo.format = RHIUtilityVulkan::FromPixelFormat(surfaceFormat.format);
+		tInfo.usage = ETextureUsage::COLOR_ATTACHMENT | ETextureUsage::SAMPLED | ETextureUsage::STAGING;
+		tInfo.isCompressed = false;
+		tInfo.useGenerateMipmap = false;
+		tInfo.mipLevel = 1;
+		tInfo.isSwapchainTexture = false;
+		tInfo.type = ETextureType::TEX_2D;
+		tInfo.swapchain = nullptr;
+		tInfo.byteSize = tInfo.extent.width * tInfo.extent.height * 4;
+		tInfo.isDepthStencilBuffer = false;
+
+		_offscreenTextures[i] = rhiContext->CreateTexture("Offscreen Swapchain Texture", nullptr, tInfo);
+	}
+
+	createFrameResources(rhiContext);
+
+	setRenderPass();
+	setFramebuffers();
+
+	if (_info.readbackDirectory != nullptr)
+	{
+		// 렌더링 중인 프레임 수보다 하나 많게 두어 인코딩이 렌더링을 막지 않게 한다.
+		_readback = new ReadbackRingVulkan();
+		if (!_readback->Initialize(_deviceVulkan, _maxFrameCount + 1, _info.nativeWindow->surfaceWidth, _info.nativeWindow->surfaceHeight, surfaceFormat.format, _info.readbackDirectory))
+		{
+			delete _readback;
+			_readback = nullptr;
+		}
+	}
+
+	_isInitialized = true;
+	return true;
+}
+
+void SwapchainVulkan::createFrameResources(VulkanContext* rhiContext)
+{
 	_commandBufferVKs = new CommandBufferVulkan * [_maxFrameCount];
 	syncObjects.imageAvailableSemaphores = new VkSemaphore[_maxFrameCount]{ VK_NULL_HANDLE };
 	syncObjects.renderFinishedSemaphores = new VkSemaphore[_maxFrameCount]{ VK_NULL_HANDLE };
@@ -249,12 +332,16 @@ bool SwapchainVulkan::initSwapchainVK(VulkanContext* rhiContext, VkInstance inst
 	{
 		_commandBufferVKs[i] = static_cast<CommandBufferVulkan*>(rhiContext->CreateCommandBuffer("CommandBuffer in Swapchain"));
 
-		VkSemaphoreCreateInfo semaphoreInfo{};
-		semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-		semaphoreInfo.pNext = nullptr;
-		semaphoreInfo.flags = 0;
-		VK_CHECK_RESULT(vkCreateSemaphore(_deviceVulkan->logicalDevice, &semaphoreInfo, nullptr, &syncObjects.imageAvailableSemaphores[i]));
-		VK_CHECK_RESULT(vkCreateSemaphore(_deviceVulkan->logicalDevice, &semaphoreInfo, nullptr, &syncObjects.renderFinishedSemaphores[i]));
+		// offscreen은 acquire/present가 없으므로 세마포어가 필요 없다.
+		if (!IsOffscreen())
+		{
+			VkSemaphoreCreateInfo semaphoreInfo{};
+			semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+			semaphoreInfo.pNext = nullptr;
+			semaphoreInfo.flags = 0;
+			VK_CHECK_RESULT(vkCreateSemaphore(_deviceVulkan->logicalDevice, &semaphoreInfo, nullptr, &syncObjects.imageAvailableSemaphores[i]));
+			VK_CHECK_RESULT(vkCreateSemaphore(_deviceVulkan->logicalDevice, &semaphoreInfo, nullptr, &syncObjects.renderFinishedSemaphores[i]));
+		}
 
 		VkFenceCreateInfo fenceInfo{};
 		fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
@@ -262,12 +349,6 @@ bool SwapchainVulkan::initSwapchainVK(VulkanContext* rhiContext, VkInstance inst
 		fenceInfo.pNext = nullptr;
 		VK_CHECK_RESULT(vkCreateFence(_deviceVulkan->logicalDevice, &fenceInfo, nullptr, &(syncObjects.inFlightFences[i])));
 	}
-
-	setRenderPass();
-	setFramebuffers();
-
-	_isInitialized = true;
-	return true;
 }
 
 void SwapchainVulkan::destroySwapchainVK()
@@ -279,6 +360,14 @@ void SwapchainVulkan::destroySwapchainVK()
 	RHIContext* rhiContext = RHIContext::Get();
 	rhiContext->WaitForIdle();
 
+	if (_readback)
+	{
+		// 남은 복사와 인코딩을 모두 끝낸 뒤 해제한다.
+		_readback->Finalize();
+		delete _readback;
+		_readback = nullptr;
+	}
+
 	for (size_t i = 0; i < imageViewVks.size(); i++)
 	{
 		if (imageViewVks[i] != VK_NULL_HANDLE)
@@ -307,7 +396,7 @@ void SwapchainVulkan::destroySwapchainVK()
 		{
 			if (_framebuffers[i])
 			{
-				delete _framebuffers[i];
+				rhiContext->DestroyFramebuffer(_framebuffers[i]);
 				_framebuffers[i] = nullptr;
 			}
 		}
@@ -315,6 +404,12 @@ void SwapchainVulkan::destroySwapchainVK()
 		_framebuffers = nullptr;
 	}
 
+	for (RHITexture* texture : _offscreenTextures)
+	{
+		rhiContext->DestroyTexture(texture);
+	}
+	_offscreenTextures.clear();
+
 	_isInitialized = false;
 }
 
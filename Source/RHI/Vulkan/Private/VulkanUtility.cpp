@@ -94,6 +94,12 @@ VkFormat RHIUtilityVulkan::ToVertexFormat(EVertexFormat format)
 	case EVertexFormat::HALF2:	return VK_FORMAT_R16G16_SFLOAT;
 	case EVertexFormat::HALF3:	return VK_FORMAT_R16G16B16_SFLOAT;
 	case EVertexFormat::HALF4:	return VK_FORMAT_R16G16B16A16_SFLOAT;
+	case EVertexFormat::SHORT2_NORM:	return VK_FORMAT_R16G16_SNORM;
+	case EVertexFormat::SHORT4_NORM:	return VK_FORMAT_R16G16B16A16_SNORM;
+	case EVertexFormat::USHORT2_NORM:	return VK_FORMAT_R16G16_UNORM;
+	case EVertexFormat::USHORT4_NORM:	return VK_FORMAT_R16G16B16A16_UNORM;
+	case EVertexFormat::CHAR4_NORM:	return VK_FORMAT_R8G8B8A8_SNORM;
+	case EVertexFormat::UCHAR4_NORM:	return VK_FORMAT_R8G8B8A8_UNORM;
 	default:
 		HS_LOG(error, "Unsupported vertex format: %d", static_cast<int>(format));
 	}
@@ -112,6 +118,12 @@ EVertexFormat RHIUtilityVulkan::FromVertexFormat(VkFormat format)
 	case VK_FORMAT_R16G16_SFLOAT:		return EVertexFormat::HALF2;
 	case VK_FORMAT_R16G16B16_SFLOAT:	return EVertexFormat::HALF3;
 	case VK_FORMAT_R16G16B16A16_SFLOAT:	return EVertexFormat::HALF4;
+	case VK_FORMAT_R16G16_SNORM:		return EVertexFormat::SHORT2_NORM;
+	case VK_FORMAT_R16G16B16A16_SNORM:	return EVertexFormat::SHORT4_NORM;
+	case VK_FORMAT_R16G16_UNORM:		return EVertexFormat::USHORT2_NORM;
+	case VK_FORMAT_R16G16B16A16_UNORM:	return EVertexFormat::USHORT4_NORM;
+	case VK_FORMAT_R8G8B8A8_SNORM:		return EVertexFormat::CHAR4_NORM;
+	case VK_FORMAT_R8G8B8A8_UNORM:		return EVertexFormat::UCHAR4_NORM;
 	default:
 		HS_LOG(error, "Unsupported VkFormat for vertex format: %d", static_cast<int>(format));
 	}
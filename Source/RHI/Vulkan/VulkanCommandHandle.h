@@ -68,11 +68,20 @@ struct HS_API CommandBufferVulkan : public RHICommandBuffer
 	void PushDebugMark(const char* label, float color[4]) override;
 	void PopDebugMark() override;
 
+	void ResetQueryPool(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount) override;
+	void WriteTimestamp(RHIQueryPool* queryPool, uint32 queryIndex) override;
+	void BeginQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+	void EndQuery(RHIQueryPool* queryPool, uint32 queryIndex) override;
+
 	VkCommandBuffer handle = VK_NULL_HANDLE;
 	VkPipeline curGraphicsPipeline = VK_NULL_HANDLE;
 	VkPipelineLayout curGraphicsPipelineLayout = VK_NULL_HANDLE;
 	VkPipeline curComputePipeline = VK_NULL_HANDLE;
 	VkPipelineLayout curComputePipelineLayout = VK_NULL_HANDLE;
+
+	// VK_EXT_debug_utils가 켜져 있지 않으면 nullptr
+	PFN_vkCmdBeginDebugUtilsLabelEXT cmdBeginDebugLabel = nullptr;
+	PFN_vkCmdEndDebugUtilsLabelEXT cmdEndDebugLabel = nullptr;
 };
 
 HS_NS_END
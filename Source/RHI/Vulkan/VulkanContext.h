@@ -13,10 +13,17 @@
 #include "RHI/Vulkan/VulkanUtility.h"
 #include "RHI/Vulkan/VulkanDevice.h"
 #include "RHI/Vulkan/VulkanDescriptorPoolAllocator.h"
+#include "RHI/Vulkan/VulkanRenderHandle.h"
+#include "RHI/Vulkan/VulkanResourceHandle.h"
+#include "RHI/Vulkan/VulkanCommandHandle.h"
+
+#include "Core/Memory/HandlePool.h"
 
 
 HS_NS_BEGIN
 
+class SwapchainVulkan;
+
 class HS_API VulkanContext final : public RHIContext
 {
 public:
@@ -79,6 +86,15 @@ public:
 	RHICommandBuffer* CreateCommandBuffer(const char* name) final;
 	void DestroyCommandBuffer(RHICommandBuffer* commandBuffer) final;
 
+	RHIQueryPool* CreateQueryPool(const char* name, const QueryPoolInfo& info) final;
+	void DestroyQueryPool(RHIQueryPool* queryPool) final;
+
+	bool GetQueryResults(RHIQueryPool* queryPool, uint32 firstQuery, uint32 queryCount, void* outData, size_t dataSize) final;
+
+	double GetTimestampPeriod() const final;
+	bool IsPipelineStatisticsSupported() const final;
+	bool IsAlive(RHIHandle::EType type, uint32 poolHandle) const final;
+
 	void Submit(Swapchain* swapchain, RHICommandBuffer** buffers, size_t bufferCount) final;
 
 	void Present(Swapchain* swapchain) final;
@@ -94,7 +110,10 @@ public:
 private:
 	bool createInstance();
 	void createDefaultCommandPool();
+#if defined(__WINDOWS__)
 	VkSurfaceKHR createSurface(const NativeWindow& nativeWindow);
+#endif
+	void initOffscreenImages(SwapchainVulkan* swapchainVK);
 	VkRenderPass createRenderPass(const RenderPassInfo& info);
 	VkFramebuffer createFramebuffer(const FramebufferInfo& info);
 	VkPipeline createGraphicsPipeline(const GraphicsPipelineInfo& info, VkPipelineLayout& outLayout);
@@ -113,13 +132,64 @@ private:
 
 	void cleanup();
 
+	template <typename T, typename... Args>
+	HS_FORCEINLINE T* createPooled(HandlePool<T>& pool, Args&&... args)
+	{
+		uint32 poolHandle = HandlePool<T>::INVALID_HANDLE;
+		T* object         = pool.Create(poolHandle, std::forward<Args>(args)...);
+		if (nullptr == object)
+		{
+			HS_LOG(error, "VulkanContext: Failed to allocate RHI object. The pool is full.");
+			return nullptr;
+		}
+		object->SetPoolHandle(poolHandle);
+		return object;
+	}
+
+	// Destroy*에서 객체 필드를 읽기 전에 부른다. 이미 반환된 객체면 메모리를 읽지 않고 false.
+	template <typename T>
+	HS_FORCEINLINE bool isPooledAlive(HandlePool<T>& pool, const T* object)
+	{
+		if (nullptr == object || HandlePool<T>::INVALID_HANDLE == pool.FindHandle(object))
+		{
+			HS_LOG(warning, "VulkanContext: Destroying stale or foreign RHI object %p", object);
+			return false;
+		}
+		return true;
+	}
+
+	template <typename T>
+	HS_FORCEINLINE void destroyPooled(HandlePool<T>& pool, T* object)
+	{
+		pool.Destroy(pool.FindHandle(object));
+	}
+
 	//std::vector<std::string> _supportedInstanceExtensions;
 	VkInstance _instanceVk = VK_NULL_HANDLE;
 	VulkanDevice _device;
 	VkCommandPool _defaultCommandPool = VK_NULL_HANDLE;
 	DescriptorPoolAllocatorVulkan _descriptorPoolAllocator;
 
+	// 타입별 슬롯 풀. RHI 객체는 여기서 생성되고 Destroy*에서 반환된다.
+	HandlePool<RenderPassVulkan> _renderPassPool;
+	HandlePool<FramebufferVulkan> _framebufferPool;
+	HandlePool<GraphicsPipelineVulkan> _graphicsPipelinePool;
+	HandlePool<ComputePipelineVulkan> _computePipelinePool;
+	HandlePool<ShaderVulkan> _shaderPool;
+	HandlePool<BufferVulkan> _bufferPool;
+	HandlePool<TextureVulkan> _texturePool;
+	HandlePool<SamplerVulkan> _samplerPool;
+	HandlePool<ResourceLayoutVulkan> _resourceLayoutPool;
+	HandlePool<ResourceSetVulkan> _resourceSetPool;
+	HandlePool<ResourceSetPoolVulkan> _resourceSetPoolPool;
+	HandlePool<CommandPoolVulkan> _commandPoolPool;
+	HandlePool<CommandBufferVulkan> _commandBufferPool;
+	HandlePool<QueryPoolVulkan> _queryPoolPool;
+
 	VkDebugUtilsMessengerEXT _debugMessenger = VK_NULL_HANDLE;
+	bool _isDebugUtilsEnabled = false;
+	PFN_vkCmdBeginDebugUtilsLabelEXT _cmdBeginDebugLabel = nullptr;
+	PFN_vkCmdEndDebugUtilsLabelEXT _cmdEndDebugLabel = nullptr;
 	bool _isInitialized = false;
 };
 
@@ -39,6 +39,9 @@ public:
 	VkQueue computeQueue = VK_NULL_HANDLE;
 	VkQueue transferQueue = VK_NULL_HANDLE;
 
+	// VK_KHR_swapchain 지원 여부. false면 offscreen 스왑체인만 만들 수 있다.
+	bool isSwapchainSupported = false;
+
 	std::vector<const char*> supportedExtensions;
 	std::vector<const char*> deviceExtensions;
 
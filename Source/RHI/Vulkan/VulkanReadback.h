@@ -0,0 +1,85 @@
+﻿//
+//  VulkanReadback.h
+//  RHI
+//
+//  Asynchronous frame readback through a ring of host-visible buffers
+//
+#ifndef __HS_READBACK_VULKAN_H__
+#define __HS_READBACK_VULKAN_H__
+
+#include "Precompile.h"
+
+#include "RHI/Vulkan/VulkanUtility.h"
+#include "RHI/Vulkan/VulkanDevice.h"
+
+#include "Core/Job/JobSystem.h"
+
+#include <atomic>
+#include <string>
+
+HS_NS_BEGIN
+
+// 렌더링이 끝난 이미지를 슬롯 버퍼로 복사하는 커맨드를 제출만 하고 기다리지 않는다.
+// 이후 Enqueue/Collect에서 펜스가 signal된 슬롯을 워커로 넘겨 PNG로 인코딩한다.
+// 슬롯이 모두 사용 중일 때만 가장 오래된 슬롯을 기다리므로, 링 크기만큼 GPU와 인코딩이 렌더링과 겹친다.
+class HS_API ReadbackRingVulkan final
+{
+public:
+	ReadbackRingVulkan() = default;
+	~ReadbackRingVulkan();
+
+	bool Initialize(VulkanDevice* device, uint32 slotCount, uint32 width, uint32 height, VkFormat format, const char* directory);
+	void Finalize();
+
+	// image는 SHADER_READ_ONLY_OPTIMAL 레이아웃이어야 하며, 복사 후 같은 레이아웃으로 되돌린다.
+	void Enqueue(VkImage image, uint64 frameNumber);
+
+	// GPU 복사가 끝난 슬롯을 인코딩 워커로 넘긴다. 기다리지 않는다.
+	void Collect();
+
+	HS_FORCEINLINE uint64 GetEncodedFrameCount() const { return _encodedFrameCount.load(std::memory_order_relaxed); }
+
+private:
+	enum class ESlotState : uint8
+	{
+		FREE,
+		GPU_PENDING,
+		ENCODING,
+	};
+
+	struct Slot
+	{
+		VkBuffer        buffer   = VK_NULL_HANDLE;
+		VkDeviceMemory  memory   = VK_NULL_HANDLE;
+		void*           mapped   = nullptr;
+		VkCommandBuffer cmd      = VK_NULL_HANDLE;
+		VkFence         fence    = VK_NULL_HANDLE;
+		uint64          frameNumber = 0;
+		ESlotState      state    = ESlotState::FREE;
+		JobCounter      encodeCounter;
+	};
+
+	void waitSlot(Slot& slot);
+	void dispatchEncode(Slot& slot);
+	void encode(const Slot& slot);
+
+	VulkanDevice* _device      = nullptr;
+	VkCommandPool _commandPool = VK_NULL_HANDLE;
+
+	Slot*  _slots     = nullptr;
+	uint32 _slotCount = 0;
+	uint32 _nextSlot  = 0;
+
+	uint32   _width        = 0;
+	uint32   _height       = 0;
+	VkFormat _format       = VK_FORMAT_UNDEFINED;
+	size_t   _byteSize     = 0;
+	bool     _isCoherent   = true;
+
+	std::string _directory;
+	std::atomic<uint64> _encodedFrameCount{0};
+};
+
+HS_NS_END
+
+#endif /*__HS_READBACK_VULKAN_H__*/
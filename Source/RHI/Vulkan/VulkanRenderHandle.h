@@ -51,6 +51,14 @@ struct HS_API ComputePipelineVulkan : public RHIComputePipeline, public Pipeline
 	~ComputePipelineVulkan() override = default;
 };
 
+struct HS_API QueryPoolVulkan : public RHIQueryPool
+{
+	QueryPoolVulkan(const char* name, const QueryPoolInfo& info) : RHIQueryPool(name, info) {}
+	~QueryPoolVulkan() override = default;
+
+	VkQueryPool handle = VK_NULL_HANDLE;
+};
+
 
 HS_NS_END
 
@@ -9,11 +9,13 @@
 #include "RHI/Vulkan/VulkanDevice.h"
 #include "RHI/Vulkan/VulkanCommandHandle.h"
 #include "RHI/Vulkan/VulkanRenderHandle.h"
+#include "RHI/Vulkan/VulkanReadback.h"
 
 HS_NS_BEGIN
 
 class CommandBufferVulkan;
 class RHIContext;
+class VulkanContext;
 
 class HS_API SwapchainVulkan final : public Swapchain
 {
@@ -33,6 +35,9 @@ public:
 	HS_FORCEINLINE RHICommandBuffer* GetCommandBufferByIndex(uint8 index) const override { HS_ASSERT(index < _maxFrameCount, "out of index"); return static_cast<RHICommandBuffer*>(_commandBufferVKs[index]); }
 	HS_FORCEINLINE RHIFramebuffer*   GetFramebufferForCurrentFrame() const override { return _framebuffers[_curImageIndex]; }
 
+	// surface 없이 생성되면 offscreen 스왑체인이 된다. VkSwapchainKHR 대신 일반 텍스처에 그린다.
+	HS_FORCEINLINE bool IsOffscreen() const { return surface == VK_NULL_HANDLE; }
+
 	VkSwapchainKHR handle = VK_NULL_HANDLE;
 
 	VkSurfaceKHR surface;
@@ -50,6 +55,8 @@ public:
 
 private:
 	bool initSwapchainVK(VulkanContext* rhiContext, VkInstance instance, VulkanDevice* deviceVulkan);
+	bool initOffscreenVK(VulkanContext* rhiContext);
+	void createFrameResources(VulkanContext* rhiContext);
 	void destroySwapchainVK();
 
 	void setRenderPass();
@@ -65,6 +72,10 @@ private:
 	CommandBufferVulkan** _commandBufferVKs;
 	RHIFramebuffer** _framebuffers;
 	bool _isSuspended;
+
+	std::vector<RHITexture*> _offscreenTextures;
+	ReadbackRingVulkan* _readback = nullptr;
+	uint64 _presentCount = 0;
 	bool _isInitialized = false;
 };
 
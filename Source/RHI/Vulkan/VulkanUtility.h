@@ -12,7 +12,9 @@
 #include "Core/Log.h"
 #include "RHI/RHIDefinition.h"
 
+#if defined(__WINDOWS__)
 #define VK_USE_PLATFORM_WIN32_KHR 
+#endif
 
 #include <vulkan/vulkan.h>
 #include <string>
@@ -0,0 +1,957 @@
+//
+//  BenchCore.cpp
+//  Bench
+//
+//  Hashers, hash maps, job scheduler scaling and batch math kernels
+//
+#include "BenchHarness.h"
+
+#include "Core/Container/FlatHashMap.h"
+#include "Core/Hash.h"
+#include "Core/Job/JobSystem.h"
+#include "Core/Math/SimdMath.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 KEY_COUNT     = 4096;
+constexpr uint32 MAX_KEY_COUNT = 64 * 1024;
+constexpr uint32 POINT_COUNT   = 16384;
+
+// 같은 입력으로 결과를 비교할 수 있도록 시드를 고정한다.
+// FindMiss가 넣은 키와 같은 수의 다른 키로 찾으므로 최대 키 수의 두 배를 만든다.
+const std::vector<uint64>& get_keys()
+{
+    static const std::vector<uint64> s_keys = [] {
+        std::mt19937_64 random(0x48534d52);
+        std::vector<uint64> keys(MAX_KEY_COUNT * 2);
+        for (uint64& key : keys)
+        {
+            key = random();
+        }
+        return keys;
+    }();
+    return s_keys;
+}
+
+const std::vector<char>& get_bytes()
+{
+    static const std::vector<char> s_bytes = [] {
+        std::mt19937 random(0x48534d52);
+        std::vector<char> bytes(64 * 1024);
+        for (char& byte : bytes)
+        {
+            byte = static_cast<char>(random());
+        }
+        return bytes;
+    }();
+    return s_bytes;
+}
+
+// FlatHashMap과 std::unordered_map을 같은 입력과 같은 순서로 잰다.
+template <typename Map>
+void bench_map_insert(BenchState& state, uint32 keyCount)
+{
+    const std::vector<uint64>& keys = get_keys();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        Map map;
+        for (uint32 k = 0; k < keyCount; k++)
+        {
+            map.insert(std::make_pair(keys[k], k));
+        }
+        BenchDoNotOptimize(map.size());
+    }
+    state.SetItemsPerIteration(keyCount);
+}
+
+// 하네스는 함수 전체를 재므로, 찾기 벤치가 쓰는 맵은 한 번만 만든다.
+template <typename Map, uint32 KeyCount>
+const Map& get_map()
+{
+    static const Map s_map = [] {
+        const std::vector<uint64>& keys = get_keys();
+
+        Map map;
+        map.reserve(KeyCount);
+        for (uint32 k = 0; k < KeyCount; k++)
+        {
+            map.insert(std::make_pair(keys[k], k));
+        }
+        return map;
+    }();
+    return s_map;
+}
+
+template <typename Map, uint32 KeyCount>
+void bench_map_find_hit(BenchState& state)
+{
+    const std::vector<uint64>& keys = get_keys();
+    const Map& map                  = get_map<Map, KeyCount>();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        uint32 sum = 0;
+        for (uint32 k = 0; k < KeyCount; k++)
+        {
+            sum += map.find(keys[k])->second;
+        }
+        BenchDoNotOptimize(sum);
+    }
+    state.SetItemsPerIteration(KeyCount);
+}
+
+// KeyCount개를 넣은 맵에서 넣지 않은 다음 KeyCount개로 찾는다.
+template <typename Map, uint32 KeyCount>
+void bench_map_find_miss(BenchState& state)
+{
+    const std::vector<uint64>& keys = get_keys();
+    const Map& map                  = get_map<Map, KeyCount>();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        uint32 missCount = 0;
+        for (uint32 k = KeyCount; k < KeyCount * 2; k++)
+        {
+            missCount += (map.find(keys[k]) == map.end()) ? 1 : 0;
+        }
+        BenchDoNotOptimize(missCount);
+    }
+    state.SetItemsPerIteration(KeyCount);
+}
+
+using BenchFlatHashMap  = FlatHashMap<uint64, uint32>;
+using BenchUnorderedMap = std::unordered_map<uint64, uint32>;
+
+constexpr uint32 PARALLEL_FOR_COUNT = 1024 * 1024;
+constexpr uint32 SCHEDULE_JOB_COUNT = 1024;
+constexpr uint32 SCHEDULE_JOB_SIZE  = 256;
+
+// 스레드 수만 바꿔 같은 작업을 잰다. 스레드 1개가 기준이다. 이름순으로 정렬되도록 스레드 수는 두 자리로 쓴다.
+void bench_parallel_for(BenchState& state, uint32 threadCount)
+{
+    if (false == SetBenchThreadCount(threadCount))
+    {
+        state.Skip("not enough hardware threads");
+        return;
+    }
+
+    static std::vector<float> s_values(PARALLEL_FOR_COUNT, 2.0f);
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        JobSystem::ParallelFor(PARALLEL_FOR_COUNT, [](uint32 begin, uint32 end) {
+            for (uint32 v = begin; v < end; v++)
+            {
+                s_values[v] = std::sqrt(s_values[v] * s_values[v] + 1.0f) - 0.5f;
+            }
+        });
+        BenchDoNotOptimize(s_values[i % PARALLEL_FOR_COUNT]);
+    }
+    state.SetItemsPerIteration(PARALLEL_FOR_COUNT);
+}
+
+// 작은 Job을 많이 넣고 기다린다. 스케줄 비용과 훔치기 경합이 드러난다.
+void bench_schedule(BenchState& state, uint32 threadCount)
+{
+    if (false == SetBenchThreadCount(threadCount))
+    {
+        state.Skip("not enough hardware threads");
+        return;
+    }
+
+    static std::vector<float> s_values(SCHEDULE_JOB_COUNT * SCHEDULE_JOB_SIZE, 2.0f);
+    static std::vector<float> s_sums(SCHEDULE_JOB_COUNT);
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        JobCounter counter;
+        for (uint32 j = 0; j < SCHEDULE_JOB_COUNT; j++)
+        {
+            JobSystem::Schedule([j]() {
+                const float* values = s_values.data() + j * SCHEDULE_JOB_SIZE;
+                float sum           = 0.0f;
+                for (uint32 v = 0; v < SCHEDULE_JOB_SIZE; v++)
+                {
+                    sum += values[v];
+                }
+                s_sums[j] = sum;
+            }, &counter);
+        }
+        JobSystem::Wait(counter);
+        BenchDoNotOptimize(s_sums[i % SCHEDULE_JOB_COUNT]);
+    }
+    state.SetItemsPerIteration(SCHEDULE_JOB_COUNT);
+}
+
+void bench_string_hash(BenchState& state, size_t length)
+{
+    const char* data = get_bytes().data();
+    const size_t stride = get_bytes().size() - length;
+
+    size_t offset = 0;
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        BenchDoNotOptimize(StringHash64(data + offset, length));
+        offset = (offset + 61) % stride;
+    }
+    state.SetBytesPerIteration(length);
+}
+
+struct PointSet
+{
+    std::vector<glm::vec3> points;
+    std::vector<glm::vec3> outPoints;
+    glm::mat4              matrix;
+};
+
+const PointSet& get_points()
+{
+    static PointSet s_points = [] {
+        std::mt19937 random(0x48534d52);
+        std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+        PointSet set;
+        set.points.resize(POINT_COUNT);
+        set.outPoints.resize(POINT_COUNT);
+        for (glm::vec3& point : set.points)
+        {
+            point = glm::vec3(distribution(random), distribution(random), distribution(random));
+        }
+        set.matrix = glm::translate(glm::mat4(1.0f), glm::vec3(1.0f, 2.0f, 3.0f)) * glm::rotate(glm::mat4(1.0f), 0.7f, glm::vec3(0.0f, 1.0f, 0.0f));
+        return set;
+    }();
+    return s_points;
+}
+
+constexpr uint32 MATRIX_COUNT = 4096;
+constexpr uint32 CULL_COUNT   = 16384;
+
+// SIMD 커널은 곱셈과 덧셈 순서가 기준 구현과 다를 수 있으므로 상대 오차를 허용한다.
+constexpr float SIMD_TOLERANCE = 1e-4f;
+
+HS_FORCEINLINE bool is_nearly_equal(float lhs, float rhs)
+{
+    const float scale = std::max(1.0f, std::max(std::fabs(lhs), std::fabs(rhs)));
+    return std::fabs(lhs - rhs) <= SIMD_TOLERANCE * scale;
+}
+
+template <glm::length_t L>
+bool is_nearly_equal(const glm::vec<L, float>& lhs, const glm::vec<L, float>& rhs)
+{
+    for (glm::length_t i = 0; i < L; i++)
+    {
+        if (false == is_nearly_equal(lhs[i], rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool is_nearly_equal(const glm::mat4& lhs, const glm::mat4& rhs)
+{
+    for (glm::length_t c = 0; c < 4; c++)
+    {
+        if (false == is_nearly_equal(lhs[c], rhs[c]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string make_mismatch(const char* kernel, size_t index)
+{
+    return std::string(kernel) + " differs from the reference at " + std::to_string(index);
+}
+
+struct MatrixSet
+{
+    std::vector<glm::mat4> lhs;
+    std::vector<glm::mat4> rhs;
+    std::vector<glm::mat4> outMatrices;
+};
+
+const MatrixSet& get_matrices()
+{
+    static MatrixSet s_matrices = [] {
+        std::mt19937 random(0x48534d52);
+        std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+        MatrixSet set;
+        set.lhs.resize(MATRIX_COUNT);
+        set.rhs.resize(MATRIX_COUNT);
+        set.outMatrices.resize(MATRIX_COUNT);
+        for (uint32 i = 0; i < MATRIX_COUNT; i++)
+        {
+            for (glm::length_t c = 0; c < 4; c++)
+            {
+                set.lhs[i][c] = glm::vec4(distribution(random), distribution(random), distribution(random), distribution(random));
+                set.rhs[i][c] = glm::vec4(distribution(random), distribution(random), distribution(random), distribution(random));
+            }
+        }
+        return set;
+    }();
+    return s_matrices;
+}
+
+struct BoxSet
+{
+    std::vector<glm::vec3> mins;
+    std::vector<glm::vec3> maxs;
+    std::vector<glm::vec3> outMins;
+    std::vector<glm::vec3> outMaxs;
+};
+
+const BoxSet& get_boxes()
+{
+    static BoxSet s_boxes = [] {
+        std::mt19937 random(0x48534d52);
+        std::uniform_real_distribution<float> extentDistribution(0.1f, 5.0f);
+
+        const PointSet& points = get_points();
+
+        BoxSet set;
+        set.mins.resize(POINT_COUNT);
+        set.maxs.resize(POINT_COUNT);
+        set.outMins.resize(POINT_COUNT);
+        set.outMaxs.resize(POINT_COUNT);
+        for (uint32 i = 0; i < POINT_COUNT; i++)
+        {
+            const glm::vec3 extent(extentDistribution(random), extentDistribution(random), extentDistribution(random));
+            set.mins[i] = points.points[i] - extent;
+            set.maxs[i] = points.points[i] + extent;
+        }
+        return set;
+    }();
+    return s_boxes;
+}
+
+// 원점을 바라보는 카메라의 절두체와, 그 안팎에 흩어진 박스와 구
+struct CullSet
+{
+    glm::vec4          planes[6];
+    std::vector<float> centerX;
+    std::vector<float> centerY;
+    std::vector<float> centerZ;
+    std::vector<float> extentX;
+    std::vector<float> extentY;
+    std::vector<float> extentZ;
+    std::vector<float> radius;
+    std::vector<uint8> visible;
+
+    AABBSoA   boxes;
+    SphereSoA spheres;
+};
+
+const CullSet& get_cull_set()
+{
+    static CullSet s_cullSet = [] {
+        std::mt19937 random(0x48534d52);
+        std::uniform_real_distribution<float> centerDistribution(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> extentDistribution(0.1f, 5.0f);
+
+        CullSet set;
+
+        // Gribb-Hartmann: 뷰-투영 행렬의 행으로 평면을 만든다.
+        const glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f) *
+                                         glm::lookAt(glm::vec3(0.0f, 20.0f, -120.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::vec4 row0 = glm::row(viewProjection, 0);
+        const glm::vec4 row1 = glm::row(viewProjection, 1);
+        const glm::vec4 row2 = glm::row(viewProjection, 2);
+        const glm::vec4 row3 = glm::row(viewProjection, 3);
+        const glm::vec4 planes[6] = {row3 + row0, row3 - row0, row3 + row1, row3 - row1, row3 + row2, row3 - row2};
+        for (uint32 p = 0; p < 6; p++)
+        {
+            set.planes[p] = planes[p] / glm::length(glm::vec3(planes[p]));
+        }
+
+        set.centerX.resize(CULL_COUNT);
+        set.centerY.resize(CULL_COUNT);
+        set.centerZ.resize(CULL_COUNT);
+        set.extentX.resize(CULL_COUNT);
+        set.extentY.resize(CULL_COUNT);
+        set.extentZ.resize(CULL_COUNT);
+        set.radius.resize(CULL_COUNT);
+        set.visible.resize(CULL_COUNT);
+        for (uint32 i = 0; i < CULL_COUNT; i++)
+        {
+            set.centerX[i] = centerDistribution(random);
+            set.centerY[i] = centerDistribution(random);
+            set.centerZ[i] = centerDistribution(random);
+            set.extentX[i] = extentDistribution(random);
+            set.extentY[i] = extentDistribution(random);
+            set.extentZ[i] = extentDistribution(random);
+            set.radius[i]  = extentDistribution(random);
+        }
+
+        set.boxes   = AABBSoA{set.centerX.data(), set.centerY.data(), set.centerZ.data(), set.extentX.data(), set.extentY.data(), set.extentZ.data()};
+        set.spheres = SphereSoA{set.centerX.data(), set.centerY.data(), set.centerZ.data(), set.radius.data()};
+        return set;
+    }();
+    return s_cullSet;
+}
+
+// 기준 구현과 결과를 비교한다. 같으면 빈 문자열, 다르면 처음 다른 위치를 돌려준다.
+// 벤치 함수마다 처음 한 번만 검사하고, 보정 샘플에서 실패하므로 측정 결과에는 섞이지 않는다.
+std::string verify_multiply_matrices()
+{
+    const MatrixSet& set = get_matrices();
+
+    std::vector<glm::mat4> simd(MATRIX_COUNT), reference(MATRIX_COUNT);
+    SimdMath::MultiplyMatrices(set.lhs.data(), set.rhs.data(), simd.data(), MATRIX_COUNT);
+    SimdMathReference::MultiplyMatrices(set.lhs.data(), set.rhs.data(), reference.data(), MATRIX_COUNT);
+    for (uint32 i = 0; i < MATRIX_COUNT; i++)
+    {
+        if (false == is_nearly_equal(simd[i], reference[i]))
+        {
+            return make_mismatch("MultiplyMatrices", i);
+        }
+    }
+
+    SimdMath::MultiplyMatrices(set.lhs[0], set.rhs.data(), simd.data(), MATRIX_COUNT);
+    SimdMathReference::MultiplyMatrices(set.lhs[0], set.rhs.data(), reference.data(), MATRIX_COUNT);
+    for (uint32 i = 0; i < MATRIX_COUNT; i++)
+    {
+        if (false == is_nearly_equal(simd[i], reference[i]))
+        {
+            return make_mismatch("MultiplyMatrices(shared lhs)", i);
+        }
+    }
+
+    return std::string();
+}
+
+std::string verify_transform_points()
+{
+    const PointSet& set = get_points();
+
+    std::vector<glm::vec3> simd(POINT_COUNT), reference(POINT_COUNT);
+    SimdMath::TransformPoints(set.matrix, set.points.data(), simd.data(), POINT_COUNT);
+    SimdMathReference::TransformPoints(set.matrix, set.points.data(), reference.data(), POINT_COUNT);
+    for (uint32 i = 0; i < POINT_COUNT; i++)
+    {
+        if (false == is_nearly_equal(simd[i], reference[i]))
+        {
+            return make_mismatch("TransformPoints", i);
+        }
+    }
+
+    return std::string();
+}
+
+std::string verify_transform_aabbs()
+{
+    const PointSet& points = get_points();
+    const BoxSet& set      = get_boxes();
+
+    std::vector<glm::vec3> simdMins(POINT_COUNT), simdMaxs(POINT_COUNT), referenceMins(POINT_COUNT), referenceMaxs(POINT_COUNT);
+    SimdMath::TransformAABBs(points.matrix, set.mins.data(), set.maxs.data(), simdMins.data(), simdMaxs.data(), POINT_COUNT);
+    SimdMathReference::TransformAABBs(points.matrix, set.mins.data(), set.maxs.data(), referenceMins.data(), referenceMaxs.data(), POINT_COUNT);
+    for (uint32 i = 0; i < POINT_COUNT; i++)
+    {
+        if (false == is_nearly_equal(simdMins[i], referenceMins[i]) || false == is_nearly_equal(simdMaxs[i], referenceMaxs[i]))
+        {
+            return make_mismatch("TransformAABBs", i);
+        }
+    }
+
+    return std::string();
+}
+
+// 평면에 거의 닿아 있는 경우에는 계산 순서에 따라 판정이 갈릴 수 있으므로, 가장 바깥쪽 평면까지의
+// 거리가 허용 오차 안일 때만 판정이 달라도 통과시킨다.
+template <typename DistanceFn>
+std::string verify_cull(const char* kernel, const std::vector<uint8>& simd, const std::vector<uint8>& reference, uint32 simdCount, uint32 referenceCount, DistanceFn&& distanceFn)
+{
+    const CullSet& set = get_cull_set();
+
+    uint32 borderCount = 0;
+    for (uint32 i = 0; i < CULL_COUNT; i++)
+    {
+        if (simd[i] == reference[i])
+        {
+            continue;
+        }
+
+        float minDistance = FLT_MAX;
+        for (const glm::vec4& plane : set.planes)
+        {
+            minDistance = std::min(minDistance, distanceFn(plane, i));
+        }
+        if (false == is_nearly_equal(minDistance, 0.0f))
+        {
+            return make_mismatch(kernel, i);
+        }
+        borderCount++;
+    }
+
+    const uint32 countDelta = (simdCount > referenceCount) ? simdCount - referenceCount : referenceCount - simdCount;
+    if (countDelta > borderCount)
+    {
+        return std::string(kernel) + " visible count differs from the reference";
+    }
+
+    return std::string();
+}
+
+std::string verify_cull_aabbs()
+{
+    const CullSet& set = get_cull_set();
+
+    std::vector<uint8> simd(CULL_COUNT), reference(CULL_COUNT);
+    const uint32 simdCount      = SimdMath::CullAABBs(set.planes, 6, set.boxes, CULL_COUNT, simd.data());
+    const uint32 referenceCount = SimdMathReference::CullAABBs(set.planes, 6, set.boxes, CULL_COUNT, reference.data());
+
+    return verify_cull("CullAABBs", simd, reference, simdCount, referenceCount, [&set](const glm::vec4& plane, uint32 i) {
+        return plane.x * set.centerX[i] + plane.y * set.centerY[i] + plane.z * set.centerZ[i] + plane.w +
+               std::fabs(plane.x) * set.extentX[i] + std::fabs(plane.y) * set.extentY[i] + std::fabs(plane.z) * set.extentZ[i];
+    });
+}
+
+std::string verify_cull_spheres()
+{
+    const CullSet& set = get_cull_set();
+
+    std::vector<uint8> simd(CULL_COUNT), reference(CULL_COUNT);
+    const uint32 simdCount      = SimdMath::CullSpheres(set.planes, 6, set.spheres, CULL_COUNT, simd.data());
+    const uint32 referenceCount = SimdMathReference::CullSpheres(set.planes, 6, set.spheres, CULL_COUNT, reference.data());
+
+    return verify_cull("CullSpheres", simd, reference, simdCount, referenceCount, [&set](const glm::vec4& plane, uint32 i) {
+        return plane.x * set.centerX[i] + plane.y * set.centerY[i] + plane.z * set.centerZ[i] + plane.w + set.radius[i];
+    });
+}
+
+std::string verify_min_max()
+{
+    const PointSet& set = get_points();
+
+    glm::vec3 simdMin(0.0f), simdMax(0.0f), referenceMin(0.0f), referenceMax(0.0f);
+    SimdMath::MinMax(set.points.data(), POINT_COUNT, simdMin, simdMax);
+    SimdMathReference::MinMax(set.points.data(), POINT_COUNT, referenceMin, referenceMax);
+    if (false == is_nearly_equal(simdMin, referenceMin) || false == is_nearly_equal(simdMax, referenceMax))
+    {
+        return make_mismatch("MinMax", 0);
+    }
+
+    return std::string();
+}
+} // namespace
+
+HS_BENCH(bench_hasher_uint64, "Hash/Hasher<uint64>")
+{
+    const std::vector<uint64>& keys = get_keys();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        uint32 hash = 0;
+        for (uint32 k = 0; k < KEY_COUNT; k++)
+        {
+            hash ^= Hasher<uint64>::Get(keys[k]);
+        }
+        BenchDoNotOptimize(hash);
+    }
+    state.SetItemsPerIteration(KEY_COUNT);
+}
+
+HS_BENCH(bench_string_hash_16, "Hash/StringHash64/16B")
+{
+    bench_string_hash(state, 16);
+}
+
+HS_BENCH(bench_string_hash_64, "Hash/StringHash64/64B")
+{
+    bench_string_hash(state, 64);
+}
+
+HS_BENCH(bench_string_hash_1k, "Hash/StringHash64/1KB")
+{
+    bench_string_hash(state, 1024);
+}
+
+HS_BENCH(bench_hash_bytes_64k, "Hash/HashBytes64/64KB")
+{
+    const std::vector<char>& bytes = get_bytes();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        BenchDoNotOptimize(HashBytes64(bytes.data(), bytes.size(), i));
+    }
+    state.SetBytesPerIteration(bytes.size());
+}
+
+HS_BENCH(bench_flat_hash_map_insert_256, "FlatHashMap/Insert/256")
+{
+    bench_map_insert<BenchFlatHashMap>(state, 256);
+}
+
+HS_BENCH(bench_flat_hash_map_insert_4k, "FlatHashMap/Insert/4K")
+{
+    bench_map_insert<BenchFlatHashMap>(state, KEY_COUNT);
+}
+
+HS_BENCH(bench_flat_hash_map_insert_64k, "FlatHashMap/Insert/64K")
+{
+    bench_map_insert<BenchFlatHashMap>(state, MAX_KEY_COUNT);
+}
+
+HS_BENCH(bench_unordered_map_insert_256, "UnorderedMap/Insert/256")
+{
+    bench_map_insert<BenchUnorderedMap>(state, 256);
+}
+
+HS_BENCH(bench_unordered_map_insert_4k, "UnorderedMap/Insert/4K")
+{
+    bench_map_insert<BenchUnorderedMap>(state, KEY_COUNT);
+}
+
+HS_BENCH(bench_unordered_map_insert_64k, "UnorderedMap/Insert/64K")
+{
+    bench_map_insert<BenchUnorderedMap>(state, MAX_KEY_COUNT);
+}
+
+HS_BENCH(bench_flat_hash_map_find_hit_256, "FlatHashMap/FindHit/256")
+{
+    bench_map_find_hit<BenchFlatHashMap, 256>(state);
+}
+
+HS_BENCH(bench_flat_hash_map_find_hit_4k, "FlatHashMap/FindHit/4K")
+{
+    bench_map_find_hit<BenchFlatHashMap, KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_flat_hash_map_find_hit_64k, "FlatHashMap/FindHit/64K")
+{
+    bench_map_find_hit<BenchFlatHashMap, MAX_KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_hit_256, "UnorderedMap/FindHit/256")
+{
+    bench_map_find_hit<BenchUnorderedMap, 256>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_hit_4k, "UnorderedMap/FindHit/4K")
+{
+    bench_map_find_hit<BenchUnorderedMap, KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_hit_64k, "UnorderedMap/FindHit/64K")
+{
+    bench_map_find_hit<BenchUnorderedMap, MAX_KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_flat_hash_map_find_miss_256, "FlatHashMap/FindMiss/256")
+{
+    bench_map_find_miss<BenchFlatHashMap, 256>(state);
+}
+
+HS_BENCH(bench_flat_hash_map_find_miss_4k, "FlatHashMap/FindMiss/4K")
+{
+    bench_map_find_miss<BenchFlatHashMap, KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_flat_hash_map_find_miss_64k, "FlatHashMap/FindMiss/64K")
+{
+    bench_map_find_miss<BenchFlatHashMap, MAX_KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_miss_256, "UnorderedMap/FindMiss/256")
+{
+    bench_map_find_miss<BenchUnorderedMap, 256>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_miss_4k, "UnorderedMap/FindMiss/4K")
+{
+    bench_map_find_miss<BenchUnorderedMap, KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_unordered_map_find_miss_64k, "UnorderedMap/FindMiss/64K")
+{
+    bench_map_find_miss<BenchUnorderedMap, MAX_KEY_COUNT>(state);
+}
+
+HS_BENCH(bench_parallel_for_1t, "JobSystem/ParallelFor/01T")
+{
+    bench_parallel_for(state, 1);
+}
+
+HS_BENCH(bench_parallel_for_2t, "JobSystem/ParallelFor/02T")
+{
+    bench_parallel_for(state, 2);
+}
+
+HS_BENCH(bench_parallel_for_4t, "JobSystem/ParallelFor/04T")
+{
+    bench_parallel_for(state, 4);
+}
+
+HS_BENCH(bench_parallel_for_8t, "JobSystem/ParallelFor/08T")
+{
+    bench_parallel_for(state, 8);
+}
+
+HS_BENCH(bench_parallel_for_16t, "JobSystem/ParallelFor/16T")
+{
+    bench_parallel_for(state, 16);
+}
+
+HS_BENCH(bench_schedule_1t, "JobSystem/Schedule/01T")
+{
+    bench_schedule(state, 1);
+}
+
+HS_BENCH(bench_schedule_2t, "JobSystem/Schedule/02T")
+{
+    bench_schedule(state, 2);
+}
+
+HS_BENCH(bench_schedule_4t, "JobSystem/Schedule/04T")
+{
+    bench_schedule(state, 4);
+}
+
+HS_BENCH(bench_schedule_8t, "JobSystem/Schedule/08T")
+{
+    bench_schedule(state, 8);
+}
+
+HS_BENCH(bench_schedule_16t, "JobSystem/Schedule/16T")
+{
+    bench_schedule(state, 16);
+}
+
+HS_BENCH(bench_multiply_matrices_simd, "SimdMath/MultiplyMatrices/Simd")
+{
+    static const std::string s_mismatch = verify_multiply_matrices();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    MatrixSet& set = const_cast<MatrixSet&>(get_matrices());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMath::MultiplyMatrices(set.lhs.data(), set.rhs.data(), set.outMatrices.data(), MATRIX_COUNT);
+        BenchDoNotOptimize(set.outMatrices[i % MATRIX_COUNT]);
+    }
+    state.SetItemsPerIteration(MATRIX_COUNT);
+}
+
+HS_BENCH(bench_multiply_matrices_reference, "SimdMath/MultiplyMatrices/Reference")
+{
+    MatrixSet& set = const_cast<MatrixSet&>(get_matrices());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMathReference::MultiplyMatrices(set.lhs.data(), set.rhs.data(), set.outMatrices.data(), MATRIX_COUNT);
+        BenchDoNotOptimize(set.outMatrices[i % MATRIX_COUNT]);
+    }
+    state.SetItemsPerIteration(MATRIX_COUNT);
+}
+
+HS_BENCH(bench_multiply_matrices_shared_simd, "SimdMath/MultiplyMatricesShared/Simd")
+{
+    static const std::string s_mismatch = verify_multiply_matrices();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    MatrixSet& set = const_cast<MatrixSet&>(get_matrices());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMath::MultiplyMatrices(set.lhs[0], set.rhs.data(), set.outMatrices.data(), MATRIX_COUNT);
+        BenchDoNotOptimize(set.outMatrices[i % MATRIX_COUNT]);
+    }
+    state.SetItemsPerIteration(MATRIX_COUNT);
+}
+
+HS_BENCH(bench_multiply_matrices_shared_reference, "SimdMath/MultiplyMatricesShared/Reference")
+{
+    MatrixSet& set = const_cast<MatrixSet&>(get_matrices());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMathReference::MultiplyMatrices(set.lhs[0], set.rhs.data(), set.outMatrices.data(), MATRIX_COUNT);
+        BenchDoNotOptimize(set.outMatrices[i % MATRIX_COUNT]);
+    }
+    state.SetItemsPerIteration(MATRIX_COUNT);
+}
+
+HS_BENCH(bench_transform_aabbs_simd, "SimdMath/TransformAABBs/Simd")
+{
+    static const std::string s_mismatch = verify_transform_aabbs();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    const PointSet& points = get_points();
+    BoxSet& set            = const_cast<BoxSet&>(get_boxes());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMath::TransformAABBs(points.matrix, set.mins.data(), set.maxs.data(), set.outMins.data(), set.outMaxs.data(), POINT_COUNT);
+        BenchDoNotOptimize(set.outMaxs[i % POINT_COUNT]);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_BENCH(bench_transform_aabbs_reference, "SimdMath/TransformAABBs/Reference")
+{
+    const PointSet& points = get_points();
+    BoxSet& set            = const_cast<BoxSet&>(get_boxes());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMathReference::TransformAABBs(points.matrix, set.mins.data(), set.maxs.data(), set.outMins.data(), set.outMaxs.data(), POINT_COUNT);
+        BenchDoNotOptimize(set.outMaxs[i % POINT_COUNT]);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_BENCH(bench_cull_aabbs_simd, "SimdMath/CullAABBs/Simd")
+{
+    static const std::string s_mismatch = verify_cull_aabbs();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    CullSet& set = const_cast<CullSet&>(get_cull_set());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        const uint32 visibleCount = SimdMath::CullAABBs(set.planes, 6, set.boxes, CULL_COUNT, set.visible.data());
+        BenchDoNotOptimize(visibleCount);
+    }
+    state.SetItemsPerIteration(CULL_COUNT);
+}
+
+HS_BENCH(bench_cull_aabbs_reference, "SimdMath/CullAABBs/Reference")
+{
+    CullSet& set = const_cast<CullSet&>(get_cull_set());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        const uint32 visibleCount = SimdMathReference::CullAABBs(set.planes, 6, set.boxes, CULL_COUNT, set.visible.data());
+        BenchDoNotOptimize(visibleCount);
+    }
+    state.SetItemsPerIteration(CULL_COUNT);
+}
+
+HS_BENCH(bench_cull_spheres_simd, "SimdMath/CullSpheres/Simd")
+{
+    static const std::string s_mismatch = verify_cull_spheres();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    CullSet& set = const_cast<CullSet&>(get_cull_set());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        const uint32 visibleCount = SimdMath::CullSpheres(set.planes, 6, set.spheres, CULL_COUNT, set.visible.data());
+        BenchDoNotOptimize(visibleCount);
+    }
+    state.SetItemsPerIteration(CULL_COUNT);
+}
+
+HS_BENCH(bench_cull_spheres_reference, "SimdMath/CullSpheres/Reference")
+{
+    CullSet& set = const_cast<CullSet&>(get_cull_set());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        const uint32 visibleCount = SimdMathReference::CullSpheres(set.planes, 6, set.spheres, CULL_COUNT, set.visible.data());
+        BenchDoNotOptimize(visibleCount);
+    }
+    state.SetItemsPerIteration(CULL_COUNT);
+}
+
+HS_BENCH(bench_transform_points_simd, "SimdMath/TransformPoints/Simd")
+{
+    static const std::string s_mismatch = verify_transform_points();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    PointSet& set = const_cast<PointSet&>(get_points());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMath::TransformPoints(set.matrix, set.points.data(), set.outPoints.data(), POINT_COUNT);
+        BenchDoNotOptimize(set.outPoints[i % POINT_COUNT]);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_BENCH(bench_transform_points_reference, "SimdMath/TransformPoints/Reference")
+{
+    PointSet& set = const_cast<PointSet&>(get_points());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        SimdMathReference::TransformPoints(set.matrix, set.points.data(), set.outPoints.data(), POINT_COUNT);
+        BenchDoNotOptimize(set.outPoints[i % POINT_COUNT]);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_BENCH(bench_min_max_simd, "SimdMath/MinMax/Simd")
+{
+    static const std::string s_mismatch = verify_min_max();
+    if (false == s_mismatch.empty())
+    {
+        state.Fail(s_mismatch);
+        return;
+    }
+
+    const PointSet& set = get_points();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        glm::vec3 minValue(0.0f), maxValue(0.0f);
+        SimdMath::MinMax(set.points.data(), POINT_COUNT, minValue, maxValue);
+        BenchDoNotOptimize(minValue);
+        BenchDoNotOptimize(maxValue);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_BENCH(bench_min_max_reference, "SimdMath/MinMax/Reference")
+{
+    const PointSet& set = get_points();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        glm::vec3 minValue(0.0f), maxValue(0.0f);
+        SimdMathReference::MinMax(set.points.data(), POINT_COUNT, minValue, maxValue);
+        BenchDoNotOptimize(minValue);
+        BenchDoNotOptimize(maxValue);
+    }
+    state.SetItemsPerIteration(POINT_COUNT);
+}
+
+HS_NS_END
@@ -0,0 +1,416 @@
+//
+//  BenchHarness.cpp
+//  Bench
+//
+//  Minimal micro-benchmark harness: warmup, repeated samples, percentiles, JSON and baseline comparison
+//
+#include "BenchHarness.h"
+
+#include "Core/Job/JobSystem.h"
+
+#include "json.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr int RESULT_FORMAT_VERSION = 1;
+
+// Debug와 Release 결과는 비교할 의미가 없으므로 결과 파일에 함께 기록한다.
+const char* get_config_name()
+{
+#if defined(_DEBUG)
+    return "Debug";
+#else
+    return "Release";
+#endif
+}
+
+const char* get_arch_name()
+{
+#if defined(__ARM64__)
+    return "arm64";
+#else
+    return "x64";
+#endif
+}
+
+std::vector<BenchCase>& get_cases()
+{
+    static std::vector<BenchCase> s_cases;
+    return s_cases;
+}
+
+std::vector<BenchCleanup>& get_cleanups()
+{
+    static std::vector<BenchCleanup> s_cleanups;
+    return s_cleanups;
+}
+
+// 반복 한 번당 나노초. 준비 작업이 섞이지 않도록 함수 전체를 잰다.
+double run_sample(const BenchCase& benchCase, uint64 iterations, BenchState& outState)
+{
+    BenchState state(iterations);
+
+    const auto begin = std::chrono::steady_clock::now();
+    benchCase.function(state);
+    const auto end = std::chrono::steady_clock::now();
+
+    outState = state;
+    return std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(iterations);
+}
+
+// 정렬된 샘플의 선형 보간 백분위수
+double percentile(const std::vector<double>& sorted, double ratio)
+{
+    const double position = ratio * static_cast<double>(sorted.size() - 1);
+    const size_t lower    = static_cast<size_t>(position);
+    const size_t upper    = std::min(lower + 1, sorted.size() - 1);
+    const double t        = position - static_cast<double>(lower);
+
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * t;
+}
+
+BenchResult run_case(const BenchCase& benchCase, const BenchConfig& config)
+{
+    BenchResult result;
+    result.name = benchCase.name;
+
+    // 샘플 하나가 minSampleSeconds를 넘을 때까지 반복 횟수를 늘린다.
+    BenchState state(1);
+    uint64 iterations = 1;
+    double sampleNs   = run_sample(benchCase, iterations, state);
+    if (false == state.GetSkipReason().empty())
+    {
+        result.skipReason = state.GetSkipReason();
+        return result;
+    }
+    if (false == state.GetFailReason().empty())
+    {
+        result.failReason = state.GetFailReason();
+        return result;
+    }
+
+    const double targetNs = config.minSampleSeconds * 1e9;
+    while (sampleNs * static_cast<double>(iterations) < targetNs && iterations < (1ull << 30))
+    {
+        const double scale = (sampleNs > 0.0) ? targetNs / (sampleNs * static_cast<double>(iterations)) : 10.0;
+        iterations         = static_cast<uint64>(static_cast<double>(iterations) * std::clamp(scale * 1.2, 2.0, 10.0));
+        sampleNs           = run_sample(benchCase, iterations, state);
+    }
+
+    for (uint32 i = 0; i < config.warmupCount; i++)
+    {
+        run_sample(benchCase, iterations, state);
+    }
+
+    std::vector<double> samples(std::max(config.repetitionCount, 1u));
+    for (double& sample : samples)
+    {
+        sample = run_sample(benchCase, iterations, state);
+    }
+
+    double sum = 0.0;
+    for (double sample : samples)
+    {
+        sum += sample;
+    }
+    const double mean = sum / static_cast<double>(samples.size());
+
+    double variance = 0.0;
+    for (double sample : samples)
+    {
+        variance += (sample - mean) * (sample - mean);
+    }
+    variance /= static_cast<double>(samples.size());
+
+    std::sort(samples.begin(), samples.end());
+
+    result.iterations  = iterations;
+    result.sampleCount = static_cast<uint32>(samples.size());
+    result.minNs       = samples.front();
+    result.p50Ns       = percentile(samples, 0.50);
+    result.p90Ns       = percentile(samples, 0.90);
+    result.p99Ns       = percentile(samples, 0.99);
+    result.maxNs       = samples.back();
+    result.meanNs      = mean;
+    result.stddevNs    = std::sqrt(variance);
+
+    if (result.p50Ns > 0.0)
+    {
+        result.itemsPerSecond = static_cast<double>(state.GetItemsPerIteration()) * 1e9 / result.p50Ns;
+        result.bytesPerSecond = static_cast<double>(state.GetBytesPerIteration()) * 1e9 / result.p50Ns;
+    }
+
+    return result;
+}
+
+void format_time(double ns, char* buffer, size_t bufferSize)
+{
+    if (ns >= 1e6)
+    {
+        std::snprintf(buffer, bufferSize, "%9.3f ms", ns * 1e-6);
+    }
+    else if (ns >= 1e3)
+    {
+        std::snprintf(buffer, bufferSize, "%9.3f us", ns * 1e-3);
+    }
+    else
+    {
+        std::snprintf(buffer, bufferSize, "%9.3f ns", ns);
+    }
+}
+
+void print_result(const BenchResult& result)
+{
+    if (false == result.skipReason.empty())
+    {
+        std::printf("%-48s skipped (%s)\n", result.name.c_str(), result.skipReason.c_str());
+        return;
+    }
+    if (false == result.failReason.empty())
+    {
+        std::printf("%-48s FAILED (%s)\n", result.name.c_str(), result.failReason.c_str());
+        return;
+    }
+
+    char p50[32], p90[32], p99[32];
+    format_time(result.p50Ns, p50, sizeof(p50));
+    format_time(result.p90Ns, p90, sizeof(p90));
+    format_time(result.p99Ns, p99, sizeof(p99));
+
+    std::printf("%-48s p50 %s  p90 %s  p99 %s", result.name.c_str(), p50, p90, p99);
+    if (result.bytesPerSecond > 0.0)
+    {
+        std::printf("  %8.2f GB/s", result.bytesPerSecond * 1e-9);
+    }
+    else if (result.itemsPerSecond > 0.0)
+    {
+        std::printf("  %8.2f M items/s", result.itemsPerSecond * 1e-6);
+    }
+    std::printf("\n");
+}
+} // namespace
+
+void BenchRegistry::Register(const char* name, BenchFunction function)
+{
+    get_cases().push_back(BenchCase{name, function});
+}
+
+void BenchRegistry::RegisterCleanup(BenchCleanup cleanup)
+{
+    get_cleanups().push_back(cleanup);
+}
+
+const std::vector<BenchCase>& BenchRegistry::GetCases()
+{
+    // 등록 순서는 번역 단위 초기화 순서에 따르므로 이름순으로 고정한다.
+    std::vector<BenchCase>& cases = get_cases();
+    std::sort(cases.begin(), cases.end(), [](const BenchCase& lhs, const BenchCase& rhs) { return std::string(lhs.name) < std::string(rhs.name); });
+
+    return cases;
+}
+
+std::vector<BenchResult> RunBenchmarks(const BenchConfig& config)
+{
+    const bool   isJobSystemInitialized = JobSystem::IsInitialized();
+    const uint32 defaultThreadCount     = JobSystem::GetThreadCount();
+
+    std::vector<BenchResult> results;
+    for (const BenchCase& benchCase : BenchRegistry::GetCases())
+    {
+        if (false == config.filter.empty() && std::string(benchCase.name).find(config.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        results.push_back(run_case(benchCase, config));
+        print_result(results.back());
+
+        // SetBenchThreadCount로 바꾼 스레드 수가 다음 케이스에 남지 않게 한다.
+        if (JobSystem::IsInitialized() != isJobSystemInitialized || JobSystem::GetThreadCount() != defaultThreadCount)
+        {
+            JobSystem::Finalize();
+            if (isJobSystemInitialized)
+            {
+                JobSystemConfig jobConfig;
+                jobConfig.workerCount = defaultThreadCount - 1;
+                JobSystem::Initialize(jobConfig);
+            }
+        }
+    }
+
+    // GPU 객체를 쥔 fixture는 main이 RHI 컨텍스트를 지우기 전에 풀어야 한다. 만든 순서의 역순으로 정리한다.
+    std::vector<BenchCleanup>& cleanups = get_cleanups();
+    for (auto it = cleanups.rbegin(); it != cleanups.rend(); ++it)
+    {
+        (*it)();
+    }
+    cleanups.clear();
+
+    return results;
+}
+
+bool SetBenchThreadCount(uint32 threadCount)
+{
+    const uint32 hardwareThreads = std::thread::hardware_concurrency();
+    if (threadCount == 0 || (hardwareThreads > 0 && threadCount > hardwareThreads))
+    {
+        return false;
+    }
+
+    if (threadCount == 1)
+    {
+        JobSystem::Finalize();
+        return true;
+    }
+
+    if (JobSystem::IsInitialized() && JobSystem::GetThreadCount() == threadCount)
+    {
+        return true;
+    }
+
+    JobSystem::Finalize();
+
+    JobSystemConfig jobConfig;
+    jobConfig.workerCount = threadCount - 1;
+    return JobSystem::Initialize(jobConfig);
+}
+
+bool WriteBenchResults(const std::string& path, const BenchConfig& config, const std::vector<BenchResult>& results)
+{
+    using json = nlohmann::json;
+
+    json benchmarks = json::array();
+    for (const BenchResult& result : results)
+    {
+        if (false == result.skipReason.empty())
+        {
+            benchmarks.push_back({{"name", result.name}, {"skipped", result.skipReason}});
+            continue;
+        }
+        if (false == result.failReason.empty())
+        {
+            benchmarks.push_back({{"name", result.name}, {"failed", result.failReason}});
+            continue;
+        }
+
+        benchmarks.push_back({{"name", result.name},
+                              {"iterations", result.iterations},
+                              {"samples", result.sampleCount},
+                              {"min_ns", result.minNs},
+                              {"p50_ns", result.p50Ns},
+                              {"p90_ns", result.p90Ns},
+                              {"p99_ns", result.p99Ns},
+                              {"max_ns", result.maxNs},
+                              {"mean_ns", result.meanNs},
+                              {"stddev_ns", result.stddevNs},
+                              {"items_per_second", result.itemsPerSecond},
+                              {"bytes_per_second", result.bytesPerSecond}});
+    }
+
+    json root;
+    root["version"] = RESULT_FORMAT_VERSION;
+    root["context"] = {{"threads", JobSystem::GetThreadCount()},
+                       {"arch", get_arch_name()},
+                       {"config", get_config_name()},
+                       {"warmup", config.warmupCount},
+                       {"repetitions", config.repetitionCount},
+                       {"min_sample_seconds", config.minSampleSeconds}};
+    root["benchmarks"] = std::move(benchmarks);
+
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (false == file.is_open())
+    {
+        std::fprintf(stderr, "Fail to open %s\n", path.c_str());
+        return false;
+    }
+    file << root.dump(2);
+
+    return true;
+}
+
+EBenchBaselineResult CompareBenchBaseline(const std::string& path, const BenchConfig& config, const std::vector<BenchResult>& results)
+{
+    using json = nlohmann::json;
+
+    std::ifstream file(path);
+    if (false == file.is_open())
+    {
+        std::fprintf(stderr, "Fail to open baseline %s\n", path.c_str());
+        return EBenchBaselineResult::UNREADABLE;
+    }
+
+    const json baseline = json::parse(file, nullptr, false);
+    if (baseline.is_discarded() || false == baseline.contains("benchmarks"))
+    {
+        std::fprintf(stderr, "%s is not a benchmark result file\n", path.c_str());
+        return EBenchBaselineResult::UNREADABLE;
+    }
+
+    if (baseline.value("version", 0) != RESULT_FORMAT_VERSION)
+    {
+        std::fprintf(stderr, "Baseline version mismatch (%d != %d)\n", baseline.value("version", 0), RESULT_FORMAT_VERSION);
+        return EBenchBaselineResult::UNREADABLE;
+    }
+
+    // 다른 구성이나 다른 머신에서 기록한 숫자와의 차이는 회귀가 아니다. 알리기만 하고 비교하지 않는다.
+    const json context = baseline.value("context", json::object());
+    const std::string baseConfig  = context.value("config", "?");
+    const std::string baseArch    = context.value("arch", "?");
+    const uint32      baseThreads = context.value("threads", 0u);
+    if (baseConfig != get_config_name() || baseArch != get_arch_name() || baseThreads != JobSystem::GetThreadCount())
+    {
+        std::printf("\nSkip baseline comparison: %s was recorded with %s/%s/%u threads, current run is %s/%s/%u threads\n",
+                    path.c_str(), baseConfig.c_str(), baseArch.c_str(), baseThreads, get_config_name(), get_arch_name(), JobSystem::GetThreadCount());
+        return EBenchBaselineResult::MISMATCHED;
+    }
+
+    std::printf("\n%-48s %12s %12s %9s\n", "benchmark", "baseline", "current", "delta");
+
+    uint32 regressionCount = 0;
+    for (const BenchResult& result : results)
+    {
+        if (false == result.skipReason.empty() || false == result.failReason.empty())
+        {
+            continue;
+        }
+
+        const auto it = std::find_if(baseline["benchmarks"].begin(), baseline["benchmarks"].end(),
+                                     [&result](const json& entry) { return entry.value("name", "") == result.name; });
+        if (it == baseline["benchmarks"].end() || false == it->contains("p50_ns"))
+        {
+            std::printf("%-48s %12s\n", result.name.c_str(), "new");
+            continue;
+        }
+
+        const double baseNs       = (*it)["p50_ns"].get<double>();
+        const double deltaPercent = (baseNs > 0.0) ? (result.p50Ns / baseNs - 1.0) * 100.0 : 0.0;
+        const bool   isRegression = deltaPercent > config.regressionPercent;
+
+        char baseText[32], currentText[32];
+        format_time(baseNs, baseText, sizeof(baseText));
+        format_time(result.p50Ns, currentText, sizeof(currentText));
+
+        std::printf("%-48s %12s %12s %+8.1f%%%s\n", result.name.c_str(), baseText, currentText, deltaPercent, isRegression ? "  REGRESSION" : "");
+        regressionCount += isRegression ? 1 : 0;
+    }
+
+    if (regressionCount > 0)
+    {
+        std::printf("\n%u benchmark(s) regressed more than %.1f%% against %s\n", regressionCount, config.regressionPercent, path.c_str());
+        return EBenchBaselineResult::REGRESSED;
+    }
+
+    std::printf("\nNo regression against %s\n", path.c_str());
+    return EBenchBaselineResult::PASSED;
+}
+
+HS_NS_END
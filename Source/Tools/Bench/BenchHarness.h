@@ -0,0 +1,144 @@
+//
+//  BenchHarness.h
+//  Bench
+//
+//  Minimal micro-benchmark harness: warmup, repeated samples, percentiles, JSON and baseline comparison
+//
+#ifndef __HS_BENCH_HARNESS_H__
+#define __HS_BENCH_HARNESS_H__
+
+#include "Precompile.h"
+
+#include <string>
+#include <vector>
+
+HS_NS_BEGIN
+
+class BenchState
+{
+public:
+    explicit BenchState(uint64 iterations)
+        : _iterations(iterations)
+    {}
+
+    // 벤치 함수는 측정 대상 작업을 GetIterations()번 반복해야 한다. 준비 작업은 루프 밖에서 한다.
+    HS_FORCEINLINE uint64 GetIterations() const { return _iterations; }
+
+    // 반복 한 번이 처리하는 항목 수와 바이트 수. 결과에 items/s, bytes/s로 함께 기록된다.
+    HS_FORCEINLINE void SetItemsPerIteration(uint64 items) { _itemsPerIteration = items; }
+    HS_FORCEINLINE void SetBytesPerIteration(uint64 bytes) { _bytesPerIteration = bytes; }
+    HS_FORCEINLINE uint64 GetItemsPerIteration() const { return _itemsPerIteration; }
+    HS_FORCEINLINE uint64 GetBytesPerIteration() const { return _bytesPerIteration; }
+
+    // 환경 문제로 측정할 수 없으면 이유를 남기고 돌아간다. 결과에는 skipped로 기록된다.
+    HS_FORCEINLINE void Skip(const char* reason) { _skipReason = reason; }
+    HS_FORCEINLINE const std::string& GetSkipReason() const { return _skipReason; }
+
+    // 측정 대상이 기준 구현과 다른 결과를 내면 이유를 남기고 돌아간다. 결과에는 failed로 기록되고 실행이 실패한다.
+    HS_FORCEINLINE void Fail(const std::string& reason) { _failReason = reason; }
+    HS_FORCEINLINE const std::string& GetFailReason() const { return _failReason; }
+
+private:
+    uint64      _iterations;
+    uint64      _itemsPerIteration = 0;
+    uint64      _bytesPerIteration = 0;
+    std::string _skipReason;
+    std::string _failReason;
+};
+
+using BenchFunction = void (*)(BenchState& state);
+using BenchCleanup  = void (*)();
+
+struct BenchCase
+{
+    const char*   name;
+    BenchFunction function;
+};
+
+struct BenchConfig
+{
+    uint32      warmupCount       = 2;
+    uint32      repetitionCount   = 15;
+    double      minSampleSeconds  = 0.01; // 샘플 하나가 이 시간보다 길어지도록 반복 횟수를 늘린다.
+    double      regressionPercent = 10.0; // baseline 대비 p50이 이 비율보다 느려지면 회귀로 본다.
+    std::string filter;
+};
+
+struct BenchResult
+{
+    std::string name;
+    uint64      iterations = 0; // 샘플 하나의 반복 횟수
+    uint32      sampleCount = 0;
+
+    // 반복 한 번당 나노초
+    double minNs    = 0.0;
+    double p50Ns    = 0.0;
+    double p90Ns    = 0.0;
+    double p99Ns    = 0.0;
+    double maxNs    = 0.0;
+    double meanNs   = 0.0;
+    double stddevNs = 0.0;
+
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+
+    std::string skipReason;
+    std::string failReason;
+};
+
+class BenchRegistry
+{
+public:
+    static void Register(const char* name, BenchFunction function);
+    static const std::vector<BenchCase>& GetCases();
+
+    // RunBenchmarks가 모든 케이스를 돈 뒤 호출한다. 렌더 장치를 쥐는 fixture를 처음 만들 때 등록한다.
+    static void RegisterCleanup(BenchCleanup cleanup);
+};
+
+struct BenchRegistrar
+{
+    BenchRegistrar(const char* name, BenchFunction function) { BenchRegistry::Register(name, function); }
+};
+
+// 이름은 "그룹/대상/변형" 형식으로 짓는다. --filter는 이름의 부분 문자열로 고른다.
+#define HS_BENCH(function, name)                                                    \
+    static void function(hs::BenchState& state);                                   \
+    static const hs::BenchRegistrar s_benchRegistrar_##function(name, function);    \
+    static void function(hs::BenchState& state)
+
+std::vector<BenchResult> RunBenchmarks(const BenchConfig& config);
+
+// 스레드 수에 따른 확장성을 재는 벤치용. JobSystem을 메인 스레드를 포함해 threadCount개 스레드로 다시 초기화한다.
+// 1이면 JobSystem을 꺼서 ParallelFor와 Schedule이 호출한 스레드에서 바로 돌게 한다.
+// 케이스가 끝나면 RunBenchmarks가 원래 스레드 수로 되돌린다. 하드웨어 스레드보다 많으면 false.
+bool SetBenchThreadCount(uint32 threadCount);
+
+bool WriteBenchResults(const std::string& path, const BenchConfig& config, const std::vector<BenchResult>& results);
+
+enum class EBenchBaselineResult
+{
+    PASSED,     // 같은 조건에서 비교했고 회귀가 없다.
+    REGRESSED,  // 같은 조건에서 비교했고 회귀가 있다.
+    MISMATCHED, // 빌드 구성, 아키텍처, 스레드 수가 달라 비교하지 않았다.
+    UNREADABLE, // 파일을 열 수 없거나 형식이 다르다.
+};
+
+// baseline에 같은 이름이 있는 결과만 비교한다. 기록 조건이 현재와 다르면 숫자를 비교하지 않는다.
+EBenchBaselineResult CompareBenchBaseline(const std::string& path, const BenchConfig& config, const std::vector<BenchResult>& results);
+
+// 컴파일러가 측정 대상 계산을 지우지 못하게 한다.
+template <typename T>
+HS_FORCEINLINE void BenchDoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    const volatile char* volatile sink = reinterpret_cast<const volatile char*>(&value);
+    (void)sink;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+HS_NS_END
+
+#endif /* __HS_BENCH_HARNESS_H__ */
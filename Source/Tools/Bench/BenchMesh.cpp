@@ -0,0 +1,293 @@
+//
+//  BenchMesh.cpp
+//  Bench
+//
+//  Mesh bound/normal/tangent kernels and MeshProxy vertex packing
+//
+#include "BenchHarness.h"
+
+#include "Engine/Resource/Mesh.h"
+#include "Engine/Resource/MeshCache.h"
+#include "Engine/Resource/MeshOptimizer.h"
+#include "Engine/Resource/MeshSimplifier.h"
+#include "Engine/Resource/Proxy/MeshProxy.h"
+
+#include "Core/Log.h"
+
+#include <cmath>
+#include <filesystem>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 GRID_SIZE = 256; // 65536 정점, 130050 삼각형
+
+// 물결 모양 격자. 법선과 접선이 정점마다 달라지도록 높이를 준다.
+void build_grid(Mesh& mesh)
+{
+    std::vector<float> positions;
+    std::vector<float> texcoords;
+    std::vector<uint32> indices;
+    positions.reserve(GRID_SIZE * GRID_SIZE * 3);
+    texcoords.reserve(GRID_SIZE * GRID_SIZE * 2);
+    indices.reserve((GRID_SIZE - 1) * (GRID_SIZE - 1) * 6);
+
+    for (uint32 y = 0; y < GRID_SIZE; y++)
+    {
+        for (uint32 x = 0; x < GRID_SIZE; x++)
+        {
+            const float u = static_cast<float>(x) / (GRID_SIZE - 1);
+            const float v = static_cast<float>(y) / (GRID_SIZE - 1);
+            positions.push_back(u * 10.0f);
+            positions.push_back(std::sin(u * 12.0f) * std::cos(v * 9.0f));
+            positions.push_back(v * 10.0f);
+            texcoords.push_back(u);
+            texcoords.push_back(v);
+        }
+    }
+
+    for (uint32 y = 0; y + 1 < GRID_SIZE; y++)
+    {
+        for (uint32 x = 0; x + 1 < GRID_SIZE; x++)
+        {
+            const uint32 i0 = y * GRID_SIZE + x;
+            const uint32 i1 = i0 + 1;
+            const uint32 i2 = i0 + GRID_SIZE;
+            const uint32 i3 = i2 + 1;
+            indices.insert(indices.end(), {i0, i2, i1, i1, i2, i3});
+        }
+    }
+
+    mesh.SetPosition(std::move(positions));
+    mesh.SetTexCoord(std::move(texcoords), 0);
+    mesh.SetIndices(std::move(indices));
+}
+
+Mesh* get_grid_mesh()
+{
+    static Mesh* s_mesh = [] {
+        Mesh* mesh = new Mesh();
+        build_grid(*mesh);
+        mesh->CalculateTangent();
+        return mesh;
+    }();
+    return s_mesh;
+}
+
+// 속성 레이아웃과 stride는 UpdateFromGameObject에서 정해진다.
+MeshProxy* make_proxy(const Mesh* mesh, const VertexCompressionInfo& compression)
+{
+    MeshProxy* proxy = new MeshProxy(mesh->GetObjectId());
+    proxy->SetVertexCompression(compression);
+    proxy->UpdateFromGameObject(mesh);
+    return proxy;
+}
+
+void run_pack_vertex_data(BenchState& state, const Mesh* mesh, const MeshProxy* proxy)
+{
+    // 업로드 버퍼 대신 미리 잡아 둔 메모리에 쓴다. 할당 비용은 재지 않는다.
+    std::vector<uint8> upload(static_cast<size_t>(mesh->GetVertexCount()) * proxy->GetVertexStride());
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        proxy->PackVertexData(mesh, upload.data());
+        BenchDoNotOptimize(upload.data());
+    }
+    state.SetItemsPerIteration(mesh->GetVertexCount());
+    state.SetBytesPerIteration(upload.size());
+}
+} // namespace
+
+HS_BENCH(bench_mesh_calculate_bounds, "Mesh/CalculateBounds")
+{
+    Mesh* mesh = get_grid_mesh();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        mesh->CalculateBounds();
+        BenchDoNotOptimize(mesh->GetBoundMax());
+    }
+    state.SetItemsPerIteration(mesh->GetVertexCount());
+}
+
+HS_BENCH(bench_mesh_calculate_normal, "Mesh/CalculateNormal")
+{
+    Mesh* mesh = get_grid_mesh();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        mesh->CalculateNormal();
+        BenchDoNotOptimize(mesh->GetNormal().data());
+    }
+    state.SetItemsPerIteration(mesh->GetTriangleCount());
+}
+
+HS_BENCH(bench_mesh_calculate_tangent, "Mesh/CalculateTangent")
+{
+    Mesh* mesh = get_grid_mesh();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        mesh->CalculateTangent();
+        BenchDoNotOptimize(mesh->GetTangent().data());
+    }
+    state.SetItemsPerIteration(mesh->GetTriangleCount());
+}
+
+// 격자는 행 순서로 인덱싱되어 있어 캐시 순서를 고치는 효과가 잘 보인다. 메시 복사도 시간에 들어간다.
+HS_BENCH(bench_mesh_optimizer_optimize, "MeshOptimizer/Optimize")
+{
+    const Mesh* source = get_grid_mesh();
+
+    MeshOptimizeResult result{};
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        Mesh mesh;
+        mesh.SetPosition(source->GetPosition());
+        mesh.SetNormal(source->GetNormal());
+        mesh.SetTexCoord(source->GetTexCoord(0), 0);
+        mesh.SetTangent(source->GetTangent());
+        mesh.SetBitangent(source->GetBitangent());
+        mesh.SetIndices(source->GetIndices());
+
+        result = MeshOptimizer::Optimize(&mesh);
+        BenchDoNotOptimize(mesh.GetIndices().data());
+    }
+    state.SetItemsPerIteration(source->GetTriangleCount());
+
+    static bool s_isReported = false;
+    if (false == s_isReported)
+    {
+        s_isReported = true;
+        HS_LOG(info, "MeshOptimizer: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f", result.before.acmr, result.after.acmr, result.before.atvr, result.after.atvr);
+    }
+}
+
+// 임포트 경로와 같이 MeshOptimizer를 거친 인덱스로 만든다.
+HS_BENCH(bench_meshlet_builder_build, "MeshletBuilder/Build")
+{
+    static Mesh* s_mesh = [] {
+        const Mesh* source = get_grid_mesh();
+        Mesh* mesh         = new Mesh();
+        mesh->SetPosition(source->GetPosition());
+        mesh->SetIndices(source->GetIndices());
+        MeshOptimizer::Optimize(mesh);
+        return mesh;
+    }();
+    const Mesh* mesh = s_mesh;
+
+    MeshletData meshlets;
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        meshlets = MeshletBuilder::Build(mesh);
+        BenchDoNotOptimize(meshlets.meshlets.data());
+    }
+    state.SetItemsPerIteration(mesh->GetTriangleCount());
+
+    static bool s_isReported = false;
+    if (false == s_isReported && false == meshlets.IsEmpty())
+    {
+        s_isReported = true;
+        HS_LOG(info, "MeshletBuilder: %zu meshlets, %.1f vertices and %.1f triangles on average",
+               meshlets.meshlets.size(),
+               static_cast<double>(meshlets.vertices.size()) / meshlets.meshlets.size(),
+               static_cast<double>(mesh->GetTriangleCount()) / meshlets.meshlets.size());
+    }
+}
+
+HS_BENCH(bench_mesh_simplifier_build_lod_chain, "MeshSimplifier/BuildLODChain")
+{
+    const Mesh* source = get_grid_mesh();
+    static Mesh* s_mesh = [source] {
+        Mesh* mesh = new Mesh();
+        mesh->SetPosition(source->GetPosition());
+        mesh->SetIndices(source->GetIndices());
+        return mesh;
+    }();
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        MeshSimplifier::BuildLODChain(s_mesh);
+        BenchDoNotOptimize(s_mesh->GetLODs().data());
+    }
+    state.SetItemsPerIteration(s_mesh->GetTriangleCount());
+
+    static bool s_isReported = false;
+    if (false == s_isReported && s_mesh->HasLODs())
+    {
+        s_isReported = true;
+        for (const MeshLOD& lod : s_mesh->GetLODs())
+        {
+            HS_LOG(info, "MeshSimplifier: %zu triangles, error %.5f", lod.indices.size() / 3, lod.error);
+        }
+    }
+}
+
+// 임포트 경로를 다 거친 격자(LOD, 클러스터 포함)를 한 번 쿠킹해 두고 다시 읽는다.
+HS_BENCH(bench_mesh_cache_read, "MeshCache/Read")
+{
+    static const std::string s_cachePath = [] {
+        const Mesh* source = get_grid_mesh();
+        Mesh mesh;
+        mesh.SetPosition(source->GetPosition());
+        mesh.SetTexCoord(source->GetTexCoord(0), 0);
+        mesh.SetIndices(source->GetIndices());
+        mesh.CalculateTangent();
+        MeshOptimizer::Optimize(&mesh);
+        mesh.SetMeshlets(MeshletBuilder::Build(&mesh));
+        MeshSimplifier::BuildLODChain(&mesh);
+
+        std::error_code errorCode;
+        const std::filesystem::path directory = std::filesystem::temp_directory_path(errorCode) / "hsmr_bench";
+        std::filesystem::create_directories(directory, errorCode);
+
+        const std::string path = (directory / "grid.hsmesh").string();
+        return (!errorCode && MeshCache::Write(path, 1, &mesh, {}, {})) ? path : std::string();
+    }();
+
+    if (s_cachePath.empty())
+    {
+        state.Skip("fail to write cache file");
+        return;
+    }
+
+    MeshCacheContent content;
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        MeshCache::Read(s_cachePath, 1, content);
+        BenchDoNotOptimize(content.mesh.get());
+    }
+
+    std::error_code errorCode;
+    const uint64 fileSize = std::filesystem::file_size(s_cachePath, errorCode);
+    state.SetBytesPerIteration(errorCode ? 0 : fileSize);
+
+    static bool s_isReported = false;
+    if (false == s_isReported && content.mesh)
+    {
+        s_isReported = true;
+        HS_LOG(info, "MeshCache: %llu bytes, %u vertices, %u triangles, %zu LODs, %zu meshlets",
+               static_cast<unsigned long long>(fileSize), content.mesh->GetVertexCount(), content.mesh->GetTriangleCount(),
+               content.mesh->GetLODs().size(), content.mesh->GetMeshlets().meshlets.size());
+    }
+}
+
+HS_BENCH(bench_mesh_proxy_pack_vertex_data_float, "MeshProxy/PackVertexData/Float")
+{
+    const Mesh* mesh = get_grid_mesh();
+    static MeshProxy* s_proxy = make_proxy(mesh, VertexCompressionInfo::Uncompressed());
+
+    run_pack_vertex_data(state, mesh, s_proxy);
+}
+
+HS_BENCH(bench_mesh_proxy_pack_vertex_data_compressed, "MeshProxy/PackVertexData/Compressed")
+{
+    const Mesh* mesh = get_grid_mesh();
+    static MeshProxy* s_proxy = make_proxy(mesh, VertexCompressionInfo{});
+
+    run_pack_vertex_data(state, mesh, s_proxy);
+}
+
+HS_NS_END
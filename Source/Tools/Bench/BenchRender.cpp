@@ -0,0 +1,313 @@
+//
+//  BenchRender.cpp
+//  Bench
+//
+//  RHIHandleCache lookups and command recording on the virtual RHI, and one offscreen frame on a real device
+//
+#include "BenchHarness.h"
+
+#include "Engine/Renderer/RenderPath.h"
+
+#include "RHI/CommandHandle.h"
+#include "RHI/RHIContext.h"
+#include "RHI/RenderHandle.h"
+#include "RHI/ResourceHandle.h"
+#include "RHI/Swapchain.h"
+
+#include <cstdlib>
+#include <vector>
+
+HS_NS_BEGIN
+
+namespace
+{
+constexpr uint32 PIPELINE_COUNT = 64;
+constexpr uint32 DRAW_COUNT     = 1000;
+
+constexpr uint16 OFFSCREEN_WIDTH  = 1280;
+constexpr uint16 OFFSCREEN_HEIGHT = 720;
+
+// 캐시만 쓰므로 패스와 프로파일러 없이 만든다.
+class BenchRenderPath final : public RenderPath
+{
+public:
+    explicit BenchRenderPath(RHIContext* rhiContext)
+        : RenderPath(rhiContext)
+    {}
+
+    RenderTargetInfo GetBareboneRenderTargetInfo() override { return RenderTargetInfo{}; }
+};
+
+// Forward 패스와 같은 모양의 렌더패스 정보. 해시가 전체 첨부물을 훑도록 색 첨부물을 둘 둔다.
+RenderPassInfo make_render_pass_info()
+{
+    Attachment colorAttachment{};
+    colorAttachment.format      = EPixelFormat::R8G8B8A8_UNORM;
+    colorAttachment.loadAction  = ELoadAction::CLEAR;
+    colorAttachment.storeAction = EStoreAction::STORE;
+    colorAttachment.clearValue  = ClearValue(0.1f, 0.1f, 0.1f, 1.0f);
+
+    Attachment depthAttachment = colorAttachment;
+    depthAttachment.format         = EPixelFormat::DEPTH32;
+    depthAttachment.isDepthStencil = true;
+
+    RenderPassInfo info{};
+    info.colorAttachments          = {colorAttachment, colorAttachment};
+    info.colorAttachmentCount      = 2;
+    info.depthStencilAttachment    = depthAttachment;
+    info.useDepthStencilAttachment = true;
+    info.isSwapchainRenderPass     = false;
+
+    return info;
+}
+
+GraphicsPipelineInfo make_pipeline_info(RHIRenderPass* renderPass, uint32 variant)
+{
+    GraphicsPipelineInfo info{};
+    info.renderPass                          = renderPass;
+    info.resourceLayout                      = nullptr;
+    info.inputAssemblyDesc.primitiveTopology = EPrimitiveTopology::TRIANGLE_LIST;
+
+    VertexInputLayoutDescriptor layout{};
+    layout.binding = 0;
+    layout.stride  = sizeof(float) * 8;
+    info.vertexInputDesc.layouts.push_back(layout);
+    info.vertexInputDesc.attributes.push_back({0, 0, EVertexFormat::FLOAT3, 0});
+    info.vertexInputDesc.attributes.push_back({1, 0, EVertexFormat::FLOAT3, sizeof(float) * 3});
+    info.vertexInputDesc.attributes.push_back({2, 0, EVertexFormat::FLOAT2, sizeof(float) * 6});
+
+    // 변형마다 다른 키가 되도록 뒤쪽 필드만 바꾼다. 비교가 끝까지 진행되는 최악의 경우다.
+    info.rasterizerDesc.depthBias = static_cast<float>(variant);
+
+    return info;
+}
+
+struct RenderFixture
+{
+    RHIContext*      rhiContext = nullptr;
+    BenchRenderPath* renderPath = nullptr;
+
+    RenderPath::RHIHandleCache* handleCache = nullptr;
+    RenderPassInfo              renderPassInfo;
+    std::vector<GraphicsPipelineInfo> pipelineInfos;
+
+    RHIRenderPass*                   renderPass  = nullptr;
+    RHITexture*                      colorTexture = nullptr;
+    RHIFramebuffer*                  framebuffer = nullptr;
+    std::vector<RHIGraphicsPipeline*> pipelines;
+    RHIResourceSet*                  resourceSet  = nullptr;
+    RHIBuffer*                       vertexBuffer = nullptr;
+    RHIBuffer*                       indexBuffer  = nullptr;
+    RHICommandBuffer*                commandBuffer = nullptr;
+};
+
+// main에서 만든 가상 RHI 컨텍스트를 쓴다. 다른 백엔드에서는 GPU 객체 생성 비용이 섞이므로 건너뛴다.
+RenderFixture* get_fixture()
+{
+    static RenderFixture* s_fixture = [] {
+        RHIContext* rhiContext = RHIContext::Get();
+        if (nullptr == rhiContext || rhiContext->GetCurrentPlatform() != ERHIPlatform::VIRTUAL)
+        {
+            return static_cast<RenderFixture*>(nullptr);
+        }
+
+        RenderFixture* fixture = new RenderFixture();
+        fixture->rhiContext    = rhiContext;
+        fixture->renderPath    = new BenchRenderPath(rhiContext);
+        fixture->handleCache   = new RenderPath::RHIHandleCache(fixture->renderPath);
+
+        fixture->renderPassInfo = make_render_pass_info();
+        fixture->renderPass     = fixture->handleCache->GetRenderPass(fixture->renderPassInfo);
+
+        for (uint32 i = 0; i < PIPELINE_COUNT; i++)
+        {
+            fixture->pipelineInfos.push_back(make_pipeline_info(fixture->renderPass, i));
+            fixture->pipelines.push_back(fixture->handleCache->GetGraphicsPipeline(fixture->pipelineInfos.back()));
+        }
+
+        fixture->colorTexture = rhiContext->CreateTexture("Bench Color", nullptr, 1920, 1080, EPixelFormat::R8G8B8A8_UNORM, ETextureType::TEX_2D, ETextureUsage::COLOR_ATTACHMENT);
+
+        FramebufferInfo fbInfo{};
+        fbInfo.width              = 1920;
+        fbInfo.height             = 1080;
+        fbInfo.renderPass         = fixture->renderPass;
+        fbInfo.depthStencilBuffer = nullptr;
+        fbInfo.resolveBuffer      = nullptr;
+        fbInfo.colorBuffers.push_back(fixture->colorTexture);
+        fixture->framebuffer = rhiContext->CreateFramebuffer("Bench Framebuffer", fbInfo);
+
+        ResourceBinding binding{};
+        RHIResourceLayout* resourceLayout = rhiContext->CreateResourceLayout("Bench ResourceLayout", &binding, 1);
+        fixture->resourceSet             = rhiContext->CreateResourceSet("Bench ResourceSet", resourceLayout);
+
+        fixture->vertexBuffer  = rhiContext->CreateBuffer("Bench VertexBuffer", nullptr, 1024 * 1024, EBufferUsage::VERTEX, EBufferMemoryOption::MAPPED);
+        fixture->indexBuffer   = rhiContext->CreateBuffer("Bench IndexBuffer", nullptr, 256 * 1024, EBufferUsage::INDEX, EBufferMemoryOption::MAPPED);
+        fixture->commandBuffer = rhiContext->CreateCommandBuffer("Bench CommandBuffer");
+
+        return fixture;
+    }();
+    return s_fixture;
+}
+
+struct OffscreenFixture
+{
+    RHIContext*  rhiContext = nullptr;
+    NativeWindow nativeWindow{};
+    Swapchain*   swapchain = nullptr;
+};
+
+OffscreenFixture* s_offscreenFixture = nullptr;
+
+void destroy_offscreen_fixture()
+{
+    s_offscreenFixture->rhiContext->WaitForIdle();
+    s_offscreenFixture->rhiContext->DestroySwapchain(s_offscreenFixture->swapchain);
+    delete s_offscreenFixture;
+    s_offscreenFixture = nullptr;
+}
+
+// 창 없는 offscreen 스왑체인. Editor와 같은 환경 변수로 Present된 프레임을 PNG로 읽어온다.
+OffscreenFixture* get_offscreen_fixture()
+{
+    if (nullptr != s_offscreenFixture)
+    {
+        return s_offscreenFixture;
+    }
+
+    RHIContext* rhiContext = RHIContext::Get();
+    if (nullptr == rhiContext || rhiContext->GetCurrentPlatform() == ERHIPlatform::VIRTUAL)
+    {
+        return nullptr;
+    }
+
+    OffscreenFixture* fixture           = new OffscreenFixture();
+    fixture->rhiContext                 = rhiContext;
+    fixture->nativeWindow.title         = "Bench Offscreen";
+    fixture->nativeWindow.width         = OFFSCREEN_WIDTH;
+    fixture->nativeWindow.height        = OFFSCREEN_HEIGHT;
+    fixture->nativeWindow.surfaceWidth  = OFFSCREEN_WIDTH;
+    fixture->nativeWindow.surfaceHeight = OFFSCREEN_HEIGHT;
+
+    SwapchainInfo info{};
+    info.nativeWindow      = &fixture->nativeWindow;
+    info.isOffscreen       = true;
+    info.readbackDirectory = ::getenv("HS_HEADLESS_READBACK_DIR");
+    if (const char* interval = ::getenv("HS_HEADLESS_READBACK_INTERVAL"))
+    {
+        info.readbackInterval = static_cast<uint32>(::strtoul(interval, nullptr, 10));
+    }
+    fixture->swapchain = rhiContext->CreateSwapchain(info);
+
+    s_offscreenFixture = fixture;
+    BenchRegistry::RegisterCleanup(destroy_offscreen_fixture);
+
+    return s_offscreenFixture;
+}
+} // namespace
+
+HS_BENCH(bench_handle_cache_render_pass, "RHIHandleCache/GetRenderPass")
+{
+    RenderFixture* fixture = get_fixture();
+    if (nullptr == fixture)
+    {
+        state.Skip("virtual RHI is not active");
+        return;
+    }
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        BenchDoNotOptimize(fixture->handleCache->GetRenderPass(fixture->renderPassInfo));
+    }
+    state.SetItemsPerIteration(1);
+}
+
+HS_BENCH(bench_handle_cache_pipeline, "RHIHandleCache/GetGraphicsPipeline")
+{
+    RenderFixture* fixture = get_fixture();
+    if (nullptr == fixture)
+    {
+        state.Skip("virtual RHI is not active");
+        return;
+    }
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        for (const GraphicsPipelineInfo& info : fixture->pipelineInfos)
+        {
+            BenchDoNotOptimize(fixture->handleCache->GetGraphicsPipeline(info));
+        }
+    }
+    state.SetItemsPerIteration(PIPELINE_COUNT);
+}
+
+// 한 프레임 분량의 불투명 드로우 기록. 파이프라인은 16 드로우마다 바뀐다.
+HS_BENCH(bench_command_recording, "CommandBuffer/RecordDraws")
+{
+    RenderFixture* fixture = get_fixture();
+    if (nullptr == fixture)
+    {
+        state.Skip("virtual RHI is not active");
+        return;
+    }
+
+    RHICommandBuffer* commandBuffer = fixture->commandBuffer;
+    const RHIBuffer* vertexBuffers[] = {fixture->vertexBuffer};
+    const uint32 vertexOffsets[]     = {0};
+
+    Viewport viewport{};
+    viewport.width  = 1920.0f;
+    viewport.height = 1080.0f;
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        commandBuffer->Reset();
+        commandBuffer->Begin();
+        commandBuffer->BeginRenderPass(fixture->renderPass, fixture->framebuffer, Area(0, 0, 1920, 1080));
+        commandBuffer->SetViewport(viewport);
+        commandBuffer->SetScissor(0, 0, 1920, 1080);
+
+        for (uint32 draw = 0; draw < DRAW_COUNT; draw++)
+        {
+            commandBuffer->BindPipeline(fixture->pipelines[(draw / 16) % PIPELINE_COUNT]);
+            commandBuffer->BindResourceSet(fixture->resourceSet);
+            commandBuffer->BindVertexBuffers(vertexBuffers, vertexOffsets, 1);
+            commandBuffer->BindIndexBuffer(fixture->indexBuffer);
+            commandBuffer->DrawIndexed(draw * 36, 36, 1, 0);
+        }
+
+        commandBuffer->EndRenderPass();
+        commandBuffer->End();
+    }
+    state.SetItemsPerIteration(DRAW_COUNT);
+}
+
+// 스왑체인 렌더패스만 지우는 빈 프레임. 획득, 제출, Present와 readback 복사까지의 프레임 고정 비용을 잰다.
+HS_BENCH(bench_offscreen_frame, "Render/OffscreenFrame")
+{
+    OffscreenFixture* fixture = get_offscreen_fixture();
+    if (nullptr == fixture)
+    {
+        state.Skip("needs --rhi vulkan");
+        return;
+    }
+
+    RHIContext* rhiContext = fixture->rhiContext;
+    Swapchain*  swapchain  = fixture->swapchain;
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        rhiContext->AcquireNextImage(swapchain);
+
+        RHICommandBuffer* commandBuffer = swapchain->GetCommandBufferForCurrentFrame();
+        commandBuffer->Begin();
+        commandBuffer->BeginRenderPass(swapchain->GetRenderPass(), swapchain->GetFramebufferForCurrentFrame(), Area(0, 0, OFFSCREEN_WIDTH, OFFSCREEN_HEIGHT));
+        commandBuffer->EndRenderPass();
+        commandBuffer->End();
+
+        rhiContext->Submit(swapchain, &commandBuffer, 1);
+        rhiContext->Present(swapchain);
+    }
+    state.SetItemsPerIteration(1);
+}
+
+HS_NS_END
@@ -0,0 +1,184 @@
+//
+//  BenchResource.cpp
+//  Bench
+//
+//  ObjectManager image and mesh import from generated files
+//
+#include "BenchHarness.h"
+
+#include "Engine/Resource/Image.h"
+#include "Engine/Resource/Mesh.h"
+#include "Engine/Resource/ObjectManager.h"
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Engine이 가진 구현과 겹치지 않도록 이 번역 단위 안에서만 쓴다.
+#define STB_IMAGE_WRITE_STATIC
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+HS_NS_BEGIN
+
+namespace
+{
+namespace fs = std::filesystem;
+
+constexpr uint32 IMAGE_SIZE    = 1024;
+constexpr uint32 IMAGE_COUNT   = 8;
+constexpr uint32 OBJ_GRID_SIZE = 128;
+
+// 입력 파일은 처음 쓰일 때 임시 디렉토리에 만든다. 에셋 폴더가 없는 환경에서도 같은 입력으로 잴 수 있다.
+struct ResourceFixture
+{
+    std::vector<std::string> imagePaths;
+    std::string              meshPath;
+    bool                     isValid = false;
+};
+
+bool write_image(const std::string& path, uint32 seed)
+{
+    std::vector<uint8> pixels(IMAGE_SIZE * IMAGE_SIZE * 4);
+    for (uint32 y = 0; y < IMAGE_SIZE; y++)
+    {
+        for (uint32 x = 0; x < IMAGE_SIZE; x++)
+        {
+            uint8* pixel = &pixels[(y * IMAGE_SIZE + x) * 4];
+            pixel[0]     = static_cast<uint8>(x ^ seed);
+            pixel[1]     = static_cast<uint8>(y + seed);
+            pixel[2]     = static_cast<uint8>((x * y) >> 4);
+            pixel[3]     = 255;
+        }
+    }
+
+    return 0 != stbi_write_png(path.c_str(), IMAGE_SIZE, IMAGE_SIZE, 4, pixels.data(), IMAGE_SIZE * 4);
+}
+
+bool write_obj(const std::string& path)
+{
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (nullptr == file)
+    {
+        return false;
+    }
+
+    for (uint32 y = 0; y < OBJ_GRID_SIZE; y++)
+    {
+        for (uint32 x = 0; x < OBJ_GRID_SIZE; x++)
+        {
+            const float u = static_cast<float>(x) / (OBJ_GRID_SIZE - 1);
+            const float v = static_cast<float>(y) / (OBJ_GRID_SIZE - 1);
+            std::fprintf(file, "v %f %f %f\nvt %f %f\n", u * 10.0f, std::sin(u * 12.0f) * std::cos(v * 9.0f), v * 10.0f, u, v);
+        }
+    }
+
+    // OBJ 인덱스는 1부터 시작한다.
+    for (uint32 y = 0; y + 1 < OBJ_GRID_SIZE; y++)
+    {
+        for (uint32 x = 0; x + 1 < OBJ_GRID_SIZE; x++)
+        {
+            const uint32 i0 = y * OBJ_GRID_SIZE + x + 1;
+            const uint32 i1 = i0 + 1;
+            const uint32 i2 = i0 + OBJ_GRID_SIZE;
+            const uint32 i3 = i2 + 1;
+            std::fprintf(file, "f %u/%u %u/%u %u/%u\nf %u/%u %u/%u %u/%u\n", i0, i0, i2, i2, i1, i1, i1, i1, i2, i2, i3, i3);
+        }
+    }
+
+    std::fclose(file);
+    return true;
+}
+
+const ResourceFixture& get_fixture()
+{
+    static const ResourceFixture s_fixture = [] {
+        ResourceFixture fixture;
+
+        std::error_code errorCode;
+        const fs::path directory = fs::temp_directory_path(errorCode) / "hsmr_bench";
+        fs::create_directories(directory, errorCode);
+        if (errorCode)
+        {
+            return fixture;
+        }
+
+        for (uint32 i = 0; i < IMAGE_COUNT; i++)
+        {
+            const std::string path = (directory / ("image_" + std::to_string(i) + ".png")).string();
+            if (false == fs::exists(path) && false == write_image(path, i * 37))
+            {
+                return fixture;
+            }
+            fixture.imagePaths.push_back(path);
+        }
+
+        fixture.meshPath = (directory / "grid.obj").string();
+        if (false == fs::exists(fixture.meshPath) && false == write_obj(fixture.meshPath))
+        {
+            return fixture;
+        }
+
+        fixture.isValid = true;
+        return fixture;
+    }();
+    return s_fixture;
+}
+} // namespace
+
+HS_BENCH(bench_load_image, "ObjectManager/LoadImageFromFile")
+{
+    const ResourceFixture& fixture = get_fixture();
+    if (false == fixture.isValid)
+    {
+        state.Skip("fail to create fixture files");
+        return;
+    }
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        Scoped<Image> image = ObjectManager::LoadImageFromFile(fixture.imagePaths[i % IMAGE_COUNT], true);
+        BenchDoNotOptimize(image.get());
+    }
+    state.SetItemsPerIteration(1);
+    state.SetBytesPerIteration(IMAGE_SIZE * IMAGE_SIZE * 4);
+}
+
+HS_BENCH(bench_load_images, "ObjectManager/LoadImagesFromFiles")
+{
+    const ResourceFixture& fixture = get_fixture();
+    if (false == fixture.isValid)
+    {
+        state.Skip("fail to create fixture files");
+        return;
+    }
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        std::vector<Scoped<Image>> images = ObjectManager::LoadImagesFromFiles(fixture.imagePaths, true);
+        BenchDoNotOptimize(images.data());
+    }
+    state.SetItemsPerIteration(IMAGE_COUNT);
+    state.SetBytesPerIteration(static_cast<uint64>(IMAGE_SIZE) * IMAGE_SIZE * 4 * IMAGE_COUNT);
+}
+
+HS_BENCH(bench_load_mesh, "ObjectManager/LoadMeshFromFile")
+{
+    const ResourceFixture& fixture = get_fixture();
+    if (false == fixture.isValid)
+    {
+        state.Skip("fail to create fixture files");
+        return;
+    }
+
+    for (uint64 i = 0; i < state.GetIterations(); i++)
+    {
+        Scoped<Mesh> mesh = ObjectManager::LoadMeshFromFile(fixture.meshPath, true);
+        BenchDoNotOptimize(mesh.get());
+    }
+    state.SetItemsPerIteration(static_cast<uint64>(OBJ_GRID_SIZE - 1) * (OBJ_GRID_SIZE - 1) * 2);
+}
+
+HS_NS_END
@@ -0,0 +1,154 @@
+//
+//  main.cpp
+//  Bench
+//
+//  Runs the in-tree micro-benchmarks headless and optionally compares them against a stored baseline
+//
+#include "BenchHarness.h"
+
+#include "Core/Job/JobSystem.h"
+#include "Engine/Resource/ObjectManager.h"
+#include "RHI/RHIContext.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static void print_usage()
+{
+    std::printf("usage: %s [options]\n", HS_EXECUTABLE_NAME);
+    std::printf("  --list                 Print benchmark names and exit\n");
+    std::printf("  --filter <text>        Run benchmarks whose name contains <text>\n");
+    std::printf("  --warmup <count>       Warmup samples per benchmark (default 2)\n");
+    std::printf("  --repetitions <count>  Measured samples per benchmark (default 15)\n");
+    std::printf("  --min-time <ms>        Minimum duration of one sample (default 10)\n");
+    std::printf("  --rhi <virtual|vulkan> RHI backend for the render benchmarks (default virtual)\n");
+    std::printf("  --out <file.json>      Write results as JSON\n");
+    std::printf("  --baseline <file.json> Compare p50 against a previous --out file. The comparison is\n");
+    std::printf("                         skipped when it was recorded with another build configuration,\n");
+    std::printf("                         architecture or thread count. Source/Tools/Bench/baseline.json\n");
+    std::printf("                         is the reference Release run on the CI machine.\n");
+    std::printf("  --threshold <percent>  Regression threshold for --baseline (default 10)\n");
+    std::printf("  Exit code is 1 when --out or --baseline cannot be written or read,\n");
+    std::printf("  2 when a benchmark regressed against a matching baseline,\n");
+    std::printf("  and 3 when a benchmark does not match its reference implementation.\n");
+}
+
+int main(int argc, char* argv[])
+{
+    hs::BenchConfig config;
+    std::string outputPath;
+    std::string baselinePath;
+    hs::ERHIPlatform rhiPlatform = hs::ERHIPlatform::VIRTUAL;
+    bool isListOnly = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string option = argv[i];
+        const bool hasValue      = i + 1 < argc;
+
+        if (option == "--list")
+        {
+            isListOnly = true;
+        }
+        else if (option == "--filter" && hasValue)
+        {
+            config.filter = argv[++i];
+        }
+        else if (option == "--warmup" && hasValue)
+        {
+            config.warmupCount = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (option == "--repetitions" && hasValue)
+        {
+            config.repetitionCount = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (option == "--min-time" && hasValue)
+        {
+            config.minSampleSeconds = std::strtod(argv[++i], nullptr) * 1e-3;
+        }
+        else if (option == "--rhi" && hasValue)
+        {
+            const std::string platform = argv[++i];
+            if (platform == "virtual")
+            {
+                rhiPlatform = hs::ERHIPlatform::VIRTUAL;
+            }
+            else if (platform == "vulkan")
+            {
+                rhiPlatform = hs::ERHIPlatform::VULKAN;
+            }
+            else
+            {
+                print_usage();
+                return 1;
+            }
+        }
+        else if (option == "--out" && hasValue)
+        {
+            outputPath = argv[++i];
+        }
+        else if (option == "--baseline" && hasValue)
+        {
+            baselinePath = argv[++i];
+        }
+        else if (option == "--threshold" && hasValue)
+        {
+            config.regressionPercent = std::strtod(argv[++i], nullptr);
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    if (isListOnly)
+    {
+        for (const hs::BenchCase& benchCase : hs::BenchRegistry::GetCases())
+        {
+            std::printf("%s\n", benchCase.name);
+        }
+        return 0;
+    }
+
+    // 창 없이 돈다. 기본은 가상 RHI로 엔진 자체의 CPU 비용만 재고, --rhi vulkan이면 offscreen 프레임 벤치가 실제 장치에서 돈다.
+    hs::JobSystem::Initialize();
+    hs::ObjectManager::Initialize();
+    hs::RHIContext::Create(rhiPlatform);
+
+    const std::vector<hs::BenchResult> results = hs::RunBenchmarks(config);
+
+    int exitCode = 0;
+    if (false == outputPath.empty() && false == hs::WriteBenchResults(outputPath, config, results))
+    {
+        exitCode = 1;
+    }
+
+    if (false == baselinePath.empty())
+    {
+        const hs::EBenchBaselineResult baselineResult = hs::CompareBenchBaseline(baselinePath, config, results);
+        if (baselineResult == hs::EBenchBaselineResult::UNREADABLE)
+        {
+            exitCode = 1;
+        }
+        else if (baselineResult == hs::EBenchBaselineResult::REGRESSED)
+        {
+            exitCode = 2;
+        }
+    }
+
+    for (const hs::BenchResult& result : results)
+    {
+        if (false == result.failReason.empty())
+        {
+            exitCode = 3;
+        }
+    }
+
+    hs::ObjectManager::Finalize();
+    hs::RHIContext::Destroy();
+    hs::JobSystem::Finalize();
+
+    return exitCode;
+}
@@ -0,0 +1,130 @@
+﻿//
+//  main.cpp
+//  Packer
+//
+//  Builds an .hspak archive from an asset directory
+//
+#include "Core/Archive/PackArchive.h"
+#include "Core/Archive/VirtualFileSystem.h"
+#include "Core/HAL/FileSystem.h"
+#include "Core/Job/JobSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static void print_usage()
+{
+    std::printf("usage: %s <asset directory> <output.hspak> [--block-size <KiB>]\n", HS_EXECUTABLE_NAME);
+    std::printf("  Entry paths are relative to the asset directory, e.g. Textures/albedo.png\n");
+    std::printf("  Mount the pack at the same directory: VirtualFileSystem::Mount(pack, assetDirectory)\n");
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        print_usage();
+        return 1;
+    }
+
+    const fs::path inputDirectory = fs::path(argv[1]);
+    const std::string outputPath  = argv[2];
+    uint32 blockSize              = hs::PackWriter::DEFAULT_BLOCK_SIZE;
+
+    for (int i = 3; i < argc; i++)
+    {
+        const std::string option = argv[i];
+        if (option == "--block-size" && i + 1 < argc)
+        {
+            blockSize = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10)) * 1024;
+        }
+        else
+        {
+            print_usage();
+            return 1;
+        }
+    }
+
+    std::error_code errorCode;
+    if (false == fs::is_directory(inputDirectory, errorCode))
+    {
+        std::fprintf(stderr, "%s is not a directory\n", inputDirectory.string().c_str());
+        return 1;
+    }
+
+    // 출력 파일이 입력 디렉토리 안에 있으면 자기 자신을 담지 않도록 뺀다.
+    const fs::path outputCanonical = fs::weakly_canonical(fs::path(outputPath), errorCode);
+
+    std::vector<fs::path> files;
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(inputDirectory, errorCode))
+    {
+        if (entry.is_regular_file() && fs::weakly_canonical(entry.path(), errorCode) != outputCanonical)
+        {
+            files.push_back(entry.path());
+        }
+    }
+
+    // 같은 입력이면 같은 팩이 나오도록 순서를 고정한다.
+    std::sort(files.begin(), files.end());
+
+    hs::JobSystem::Initialize();
+
+    hs::PackWriter writer;
+    if (false == writer.Begin(outputPath, blockSize))
+    {
+        hs::JobSystem::Finalize();
+        return 1;
+    }
+
+    bool result = true;
+    for (const fs::path& file : files)
+    {
+        const std::string entryPath = hs::VirtualFileSystem::NormalizePath(fs::relative(file, inputDirectory).generic_string());
+        if (entryPath.empty() || entryPath == ".." || 0 == entryPath.compare(0, 3, "../"))
+        {
+            // 심볼릭 링크 등으로 입력 폴더 밖을 가리키면 마운트 경로 아래에서 찾을 수 없다.
+            std::fprintf(stderr, "entry is outside of input directory: %s\n", file.string().c_str());
+            result = false;
+            break;
+        }
+
+        hs::MappedFile mappedFile;
+        if (false == hs::FileSystem::MapFile(file.string(), hs::EFileAccessPattern::SEQUENTIAL, mappedFile))
+        {
+            std::fprintf(stderr, "fail to read %s\n", file.string().c_str());
+            result = false;
+            break;
+        }
+
+        result = writer.AddFile(entryPath, mappedFile.data, mappedFile.size);
+        hs::FileSystem::UnmapFile(mappedFile);
+
+        if (false == result)
+        {
+            break;
+        }
+    }
+
+    result = result && writer.Finish();
+
+    if (result)
+    {
+        const double inputSize  = static_cast<double>(writer.GetUncompressedSize());
+        const double outputSize = static_cast<double>(writer.GetCompressedSize());
+        std::printf("%s: %zu files, %.2f MiB -> %.2f MiB (%.1f%%)\n",
+                    outputPath.c_str(),
+                    files.size(),
+                    inputSize / (1024.0 * 1024.0),
+                    outputSize / (1024.0 * 1024.0),
+                    inputSize > 0.0 ? outputSize * 100.0 / inputSize : 100.0);
+    }
+
+    hs::JobSystem::Finalize();
+    return result ? 0 : 1;
+}